@@ -18,6 +18,7 @@ extern "C" {
  * @param channels Number of channels (1=mono, 2=stereo)
  * @param bitrate Target bitrate in bits/second
  * @param dred_duration_ms DRED recovery duration in milliseconds (0-100)
+ * @param adaptive_frame_size Let the encoder pick 20, 40 or 60 ms per packet
  * @return Encoder pointer as jlong, or 0 on failure
  */
 JNIEXPORT jlong JNICALL
@@ -27,7 +28,8 @@ Java_expo_modules_opuslib_OpusEncoder_nativeCreate(
     jint sample_rate,
     jint channels,
     jint bitrate,
-    jint dred_duration_ms
+    jint dred_duration_ms,
+    jboolean adaptive_frame_size
 ) {
   int error = 0;
 
@@ -65,6 +67,16 @@ Java_expo_modules_opuslib_OpusEncoder_nativeCreate(
     }
   }
 
+  // Let the encoder pick the packet duration from the signal
+  if (adaptive_frame_size) {
+    result = opus_encoder_ctl(encoder, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE));
+    if (result != OPUS_OK) {
+      LOGE("Failed to enable adaptive frame size: error %d", result);
+    } else {
+      LOGI("Adaptive frame size enabled");
+    }
+  }
+
   // Return encoder pointer as long
   return reinterpret_cast<jlong>(encoder);
 }
@@ -144,6 +156,100 @@ Java_expo_modules_opuslib_OpusEncoder_nativeEncode(
   return result;
 }
 
+/**
+ * Get the duration of an encoded packet
+ *
+ * With adaptive frame size, this is how much of the PCM passed to
+ * nativeEncode the encoder consumed.
+ *
+ * @param env JNI environment
+ * @param thiz Java object instance
+ * @param packet Opus packet
+ * @param sample_rate Sample rate in Hz
+ * @return Number of samples per channel, or a negative error code
+ */
+JNIEXPORT jint JNICALL
+Java_expo_modules_opuslib_OpusEncoder_nativeGetPacketSamples(
+    JNIEnv *env,
+    jobject thiz,
+    jbyteArray packet,
+    jint sample_rate
+) {
+  jsize length = env->GetArrayLength(packet);
+  jbyte *data = env->GetByteArrayElements(packet, nullptr);
+  if (!data) {
+    LOGE("Failed to get packet data");
+    return OPUS_BAD_ARG;
+  }
+
+  int samples = opus_packet_get_nb_samples(
+    reinterpret_cast<const unsigned char*>(data),
+    length,
+    sample_rate
+  );
+
+  env->ReleaseByteArrayElements(packet, data, JNI_ABORT);
+
+  if (samples < 0) {
+    LOGE("Invalid packet: error %d", samples);
+  }
+  return samples;
+}
+
+/**
+ * Get the encoder's analysis of the last encoded frame
+ *
+ * The result is packed as [vad, analysis_valid, activity_probability_Q15,
+ * music_probability_Q15, tonality_Q15, bandwidth, pitch, band_count,
+ * band_energy_Q8[0..band_count-1]].
+ *
+ * @param env JNI environment
+ * @param thiz Java object instance
+ * @param encoder_ptr Encoder pointer from nativeCreate
+ * @return Packed analysis as int array, or null on failure
+ */
+JNIEXPORT jintArray JNICALL
+Java_expo_modules_opuslib_OpusEncoder_nativeGetFrameAnalysis(
+    JNIEnv *env,
+    jobject thiz,
+    jlong encoder_ptr
+) {
+  OpusEncoder *encoder = reinterpret_cast<OpusEncoder*>(encoder_ptr);
+  if (!encoder) {
+    LOGE("Encoder pointer is null");
+    return nullptr;
+  }
+
+  OpusFrameAnalysis analysis;
+  int result = opus_encoder_ctl(encoder, OPUS_GET_FRAME_ANALYSIS(&analysis));
+  if (result != OPUS_OK) {
+    LOGE("Failed to get frame analysis: error %d", result);
+    return nullptr;
+  }
+
+  jint packed[8 + OPUS_FRAME_ANALYSIS_BANDS];
+  packed[0] = analysis.vad;
+  packed[1] = analysis.analysis_valid;
+  packed[2] = analysis.activity_probability;
+  packed[3] = analysis.music_probability;
+  packed[4] = analysis.tonality;
+  packed[5] = analysis.bandwidth;
+  packed[6] = analysis.pitch;
+  packed[7] = analysis.band_count;
+  for (int i = 0; i < analysis.band_count; i++) {
+    packed[8 + i] = analysis.band_energy[i];
+  }
+
+  jintArray array = env->NewIntArray(8 + analysis.band_count);
+  if (!array) {
+    LOGE("Failed to allocate int array");
+    return nullptr;
+  }
+  env->SetIntArrayRegion(array, 0, 8 + analysis.band_count, packed);
+
+  return array;
+}
+
 /**
  * Destroy Opus encoder and free resources
  *
@@ -46,7 +46,7 @@ class AudioRecordManager(
   private val framesPerPacket: Int = (config.packetDuration / config.frameSize).toInt()
 
   // Event callbacks
-  private var onAudioChunk: ((ByteArray, Double, Int) -> Unit)? = null
+  private var onAudioChunk: ((ByteArray, Double, Int, FrameAnalysis?) -> Unit)? = null
   private var onAmplitude: ((Float, Float, Double) -> Unit)? = null
   private var onError: ((Exception) -> Unit)? = null
 
@@ -68,7 +68,8 @@ class AudioRecordManager(
       channels = config.channels,
       bitrate = config.bitrate,
       frameSizeMs = config.frameSize,
-      dredDurationMs = dredDuration
+      dredDurationMs = dredDuration,
+      adaptiveFrameSize = config.adaptiveFrameSize
     )
 
     // Calculate buffer size
@@ -201,7 +202,7 @@ class AudioRecordManager(
 
   // MARK: - Event Handlers
 
-  fun setOnAudioChunk(callback: (ByteArray, Double, Int) -> Unit) {
+  fun setOnAudioChunk(callback: (ByteArray, Double, Int, FrameAnalysis?) -> Unit) {
     this.onAudioChunk = callback
   }
 
@@ -280,16 +281,24 @@ class AudioRecordManager(
 
     // Calculate how many samples we need for one packet
     val samplesPerPacket = (config.sampleRate * config.packetDuration / 1000.0).toInt()
-    val currentSampleCount = frameBuffer.sumOf { it.size }
 
-    // When we have enough samples for a packet, encode and send
-    if (currentSampleCount >= samplesPerPacket) {
-      encodeAndSendPacket()
+    // When we have enough samples for a packet, encode and send. With
+    // adaptive frame size a packet may use only part of a frame, so keep
+    // going until the backlog is below one packet.
+    while (frameBuffer.sumOf { it.size } >= samplesPerPacket) {
+      if (!encodeAndSendPacket()) {
+        break
+      }
     }
   }
 
-  private fun encodeAndSendPacket() {
-    val encoder = opusEncoder ?: return
+  /**
+   * Encode one packet from the frame buffer
+   *
+   * @return true if samples were consumed from the frame buffer
+   */
+  private fun encodeAndSendPacket(): Boolean {
+    val encoder = opusEncoder ?: return false
 
     // Flatten frame buffer into continuous PCM data
     val pcmData = ShortArray(frameBuffer.sumOf { it.size })
@@ -304,7 +313,7 @@ class AudioRecordManager(
 
     // We should only encode when we have at least one frame
     if (pcmData.size < samplesPerFrame) {
-      return
+      return false
     }
 
     // Take only ONE frame worth of samples
@@ -316,31 +325,38 @@ class AudioRecordManager(
     } catch (e: Exception) {
       Log.e(TAG, "Failed to encode Opus packet: ${e.message}")
       frameBuffer.clear()
-      return
+      return false
     }
 
     if (opusData == null || opusData.isEmpty()) {
       Log.w(TAG, "Failed to encode Opus packet (null or empty)")
       frameBuffer.clear()
-      return
+      return false
     }
 
+    // With adaptive frame size the encoder may use only part of the frame
+    val consumedSamples = encoder.packetSamples(opusData)
+
+    // Fetch the encoder's analysis of this frame if requested
+    val analysis = if (config.enableFrameAnalysis) encoder.getFrameAnalysis() else null
+
     // Calculate timestamp in milliseconds
     val timestampMs = System.currentTimeMillis().toDouble()
 
     // Emit audioChunk event with Opus packet (may be larger due to DRED)
-    onAudioChunk?.invoke(opusData, timestampMs, sequenceNumber)
+    onAudioChunk?.invoke(opusData, timestampMs, sequenceNumber, analysis)
 
     sequenceNumber++
 
     // Keep any remaining samples for next packet
-    val remainingSamples = pcmData.size - samplesPerFrame
+    val remainingSamples = pcmData.size - consumedSamples
     if (remainingSamples > 0) {
-      val remaining = pcmData.copyOfRange(samplesPerFrame, pcmData.size)
+      val remaining = pcmData.copyOfRange(consumedSamples, pcmData.size)
       frameBuffer.clear()
       frameBuffer.add(remaining)
     } else {
       frameBuffer.clear()
     }
+    return true
   }
 }
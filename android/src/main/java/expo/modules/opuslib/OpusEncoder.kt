@@ -16,7 +16,8 @@ class OpusEncoder(
   private val channels: Int,
   private val bitrate: Int,
   frameSizeMs: Double,
-  dredDurationMs: Int = 100
+  dredDurationMs: Int = 100,
+  private val adaptiveFrameSize: Boolean = false
 ) {
   companion object {
     private const val TAG = "OpusEncoder"
@@ -37,7 +38,7 @@ class OpusEncoder(
 
   init {
     // Create native encoder
-    encoderPtr = nativeCreate(sampleRate, channels, bitrate, dredDurationMs)
+    encoderPtr = nativeCreate(sampleRate, channels, bitrate, dredDurationMs, adaptiveFrameSize)
     if (encoderPtr == 0L) {
       throw RuntimeException("Failed to create Opus encoder")
     }
@@ -49,6 +50,7 @@ class OpusEncoder(
         - Bitrate: ${bitrate / 1000}kbps
         - Frame size: $frameSize samples (${frameSizeMs}ms)
         - DRED: ${dredDurationMs}ms
+        - Adaptive frame size: $adaptiveFrameSize
     """.trimIndent())
   }
 
@@ -73,6 +75,41 @@ class OpusEncoder(
     return nativeEncode(encoderPtr, pcm, frameSize)
   }
 
+  /**
+   * Get the number of input samples per channel a packet encodes
+   *
+   * With adaptive frame size the encoder consumes 20, 40 or 60 ms of the
+   * PCM passed to encode(), and the caller keeps the rest for the next call.
+   *
+   * @param packet Opus packet returned by encode()
+   * @return Samples per channel, or frameSize if the packet can't be parsed
+   */
+  fun packetSamples(packet: ByteArray): Int {
+    if (!adaptiveFrameSize) {
+      return frameSize
+    }
+
+    val samples = nativeGetPacketSamples(packet, sampleRate)
+    return if (samples > 0) samples else frameSize
+  }
+
+  /**
+   * Get the encoder's analysis of the last encoded frame
+   *
+   * Reuses the VAD, speech/music classifier, band energies and pitch the
+   * encoder already computed, so callers don't need to analyze the PCM again.
+   *
+   * @return Frame analysis, or null on failure
+   */
+  fun getFrameAnalysis(): FrameAnalysis? {
+    if (encoderPtr == 0L) {
+      throw RuntimeException("Encoder not initialized")
+    }
+
+    val packed = nativeGetFrameAnalysis(encoderPtr) ?: return null
+    return FrameAnalysis.fromPacked(packed)
+  }
+
   /**
    * Destroy encoder and free native resources
    */
@@ -90,7 +127,8 @@ class OpusEncoder(
     sampleRate: Int,
     channels: Int,
     bitrate: Int,
-    dredDurationMs: Int
+    dredDurationMs: Int,
+    adaptiveFrameSize: Boolean
   ): Long
 
   private external fun nativeEncode(
@@ -99,5 +137,51 @@ class OpusEncoder(
     frameSize: Int
   ): ByteArray?
 
+  private external fun nativeGetPacketSamples(packet: ByteArray, sampleRate: Int): Int
+
+  private external fun nativeGetFrameAnalysis(encoderPtr: Long): IntArray?
+
   private external fun nativeDestroy(encoderPtr: Long)
 }
+
+/**
+ * Encoder analysis of one frame (see OPUS_GET_FRAME_ANALYSIS)
+ *
+ * Probabilities are null when the encoder's tonality analysis did not run
+ * (it requires complexity 7 or higher).
+ */
+data class FrameAnalysis(
+  val vad: Boolean,
+  val activityProbability: Double?,
+  val musicProbability: Double?,
+  val tonality: Double?,
+  val pitch: Int,
+  val bandEnergies: DoubleArray
+) {
+  fun toMap(): Map<String, Any?> = mapOf(
+    "vad" to vad,
+    "activityProbability" to activityProbability,
+    "musicProbability" to musicProbability,
+    "tonality" to tonality,
+    "pitch" to pitch,
+    "bandEnergies" to bandEnergies.toList()
+  )
+
+  companion object {
+    // log2 amplitude in Q8 to dB
+    private const val Q8_LOG2_TO_DB = 6.0206 / 256.0
+
+    fun fromPacked(packed: IntArray): FrameAnalysis {
+      val analysisValid = packed[1] != 0
+      val bandCount = packed[7]
+      return FrameAnalysis(
+        vad = packed[0] != 0,
+        activityProbability = if (analysisValid) packed[2] / 32768.0 else null,
+        musicProbability = if (analysisValid) packed[3] / 32768.0 else null,
+        tonality = if (analysisValid) packed[4] / 32768.0 else null,
+        pitch = packed[6],
+        bandEnergies = DoubleArray(bandCount) { packed[8 + it] * Q8_LOG2_TO_DB }
+      )
+    }
+  }
+}
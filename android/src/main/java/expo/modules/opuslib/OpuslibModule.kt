@@ -81,12 +81,14 @@ class OpuslibModule : Module() {
 
     // Set up event callbacks
     android.util.Log.d(TAG, "🔗 Setting up event callbacks...")
-    manager.setOnAudioChunk { data, timestamp, sequenceNumber ->
-      sendEvent("audioChunk", mapOf(
+    manager.setOnAudioChunk { data, timestamp, sequenceNumber, analysis ->
+      val event = mutableMapOf<String, Any?>(
         "data" to data,
         "timestamp" to timestamp,
         "sequenceNumber" to sequenceNumber
-      ))
+      )
+      analysis?.let { event["analysis"] = it.toMap() }
+      sendEvent("audioChunk", event)
     }
 
     manager.setOnAmplitude { rms, peak, timestamp ->
@@ -183,6 +185,12 @@ class AudioConfig : Record {
 
   @Field
   var saveDebugAudio: Boolean = false
+
+  @Field
+  var enableFrameAnalysis: Boolean = false
+
+  @Field
+  var adaptiveFrameSize: Boolean = false
 }
 
 // MARK: - Errors
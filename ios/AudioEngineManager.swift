@@ -37,7 +37,7 @@ class AudioEngineManager {
   private let framesPerPacket: Int
 
   // Event callbacks
-  private var onAudioChunk: ((Data, Double, Int) -> Void)?
+  private var onAudioChunk: ((Data, Double, Int, FrameAnalysis?) -> Void)?
   private var onAmplitude: ((Float, Float, Double) -> Void)?
   private var onError: ((Error) -> Void)?
 
@@ -75,7 +75,8 @@ class AudioEngineManager {
       channels: config.channels,
       bitrate: config.bitrate,
       frameSizeMs: config.frameSize,
-      dredDurationMs: dredDuration
+      dredDurationMs: dredDuration,
+      adaptiveFrameSize: config.adaptiveFrameSize ?? false
     )
 
     // Create and configure AVAudioEngine
@@ -193,7 +194,7 @@ class AudioEngineManager {
 
   // MARK: - Event Handlers
 
-  func setOnAudioChunk(_ callback: @escaping (Data, Double, Int) -> Void) {
+  func setOnAudioChunk(_ callback: @escaping (Data, Double, Int, FrameAnalysis?) -> Void) {
     self.onAudioChunk = callback
   }
 
@@ -271,17 +272,25 @@ class AudioEngineManager {
 
     // Calculate how many samples we need for one packet
     let samplesPerPacket = Int(Double(config.sampleRate) * config.packetDuration / 1000.0)
-    let currentSampleCount = frameBuffer.reduce(0) { $0 + $1.count }
 
-    // When we have enough samples for a packet, encode and send
-    if currentSampleCount >= samplesPerPacket {
-      encodeAndSendPacket(timestamp: time.sampleTime)
+    // When we have enough samples for a packet, encode and send. With
+    // adaptive frame size a packet may use only part of a frame, so keep
+    // going until the backlog is below one packet.
+    while frameBuffer.reduce(0, { $0 + $1.count }) >= samplesPerPacket {
+      if !encodeAndSendPacket(timestamp: time.sampleTime) {
+        break
+      }
     }
   }
 
-  private func encodeAndSendPacket(timestamp: AVAudioFramePosition) {
+  /**
+   * Encode one packet from the frame buffer
+   *
+   * @returns: true if samples were consumed from the frame buffer
+   */
+  private func encodeAndSendPacket(timestamp: AVAudioFramePosition) -> Bool {
     guard let opusEncoder = opusEncoder else {
-      return
+      return false
     }
 
     // Flatten frame buffer into continuous PCM data
@@ -292,7 +301,7 @@ class AudioEngineManager {
 
     // We should only encode when we have at least one frame
     guard pcmData.count >= samplesPerFrame else {
-      return
+      return false
     }
 
     // Take only ONE frame worth of samples
@@ -311,24 +320,31 @@ class AudioEngineManager {
     guard let opusData = encodedPacket, !opusData.isEmpty else {
       print("[AudioEngineManager] Failed to encode Opus packet")
       frameBuffer.removeAll()
-      return
+      return false
     }
 
+    // With adaptive frame size the encoder may use only part of the frame
+    let consumedSamples = opusEncoder.packetSamples(opusData)
+
+    // Fetch the encoder's analysis of this frame if requested
+    let analysis = config.enableFrameAnalysis == true ? opusEncoder.frameAnalysis() : nil
+
     // Calculate timestamp in milliseconds
     let timestampMs = Date().timeIntervalSince1970 * 1000
 
     // Emit audioChunk event with Opus packet (may be larger due to DRED)
-    onAudioChunk?(opusData, timestampMs, sequenceNumber)
+    onAudioChunk?(opusData, timestampMs, sequenceNumber, analysis)
 
     sequenceNumber += 1
 
     // Keep any remaining samples for next packet
-    let remainingSamples = pcmData.count - samplesPerFrame
+    let remainingSamples = pcmData.count - consumedSamples
     if remainingSamples > 0 {
-      frameBuffer = [Array(pcmData[samplesPerFrame...])]
+      frameBuffer = [Array(pcmData[consumedSamples...])]
     } else {
       frameBuffer.removeAll()
     }
+    return true
   }
 
   private func configureAudioSession() throws {
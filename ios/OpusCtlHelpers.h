@@ -1,4 +1,5 @@
 #import <Foundation/Foundation.h>
+#import "opus.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -56,6 +57,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (int)setDtx:(void *)encoder dtx:(int)dtx;
 
+/**
+ * Set the frame duration (OPUS_SET_EXPERT_FRAME_DURATION)
+ * @param encoder Pointer to OpusEncoder (as void*)
+ * @param duration One of the OPUS_FRAMESIZE_* values, e.g. OPUS_FRAMESIZE_ADAPTIVE
+ * @return OPUS_OK on success, or negative error code
+ */
++ (int)setExpertFrameDuration:(void *)encoder duration:(int)duration;
+
+/**
+ * Get the encoder's analysis of the last encoded frame
+ * @param encoder Pointer to OpusEncoder (as void*)
+ * @param analysis Receives the VAD decision, classifier probabilities, pitch and band energies
+ * @return OPUS_OK on success, or negative error code
+ */
++ (int)getFrameAnalysis:(void *)encoder analysis:(OpusFrameAnalysis *)analysis;
+
 @end
 
 NS_ASSUME_NONNULL_END
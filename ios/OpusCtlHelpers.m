@@ -27,4 +27,12 @@
     return opus_encoder_ctl((OpusEncoder *)encoder, OPUS_SET_DTX(dtx));
 }
 
++ (int)setExpertFrameDuration:(void *)encoder duration:(int)duration {
+    return opus_encoder_ctl((OpusEncoder *)encoder, OPUS_SET_EXPERT_FRAME_DURATION(duration));
+}
+
++ (int)getFrameAnalysis:(void *)encoder analysis:(OpusFrameAnalysis *)analysis {
+    return opus_encoder_ctl((OpusEncoder *)encoder, OPUS_GET_FRAME_ANALYSIS(analysis));
+}
+
 @end
@@ -27,6 +27,7 @@ class OpusEncoder {
   private let bitrate: Int
   private let frameSize: Int // samples per frame
   private let dredDuration: Int // DRED recovery duration in ms
+  private let adaptiveFrameSize: Bool // encoder picks 20, 40 or 60 ms per packet
 
   // Buffer for encoded output
   private let maxPacketSize = 4000 // bytes
@@ -43,6 +44,8 @@ class OpusEncoder {
    * @param complexity: Encoding complexity 0-10 (default 10)
    * @param inbandFec: Enable in-band forward error correction (default false)
    * @param dtx: Enable discontinuous transmission for silence (default false)
+   * @param adaptiveFrameSize: Let the encoder pick 20, 40 or 60 ms per packet,
+   *   frameSizeMs being the most audio it is given (default false)
    */
   init(
     sampleRate: Int,
@@ -53,12 +56,14 @@ class OpusEncoder {
     vbr: Bool = true,
     complexity: Int = 10,
     inbandFec: Bool = false,
-    dtx: Bool = false
+    dtx: Bool = false,
+    adaptiveFrameSize: Bool = false
   ) throws {
     self.sampleRate = sampleRate
     self.channels = channels
     self.bitrate = bitrate
     self.dredDuration = dredDurationMs
+    self.adaptiveFrameSize = adaptiveFrameSize
 
     // Calculate frame size in samples
     // frameSize = (sampleRate * frameSizeMs) / 1000
@@ -136,6 +141,14 @@ class OpusEncoder {
       }
     }
 
+    // Let the encoder pick the packet duration from the signal
+    if adaptiveFrameSize {
+      result = Int32(OpusCtlHelpers.setExpertFrameDuration(encoderPtr, duration: OPUS_FRAMESIZE_ADAPTIVE))
+      if result != OPUS_OK {
+        print("[OpusEncoder] Warning: Failed to enable adaptive frame size (error \(result))")
+      }
+    }
+
     print("""
     [OpusEncoder] Initialized:
       - Sample rate: \(sampleRate)Hz
@@ -147,6 +160,7 @@ class OpusEncoder {
       - In-band FEC: \(inbandFec)
       - DTX: \(dtx)
       - DRED: \(dredDurationMs)ms
+      - Adaptive frame size: \(adaptiveFrameSize)
     """)
   }
 
@@ -194,6 +208,29 @@ class OpusEncoder {
     return Data(outputBuffer.prefix(Int(encodedBytes)))
   }
 
+  /**
+   * Get the number of input samples per channel a packet encodes
+   *
+   * With adaptive frame size the encoder consumes 20, 40 or 60 ms of the
+   * PCM passed to encode(), and the caller keeps the rest for the next call.
+   *
+   * @param packet: Opus packet returned by encode()
+   * @returns: Samples per channel, or frameSize if the packet can't be parsed
+   */
+  func packetSamples(_ packet: Data) -> Int {
+    guard adaptiveFrameSize else {
+      return frameSize
+    }
+
+    let samples = packet.withUnsafeBytes { raw -> Int32 in
+      guard let base = raw.bindMemory(to: UInt8.self).baseAddress else {
+        return OPUS_BAD_ARG
+      }
+      return opus_packet_get_nb_samples(base, Int32(packet.count), Int32(sampleRate))
+    }
+    return samples > 0 ? Int(samples) : frameSize
+  }
+
   /**
    * Encode multiple frames into a single packet
    *
@@ -222,6 +259,31 @@ class OpusEncoder {
     return encodedPacket
   }
 
+  /**
+   * Get the encoder's analysis of the last encoded frame
+   *
+   * Reuses the VAD, speech/music classifier, band energies and pitch the
+   * encoder already computed, so callers don't need to analyze the PCM again.
+   *
+   * @returns: Frame analysis, or nil on failure
+   */
+  func frameAnalysis() -> FrameAnalysis? {
+    guard let encoder = encoder else {
+      print("[OpusEncoder] Encoder not initialized")
+      return nil
+    }
+
+    var analysis = OpusFrameAnalysis()
+    let encoderPtr = UnsafeMutableRawPointer(encoder)
+    let result = Int32(OpusCtlHelpers.getFrameAnalysis(encoderPtr, analysis: &analysis))
+    if result != OPUS_OK {
+      print("[OpusEncoder] Failed to get frame analysis (error \(result))")
+      return nil
+    }
+
+    return FrameAnalysis(analysis)
+  }
+
   deinit {
     if let encoder = encoder {
       opus_encoder_destroy(encoder)
@@ -230,3 +292,55 @@ class OpusEncoder {
     }
   }
 }
+
+/**
+ * Encoder analysis of one frame (see OPUS_GET_FRAME_ANALYSIS)
+ *
+ * Probabilities are nil when the encoder's tonality analysis did not run
+ * (it requires complexity 7 or higher).
+ */
+struct FrameAnalysis {
+  let vad: Bool
+  let activityProbability: Double?
+  let musicProbability: Double?
+  let tonality: Double?
+  let pitch: Int
+  let bandEnergies: [Double]
+
+  // log2 amplitude in Q8 to dB
+  private static let q8Log2ToDb = 6.0206 / 256.0
+
+  init(_ analysis: OpusFrameAnalysis) {
+    let analysisValid = analysis.analysis_valid != 0
+    vad = analysis.vad != 0
+    activityProbability = analysisValid ? Double(analysis.activity_probability) / 32768.0 : nil
+    musicProbability = analysisValid ? Double(analysis.music_probability) / 32768.0 : nil
+    tonality = analysisValid ? Double(analysis.tonality) / 32768.0 : nil
+    pitch = Int(analysis.pitch)
+
+    // band_energy is imported as a tuple, read it through its raw bytes
+    var bands = analysis.band_energy
+    let count = Int(analysis.band_count)
+    bandEnergies = withUnsafeBytes(of: &bands) { raw in
+      raw.bindMemory(to: Int16.self).prefix(count).map { Double($0) * FrameAnalysis.q8Log2ToDb }
+    }
+  }
+
+  func toDictionary() -> [String: Any] {
+    var dict: [String: Any] = [
+      "vad": vad,
+      "pitch": pitch,
+      "bandEnergies": bandEnergies
+    ]
+    if let activityProbability = activityProbability {
+      dict["activityProbability"] = activityProbability
+    }
+    if let musicProbability = musicProbability {
+      dict["musicProbability"] = musicProbability
+    }
+    if let tonality = tonality {
+      dict["tonality"] = tonality
+    }
+    return dict
+  }
+}
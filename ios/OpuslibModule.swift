@@ -59,12 +59,16 @@ public class OpuslibModule: Module {
 
     // Set up event callbacks
     print("[OpuslibModule] 🔗 Setting up event callbacks...")
-    manager.setOnAudioChunk { [weak self] data, timestamp, sequenceNumber in
-      self?.sendEvent("audioChunk", [
+    manager.setOnAudioChunk { [weak self] data, timestamp, sequenceNumber, analysis in
+      var event: [String: Any] = [
         "data": data,
         "timestamp": timestamp,
         "sequenceNumber": sequenceNumber
-      ])
+      ]
+      if let analysis = analysis {
+        event["analysis"] = analysis.toDictionary()
+      }
+      self?.sendEvent("audioChunk", event)
     }
 
     manager.setOnAmplitude { [weak self] rms, peak, timestamp in
@@ -172,6 +176,8 @@ struct AudioConfig: Record {
   @Field var enableAmplitudeEvents: Bool? = false
   @Field var amplitudeEventInterval: Double? = 16.0
   @Field var saveDebugAudio: Bool? = false
+  @Field var enableFrameAnalysis: Bool? = false
+  @Field var adaptiveFrameSize: Bool? = false
 }
 
 // MARK: - Errors
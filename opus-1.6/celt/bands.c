@@ -1116,7 +1116,8 @@ static unsigned quant_partition(struct band_ctx *ctx, celt_norm *X,
                            ctx->arch);
          } else {
             cm = alg_unquant(X, N, K, spread, B, ec, gain
-                             ARG_QEXT(ctx->ext_ec) ARG_QEXT(extra_bits));
+                             ARG_QEXT(ctx->ext_ec) ARG_QEXT(extra_bits),
+                             ctx->arch);
          }
 #ifdef ENABLE_QEXT
       } else if (ext_b > 2*N<<BITRES)
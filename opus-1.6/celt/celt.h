@@ -78,6 +78,7 @@ typedef struct {
    int   bandwidth;
    float activity_probability;
    float max_pitch_ratio;
+   float energy_rise;
    /* Store as Q6 char to save space. */
    unsigned char leak_boost[LEAK_BANDS];
 } AnalysisInfo;
@@ -87,6 +88,53 @@ typedef struct {
    int offset;
 } SILKInfo;
 
+#ifdef ENABLE_QEXT
+#define CELT_FRONT_END_MAX_N 1920
+#define CELT_FRONT_END_MAX_OVERLAP 240
+#else
+#define CELT_FRONT_END_MAX_N 960
+#define CELT_FRONT_END_MAX_OVERLAP 120
+#endif
+#define CELT_FRONT_END_MAX_BANDS 21
+
+/** Output of celt_encode_front_end(): the part of the CELT analysis that
+    only depends on the input signal and can be computed ahead of (or
+    concurrently with) the rest of the frame. */
+typedef struct {
+   int frame_size;
+   int end;
+   int channels;
+   /* Encoder state the analysis was computed from. */
+   opus_val32 overlap_max_prev;
+   celt_sig preemph_mem_prev[2];
+   /* Results */
+   opus_val32 sample_max;
+   opus_val32 overlap_max;
+   celt_sig preemph_memE[2];
+   opus_val16 tone_freq;
+   opus_val32 toneishness;
+   int has_mdct;
+   celt_sig in[2*(CELT_FRONT_END_MAX_N+CELT_FRONT_END_MAX_OVERLAP)];
+   celt_sig freq[2*CELT_FRONT_END_MAX_N];
+   celt_ener bandE[2*CELT_FRONT_END_MAX_BANDS];
+} CELTFrontEnd;
+
+/** Decisions of a decoded frame that an encoder can reuse instead of running
+    its own searches (see opus_transrater.c). */
+typedef struct {
+   int valid;
+   int LM;
+   int start, end;
+   int channels;
+   int transient;
+   int tf_select;
+   int tf_res[CELT_FRONT_END_MAX_BANDS];   /* Per-band tf change flags, as coded */
+   int spread_decision;
+   int postfilter_period;                  /* Zero when the postfilter is off */
+   opus_val16 postfilter_gain;
+   int postfilter_tapset;
+} CELTParamHints;
+
 #define celt_check_mode_ptr_ptr(ptr) ((ptr) + ((ptr) - (const CELTMode**)(ptr)))
 
 #define celt_check_analysis_ptr(ptr) ((ptr) + ((ptr) - (const AnalysisInfo*)(ptr)))
@@ -95,6 +143,10 @@ typedef struct {
 
 #define celt_check_glog_ptr(ptr) ((ptr) + ((ptr) - (celt_glog*)(ptr)))
 
+#define celt_check_front_end_ptr(ptr) ((ptr) + ((ptr) - (const CELTFrontEnd*)(ptr)))
+
+#define celt_check_param_hints_ptr(ptr) ((ptr) + ((ptr) - (CELTParamHints*)(ptr)))
+
 /* Encoder/decoder Requests */
 
 
@@ -147,6 +199,26 @@ typedef struct {
 #define CELT_SET_SILK_INFO_REQUEST    10028
 #define CELT_SET_SILK_INFO(x) CELT_SET_SILK_INFO_REQUEST, celt_check_silkinfo_ptr(x)
 
+#define CELT_GET_BAND_ENERGIES_REQUEST    10030
+/** Get the log2 amplitude of each band (including the band means) in the
+    last encoded frame, maximized across channels. Takes mode->nbEBands values. */
+#define CELT_GET_BAND_ENERGIES(x) CELT_GET_BAND_ENERGIES_REQUEST, celt_check_glog_ptr(x)
+
+#define CELT_SET_SHADOW_DECODE_REQUEST    10032
+/** Only update the decoder state, without synthesizing any output. */
+#define CELT_SET_SHADOW_DECODE(x) CELT_SET_SHADOW_DECODE_REQUEST, opus_check_int(x)
+
+#define CELT_SET_FRONT_END_REQUEST    10034
+/** Use a precomputed front-end analysis for the next encoded frame only.
+    The analysis is ignored if it no longer matches the encoder state. */
+#define CELT_SET_FRONT_END(x) CELT_SET_FRONT_END_REQUEST, celt_check_front_end_ptr(x)
+
+#define CELT_SET_PARAM_HINTS_REQUEST    10036
+/** Decoder: export the decisions of each decoded frame to the given struct.
+    Encoder: reuse the decisions from the given struct where they match the
+    frame being encoded. NULL disables both. */
+#define CELT_SET_PARAM_HINTS(x) CELT_SET_PARAM_HINTS_REQUEST, celt_check_param_hints_ptr(x)
+
 
 static OPUS_INLINE opus_int32 bits_to_bitrate(opus_int32 bits, opus_int32 Fs, opus_int32 frame_size) {
    return bits*(6*Fs/frame_size)/6;
@@ -160,6 +232,9 @@ static OPUS_INLINE opus_int32 bitrate_to_bits(opus_int32 bitrate, opus_int32 Fs,
 
 int celt_encoder_get_size(int channels);
 
+int celt_encode_front_end(const OpusCustomEncoder *st, const opus_res *pcm, int frame_size,
+      int end, int channels, CELTFrontEnd *fe);
+
 int celt_encode_with_ec(OpusCustomEncoder * OPUS_RESTRICT st, const opus_res * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes, ec_enc *enc);
 
 int celt_encoder_init(CELTEncoder *st, opus_int32 sampling_rate, int channels,
@@ -260,6 +335,27 @@ void comb_filter(opus_val32 *y, opus_val32 *x, int T0, int T1, int N,
 
 void init_caps(const CELTMode *m,int *cap,int LM,int C);
 
+void tf_l1_metrics_c(const celt_norm *X, int N, int K, opus_val32 *L1);
+
+#ifndef FIXED_POINT
+void transient_energy_c(const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+#include "x86/celt_encoder_sse.h"
+#endif
+
+#ifndef OVERRIDE_TF_L1_METRICS
+#define tf_l1_metrics(X, N, K, L1, arch) \
+    ((void)(arch), tf_l1_metrics_c(X, N, K, L1))
+#endif
+
+#if !defined(OVERRIDE_TRANSIENT_ENERGY) && !defined(FIXED_POINT)
+#define transient_energy(in, len, C, forward_decay, tmp, mean, maxE, arch) \
+    ((void)(arch), transient_energy_c(in, len, C, forward_decay, tmp, mean, maxE))
+#endif
+
 #ifdef RESYNTH
 void deemphasis(celt_sig *in[], opus_res *pcm, int N, int C, int downsample, const opus_val16 *coef, celt_sig *mem, int accum);
 void celt_synthesis(const CELTMode *mode, celt_norm *X, celt_sig * out_syn[],
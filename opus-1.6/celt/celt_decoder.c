@@ -99,6 +99,8 @@ struct OpusCustomDecoder {
 #ifdef ENABLE_QEXT
    int qext_scale;
 #endif
+   int shadow;
+   CELTParamHints *param_hints;
 
    /* Everything beyond this point gets cleared on a reset */
 #define DECODER_RESET_START rng
@@ -510,7 +512,7 @@ void celt_synthesis(const CELTMode *mode, celt_norm *X, celt_sig * out_syn[],
    RESTORE_STACK;
 }
 
-static void tf_decode(int start, int end, int isTransient, int *tf_res, int LM, ec_dec *dec)
+static int tf_decode(int start, int end, int isTransient, int *tf_res, int LM, ec_dec *dec)
 {
    int i, curr, tf_select;
    int tf_select_rsv;
@@ -547,6 +549,7 @@ static void tf_decode(int start, int end, int isTransient, int *tf_res, int LM,
    {
       tf_res[i] = tf_select_table[LM][4*isTransient+2*tf_select+tf_res[i]];
    }
+   return tf_select;
 }
 
 static int celt_plc_pitch_search(CELTDecoder *st, celt_sig *decode_mem[2], int C, int arch)
@@ -1133,6 +1136,7 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
    int alloc_trim;
    int postfilter_pitch;
    opus_val16 postfilter_gain;
+   int tf_select;
    int intensity=0;
    int dual_stereo=0;
    opus_int32 total_bits;
@@ -1274,6 +1278,9 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
    if (effEnd > mode->effEBands)
       effEnd = mode->effEBands;
 
+   if (st->param_hints)
+      st->param_hints->valid = 0;
+
    if (data == NULL || len<=1)
    {
       celt_decode_lost(st, N, LM
@@ -1281,7 +1288,8 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
       , lpcnet
 #endif
                       );
-      deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
+      if (!st->shadow)
+         deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
       RESTORE_STACK;
       return frame_size/st->downsample;
    }
@@ -1393,7 +1401,7 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
          intra_ener, dec, C, LM);
 
    ALLOC(tf_res, nbEBands, int);
-   tf_decode(start, end, isTransient, tf_res, LM, dec);
+   tf_select = tf_decode(start, end, isTransient, tf_res, LM, dec);
 
    tell = ec_tell(dec);
    spread_decision = SPREAD_NORMAL;
@@ -1479,9 +1487,14 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
    }
 #endif
 
-   c=0; do {
-      OPUS_MOVE(decode_mem[c], decode_mem[c]+N, decode_buffer_size-N+overlap);
-   } while (++c<CC);
+   /* The synthesis memory is only needed for the output (and the PLC), so
+      shadow decoding leaves it alone and it gets cleared on promotion. */
+   if (!st->shadow)
+   {
+      c=0; do {
+         OPUS_MOVE(decode_mem[c], decode_mem[c]+N, decode_buffer_size-N+overlap);
+      } while (++c<CC);
+   }
 
    /* Decode fixed codebook */
    ALLOC(collapse_masks, C*nbEBands, unsigned char);
@@ -1519,7 +1532,7 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
    }
    unquant_energy_finalise(mode, start, end, (qext_bytes > 0) ? NULL : oldBandE,
          fine_quant, fine_priority, len*8-ec_tell(dec), dec, C);
-   if (anti_collapse_on)
+   if (anti_collapse_on && !st->shadow)
       anti_collapse(mode, X, collapse_masks, LM, C, N,
             start, end, oldBandE, oldLogE, oldLogE2, pulses, st->rng, 0, st->arch);
 
@@ -1528,24 +1541,27 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
       for (i=0;i<C*nbEBands;i++)
          oldBandE[i] = -GCONST(28.f);
    }
-   if (st->prefilter_and_fold) {
-      prefilter_and_fold(st, N);
-   }
-   celt_synthesis(mode, X, out_syn, oldBandE, start, effEnd,
-                  C, CC, isTransient, LM, st->downsample, silence, st->arch ARG_QEXT(qext_mode) ARG_QEXT(st->qext_oldBandE) ARG_QEXT(qext_end));
+   if (!st->shadow)
+   {
+      if (st->prefilter_and_fold) {
+         prefilter_and_fold(st, N);
+      }
+      celt_synthesis(mode, X, out_syn, oldBandE, start, effEnd,
+                     C, CC, isTransient, LM, st->downsample, silence, st->arch ARG_QEXT(qext_mode) ARG_QEXT(st->qext_oldBandE) ARG_QEXT(qext_end));
 
-   c=0; do {
-      st->postfilter_period=IMAX(st->postfilter_period, COMBFILTER_MINPERIOD);
-      st->postfilter_period_old=IMAX(st->postfilter_period_old, COMBFILTER_MINPERIOD);
-      comb_filter(out_syn[c], out_syn[c], st->postfilter_period_old, st->postfilter_period, mode->shortMdctSize,
-            st->postfilter_gain_old, st->postfilter_gain, st->postfilter_tapset_old, st->postfilter_tapset,
-            mode->window, overlap, st->arch);
-      if (LM!=0)
-         comb_filter(out_syn[c]+mode->shortMdctSize, out_syn[c]+mode->shortMdctSize, st->postfilter_period, postfilter_pitch, N-mode->shortMdctSize,
-               st->postfilter_gain, postfilter_gain, st->postfilter_tapset, postfilter_tapset,
+      c=0; do {
+         st->postfilter_period=IMAX(st->postfilter_period, COMBFILTER_MINPERIOD);
+         st->postfilter_period_old=IMAX(st->postfilter_period_old, COMBFILTER_MINPERIOD);
+         comb_filter(out_syn[c], out_syn[c], st->postfilter_period_old, st->postfilter_period, mode->shortMdctSize,
+               st->postfilter_gain_old, st->postfilter_gain, st->postfilter_tapset_old, st->postfilter_tapset,
                mode->window, overlap, st->arch);
+         if (LM!=0)
+            comb_filter(out_syn[c]+mode->shortMdctSize, out_syn[c]+mode->shortMdctSize, st->postfilter_period, postfilter_pitch, N-mode->shortMdctSize,
+                  st->postfilter_gain, postfilter_gain, st->postfilter_tapset, postfilter_tapset,
+                  mode->window, overlap, st->arch);
 
-   } while (++c<CC);
+      } while (++c<CC);
+   }
    st->postfilter_period_old = st->postfilter_period;
    st->postfilter_gain_old = st->postfilter_gain;
    st->postfilter_tapset_old = st->postfilter_tapset;
@@ -1559,6 +1575,25 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
       st->postfilter_tapset_old = st->postfilter_tapset;
    }
 
+   if (st->param_hints && !silence && nbEBands <= CELT_FRONT_END_MAX_BANDS)
+   {
+      CELTParamHints *hints = st->param_hints;
+      hints->valid = 1;
+      hints->LM = LM;
+      hints->start = start;
+      hints->end = end;
+      hints->channels = C;
+      hints->transient = isTransient;
+      hints->tf_select = tf_select;
+      /* Map the tf changes back to the coded flags */
+      for (i=start;i<end;i++)
+         hints->tf_res[i] = tf_res[i] != tf_select_table[LM][4*isTransient+2*tf_select];
+      hints->spread_decision = spread_decision;
+      hints->postfilter_period = postfilter_pitch;
+      hints->postfilter_gain = postfilter_gain;
+      hints->postfilter_tapset = postfilter_tapset;
+   }
+
    if (C==1)
       OPUS_COPY(&oldBandE[nbEBands], oldBandE, nbEBands);
 
@@ -1595,7 +1630,8 @@ int celt_decode_with_ec_dred(CELTDecoder * OPUS_RESTRICT st, const unsigned char
    if (qext_bytes) st->rng = st->rng ^ ext_dec.rng;
 #endif
 
-   deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
+   if (!st->shadow)
+      deemphasis(out_syn, pcm, N, CC, st->downsample, mode->preemph, st->preemph_memD, accum);
    st->loss_duration = 0;
    st->plc_duration = 0;
    st->last_frame_type = FRAME_NORMAL;
@@ -1830,6 +1866,35 @@ int opus_custom_decoder_ctl(CELTDecoder * OPUS_RESTRICT st, int request, ...)
          st->signalling = value;
       }
       break;
+      case CELT_SET_PARAM_HINTS_REQUEST:
+      {
+         CELTParamHints *value = va_arg(ap, CELTParamHints*);
+         st->param_hints = value;
+      }
+      break;
+      case CELT_SET_SHADOW_DECODE_REQUEST:
+      {
+         opus_int32 value = va_arg(ap, opus_int32);
+         if (value<0 || value>1)
+            goto bad_arg;
+         if (st->shadow && !value)
+         {
+            int decode_buffer_size;
+#ifdef ENABLE_QEXT
+            int qext_scale = st->qext_scale;
+#endif
+            /* The synthesis memory is stale: restart from silence so that
+               the overlap-add fades the first frame in. */
+            decode_buffer_size = QEXT_SCALE(DECODE_BUFFER_SIZE);
+            OPUS_CLEAR(st->_decode_mem, (decode_buffer_size+st->overlap)*st->channels);
+            OPUS_CLEAR(st->preemph_memD, 2);
+            st->postfilter_gain_old = st->postfilter_gain = 0;
+            st->prefilter_and_fold = 0;
+            st->skip_plc = 1;
+         }
+         st->shadow = value;
+      }
+      break;
       case OPUS_GET_FINAL_RANGE_REQUEST:
       {
          opus_uint32 * value = va_arg(ap, opus_uint32 *);
@@ -85,6 +85,7 @@ struct OpusCustomEncoder {
    int enable_qext;
    int qext_scale;
 #endif
+   const CELTParamHints *param_hints;
 
    /* Everything beyond this point gets cleared on a reset */
 #define ENCODER_RESET_START rng
@@ -121,6 +122,7 @@ struct OpusCustomEncoder {
    opus_val16 stereo_saving;
    int intensity;
    celt_glog *energy_mask;
+   const CELTFrontEnd *front_end;
    celt_glog spec_avg;
 
 #ifdef RESYNTH
@@ -139,6 +141,7 @@ struct OpusCustomEncoder {
    /* celt_glog oldLogE[],      Size = channels*mode->nbEBands */
    /* celt_glog oldLogE2[],     Size = channels*mode->nbEBands */
    /* celt_glog energyError[],  Size = channels*mode->nbEBands */
+   /* celt_glog analysisE[],    Size = channels*mode->nbEBands */
 };
 
 int celt_encoder_get_size(int channels)
@@ -165,10 +168,11 @@ OPUS_CUSTOM_NOSTATIC int opus_custom_encoder_get_size(const CELTMode *mode, int
    size = sizeof(struct CELTEncoder)
          + (channels*mode->overlap-1)*sizeof(celt_sig)    /* celt_sig in_mem[channels*mode->overlap]; */
          + channels*QEXT_SCALE(COMBFILTER_MAXPERIOD)*sizeof(celt_sig) /* celt_sig prefilter_mem[channels*COMBFILTER_MAXPERIOD]; */
-         + 4*channels*mode->nbEBands*sizeof(celt_glog)    /* celt_glog oldBandE[channels*mode->nbEBands]; */
+         + 5*channels*mode->nbEBands*sizeof(celt_glog)    /* celt_glog oldBandE[channels*mode->nbEBands]; */
                                                           /* celt_glog oldLogE[channels*mode->nbEBands]; */
                                                           /* celt_glog oldLogE2[channels*mode->nbEBands]; */
                                                           /* celt_glog energyError[channels*mode->nbEBands]; */
+                                                          /* celt_glog analysisE[channels*mode->nbEBands]; */
          + extra;
    return size;
 }
@@ -264,13 +268,77 @@ void opus_custom_encoder_destroy(CELTEncoder *st)
 #endif /* CUSTOM_MODES */
 
 
+#ifndef FIXED_POINT
+/* Computes the high-passed, forward- and backward-masked energy used by
+   transient_analysis() for each channel, with the output of channel c in
+   tmp[c*(len/2)...]. The forward masking only needs the high-pass output two
+   samples at a time, so both filters run in the same loop. */
+void transient_energy_c(const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE)
+{
+   int i, c;
+   int len2;
+   len2=len/2;
+   for (c=0;c<C;c++)
+   {
+      const celt_sig *x = in+c*len;
+      opus_val16 *e = tmp+c*len2;
+      opus_val32 mem0, mem1, fmem, sum;
+      opus_val16 m;
+      mem0=0;
+      mem1=0;
+      fmem=0;
+      sum=0;
+      for (i=0;i<len2;i++)
+      {
+         float mem00;
+         opus_val32 y0, y1, x2;
+         /* High-pass filter: (1 - 2*z^-1 + z^-2) / (1 - z^-1 + .5*z^-2) */
+         y0 = mem0 + x[2*i];
+         mem00=mem0;
+         mem0 = mem0 - x[2*i] + .5f*mem1;
+         mem1 = x[2*i] - mem00;
+         y1 = mem0 + x[2*i+1];
+         mem00=mem0;
+         mem0 = mem0 - x[2*i+1] + .5f*mem1;
+         mem1 = x[2*i+1] - mem00;
+         /* First few samples are bad because we don't propagate the memory */
+         if (i<6)
+            y0 = y1 = 0;
+         /* Forward pass to compute the post-echo threshold*/
+         x2 = y0*y0 + y1*y1;
+         sum += x2;
+         fmem = x2 + (1.f-forward_decay)*fmem;
+         e[i] = forward_decay*fmem;
+      }
+      mem0=0;
+      m=0;
+      /* Backward pass to compute the pre-echo threshold */
+      for (i=len2-1;i>=0;i--)
+      {
+         mem0 = e[i] + 0.875f*mem0;
+         e[i] = 0.125f*mem0;
+         m = MAX16(m, 0.125f*mem0);
+      }
+      mean[c] = sum;
+      maxE[c] = m;
+   }
+}
+#endif
+
 static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int C,
                               opus_val16 *tf_estimate, int *tf_chan, int allow_weak_transients,
-                              int *weak_transient, opus_val16 tone_freq, opus_val32 toneishness)
+                              int *weak_transient, opus_val16 tone_freq, opus_val32 toneishness,
+                              int arch)
 {
    int i;
    VARDECL(opus_val16, tmp);
+#ifdef FIXED_POINT
    opus_val32 mem0,mem1;
+#else
+   VARDECL(opus_val32, energy_mean);
+   VARDECL(opus_val16, energy_max);
+#endif
    int is_transient = 0;
    opus_int32 mask_metric = 0;
    int c;
@@ -296,8 +364,9 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
    SAVE_STACK;
 #ifdef FIXED_POINT
    int in_shift = IMAX(0, celt_ilog2(1+celt_maxabs32(in, C*len))-14);
-#endif
    ALLOC(tmp, len, opus_val16);
+   (void)arch;
+#endif
 
    *weak_transient = 0;
    /* For lower bitrates, let's be more conservative and have a forward masking
@@ -313,35 +382,30 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
 #endif
    }
    len2=len/2;
+#ifndef FIXED_POINT
+   ALLOC(tmp, C*len2, opus_val16);
+   ALLOC(energy_mean, C, opus_val32);
+   ALLOC(energy_max, C, opus_val16);
+   transient_energy(in, len, C, forward_decay, tmp, energy_mean, energy_max, arch);
+#endif
    for (c=0;c<C;c++)
    {
       opus_val32 mean;
       opus_int32 unmask=0;
       opus_val32 norm;
       opus_val16 maxE;
+      opus_val16 *mask;
+#ifdef FIXED_POINT
       mem0=0;
       mem1=0;
       /* High-pass filter: (1 - 2*z^-1 + z^-2) / (1 - z^-1 + .5*z^-2) */
       for (i=0;i<len;i++)
       {
-#ifndef FIXED_POINT
-         float mem00;
-#endif
          opus_val32 x,y;
          x = SHR32(in[i+c*len],in_shift);
          y = ADD32(mem0, x);
-#ifdef FIXED_POINT
          mem0 = mem1 + y - SHL32(x,1);
          mem1 = x - SHR32(y,1);
-#else
-         /* Original code:
-         mem0 = mem1 + y - 2*x;
-         mem1 = x - .5f*y;
-         Modified code to shorten dependency chains: */
-         mem00=mem0;
-         mem0 = mem0 - x + .5f*mem1;
-         mem1 =  x - mem00;
-#endif
          tmp[i] = SROUND16(y, 2);
          /*printf("%f ", tmp[i]);*/
       }
@@ -349,7 +413,6 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
       /* First few samples are bad because we don't propagate the memory */
       OPUS_CLEAR(tmp, 12);
 
-#ifdef FIXED_POINT
       /* Normalize tmp to max range */
       {
          int shift=0;
@@ -360,7 +423,6 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
                tmp[i] = SHL16(tmp[i], shift);
          }
       }
-#endif
 
       mean=0;
       mem0=0;
@@ -370,14 +432,9 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
       {
          opus_val32 x2 = PSHR32(MULT16_16(tmp[2*i],tmp[2*i]) + MULT16_16(tmp[2*i+1],tmp[2*i+1]),4);
          mean += PSHR32(x2, 12);
-#ifdef FIXED_POINT
          /* FIXME: Use PSHR16() instead */
          mem0 = mem0 + PSHR32(x2-mem0,forward_shift);
          tmp[i] = PSHR32(mem0, 12);
-#else
-         mem0 = x2 + (1.f-forward_decay)*mem0;
-         tmp[i] = forward_decay*mem0;
-#endif
       }
 
       mem0=0;
@@ -386,17 +443,17 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
       for (i=len2-1;i>=0;i--)
       {
          /* Backward masking: 13.9 dB/ms. */
-#ifdef FIXED_POINT
          /* FIXME: Use PSHR16() instead */
          mem0 = mem0 + PSHR32(SHL32(tmp[i],4)-mem0,3);
          tmp[i] = PSHR32(mem0, 4);
          maxE = MAX16(maxE, tmp[i]);
+      }
+      mask = tmp;
 #else
-         mem0 = tmp[i] + 0.875f*mem0;
-         tmp[i] = 0.125f*mem0;
-         maxE = MAX16(maxE, 0.125f*mem0);
+      mean = energy_mean[c];
+      maxE = energy_max[c];
+      mask = tmp+c*len2;
 #endif
-      }
       /*for (i=0;i<len2;i++)printf("%f ", tmp[i]/mean);printf("\n");*/
 
       /* Compute the ratio of the "frame energy" over the harmonic mean of the energy.
@@ -420,15 +477,15 @@ static int transient_analysis(const opus_val32 * OPUS_RESTRICT in, int len, int
          before it does any damage later on. If these asserts are disabled (no hardening), then the table
          lookup a few lines below (id = ...) is likely to crash dur to an out-of-bounds read. DO NOT FIX
          that crash on NaN since it could result in a worse issue later on. */
-      celt_assert(!celt_isnan(tmp[0]));
+      celt_assert(!celt_isnan(mask[0]));
       celt_assert(!celt_isnan(norm));
       for (i=12;i<len2-5;i+=4)
       {
          int id;
 #ifdef FIXED_POINT
-         id = MAX32(0,MIN32(127,MULT16_32_Q15(tmp[i]+EPSILON,norm))); /* Do not round to nearest */
+         id = MAX32(0,MIN32(127,MULT16_32_Q15(mask[i]+EPSILON,norm))); /* Do not round to nearest */
 #else
-         id = (int)MAX32(0,MIN32(127,floor(64*norm*(tmp[i]+EPSILON)))); /* Do not round to nearest */
+         id = (int)MAX32(0,MIN32(127,floor(64*norm*(mask[i]+EPSILON)))); /* Do not round to nearest */
 #endif
          unmask += inv_table[id];
       }
@@ -640,22 +697,28 @@ void celt_preemphasis(const opus_res * OPUS_RESTRICT pcmp, celt_sig * OPUS_RESTR
 
 
 
-static opus_val32 l1_metric(const celt_norm *tmp, int N, int LM, opus_val16 bias)
+/* Computes the L1 norm of K consecutive rows of N coefficients. */
+void tf_l1_metrics_c(const celt_norm *X, int N, int K, opus_val32 *L1)
 {
-   int i;
-   opus_val32 L1;
-   L1 = 0;
-   for (i=0;i<N;i++)
-      L1 += EXTEND32(ABS16(SHR32(tmp[i], NORM_SHIFT-14)));
-   /* When in doubt, prefer good freq resolution */
-   L1 = MAC16_32_Q15(L1, LM*bias, L1);
-   return L1;
+   int i, k;
+   for (k=0;k<K;k++)
+   {
+      opus_val32 sum = 0;
+      for (i=0;i<N;i++)
+         sum += EXTEND32(ABS16(SHR32(X[k*N+i], NORM_SHIFT-14)));
+      L1[k] = sum;
+   }
+}
 
+static opus_val32 l1_metric(opus_val32 L1, int LM, opus_val16 bias)
+{
+   /* When in doubt, prefer good freq resolution */
+   return MAC16_32_Q15(L1, LM*bias, L1);
 }
 
 static int tf_analysis(const CELTMode *m, int len, int isTransient,
       int *tf_res, int lambda, celt_norm *X, int N0, int LM,
-      opus_val16 tf_estimate, int tf_chan, int *importance)
+      opus_val16 tf_estimate, int tf_chan, int *importance, int arch)
 {
    int i;
    VARDECL(int, metric);
@@ -664,7 +727,7 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
    VARDECL(int, path0);
    VARDECL(int, path1);
    VARDECL(celt_norm, tmp);
-   VARDECL(celt_norm, tmp_1);
+   VARDECL(opus_val32, L1s);
    int sel;
    int selcost[2];
    int tf_select=0;
@@ -675,8 +738,10 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
    /*printf("%f ", bias);*/
 
    ALLOC(metric, len, int);
-   ALLOC(tmp, (m->eBands[len]-m->eBands[len-1])<<LM, celt_norm);
-   ALLOC(tmp_1, (m->eBands[len]-m->eBands[len-1])<<LM, celt_norm);
+   /* One row for every candidate resolution, so that their L1 norms can all
+      be computed in a single call. */
+   ALLOC(tmp, (LM+2)*((m->eBands[len]-m->eBands[len-1])<<LM), celt_norm);
+   ALLOC(L1s, LM+2, opus_val32);
    ALLOC(path0, len, int);
    ALLOC(path1, len, int);
 
@@ -684,24 +749,38 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
    {
       int k, N;
       int narrow;
+      int split, levels;
       opus_val32 L1, best_L1;
       int best_level=0;
       N = (m->eBands[i+1]-m->eBands[i])<<LM;
       /* band is too narrow to be split down to LM=-1 */
       narrow = (m->eBands[i+1]-m->eBands[i])==1;
+      split = isTransient && !narrow;
+      levels = LM+!(isTransient||narrow);
       OPUS_COPY(tmp, &X[tf_chan*N0 + (m->eBands[i]<<LM)], N);
       /* Just add the right channel if we're in stereo */
       /*if (C==2)
          for (j=0;j<N;j++)
             tmp[j] = ADD16(SHR16(tmp[j], 1),SHR16(X[N0+j+(m->eBands[i]<<LM)], 1));*/
-      L1 = l1_metric(tmp, N, isTransient ? LM : 0, bias);
+      /* The -1 case for transients goes in the second row */
+      if (split)
+      {
+         OPUS_COPY(tmp+N, tmp, N);
+         haar1(tmp+N, N>>LM, 1<<LM);
+      }
+      for (k=0;k<levels;k++)
+      {
+         celt_norm *prev = k==0 ? tmp : tmp+(split+k)*N;
+         OPUS_COPY(tmp+(split+k+1)*N, prev, N);
+         haar1(tmp+(split+k+1)*N, N>>k, 1<<k);
+      }
+      tf_l1_metrics(tmp, N, 1+split+levels, L1s, arch);
+      L1 = l1_metric(L1s[0], isTransient ? LM : 0, bias);
       best_L1 = L1;
       /* Check the -1 case for transients */
-      if (isTransient && !narrow)
+      if (split)
       {
-         OPUS_COPY(tmp_1, tmp, N);
-         haar1(tmp_1, N>>LM, 1<<LM);
-         L1 = l1_metric(tmp_1, N, LM+1, bias);
+         L1 = l1_metric(L1s[1], LM+1, bias);
          if (L1<best_L1)
          {
             best_L1 = L1;
@@ -709,7 +788,7 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
          }
       }
       /*printf ("%f ", L1);*/
-      for (k=0;k<LM+!(isTransient||narrow);k++)
+      for (k=0;k<levels;k++)
       {
          int B;
 
@@ -718,9 +797,7 @@ static int tf_analysis(const CELTMode *m, int len, int isTransient,
          else
             B = k+1;
 
-         haar1(tmp, N>>k, 1<<k);
-
-         L1 = l1_metric(tmp, N, B, bias);
+         L1 = l1_metric(L1s[split+k+1], B, bias);
 
          if (L1 < best_L1)
          {
@@ -1394,7 +1471,8 @@ static opus_val16 tone_detect(const celt_sig *in, int CC, int N, opus_val32 *ton
 
 static int run_prefilter(CELTEncoder *st, celt_sig *in, celt_sig *prefilter_mem, int CC, int N,
       int prefilter_tapset, int *pitch, opus_val16 *gain, int *qgain, int enabled, int complexity, opus_val16 tf_estimate,
-      int nbAvailableBytes, AnalysisInfo *analysis, opus_val16 tone_freq, opus_val32 toneishness ARG_QEXT(int qext_scale))
+      int nbAvailableBytes, AnalysisInfo *analysis, opus_val16 tone_freq, opus_val32 toneishness,
+      const CELTParamHints *hints ARG_QEXT(int qext_scale))
 {
    int c;
    VARDECL(celt_sig, _pre);
@@ -1449,6 +1527,16 @@ static int run_prefilter(CELTEncoder *st, celt_sig *in, celt_sig *prefilter_mem,
          pitch_index = COMBFILTER_MINPERIOD;
       }
       gain1 = QCONST16(.75f, 15);
+   } else if (enabled && hints != NULL) {
+      /* Start from the postfilter of the decoded frame rather than searching */
+      if (hints->postfilter_period > 0)
+      {
+         pitch_index = IMIN(hints->postfilter_period, COMBFILTER_MAXPERIOD-2);
+         gain1 = hints->postfilter_gain;
+      } else {
+         pitch_index = COMBFILTER_MINPERIOD;
+         gain1 = 0;
+      }
    } else if (enabled && complexity >= 5) {
       VARDECL(opus_val16, pitch_buf);
       ALLOC(pitch_buf, (max_period+N)>>1, opus_val16);
@@ -1713,6 +1801,86 @@ static void encode_qext_stereo_params(ec_enc *ec, int qext_end, int qext_intensi
 }
 #endif
 
+/* Computes the parts of the CELT analysis that only depend on the input
+   signal and on the encoder state left by the previous frame: peak level,
+   pre-emphasis, tone detection and, when the prefilter is known to be a no-op,
+   the long MDCT and band energies. The encoder state is not modified, so this
+   can run concurrently with anything that does not touch the encoder. */
+int celt_encode_front_end(const CELTEncoder *st, const opus_res *pcm, int frame_size,
+      int end, int channels, CELTFrontEnd *fe)
+{
+   int c, LM, N;
+   int effEnd;
+   const OpusCustomMode *mode;
+   const celt_sig *prefilter_mem;
+   const int CC = st->channels;
+   const int C = channels;
+   int overlap;
+   int nbEBands;
+   int max_period;
+   VARDECL(celt_sig, in);
+   SAVE_STACK;
+
+   mode = st->mode;
+   overlap = mode->overlap;
+   nbEBands = mode->nbEBands;
+   fe->frame_size = 0;
+   frame_size *= st->upsample;
+   for (LM=0;LM<=mode->maxLM;LM++)
+      if (mode->shortMdctSize<<LM==frame_size)
+         break;
+   N = mode->shortMdctSize<<LM;
+   if (pcm==NULL || LM>mode->maxLM || N>CELT_FRONT_END_MAX_N || overlap>CELT_FRONT_END_MAX_OVERLAP
+         || C<1 || C>CC || end<1 || end>nbEBands)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+#ifdef ENABLE_QEXT
+   max_period = st->qext_scale*COMBFILTER_MAXPERIOD;
+#else
+   max_period = COMBFILTER_MAXPERIOD;
+#endif
+   prefilter_mem = st->in_mem+CC*overlap;
+
+   fe->overlap_max_prev = st->overlap_max;
+   fe->sample_max = MAX32(st->overlap_max, celt_maxabs_res(pcm, C*(N-overlap)/st->upsample));
+   fe->overlap_max = celt_maxabs_res(pcm+C*(N-overlap)/st->upsample, C*overlap/st->upsample);
+   fe->sample_max = MAX32(fe->sample_max, fe->overlap_max);
+   c=0; do {
+      int need_clip=0;
+#ifndef FIXED_POINT
+      need_clip = st->clip && fe->sample_max>65536.f;
+#endif
+      fe->preemph_mem_prev[c] = fe->preemph_memE[c] = st->preemph_memE[c];
+      celt_preemphasis(pcm+c, fe->in+c*(N+overlap)+overlap, N, CC, st->upsample,
+                  mode->preemph, fe->preemph_memE+c, need_clip);
+      OPUS_COPY(fe->in+c*(N+overlap), &prefilter_mem[(1+c)*max_period-overlap], overlap);
+   } while (++c<CC);
+   fe->tone_freq = tone_detect(fe->in, CC, N+overlap, &fe->toneishness, mode->Fs);
+
+   /* With a zero gain on both sides, run_prefilter() only replaces the first
+      overlap with the previous frame's tail, so the long MDCT can be done here. */
+   fe->has_mdct = st->prefilter_gain==0 && !st->lfe && nbEBands<=CELT_FRONT_END_MAX_BANDS
+         && max_period==COMBFILTER_MAXPERIOD;
+   if (fe->has_mdct)
+   {
+      effEnd = IMIN(end, mode->effEBands);
+      ALLOC(in, CC*(N+overlap), celt_sig);
+      OPUS_COPY(in, fe->in, CC*(N+overlap));
+      c=0; do {
+         OPUS_COPY(in+c*(N+overlap), st->in_mem+c*overlap, overlap);
+      } while (++c<CC);
+      compute_mdcts(mode, 0, in, fe->freq, C, CC, LM, st->upsample, st->arch);
+      compute_band_energies(mode, fe->freq, fe->bandE, effEnd, C, LM, st->arch);
+   }
+   fe->end = end;
+   fe->channels = C;
+   fe->frame_size = frame_size/st->upsample;
+   RESTORE_STACK;
+   return OPUS_OK;
+}
+
 int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, int frame_size, unsigned char *compressed, int nbCompressedBytes, ec_enc *enc)
 {
    int i, c, N;
@@ -1735,7 +1903,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    VARDECL(int, tf_res);
    VARDECL(unsigned char, collapse_masks);
    celt_sig *prefilter_mem;
-   celt_glog *oldBandE, *oldLogE, *oldLogE2, *energyError;
+   celt_glog *oldBandE, *oldLogE, *oldLogE2, *energyError, *analysisE;
    int shortBlocks=0;
    int isTransient=0;
    const int CC = st->channels;
@@ -1788,6 +1956,9 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    opus_val16 tone_freq=-1;
    opus_val32 toneishness=0;
    VARDECL(celt_glog, surround_dynalloc);
+   const CELTFrontEnd *fe;
+   int fe_mdct;
+   const CELTParamHints *hints;
    int qext_bytes=0;
    int packet_size_cap = 1275;
 #ifdef ENABLE_QEXT
@@ -1819,6 +1990,8 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    end = st->end;
    hybrid = start != 0;
    tf_estimate = 0;
+   fe = st->front_end;
+   st->front_end = NULL;
    if (nbCompressedBytes<2 || pcm==NULL)
    {
       RESTORE_STACK;
@@ -1837,6 +2010,16 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    M=1<<LM;
    N = M*mode->shortMdctSize;
 
+   /* Only use a precomputed front-end if it was computed from the current state. */
+   if (fe != NULL && (fe->frame_size*st->upsample != frame_size || fe->end != end
+         || fe->channels != C || fe->overlap_max_prev != st->overlap_max))
+      fe = NULL;
+   for (c=0;fe!=NULL && c<CC;c++)
+   {
+      if (fe->preemph_mem_prev[c] != st->preemph_memE[c])
+         fe = NULL;
+   }
+
 #ifdef ENABLE_QEXT
    qext_scale = st->qext_scale;
    if (st->enable_qext) packet_size_cap = QEXT_PACKET_SIZE_CAP;
@@ -1847,6 +2030,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    oldLogE = oldBandE + CC*nbEBands;
    oldLogE2 = oldLogE + CC*nbEBands;
    energyError = oldLogE2 + CC*nbEBands;
+   analysisE = energyError + CC*nbEBands;
 
    if (enc==NULL)
    {
@@ -1957,9 +2141,15 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
 
    ALLOC(in, CC*(N+overlap), celt_sig);
 
-   sample_max=MAX32(st->overlap_max, celt_maxabs_res(pcm, C*(N-overlap)/st->upsample));
-   st->overlap_max=celt_maxabs_res(pcm+C*(N-overlap)/st->upsample, C*overlap/st->upsample);
-   sample_max=MAX32(sample_max, st->overlap_max);
+   if (fe != NULL)
+   {
+      sample_max = fe->sample_max;
+      st->overlap_max = fe->overlap_max;
+   } else {
+      sample_max=MAX32(st->overlap_max, celt_maxabs_res(pcm, C*(N-overlap)/st->upsample));
+      st->overlap_max=celt_maxabs_res(pcm+C*(N-overlap)/st->upsample, C*overlap/st->upsample);
+      sample_max=MAX32(sample_max, st->overlap_max);
+   }
 #ifdef FIXED_POINT
    silence = (sample_max==0);
 #else
@@ -1996,18 +2186,30 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
       tell = nbCompressedBytes*8;
       enc->nbits_total+=tell-ec_tell(enc);
    }
-   c=0; do {
-      int need_clip=0;
+   if (fe != NULL)
+   {
+      OPUS_COPY(in, fe->in, CC*(N+overlap));
+      OPUS_COPY(st->preemph_memE, fe->preemph_memE, CC);
+      tone_freq = fe->tone_freq;
+      toneishness = fe->toneishness;
+   } else {
+      c=0; do {
+         int need_clip=0;
 #ifndef FIXED_POINT
-      need_clip = st->clip && sample_max>65536.f;
+         need_clip = st->clip && sample_max>65536.f;
 #endif
-      celt_preemphasis(pcm+c, in+c*(N+overlap)+overlap, N, CC, st->upsample,
-                  mode->preemph, st->preemph_memE+c, need_clip);
-      OPUS_COPY(in+c*(N+overlap), &prefilter_mem[(1+c)*QEXT_SCALE(COMBFILTER_MAXPERIOD)-overlap], overlap);
-   } while (++c<CC);
-
+         celt_preemphasis(pcm+c, in+c*(N+overlap)+overlap, N, CC, st->upsample,
+                     mode->preemph, st->preemph_memE+c, need_clip);
+         OPUS_COPY(in+c*(N+overlap), &prefilter_mem[(1+c)*QEXT_SCALE(COMBFILTER_MAXPERIOD)-overlap], overlap);
+      } while (++c<CC);
 
-   tone_freq = tone_detect(in, CC, N+overlap, &toneishness, mode->Fs);
+      tone_freq = tone_detect(in, CC, N+overlap, &toneishness, mode->Fs);
+   }
+   /* Decisions of a decoded frame are only reused if it has the same layout. */
+   hints = st->param_hints;
+   if (hints != NULL && (!hints->valid || hints->LM != LM || hints->start != start
+         || hints->end != end || hints->channels != C || st->lfe))
+      hints = NULL;
    isTransient = 0;
    shortBlocks = 0;
    if (st->complexity >= 1 && !st->lfe)
@@ -2017,7 +2219,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
          though (small SILK quantization offset value). */
       int allow_weak_transients = hybrid && effectiveBytes<15 && st->silk_info.signalType != 2;
       isTransient = transient_analysis(in, N+overlap, CC,
-            &tf_estimate, &tf_chan, allow_weak_transients, &weak_transient, tone_freq, toneishness);
+            &tf_estimate, &tf_chan, allow_weak_transients, &weak_transient, tone_freq, toneishness, st->arch);
    }
    toneishness = MIN32(toneishness, QCONST32(1.f, 29)-SHL32(tf_estimate, 15));
    /* Find pitch period and gain */
@@ -2027,7 +2229,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
       enabled = ((st->lfe&&nbAvailableBytes>3) || nbAvailableBytes>12*C) && !hybrid && !silence && tell+16<=total_bits && !st->disable_pf;
 
       prefilter_tapset = st->tapset_decision;
-      pf_on = run_prefilter(st, in, prefilter_mem, CC, N, prefilter_tapset, &pitch_index, &gain1, &qg, enabled, st->complexity, tf_estimate, nbAvailableBytes, &st->analysis, tone_freq, toneishness ARG_QEXT(qext_scale));
+      pf_on = run_prefilter(st, in, prefilter_mem, CC, N, prefilter_tapset, &pitch_index, &gain1, &qg, enabled, st->complexity, tf_estimate, nbAvailableBytes, &st->analysis, tone_freq, toneishness, hints ARG_QEXT(qext_scale));
       if ((gain1 > QCONST16(.4f,15) || st->prefilter_gain > QCONST16(.4f,15)) && (!st->analysis.valid || st->analysis.tonality > .3)
             && (pitch_index > 1.26*st->prefilter_period || pitch_index < .79*st->prefilter_period))
          pitch_change = 1;
@@ -2063,11 +2265,18 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    ALLOC(bandLogE,nbEBands*CC, celt_glog);
 
    secondMdct = shortBlocks && st->complexity>=8;
+   /* The front-end long MDCT is only valid if the prefilter did nothing. */
+   fe_mdct = fe != NULL && fe->has_mdct && gain1==0 && st->prefilter_gain==0;
    ALLOC(bandLogE2, C*nbEBands, celt_glog);
    if (secondMdct)
    {
-      compute_mdcts(mode, 0, in, freq, C, CC, LM, st->upsample, st->arch);
-      compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
+      if (fe_mdct)
+      {
+         OPUS_COPY(bandE, fe->bandE, C*nbEBands);
+      } else {
+         compute_mdcts(mode, 0, in, freq, C, CC, LM, st->upsample, st->arch);
+         compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
+      }
       amp2Log2(mode, effEnd, end, bandE, bandLogE2, C);
       for (c=0;c<C;c++)
       {
@@ -2076,13 +2285,19 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
       }
    }
 
-   compute_mdcts(mode, shortBlocks, in, freq, C, CC, LM, st->upsample, st->arch);
+   if (fe_mdct && !shortBlocks)
+   {
+      OPUS_COPY(freq, fe->freq, CC*N);
+      OPUS_COPY(bandE, fe->bandE, C*nbEBands);
+   } else {
+      compute_mdcts(mode, shortBlocks, in, freq, C, CC, LM, st->upsample, st->arch);
+      compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
+   }
    /* This should catch any NaN in the CELT input. Since we're not supposed to see any (they're filtered
       at the Opus layer), just abort. */
    celt_assert(!celt_isnan(freq[0]) && (C==1 || !celt_isnan(freq[N])));
    if (CC==2&&C==1)
       tf_chan = 0;
-   compute_band_energies(mode, freq, bandE, effEnd, C, LM, st->arch);
 
    if (st->lfe)
    {
@@ -2220,6 +2435,9 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
       }
    }
 
+   /* Keep the (long-block equivalent) band energies for CELT_GET_BAND_ENERGIES. */
+   OPUS_COPY(analysisE, bandLogE2, C*nbEBands);
+
    if (LM>0 && ec_tell(enc)+3<=total_bits)
       ec_enc_bit_logp(enc, isTransient, 3);
 
@@ -2240,11 +2458,17 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
 
    ALLOC(tf_res, nbEBands, int);
    /* Disable variable tf resolution for hybrid and at very low bitrate */
-   if (enable_tf_analysis)
+   if (enable_tf_analysis && hints != NULL && hints->transient == isTransient)
+   {
+      /* Reuse the tf resolution of the decoded frame */
+      for (i=start;i<end;i++)
+         tf_res[i] = hints->tf_res[i];
+      tf_select = hints->tf_select;
+   } else if (enable_tf_analysis)
    {
       int lambda;
       lambda = IMAX(80, 20480/effectiveBytes + 2);
-      tf_select = tf_analysis(mode, effEnd, isTransient, tf_res, lambda, X, N, LM, tf_estimate, tf_chan, importance);
+      tf_select = tf_analysis(mode, effEnd, isTransient, tf_res, lambda, X, N, LM, tf_estimate, tf_chan, importance, st->arch);
       for (i=effEnd;i<end;i++)
          tf_res[i] = tf_res[effEnd-1];
    } else if (hybrid && weak_transient)
@@ -2323,7 +2547,13 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
             st->tapset_decision = hysteresis_decision(st->analysis.tonality_slope, tapset_thresholds, tapset_histeresis, 2, st->tapset_decision);
          } else
 #endif
+         if (hints != NULL)
          {
+            /* Reuse the spreading and tapset decisions of the decoded frame */
+            st->spread_decision = hints->spread_decision;
+            if (hints->postfilter_period > 0)
+               st->tapset_decision = hints->postfilter_tapset;
+         } else {
             st->spread_decision = spreading_decision(mode, X,
                   &st->tonal_average, st->spread_decision, &st->hf_average,
                   &st->tapset_decision, pf_on&&!shortBlocks, effEnd, C, M, spread_weight);
@@ -2627,7 +2857,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_res * pcm, in
    {
       /* Don't bias for intra. */
       opus_val32 qext_delayedIntra=0;
-      qext_oldBandE = energyError + CC*nbEBands;
+      qext_oldBandE = analysisE + CC*nbEBands;
       compute_band_energies(qext_mode, freq, qext_bandE, qext_end, C, LM, st->arch);
       normalise_bands(qext_mode, freq, X, qext_bandE, qext_end, C, M);
       amp2Log2(qext_mode, qext_end, qext_end, qext_bandE, qext_bandLogE, C);
@@ -3108,6 +3338,36 @@ int opus_custom_encoder_ctl(CELTEncoder * OPUS_RESTRICT st, int request, ...)
             OPUS_COPY(&st->silk_info, info, 1);
       }
       break;
+      case CELT_SET_FRONT_END_REQUEST:
+      {
+         const CELTFrontEnd *value = va_arg(ap, const CELTFrontEnd*);
+         st->front_end = value;
+      }
+      break;
+      case CELT_SET_PARAM_HINTS_REQUEST:
+      {
+         const CELTParamHints *value = va_arg(ap, const CELTParamHints*);
+         st->param_hints = value;
+      }
+      break;
+      case CELT_GET_BAND_ENERGIES_REQUEST:
+      {
+         int i, c;
+         celt_glog *analysisE;
+         celt_glog *value = va_arg(ap, celt_glog*);
+         if (!value)
+            goto bad_arg;
+         analysisE = (celt_glog*)(st->in_mem+st->channels*(st->mode->overlap+QEXT_SCALE2(COMBFILTER_MAXPERIOD, st->qext_scale)))
+               + 4*st->channels*st->mode->nbEBands;
+         for (i=0;i<st->mode->nbEBands;i++)
+         {
+            value[i] = analysisE[i];
+            for (c=1;c<st->stream_channels;c++)
+               value[i] = MAXG(value[i], analysisE[c*st->mode->nbEBands+i]);
+            value[i] += SHL32((celt_glog)eMeans[i], DB_SHIFT-4);
+         }
+      }
+      break;
       case CELT_GET_MODE_REQUEST:
       {
          const CELTMode ** value = va_arg(ap, const CELTMode**);
@@ -45,18 +45,24 @@
 #define OPUS_ARCHMASK 7
 
 #elif defined(OPUS_HAVE_RTCD) && \
-  ((defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
+  (defined(OPUS_CLONE) || \
+  (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) || \
-  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)))
+  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)) || \
+  (defined(OPUS_X86_MAY_HAVE_AVX512) && !defined(OPUS_X86_PRESUME_AVX512)))
 
 #include "x86/x86cpu.h"
-/* We currently support 5 x86 variants:
+/* The x86-64 level clones (see src/opus_clones.h) presume all the SIMD
+ * levels their kernels need, but the states and their arch still come from
+ * the baseline build. */
+/* We currently support 6 x86 variants:
  * arch[0] -> non-sse
  * arch[1] -> sse
  * arch[2] -> sse2
  * arch[3] -> sse4.1
  * arch[4] -> avx
+ * arch[5] -> avx512 (F, BW, DQ and VL)
  */
 #define OPUS_ARCHMASK 7
 int opus_select_arch(void);
@@ -313,6 +313,18 @@ void celt_float2int16_c(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT ou
    }
 }
 
+int celt_float2int16_checkwithin1_c(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt)
+{
+   int i;
+   int within1 = 1;
+   for (i = 0; i < cnt; i++)
+   {
+      out[i] = FLOAT2INT16(in[i]);
+      within1 &= in[i] >= -1.f && in[i] <= 1.f;
+   }
+   return within1;
+}
+
 int opus_limit2_checkwithin1_c(float * samples, int cnt)
 {
    int i;
@@ -44,6 +44,10 @@
 #include "arm/mathops_arm.h"
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+#include "x86/mathops_sse.h"
+#endif
+
 #define PI 3.1415926535897931
 
 /* Multiplies two 16-bit fractional values. Bit-exactness of this macro is important */
@@ -657,6 +661,14 @@ int opus_limit2_checkwithin1_c(float *samples, int cnt);
 #define opus_limit2_checkwithin1(samples, cnt, arch) ((void)(arch), opus_limit2_checkwithin1_c(samples, cnt))
 #endif
 
+/* Same as celt_float2int16(), but also returns 1 if all the input samples
+   are within [-1,1] and 0 otherwise (including for NaNs). */
+int celt_float2int16_checkwithin1_c(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt);
+
+#ifndef OVERRIDE_FLOAT2INT16_CHECKWITHIN1
+#define celt_float2int16_checkwithin1(in, out, cnt, arch) ((void)(arch), celt_float2int16_checkwithin1_c(in, out, cnt))
+#endif
+
 #endif /* DISABLE_FLOAT_API */
 
 #endif /* MATHOPS_H */
@@ -702,6 +702,54 @@ void testcelt_float2int16(int use_ref_impl, int buffer_size)
 #undef MAX_BUFFER_SIZE
 }
 
+void testcelt_float2int16_checkwithin1(int use_ref_impl, int buffer_size)
+{
+#define MAX_BUFFER_SIZE 1031
+   int i, j, within1;
+   float in[MAX_BUFFER_SIZE];
+   short results[MAX_BUFFER_SIZE];
+   short expected[MAX_BUFFER_SIZE];
+   const int arch = opus_select_arch();
+   const float outliers[4] = { 1.0001f, -1.0001f, 3.f, -3.f };
+
+   celt_assert(buffer_size <= MAX_BUFFER_SIZE);
+
+   for (i = 0; i < buffer_size; ++i)
+   {
+      in[i] = ((i * 37) % 201 - 100) * .01f;
+      expected[i] = FLOAT2INT16(in[i]);
+   }
+
+   /* All values within -1..1 (including both bounds) */
+   within1 = use_ref_impl ? celt_float2int16_checkwithin1_c(in, results, buffer_size) : celt_float2int16_checkwithin1(in, results, buffer_size, arch);
+   if (!within1 || memcmp(results, expected, buffer_size * sizeof(short)) != 0)
+   {
+      fprintf (stderr, "celt_float2int16_checkwithin1() failed for values within -1..1 (cnt: %d, ref: %d)\n", buffer_size, use_ref_impl);
+      ret = 1;
+   }
+
+   /* One value outside -1..1 at every position: conversion unchanged, return value 0 */
+   for (j = 0; j < 4; ++j)
+   {
+      for (i = 0; i < buffer_size; ++i)
+      {
+         const float saved = in[i];
+         const short saved_expected = expected[i];
+         in[i] = outliers[j];
+         expected[i] = FLOAT2INT16(in[i]);
+         within1 = use_ref_impl ? celt_float2int16_checkwithin1_c(in, results, buffer_size) : celt_float2int16_checkwithin1(in, results, buffer_size, arch);
+         if (within1 || memcmp(results, expected, buffer_size * sizeof(short)) != 0)
+         {
+            fprintf (stderr, "celt_float2int16_checkwithin1() failed for %f (index: %d, cnt: %d, ref: %d)\n", outliers[j], i, buffer_size, use_ref_impl);
+            ret = 1;
+         }
+         in[i] = saved;
+         expected[i] = saved_expected;
+      }
+   }
+#undef MAX_BUFFER_SIZE
+}
+
 void testopus_limit2_checkwithin1(int use_ref_impl)
 {
 #define BUFFER_SIZE 37 /* strange float count to trigger residue loop of SIMD implementation */
@@ -806,6 +854,9 @@ int main(void)
       testcelt_float2int16(use_ref_impl[i], 32);
       testcelt_float2int16(use_ref_impl[i], 127);
       testcelt_float2int16(use_ref_impl[i], 1031);
+      testcelt_float2int16_checkwithin1(use_ref_impl[i], 1);
+      testcelt_float2int16_checkwithin1(use_ref_impl[i], 29);
+      testcelt_float2int16_checkwithin1(use_ref_impl[i], 1031);
       testopus_limit2_checkwithin1(use_ref_impl[i]);
    }
 #else
@@ -38,13 +38,14 @@
 #include "vq.h"
 #include "bands.h"
 #include "stack_alloc.h"
+#include "cpu_support.h"
 #include <math.h>
 
 
 #define MAX_SIZE 100
 
 int ret=0;
-void test_rotation(int N, int K)
+void test_rotation(int N, int K, int arch)
 {
    int i;
    double err = 0, ener = 0, snr, snr0;
@@ -52,7 +53,7 @@ void test_rotation(int N, int K)
    celt_norm x1[MAX_SIZE];
    for (i=0;i<N;i++)
       x1[i] = x0[i] = rand()%16777215-8388608;
-   exp_rotation(x1, N, 1, 1, K, SPREAD_NORMAL);
+   exp_rotation(x1, N, 1, 1, K, SPREAD_NORMAL, arch);
    for (i=0;i<N;i++)
    {
       err += (x0[i]-(double)x1[i])*(x0[i]-(double)x1[i]);
@@ -60,7 +61,7 @@ void test_rotation(int N, int K)
    }
    snr0 = 20*log10(ener/err);
    err = ener = 0;
-   exp_rotation(x1, N, -1, 1, K, SPREAD_NORMAL);
+   exp_rotation(x1, N, -1, 1, K, SPREAD_NORMAL, arch);
    for (i=0;i<N;i++)
    {
       err += (x0[i]-(double)x1[i])*(x0[i]-(double)x1[i]);
@@ -75,13 +76,61 @@ void test_rotation(int N, int K)
    }
 }
 
+/* The optimized versions must match the C code exactly, whatever the number of
+   blocks and the second stride. */
+void test_rotation_blocks(int len, int stride, int stride2, int dir, int arch)
+{
+   int i;
+   opus_val16 c, s;
+   double theta;
+   celt_norm x0[4*MAX_SIZE];
+   celt_norm x1[4*MAX_SIZE];
+   theta = .1 + 1.3*(rand()/(double)RAND_MAX);
+#ifdef FIXED_POINT
+   c = (opus_val16)floor(.5 + 32767*cos(theta));
+   s = (opus_val16)floor(.5 + 32767*sin(theta));
+#else
+   c = (opus_val16)cos(theta);
+   s = (opus_val16)sin(theta);
+#endif
+   for (i=0;i<len*stride;i++)
+      x1[i] = x0[i] = rand()%16777215-8388608;
+   exp_rotation_blocks_c(x0, len, stride, stride2, c, s, dir, arch);
+   exp_rotation_blocks(x1, len, stride, stride2, c, s, dir, arch);
+   for (i=0;i<len*stride;i++)
+   {
+      if (x0[i] != x1[i])
+      {
+         fprintf(stderr, "FAIL! Mismatch for %d blocks of size %d (stride2 %d, dir %d) at %d\n",
+               stride, len, stride2, dir, i);
+         ret = 1;
+         return;
+      }
+   }
+}
+
 int main(void)
 {
+   static const int strides[5] = {1, 2, 3, 4, 8};
+   int i, len, stride2;
+   int arch;
    ALLOC_STACK;
-   test_rotation(15, 3);
-   test_rotation(23, 5);
-   test_rotation(50, 3);
-   test_rotation(80, 1);
+   arch = opus_select_arch();
+   test_rotation(15, 3, arch);
+   test_rotation(23, 5, arch);
+   test_rotation(50, 3, arch);
+   test_rotation(80, 1, arch);
+   for (i=0;i<5;i++)
+   {
+      for (len=1;len<=4*MAX_SIZE/strides[i];len+=len<8?1:7)
+      {
+         for (stride2=0;stride2<=10 && stride2<len;stride2++)
+         {
+            test_rotation_blocks(len, strides[i], stride2, 1, arch);
+            test_rotation_blocks(len, strides[i], stride2, -1, arch);
+         }
+      }
+   }
    RESTORE_STACK;
    return ret;
 }
@@ -101,10 +101,29 @@ static void exp_rotation1(celt_norm *X, int len, int stride, opus_val16 c, opus_
 }
 #endif /* OVERRIDE_vq_exp_rotation1 */
 
-void exp_rotation(celt_norm *X, int len, int dir, int stride, int K, int spread)
+void exp_rotation_blocks_c(celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch)
 {
-   static const int SPREAD_FACTOR[3]={15,10,5};
    int i;
+   (void)arch;
+   for (i=0;i<stride;i++)
+   {
+      if (dir < 0)
+      {
+         if (stride2)
+            exp_rotation1(X+i*len, len, stride2, s, c);
+         exp_rotation1(X+i*len, len, 1, c, s);
+      } else {
+         exp_rotation1(X+i*len, len, 1, c, -s);
+         if (stride2)
+            exp_rotation1(X+i*len, len, stride2, s, -c);
+      }
+   }
+}
+
+void exp_rotation(celt_norm *X, int len, int dir, int stride, int K, int spread, int arch)
+{
+   static const int SPREAD_FACTOR[3]={15,10,5};
    opus_val16 c, s;
    opus_val16 gain, theta;
    int stride2=0;
@@ -131,19 +150,7 @@ void exp_rotation(celt_norm *X, int len, int dir, int stride, int K, int spread)
    /*NOTE: As a minor optimization, we could be passing around log2(B), not B, for both this and for
       extract_collapse_mask().*/
    len = celt_udiv(len, stride);
-   for (i=0;i<stride;i++)
-   {
-      if (dir < 0)
-      {
-         if (stride2)
-            exp_rotation1(X+i*len, len, stride2, s, c);
-         exp_rotation1(X+i*len, len, 1, c, s);
-      } else {
-         exp_rotation1(X+i*len, len, 1, c, -s);
-         if (stride2)
-            exp_rotation1(X+i*len, len, stride2, s, -c);
-      }
-   }
+   exp_rotation_blocks(X, len, stride, stride2, c, s, dir, arch);
 }
 
 /** Normalizes the decoded integer pvq codeword to unit norm. */
@@ -565,7 +572,7 @@ unsigned alg_quant(celt_norm *X, int N, int K, int spread, int B, ec_enc *enc,
    /* Covers vectorization by up to 4. */
    ALLOC(iy, N+3, int);
 
-   exp_rotation(X, N, 1, B, K, spread);
+   exp_rotation(X, N, 1, B, K, spread, arch);
 
 #ifdef ENABLE_QEXT
    if (N==2 && extra_bits >= 2) {
@@ -608,7 +615,7 @@ unsigned alg_quant(celt_norm *X, int N, int K, int spread, int B, ec_enc *enc,
    }
 
    if (resynth)
-      exp_rotation(X, N, -1, B, K, spread);
+      exp_rotation(X, N, -1, B, K, spread, arch);
 
    RESTORE_STACK;
    return collapse_mask;
@@ -618,7 +625,7 @@ unsigned alg_quant(celt_norm *X, int N, int K, int spread, int B, ec_enc *enc,
     the final normalised signal in the current band. */
 unsigned alg_unquant(celt_norm *X, int N, int K, int spread, int B,
       ec_dec *dec, opus_val32 gain
-      ARG_QEXT(ec_enc *ext_dec) ARG_QEXT(int extra_bits))
+      ARG_QEXT(ec_enc *ext_dec) ARG_QEXT(int extra_bits), int arch)
 {
    opus_val32 Ryy;
    unsigned collapse_mask;
@@ -683,7 +690,7 @@ unsigned alg_unquant(celt_norm *X, int N, int K, int spread, int B,
    }
 #endif
    normalise_residual(iy, X, N, Ryy, gain, yy_shift);
-   exp_rotation(X, N, -1, B, K, spread);
+   exp_rotation(X, N, -1, B, K, spread, arch);
    collapse_mask = extract_collapse_mask(iy, N, B);
    RESTORE_STACK;
    return collapse_mask;
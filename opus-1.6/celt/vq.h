@@ -55,7 +55,18 @@ void norm_scaledown(celt_norm *X, int N, int shift);
 #define norm_scaledown(X, N, shift)
 #endif
 
-void exp_rotation(celt_norm *X, int len, int dir, int stride, int K, int spread);
+void exp_rotation(celt_norm *X, int len, int dir, int stride, int K, int spread, int arch);
+
+/* Applies the spreading rotation to each of the stride consecutive blocks of
+   len samples. The blocks are independent of each other, so SIMD versions can
+   rotate several of them at once. */
+void exp_rotation_blocks_c(celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch);
+
+#if !defined(OVERRIDE_EXP_ROTATION_BLOCKS)
+#define exp_rotation_blocks(X, len, stride, stride2, c, s, dir, arch) \
+    (exp_rotation_blocks_c(X, len, stride, stride2, c, s, dir, arch))
+#endif
 
 opus_val16 op_pvq_search_c(celt_norm *X, int *iy, int K, int N, int arch);
 
@@ -86,7 +97,7 @@ unsigned alg_quant(celt_norm *X, int N, int K, int spread, int B, ec_enc *enc,
  */
 unsigned alg_unquant(celt_norm *X, int N, int K, int spread, int B,
       ec_dec *dec, opus_val32 gain
-      ARG_QEXT(ec_enc *ext_dec) ARG_QEXT(int extra_bits));
+      ARG_QEXT(ec_enc *ext_dec) ARG_QEXT(int extra_bits), int arch);
 
 void renormalise_vector(celt_norm *X, int N, opus_val32 gain, int arch);
 
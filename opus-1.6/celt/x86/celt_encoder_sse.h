@@ -0,0 +1,68 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CELT_ENCODER_SSE_H
+#define CELT_ENCODER_SSE_H
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(FIXED_POINT)
+
+void tf_l1_metrics_sse2(const celt_norm *X, int N, int K, opus_val32 *L1);
+
+void transient_energy_sse2(const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE);
+
+#if defined(OPUS_X86_PRESUME_SSE2)
+
+#define OVERRIDE_TF_L1_METRICS
+#define tf_l1_metrics(X, N, K, L1, arch) \
+    ((void)(arch), tf_l1_metrics_sse2(X, N, K, L1))
+
+#define OVERRIDE_TRANSIENT_ENERGY
+#define transient_energy(in, len, C, forward_decay, tmp, mean, maxE, arch) \
+    ((void)(arch), transient_energy_sse2(in, len, C, forward_decay, tmp, mean, maxE))
+
+#elif defined(OPUS_HAVE_RTCD)
+
+#define OVERRIDE_TF_L1_METRICS
+extern void (*const TF_L1_METRICS_IMPL[OPUS_ARCHMASK + 1])(
+      const celt_norm *X, int N, int K, opus_val32 *L1);
+
+#define tf_l1_metrics(X, N, K, L1, arch) \
+    ((*TF_L1_METRICS_IMPL[(arch) & OPUS_ARCHMASK])(X, N, K, L1))
+
+#define OVERRIDE_TRANSIENT_ENERGY
+extern void (*const TRANSIENT_ENERGY_IMPL[OPUS_ARCHMASK + 1])(
+      const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE);
+
+#define transient_energy(in, len, C, forward_decay, tmp, mean, maxE, arch) \
+    ((*TRANSIENT_ENERGY_IMPL[(arch) & OPUS_ARCHMASK])(in, len, C, forward_decay, tmp, mean, maxE))
+
+#endif
+
+#endif
+
+#endif
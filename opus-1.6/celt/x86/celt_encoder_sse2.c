@@ -0,0 +1,167 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include "celt.h"
+#include "stack_alloc.h"
+#include "mathops.h"
+#include "x86cpu.h"
+
+#ifndef FIXED_POINT
+
+/* Adds the absolute values of four consecutive coefficients from each of
+   four rows to the row sums in acc, one coefficient at a time. */
+static OPUS_INLINE __m128 l1_accum4(__m128 acc, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+{
+   const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+   _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+   acc = _mm_add_ps(acc, _mm_and_ps(r0, abs_mask));
+   acc = _mm_add_ps(acc, _mm_and_ps(r1, abs_mask));
+   acc = _mm_add_ps(acc, _mm_and_ps(r2, abs_mask));
+   acc = _mm_add_ps(acc, _mm_and_ps(r3, abs_mask));
+   return acc;
+}
+
+/* Each row gets its own lane so that every sum is accumulated in the same
+   order as in the C version and the tf decisions do not change. Up to eight
+   rows are handled per pass, in two independent groups of four. */
+void tf_l1_metrics_sse2(const celt_norm *X, int N, int K, opus_val32 *L1)
+{
+   int i, k, j;
+   const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+   for (k=0;k<K;k+=8)
+   {
+      const float *x[8];
+      float sum[8];
+      __m128 acc0, acc1;
+      /* Rows past K repeat the last one and their sums are discarded. */
+      for (j=0;j<8;j++)
+         x[j] = X + IMIN(k+j, K-1)*N;
+      acc0 = _mm_setzero_ps();
+      acc1 = _mm_setzero_ps();
+      if (K-k > 4)
+      {
+         for (i=0;i<N-3;i+=4)
+         {
+            acc0 = l1_accum4(acc0, _mm_loadu_ps(x[0]+i), _mm_loadu_ps(x[1]+i),
+                  _mm_loadu_ps(x[2]+i), _mm_loadu_ps(x[3]+i));
+            acc1 = l1_accum4(acc1, _mm_loadu_ps(x[4]+i), _mm_loadu_ps(x[5]+i),
+                  _mm_loadu_ps(x[6]+i), _mm_loadu_ps(x[7]+i));
+         }
+      } else {
+         for (i=0;i<N-3;i+=4)
+         {
+            acc0 = l1_accum4(acc0, _mm_loadu_ps(x[0]+i), _mm_loadu_ps(x[1]+i),
+                  _mm_loadu_ps(x[2]+i), _mm_loadu_ps(x[3]+i));
+         }
+      }
+      for (;i<N;i++)
+      {
+         acc0 = _mm_add_ps(acc0, _mm_and_ps(_mm_setr_ps(x[0][i], x[1][i], x[2][i], x[3][i]), abs_mask));
+         acc1 = _mm_add_ps(acc1, _mm_and_ps(_mm_setr_ps(x[4][i], x[5][i], x[6][i], x[7][i]), abs_mask));
+      }
+      _mm_storeu_ps(sum, acc0);
+      _mm_storeu_ps(sum+4, acc1);
+      for (j=0;j<IMIN(8, K-k);j++)
+         L1[k+j] = sum[j];
+   }
+}
+
+/* Stereo runs both channels in the low two lanes; the filters are recursive,
+   so mono has nothing to gain and uses the C version. */
+void transient_energy_sse2(const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE)
+{
+   int i;
+   int len2;
+   __m128 mem0, mem1, fmem, sum, m;
+   __m128 half, fdecay, fdecay1, bdecay, bgain;
+   VARDECL(float, e);
+   SAVE_STACK;
+   if (C != 2)
+   {
+      transient_energy_c(in, len, C, forward_decay, tmp, mean, maxE);
+      RESTORE_STACK;
+      return;
+   }
+   len2 = len/2;
+   ALLOC(e, 2*len2, float);
+   half = _mm_set1_ps(.5f);
+   fdecay = _mm_set1_ps(forward_decay);
+   fdecay1 = _mm_set1_ps(1.f-forward_decay);
+   bdecay = _mm_set1_ps(0.875f);
+   bgain = _mm_set1_ps(0.125f);
+   mem0 = _mm_setzero_ps();
+   mem1 = _mm_setzero_ps();
+   fmem = _mm_setzero_ps();
+   sum = _mm_setzero_ps();
+   for (i=0;i<len2;i++)
+   {
+      __m128 x, x0, x1, y0, y1, mem00, x2;
+      /* [left 2i, right 2i, left 2i+1, right 2i+1] */
+      x = _mm_unpacklo_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(in+2*i)),
+                          _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(in+len+2*i)));
+      x0 = x;
+      x1 = _mm_movehl_ps(x, x);
+      y0 = _mm_add_ps(mem0, x0);
+      mem00 = mem0;
+      mem0 = _mm_add_ps(_mm_sub_ps(mem0, x0), _mm_mul_ps(half, mem1));
+      mem1 = _mm_sub_ps(x0, mem00);
+      y1 = _mm_add_ps(mem0, x1);
+      mem00 = mem0;
+      mem0 = _mm_add_ps(_mm_sub_ps(mem0, x1), _mm_mul_ps(half, mem1));
+      mem1 = _mm_sub_ps(x1, mem00);
+      if (i<6)
+         y0 = y1 = _mm_setzero_ps();
+      x2 = _mm_add_ps(_mm_mul_ps(y0, y0), _mm_mul_ps(y1, y1));
+      sum = _mm_add_ps(sum, x2);
+      fmem = _mm_add_ps(x2, _mm_mul_ps(fdecay1, fmem));
+      _mm_storel_pi((__m64*)(e+2*i), _mm_mul_ps(fdecay, fmem));
+   }
+   mem0 = _mm_setzero_ps();
+   m = _mm_setzero_ps();
+   for (i=len2-1;i>=0;i--)
+   {
+      __m128 out;
+      mem0 = _mm_add_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(e+2*i)), _mm_mul_ps(bdecay, mem0));
+      out = _mm_mul_ps(bgain, mem0);
+      m = _mm_max_ps(m, out);
+      _mm_store_ss(tmp+i, out);
+      _mm_store_ss(tmp+len2+i, _mm_shuffle_ps(out, out, _MM_SHUFFLE(1, 1, 1, 1)));
+   }
+   _mm_store_ss(mean, sum);
+   _mm_store_ss(mean+1, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+   _mm_store_ss(maxE, m);
+   _mm_store_ss(maxE+1, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+   RESTORE_STACK;
+}
+
+#endif
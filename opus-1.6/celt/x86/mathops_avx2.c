@@ -0,0 +1,117 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "arch.h"
+#include "mathops.h"
+#include "float_cast.h"
+#include "x86cpu.h"
+
+#ifndef DISABLE_FLOAT_API
+
+/* See mathops_sse2.c for the operand order. The pack works within each
+   128-bit lane, so the 64-bit blocks are put back in order afterwards. */
+static OPUS_INLINE __m256i float2int16_x16(const float *in, __m256 scale, __m256 lo, __m256 hi)
+{
+   __m256 a, b;
+   a = _mm256_mul_ps(_mm256_loadu_ps(in), scale);
+   b = _mm256_mul_ps(_mm256_loadu_ps(in + 8), scale);
+   a = _mm256_min_ps(_mm256_max_ps(a, lo), hi);
+   b = _mm256_min_ps(_mm256_max_ps(b, lo), hi);
+   return _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b)), 0xd8);
+}
+
+static OPUS_INLINE __m256 within1_x8(__m256 x)
+{
+   return _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-1.f), _CMP_GE_OQ),
+                        _mm256_cmp_ps(x, _mm256_set1_ps(1.f), _CMP_LE_OQ));
+}
+
+void celt_float2int16_avx2(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt)
+{
+   int i;
+   const __m256 scale = _mm256_set1_ps(CELT_SIG_SCALE);
+   const __m256 lo = _mm256_set1_ps(-32768.f);
+   const __m256 hi = _mm256_set1_ps(32767.f);
+   for (i = 0; i < cnt - 15; i += 16)
+      _mm256_storeu_si256((__m256i *)(void *)&out[i], float2int16_x16(&in[i], scale, lo, hi));
+   for (; i < cnt; i++)
+      out[i] = FLOAT2INT16(in[i]);
+}
+
+int celt_float2int16_checkwithin1_avx2(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt)
+{
+   int i;
+   int within1;
+   const __m256 scale = _mm256_set1_ps(CELT_SIG_SCALE);
+   const __m256 lo = _mm256_set1_ps(-32768.f);
+   const __m256 hi = _mm256_set1_ps(32767.f);
+   __m256 ok = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+   for (i = 0; i < cnt - 15; i += 16)
+   {
+      ok = _mm256_and_ps(ok, within1_x8(_mm256_loadu_ps(&in[i])));
+      ok = _mm256_and_ps(ok, within1_x8(_mm256_loadu_ps(&in[i + 8])));
+      _mm256_storeu_si256((__m256i *)(void *)&out[i], float2int16_x16(&in[i], scale, lo, hi));
+   }
+   within1 = _mm256_movemask_ps(ok) == 0xff;
+   for (; i < cnt; i++)
+   {
+      out[i] = FLOAT2INT16(in[i]);
+      within1 &= in[i] >= -1.f && in[i] <= 1.f;
+   }
+   return within1;
+}
+
+int opus_limit2_checkwithin1_avx2(float *samples, int cnt)
+{
+   int i;
+   int within1;
+   const __m256 two = _mm256_set1_ps(2.f);
+   const __m256 minus_two = _mm256_set1_ps(-2.f);
+   __m256 ok = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+   for (i = 0; i < cnt - 15; i += 16)
+   {
+      __m256 a = _mm256_min_ps(two, _mm256_max_ps(minus_two, _mm256_loadu_ps(&samples[i])));
+      __m256 b = _mm256_min_ps(two, _mm256_max_ps(minus_two, _mm256_loadu_ps(&samples[i + 8])));
+      ok = _mm256_and_ps(ok, _mm256_and_ps(within1_x8(a), within1_x8(b)));
+      _mm256_storeu_ps(&samples[i], a);
+      _mm256_storeu_ps(&samples[i + 8], b);
+   }
+   within1 = _mm256_movemask_ps(ok) == 0xff;
+   for (; i < cnt; i++)
+   {
+      float x = FMIN(2.f, FMAX(-2.f, samples[i]));
+      samples[i] = x;
+      within1 &= x >= -1.f && x <= 1.f;
+   }
+   return within1;
+}
+
+#endif
@@ -0,0 +1,122 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#include "arch.h"
+#include "mathops.h"
+#include "float_cast.h"
+#include "x86cpu.h"
+
+#ifndef DISABLE_FLOAT_API
+
+/* Both FLOAT2INT16() and these kernels clamp with the sample as the first
+   operand of the comparison, so that a NaN ends up as -32768 either way, and
+   round to nearest like float2int(). */
+static OPUS_INLINE __m128i float2int16_x8(const float *in, __m128 scale, __m128 lo, __m128 hi)
+{
+   __m128 a, b;
+   a = _mm_mul_ps(_mm_loadu_ps(in), scale);
+   b = _mm_mul_ps(_mm_loadu_ps(in + 4), scale);
+   a = _mm_min_ps(_mm_max_ps(a, lo), hi);
+   b = _mm_min_ps(_mm_max_ps(b, lo), hi);
+   return _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+}
+
+void celt_float2int16_sse2(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt)
+{
+   int i;
+   const __m128 scale = _mm_set1_ps(CELT_SIG_SCALE);
+   const __m128 lo = _mm_set1_ps(-32768.f);
+   const __m128 hi = _mm_set1_ps(32767.f);
+   for (i = 0; i < cnt - 7; i += 8)
+      _mm_storeu_si128((__m128i *)(void *)&out[i], float2int16_x8(&in[i], scale, lo, hi));
+   for (; i < cnt; i++)
+      out[i] = FLOAT2INT16(in[i]);
+}
+
+int celt_float2int16_checkwithin1_sse2(const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt)
+{
+   int i;
+   int within1;
+   const __m128 scale = _mm_set1_ps(CELT_SIG_SCALE);
+   const __m128 lo = _mm_set1_ps(-32768.f);
+   const __m128 hi = _mm_set1_ps(32767.f);
+   const __m128 one = _mm_set1_ps(1.f);
+   const __m128 minus_one = _mm_set1_ps(-1.f);
+   __m128 ok = _mm_castsi128_ps(_mm_set1_epi32(-1));
+   for (i = 0; i < cnt - 7; i += 8)
+   {
+      __m128 a = _mm_loadu_ps(&in[i]);
+      __m128 b = _mm_loadu_ps(&in[i + 4]);
+      /* Ordered comparisons, so that NaNs are out of range. */
+      ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(a, minus_one), _mm_cmple_ps(a, one)));
+      ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(b, minus_one), _mm_cmple_ps(b, one)));
+      _mm_storeu_si128((__m128i *)(void *)&out[i], float2int16_x8(&in[i], scale, lo, hi));
+   }
+   within1 = _mm_movemask_ps(ok) == 0xf;
+   for (; i < cnt; i++)
+   {
+      out[i] = FLOAT2INT16(in[i]);
+      within1 &= in[i] >= -1.f && in[i] <= 1.f;
+   }
+   return within1;
+}
+
+int opus_limit2_checkwithin1_sse2(float *samples, int cnt)
+{
+   int i;
+   int within1;
+   const __m128 two = _mm_set1_ps(2.f);
+   const __m128 minus_two = _mm_set1_ps(-2.f);
+   const __m128 one = _mm_set1_ps(1.f);
+   const __m128 minus_one = _mm_set1_ps(-1.f);
+   __m128 ok = _mm_castsi128_ps(_mm_set1_epi32(-1));
+   for (i = 0; i < cnt - 7; i += 8)
+   {
+      /* Same operand order as FMIN(2, FMAX(-2, x)), which keeps NaNs. */
+      __m128 a = _mm_min_ps(two, _mm_max_ps(minus_two, _mm_loadu_ps(&samples[i])));
+      __m128 b = _mm_min_ps(two, _mm_max_ps(minus_two, _mm_loadu_ps(&samples[i + 4])));
+      ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(a, minus_one), _mm_cmple_ps(a, one)));
+      ok = _mm_and_ps(ok, _mm_and_ps(_mm_cmpge_ps(b, minus_one), _mm_cmple_ps(b, one)));
+      _mm_storeu_ps(&samples[i], a);
+      _mm_storeu_ps(&samples[i + 4], b);
+   }
+   within1 = _mm_movemask_ps(ok) == 0xf;
+   for (; i < cnt; i++)
+   {
+      float x = FMIN(2.f, FMAX(-2.f, samples[i]));
+      samples[i] = x;
+      within1 &= x >= -1.f && x <= 1.f;
+   }
+   return within1;
+}
+
+#endif
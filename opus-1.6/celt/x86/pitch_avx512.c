@@ -0,0 +1,273 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "arch.h"
+#include "x86cpu.h"
+#include "pitch.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+
+/* Only celt_pitch_xcorr() uses 512-bit vectors. It runs for thousands of
+   cycles at a time, which amortizes the lower clock some CPUs switch to for
+   them. The other kernels here are short and use the 256-bit AVX-512VL forms
+   instead, mostly for the masked loads and stores that replace the scalar
+   tails, so they run at the same clock as the AVX2 code. */
+
+/* Lanes [0, n) of a 16-lane vector. */
+static OPUS_INLINE __mmask16 lanes16(int n)
+{
+   return n >= 16 ? (__mmask16)0xffff : n <= 0 ? (__mmask16)0 : (__mmask16)((1u<<n) - 1);
+}
+
+/* Lanes [0, n) of an 8-lane vector. */
+static OPUS_INLINE __mmask8 lanes8(int n)
+{
+   return n >= 8 ? (__mmask8)0xff : n <= 0 ? (__mmask8)0 : (__mmask8)((1u<<n) - 1);
+}
+
+#ifdef FIXED_POINT
+
+/* Lanes [0, n) of a 32-lane vector. */
+static OPUS_INLINE __mmask32 lanes32(int n)
+{
+   return n >= 32 ? (__mmask32)0xffffffff : n <= 0 ? (__mmask32)0 : (__mmask32)((1u<<n) - 1);
+}
+
+/* Each lane holds one lag. 32 lags are computed at a time, the even ones in
+   one vector and the odd ones in another, so that each 32-bit lane of a y
+   load holds the two samples to multiply with the same pair of x samples. */
+opus_val32 celt_pitch_xcorr_avx512(const opus_val16 *_x, const opus_val16 *_y,
+      opus_val32 *xcorr, int len, int max_pitch, int arch)
+{
+   int i, j;
+   __m512i maxcorr;
+   const __m512i lo_idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+   const __m512i hi_idx = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+   celt_assert(max_pitch>0);
+   (void)arch;
+   maxcorr = _mm512_set1_epi32(1);
+   for (i=0;i<max_pitch;i+=32)
+   {
+      int n;
+      __mmask32 even_mask, odd_mask;
+      __m512i even, odd, lo, hi;
+      n = max_pitch - i;
+      /* The 16-bit y samples the valid lags need. */
+      even_mask = lanes32(2*((n+1)>>1));
+      odd_mask = lanes32(2*(n>>1));
+      even = odd = _mm512_setzero_si512();
+      for (j=0;j<len-1;j+=2)
+      {
+         __m512i x2;
+         x2 = _mm512_set1_epi32((opus_uint16)_x[j] | ((opus_uint32)(opus_uint16)_x[j+1]<<16));
+         even = _mm512_add_epi32(even, _mm512_madd_epi16(x2, _mm512_maskz_loadu_epi16(even_mask, _y+i+j)));
+         odd = _mm512_add_epi32(odd, _mm512_madd_epi16(x2, _mm512_maskz_loadu_epi16(odd_mask, _y+i+j+1)));
+      }
+      if (j<len)
+      {
+         /* Only the first sample of each pair is loaded, as the second one
+            could be past the end of y. */
+         __m512i x2;
+         x2 = _mm512_set1_epi32((opus_uint16)_x[j]);
+         even = _mm512_add_epi32(even, _mm512_madd_epi16(x2, _mm512_maskz_loadu_epi16(even_mask&0x55555555, _y+i+j)));
+         odd = _mm512_add_epi32(odd, _mm512_madd_epi16(x2, _mm512_maskz_loadu_epi16(odd_mask&0x55555555, _y+i+j+1)));
+      }
+      lo = _mm512_permutex2var_epi32(even, lo_idx, odd);
+      hi = _mm512_permutex2var_epi32(even, hi_idx, odd);
+      _mm512_mask_storeu_epi32(xcorr+i, lanes16(n), lo);
+      _mm512_mask_storeu_epi32(xcorr+i+16, lanes16(n-16), hi);
+      maxcorr = _mm512_mask_max_epi32(maxcorr, lanes16(n), maxcorr, lo);
+      maxcorr = _mm512_mask_max_epi32(maxcorr, lanes16(n-16), maxcorr, hi);
+   }
+   return _mm512_reduce_max_epi32(maxcorr);
+}
+
+opus_val32 celt_inner_prod_avx512(const opus_int16 *x, const opus_int16 *y,
+      int N)
+{
+   int i;
+   __m256i sum0, sum1;
+   __m128i sum;
+   sum0 = sum1 = _mm256_setzero_si256();
+   for (i=0;i<N-31;i+=32)
+   {
+      sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(
+            _mm256_loadu_si256((const __m256i *)(const void *)(x+i)),
+            _mm256_loadu_si256((const __m256i *)(const void *)(y+i))));
+      sum1 = _mm256_add_epi32(sum1, _mm256_madd_epi16(
+            _mm256_loadu_si256((const __m256i *)(const void *)(x+i+16)),
+            _mm256_loadu_si256((const __m256i *)(const void *)(y+i+16))));
+   }
+   for (;i<N;i+=16)
+   {
+      __mmask16 m = lanes16(N-i);
+      sum0 = _mm256_add_epi32(sum0, _mm256_madd_epi16(
+            _mm256_maskz_loadu_epi16(m, x+i), _mm256_maskz_loadu_epi16(m, y+i)));
+   }
+   sum0 = _mm256_add_epi32(sum0, sum1);
+   sum = _mm_add_epi32(_mm256_castsi256_si128(sum0), _mm256_extracti128_si256(sum0, 1));
+   sum = _mm_add_epi32(sum, _mm_unpackhi_epi64(sum, sum));
+   sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+   return _mm_cvtsi128_si32(sum);
+}
+
+#else
+
+static OPUS_INLINE float horizontal_sum(__m256 x)
+{
+   __m128 sum;
+   sum = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+   sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+   sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+   return _mm_cvtss_f32(sum);
+}
+
+/* Each lane holds one lag, so unlike xcorr_kernel() there is no horizontal
+   sum. 64 lags are computed at a time, with the odd and even x samples
+   accumulated separately to hide the FMA latency. */
+void celt_pitch_xcorr_avx512(const float *_x, const float *_y, float *xcorr,
+      int len, int max_pitch, int arch)
+{
+   int i, j;
+   celt_assert(max_pitch>0);
+   (void)arch;
+   for (i=0;i<max_pitch;i+=64)
+   {
+      int n;
+      __mmask16 m0, m1, m2, m3;
+      __m512 a0, a1, a2, a3;
+      __m512 b0, b1, b2, b3;
+      const float *y;
+      n = max_pitch - i;
+      m0 = lanes16(n);
+      m1 = lanes16(n-16);
+      m2 = lanes16(n-32);
+      m3 = lanes16(n-48);
+      a0 = a1 = a2 = a3 = _mm512_setzero_ps();
+      b0 = b1 = b2 = b3 = _mm512_setzero_ps();
+      y = _y+i;
+      for (j=0;j<len-1;j+=2)
+      {
+         __m512 x0, x1;
+         x0 = _mm512_set1_ps(_x[j]);
+         x1 = _mm512_set1_ps(_x[j+1]);
+         a0 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m0, y+j), a0);
+         a1 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m1, y+j+16), a1);
+         a2 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m2, y+j+32), a2);
+         a3 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m3, y+j+48), a3);
+         b0 = _mm512_fmadd_ps(x1, _mm512_maskz_loadu_ps(m0, y+j+1), b0);
+         b1 = _mm512_fmadd_ps(x1, _mm512_maskz_loadu_ps(m1, y+j+17), b1);
+         b2 = _mm512_fmadd_ps(x1, _mm512_maskz_loadu_ps(m2, y+j+33), b2);
+         b3 = _mm512_fmadd_ps(x1, _mm512_maskz_loadu_ps(m3, y+j+49), b3);
+      }
+      if (j<len)
+      {
+         __m512 x0;
+         x0 = _mm512_set1_ps(_x[j]);
+         a0 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m0, y+j), a0);
+         a1 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m1, y+j+16), a1);
+         a2 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m2, y+j+32), a2);
+         a3 = _mm512_fmadd_ps(x0, _mm512_maskz_loadu_ps(m3, y+j+48), a3);
+      }
+      _mm512_mask_storeu_ps(xcorr+i, m0, _mm512_add_ps(a0, b0));
+      _mm512_mask_storeu_ps(xcorr+i+16, m1, _mm512_add_ps(a1, b1));
+      _mm512_mask_storeu_ps(xcorr+i+32, m2, _mm512_add_ps(a2, b2));
+      _mm512_mask_storeu_ps(xcorr+i+48, m3, _mm512_add_ps(a3, b3));
+   }
+}
+
+opus_val32 celt_inner_prod_avx512(const opus_val16 *x, const opus_val16 *y,
+      int N)
+{
+   int i;
+   __m256 sum0, sum1;
+   sum0 = sum1 = _mm256_setzero_ps();
+   for (i=0;i<N-15;i+=16)
+   {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(x+i), _mm256_loadu_ps(y+i), sum0);
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(x+i+8), _mm256_loadu_ps(y+i+8), sum1);
+   }
+   for (;i<N;i+=8)
+   {
+      __mmask8 m = lanes8(N-i);
+      sum0 = _mm256_fmadd_ps(_mm256_maskz_loadu_ps(m, x+i), _mm256_maskz_loadu_ps(m, y+i), sum0);
+   }
+   return horizontal_sum(_mm256_add_ps(sum0, sum1));
+}
+
+void dual_inner_prod_avx512(const opus_val16 *x, const opus_val16 *y01, const opus_val16 *y02,
+      int N, opus_val32 *xy1, opus_val32 *xy2)
+{
+   int i;
+   __m256 sum1, sum2;
+   sum1 = sum2 = _mm256_setzero_ps();
+   for (i=0;i<N;i+=8)
+   {
+      __mmask8 m = lanes8(N-i);
+      __m256 xi = _mm256_maskz_loadu_ps(m, x+i);
+      sum1 = _mm256_fmadd_ps(xi, _mm256_maskz_loadu_ps(m, y01+i), sum1);
+      sum2 = _mm256_fmadd_ps(xi, _mm256_maskz_loadu_ps(m, y02+i), sum2);
+   }
+   *xy1 = horizontal_sum(sum1);
+   *xy2 = horizontal_sum(sum2);
+}
+
+/* Unaligned loads are cheap enough that the five taps are loaded directly
+   rather than shuffled as in the SSE version. With eight lanes, all the taps
+   are still behind the outputs when filtering in place, as T is at least
+   COMBFILTER_MINPERIOD. */
+void comb_filter_const_avx512(opus_val32 *y, opus_val32 *x, int T, int N,
+      opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+   int i;
+   __m256 g10v, g11v, g12v;
+   g10v = _mm256_set1_ps(g10);
+   g11v = _mm256_set1_ps(g11);
+   g12v = _mm256_set1_ps(g12);
+   for (i=0;i<N;i+=8)
+   {
+      __mmask8 m;
+      __m256 yi;
+      const opus_val32 *xp = &x[i-T-2];
+      m = lanes8(N-i);
+      yi = _mm256_maskz_loadu_ps(m, x+i);
+      yi = _mm256_fmadd_ps(g10v, _mm256_maskz_loadu_ps(m, xp+2), yi);
+      yi = _mm256_fmadd_ps(g11v, _mm256_add_ps(_mm256_maskz_loadu_ps(m, xp+3),
+                                               _mm256_maskz_loadu_ps(m, xp+1)), yi);
+      yi = _mm256_fmadd_ps(g12v, _mm256_add_ps(_mm256_maskz_loadu_ps(m, xp+4),
+                                               _mm256_maskz_loadu_ps(m, xp)), yi);
+      _mm256_mask_storeu_ps(y+i, m, yi);
+   }
+}
+
+#endif
+
+#endif
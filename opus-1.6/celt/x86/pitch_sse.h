@@ -77,6 +77,40 @@ extern void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
 
 #endif
 
+#if defined(OPUS_X86_MAY_HAVE_AVX512) && defined(FIXED_POINT)
+opus_val32 celt_pitch_xcorr_avx512(const opus_val16 *_x, const opus_val16 *_y,
+      opus_val32 *xcorr, int len, int max_pitch, int arch);
+
+#if defined(OPUS_X86_PRESUME_AVX512)
+
+#define OVERRIDE_PITCH_XCORR
+# define celt_pitch_xcorr celt_pitch_xcorr_avx512
+
+#elif defined(OPUS_HAVE_RTCD)
+
+#define OVERRIDE_PITCH_XCORR
+extern opus_val32 (*const PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
+              const opus_val16 *_x,
+              const opus_val16 *_y,
+              opus_val32 *xcorr,
+              int len,
+              int max_pitch,
+              int arch
+              );
+
+#define celt_pitch_xcorr(_x, _y, xcorr, len, max_pitch, arch) \
+    ((*PITCH_XCORR_IMPL[(arch) & OPUS_ARCHMASK])(_x, _y, xcorr, len, max_pitch, arch))
+
+#endif
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+opus_val32 celt_inner_prod_avx512(
+    const opus_val16 *x,
+    const opus_val16 *y,
+    int               N);
+#endif
+
 #if defined(OPUS_X86_MAY_HAVE_SSE4_1) && defined(FIXED_POINT)
 opus_val32 celt_inner_prod_sse4_1(
     const opus_int16 *x,
@@ -99,24 +133,30 @@ opus_val32 celt_inner_prod_sse(
 #endif
 
 
-#if defined(OPUS_X86_PRESUME_SSE4_1) && defined(FIXED_POINT)
+#if defined(OPUS_X86_PRESUME_AVX512)
+#define OVERRIDE_CELT_INNER_PROD
+#define celt_inner_prod(x, y, N, arch) \
+    ((void)arch, celt_inner_prod_avx512(x, y, N))
+
+#elif defined(OPUS_X86_PRESUME_SSE4_1) && defined(FIXED_POINT) && !defined(OPUS_X86_MAY_HAVE_AVX512)
 #define OVERRIDE_CELT_INNER_PROD
 #define celt_inner_prod(x, y, N, arch) \
     ((void)arch, celt_inner_prod_sse4_1(x, y, N))
 
-#elif defined(OPUS_X86_PRESUME_SSE2) && defined(FIXED_POINT) && !defined(OPUS_X86_MAY_HAVE_SSE4_1)
+#elif defined(OPUS_X86_PRESUME_SSE2) && defined(FIXED_POINT) && !defined(OPUS_X86_MAY_HAVE_SSE4_1) && \
+    !defined(OPUS_X86_MAY_HAVE_AVX512)
 #define OVERRIDE_CELT_INNER_PROD
 #define celt_inner_prod(x, y, N, arch) \
     ((void)arch, celt_inner_prod_sse2(x, y, N))
 
-#elif defined(OPUS_X86_PRESUME_SSE) && !defined(FIXED_POINT)
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(FIXED_POINT) && !defined(OPUS_X86_MAY_HAVE_AVX512)
 #define OVERRIDE_CELT_INNER_PROD
 #define celt_inner_prod(x, y, N, arch) \
     ((void)arch, celt_inner_prod_sse(x, y, N))
 
 
 #elif defined(OPUS_HAVE_RTCD) && (((defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_SSE2)) && defined(FIXED_POINT)) || \
-    (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)))
+    (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(FIXED_POINT)) || defined(OPUS_X86_MAY_HAVE_AVX512))
 
 extern opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
                     const opus_val16 *x,
@@ -146,8 +186,32 @@ void comb_filter_const_sse(opus_val32 *y,
     opus_val16  g11,
     opus_val16  g12);
 
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+void dual_inner_prod_avx512(const opus_val16 *x,
+    const opus_val16 *y01,
+    const opus_val16 *y02,
+    int               N,
+    opus_val32       *xy1,
+    opus_val32       *xy2);
+
+void comb_filter_const_avx512(opus_val32 *y,
+    opus_val32 *x,
+    int         T,
+    int         N,
+    opus_val16  g10,
+    opus_val16  g11,
+    opus_val16  g12);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX512)
+#define OVERRIDE_DUAL_INNER_PROD
+#define OVERRIDE_COMB_FILTER_CONST
+# define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
+    ((void)(arch),dual_inner_prod_avx512(x, y01, y02, N, xy1, xy2))
 
-#if defined(OPUS_X86_PRESUME_SSE)
+# define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+    ((void)(arch),comb_filter_const_avx512(y, x, T, N, g10, g11, g12))
+#elif defined(OPUS_X86_PRESUME_SSE) && !defined(OPUS_X86_MAY_HAVE_AVX512)
 #define OVERRIDE_DUAL_INNER_PROD
 #define OVERRIDE_COMB_FILTER_CONST
 # define dual_inner_prod(x, y01, y02, N, xy1, xy2, arch) \
@@ -187,8 +251,14 @@ extern void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
 #endif
 
 void celt_pitch_xcorr_avx2(const float *_x, const float *_y, float *xcorr, int len, int max_pitch, int arch);
+void celt_pitch_xcorr_avx512(const float *_x, const float *_y, float *xcorr, int len, int max_pitch, int arch);
+
+#if defined(OPUS_X86_PRESUME_AVX512)
+
+#define OVERRIDE_PITCH_XCORR
+# define celt_pitch_xcorr celt_pitch_xcorr_avx512
 
-#if defined(OPUS_X86_PRESUME_AVX2)
+#elif defined(OPUS_X86_PRESUME_AVX2) && !defined(OPUS_X86_MAY_HAVE_AVX512)
 
 #define OVERRIDE_PITCH_XCORR
 # define celt_pitch_xcorr celt_pitch_xcorr_avx2
@@ -209,7 +279,7 @@ extern void (*const PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
     ((*PITCH_XCORR_IMPL[(arch) & OPUS_ARCHMASK])(_x, _y, xcorr, len, max_pitch, arch))
 
 
-#endif /* OPUS_X86_PRESUME_AVX2 && !OPUS_HAVE_RTCD */
+#endif /* OPUS_X86_PRESUME_AVX512 && !OPUS_HAVE_RTCD */
 
 #endif /* OPUS_X86_MAY_HAVE_SSE && !FIXED_POINT */
 
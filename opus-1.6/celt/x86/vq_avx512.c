@@ -0,0 +1,223 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "celt_lpc.h"
+#include "stack_alloc.h"
+#include "mathops.h"
+#include "vq.h"
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX512) && !defined(FIXED_POINT)
+
+/* Lanes [0, n) of an 8-lane vector. */
+static OPUS_INLINE __mmask8 lanes8(int n)
+{
+   return n >= 8 ? (__mmask8)0xff : (__mmask8)((1u<<n) - 1);
+}
+
+static OPUS_INLINE float horizontal_sum(__m256 x)
+{
+   __m128 sum;
+   sum = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+   sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+   sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+   return _mm_cvtss_f32(sum);
+}
+
+/* Same algorithm as op_pvq_search_sse2(), on 256-bit AVX-512VL vectors. The
+   masked loads and stores take care of the end of the band, so nothing needs
+   to be padded. The search ranks the positions by (xy+X[j])^2/(yy+y[j]),
+   like the C version does, and picks the first of equal scores. */
+opus_val16 op_pvq_search_avx512(celt_norm *_X, int *iy, int K, int N, int arch)
+{
+   int i, j;
+   int pulsesLeft;
+   float xy, yy;
+   VARDECL(celt_norm, y);
+   VARDECL(celt_norm, X);
+   VARDECL(int, signy);
+   __m256 sums;
+   SAVE_STACK;
+
+   (void)arch;
+   ALLOC(y, N, celt_norm);
+   ALLOC(X, N, celt_norm);
+   ALLOC(signy, N, int);
+
+   sums = _mm256_setzero_ps();
+   for (j=0;j<N;j+=8)
+   {
+      __mmask8 m;
+      __m256 x8;
+      m = lanes8(N-j);
+      x8 = _mm256_maskz_loadu_ps(m, &_X[j]);
+      _mm256_mask_storeu_epi32(&signy[j], m,
+            _mm256_movm_epi32(_mm256_cmp_ps_mask(x8, _mm256_setzero_ps(), _CMP_LT_OQ)));
+      /* Get rid of the sign */
+      x8 = _mm256_andnot_ps(_mm256_set1_ps(-0.f), x8);
+      sums = _mm256_add_ps(sums, x8);
+      /* Clear y and iy in case we don't do the projection. */
+      _mm256_mask_storeu_ps(&y[j], m, _mm256_setzero_ps());
+      _mm256_mask_storeu_epi32(&iy[j], m, _mm256_setzero_si256());
+      _mm256_mask_storeu_ps(&X[j], m, x8);
+   }
+
+   xy = yy = 0;
+
+   pulsesLeft = K;
+
+   /* Do a pre-search by projecting on the pyramid */
+   if (K > (N>>1))
+   {
+      __m256i pulses_sum;
+      __m128i pulses4;
+      __m256 yy8, xy8;
+      __m256 rcp8;
+      opus_val32 sum = horizontal_sum(sums);
+      /* If X is too small, just replace it with a pulse at 0 */
+      /* Prevents infinities and NaNs from causing too many pulses
+         to be allocated. 64 is an approximation of infinity here. */
+      if (!(sum > EPSILON && sum < 64))
+      {
+         X[0] = QCONST16(1.f,14);
+         j=1; do
+            X[j]=0;
+         while (++j<N);
+         sum = QCONST16(1.f,14);
+      }
+      /* Using K+e with e < 1 guarantees we cannot get more than K pulses. */
+      rcp8 = _mm256_set1_ps((K+0.8f)*celt_rcp(sum));
+      xy8 = yy8 = _mm256_setzero_ps();
+      pulses_sum = _mm256_setzero_si256();
+      for (j=0;j<N;j+=8)
+      {
+         __mmask8 m;
+         __m256 x8, y8;
+         __m256i iy8;
+         m = lanes8(N-j);
+         x8 = _mm256_maskz_loadu_ps(m, &X[j]);
+         iy8 = _mm256_cvttps_epi32(_mm256_mul_ps(x8, rcp8));
+         pulses_sum = _mm256_add_epi32(pulses_sum, iy8);
+         _mm256_mask_storeu_epi32(&iy[j], m, iy8);
+         y8 = _mm256_cvtepi32_ps(iy8);
+         xy8 = _mm256_fmadd_ps(x8, y8, xy8);
+         yy8 = _mm256_fmadd_ps(y8, y8, yy8);
+         /* double the y[] vector so we don't have to do it in the search loop. */
+         _mm256_mask_storeu_ps(&y[j], m, _mm256_add_ps(y8, y8));
+      }
+      pulses4 = _mm_add_epi32(_mm256_castsi256_si128(pulses_sum), _mm256_extracti128_si256(pulses_sum, 1));
+      pulses4 = _mm_add_epi32(pulses4, _mm_shuffle_epi32(pulses4, _MM_SHUFFLE(1, 0, 3, 2)));
+      pulses4 = _mm_add_epi32(pulses4, _mm_shuffle_epi32(pulses4, _MM_SHUFFLE(2, 3, 0, 1)));
+      pulsesLeft -= _mm_cvtsi128_si32(pulses4);
+      xy = horizontal_sum(xy8);
+      yy = horizontal_sum(yy8);
+   }
+   celt_sig_assert(pulsesLeft>=0);
+
+   /* This should never happen, but just in case it does (e.g. on silence)
+      we fill the first bin with pulses. */
+   if (pulsesLeft > N+3)
+   {
+      opus_val16 tmp = (opus_val16)pulsesLeft;
+      yy = MAC16_16(yy, tmp, tmp);
+      yy = MAC16_16(yy, tmp, y[0]);
+      iy[0] += pulsesLeft;
+      pulsesLeft=0;
+   }
+
+   for (i=0;i<pulsesLeft;i++)
+   {
+      int best_id;
+      __m256 xy8, yy8;
+      __m256 best, best_all;
+      __m256i pos, count;
+      __m128i pos4;
+      /* The squared magnitude term gets added anyway, so we might as well
+         add it outside the loop */
+      yy = ADD16(yy, 1);
+      xy8 = _mm256_set1_ps(xy);
+      yy8 = _mm256_set1_ps(yy);
+      best = _mm256_setzero_ps();
+      pos = _mm256_setzero_si256();
+      count = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      for (j=0;j<N;j+=8)
+      {
+         __mmask8 m;
+         __m256 x8, y8, r8;
+         m = lanes8(N-j);
+         x8 = _mm256_add_ps(_mm256_maskz_loadu_ps(m, &X[j]), xy8);
+         y8 = _mm256_add_ps(_mm256_maskz_loadu_ps(m, &y[j]), yy8);
+         r8 = _mm256_div_ps(_mm256_mul_ps(x8, x8), y8);
+         /* Only strictly better scores move the position, so each lane keeps
+            the first of its best. */
+         m = _mm256_mask_cmp_ps_mask(m, r8, best, _CMP_GT_OQ);
+         pos = _mm256_mask_mov_epi32(pos, m, count);
+         best = _mm256_mask_mov_ps(best, m, r8);
+         count = _mm256_add_epi32(count, _mm256_set1_epi32(8));
+      }
+      /* Horizontal max */
+      best_all = _mm256_max_ps(best, _mm256_permute2f128_ps(best, best, 1));
+      best_all = _mm256_max_ps(best_all, _mm256_shuffle_ps(best_all, best_all, _MM_SHUFFLE(1, 0, 3, 2)));
+      best_all = _mm256_max_ps(best_all, _mm256_shuffle_ps(best_all, best_all, _MM_SHUFFLE(2, 3, 0, 1)));
+      /* The lowest position among the lanes that reached the max. */
+      pos = _mm256_mask_mov_epi32(_mm256_set1_epi32(N),
+            _mm256_cmp_ps_mask(best, best_all, _CMP_EQ_OQ), pos);
+      pos4 = _mm_min_epi32(_mm256_castsi256_si128(pos), _mm256_extracti128_si256(pos, 1));
+      pos4 = _mm_min_epi32(pos4, _mm_shuffle_epi32(pos4, _MM_SHUFFLE(1, 0, 3, 2)));
+      pos4 = _mm_min_epi32(pos4, _mm_shuffle_epi32(pos4, _MM_SHUFFLE(2, 3, 0, 1)));
+      best_id = _mm_cvtsi128_si32(pos4);
+
+      /* Updating the sums of the new pulse(s) */
+      xy = ADD32(xy, EXTEND32(X[best_id]));
+      /* We're multiplying y[j] by two so we don't have to do it here */
+      yy = ADD16(yy, y[best_id]);
+
+      /* Only now that we've made the final choice, update y/iy */
+      /* Multiplying y[j] by 2 so we don't have to do it everywhere else */
+      y[best_id] += 2;
+      iy[best_id]++;
+   }
+
+   /* Put the original sign back */
+   for (j=0;j<N;j+=8)
+   {
+      __mmask8 m;
+      __m256i y8, s8;
+      m = lanes8(N-j);
+      y8 = _mm256_maskz_loadu_epi32(m, &iy[j]);
+      s8 = _mm256_maskz_loadu_epi32(m, &signy[j]);
+      _mm256_mask_storeu_epi32(&iy[j], m, _mm256_xor_si256(_mm256_add_epi32(y8, s8), s8));
+   }
+   RESTORE_STACK;
+   return yy;
+}
+
+#endif
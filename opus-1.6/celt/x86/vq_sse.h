@@ -31,7 +31,17 @@
 
 opus_val16 op_pvq_search_sse2(celt_norm *_X, int *iy, int K, int N, int arch);
 
-#if defined(OPUS_X86_PRESUME_SSE2)
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+opus_val16 op_pvq_search_avx512(celt_norm *_X, int *iy, int K, int N, int arch);
+#endif
+
+#if defined(OPUS_X86_PRESUME_AVX512)
+
+#define OVERRIDE_OP_PVQ_SEARCH
+#define op_pvq_search(x, iy, K, N, arch) \
+    (op_pvq_search_avx512(x, iy, K, N, arch))
+
+#elif defined(OPUS_X86_PRESUME_SSE2) && !defined(OPUS_X86_MAY_HAVE_AVX512)
 
 #define OVERRIDE_OP_PVQ_SEARCH
 #define op_pvq_search(x, iy, K, N, arch) \
@@ -46,6 +56,27 @@ extern opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
 #  define op_pvq_search(X, iy, K, N, arch) \
     ((*OP_PVQ_SEARCH_IMPL[(arch) & OPUS_ARCHMASK])(X, iy, K, N, arch))
 
+#endif
+
+void exp_rotation_blocks_sse2(celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch);
+
+#if defined(OPUS_X86_PRESUME_SSE2)
+
+#define OVERRIDE_EXP_ROTATION_BLOCKS
+#define exp_rotation_blocks(X, len, stride, stride2, c, s, dir, arch) \
+    (exp_rotation_blocks_sse2(X, len, stride, stride2, c, s, dir, arch))
+
+#elif defined(OPUS_HAVE_RTCD)
+
+#define OVERRIDE_EXP_ROTATION_BLOCKS
+extern void (*const EXP_ROTATION_BLOCKS_IMPL[OPUS_ARCHMASK + 1])(
+      celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch);
+
+#  define exp_rotation_blocks(X, len, stride, stride2, c, s, dir, arch) \
+    ((*EXP_ROTATION_BLOCKS_IMPL[(arch) & OPUS_ARCHMASK])(X, len, stride, stride2, c, s, dir, arch))
+
 #endif
 #endif
 
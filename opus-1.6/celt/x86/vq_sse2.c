@@ -214,4 +214,220 @@ opus_val16 op_pvq_search_sse2(celt_norm *_X, int *iy, int K, int N, int arch)
    return yy;
 }
 
+/* Same as exp_rotation1() on a single block. A pass with a stride of at least
+   four has no dependency between four consecutive positions, so it is done
+   four at a time. A stride of one is a serial recurrence, so the value that
+   gets carried to the next position is kept in a register instead. */
+static void exp_rotation1_sse2(float *X, int len, int stride, float c, float s)
+{
+   int i;
+   float ms;
+   ms = -s;
+   if (stride == 1)
+   {
+      float x1, x2;
+      if (len < 2)
+         return;
+      x1 = X[0];
+      for (i=0;i<len-1;i++)
+      {
+         float y;
+         x2 = X[i+1];
+         y = c*x2 + s*x1;
+         X[i] = c*x1 + ms*x2;
+         x1 = y;
+      }
+      X[len-1] = x1;
+      if (len < 3)
+         return;
+      x2 = X[len-2];
+      for (i=len-3;i>=0;i--)
+      {
+         float y;
+         x1 = X[i];
+         X[i+1] = c*x2 + s*x1;
+         y = c*x1 + ms*x2;
+         x2 = y;
+      }
+      X[0] = x2;
+   } else {
+      __m128 c4, s4, ms4;
+      c4 = _mm_set1_ps(c);
+      s4 = _mm_set1_ps(s);
+      ms4 = _mm_set1_ps(ms);
+      i = 0;
+      if (stride >= 4)
+      {
+         for (;i<len-stride-3;i+=4)
+         {
+            __m128 x1, x2;
+            x1 = _mm_loadu_ps(&X[i]);
+            x2 = _mm_loadu_ps(&X[i+stride]);
+            _mm_storeu_ps(&X[i+stride], _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1)));
+            _mm_storeu_ps(&X[i], _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2)));
+         }
+      }
+      for (;i<len-stride;i++)
+      {
+         float x1, x2;
+         x1 = X[i];
+         x2 = X[i+stride];
+         X[i+stride] = c*x2 + s*x1;
+         X[i]        = c*x1 + ms*x2;
+      }
+      i = len-2*stride-1;
+      if (stride >= 4)
+      {
+         for (;i>=3;i-=4)
+         {
+            __m128 x1, x2;
+            x1 = _mm_loadu_ps(&X[i-3]);
+            x2 = _mm_loadu_ps(&X[i-3+stride]);
+            _mm_storeu_ps(&X[i-3+stride], _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1)));
+            _mm_storeu_ps(&X[i-3], _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2)));
+         }
+      }
+      for (;i>=0;i--)
+      {
+         float x1, x2;
+         x1 = X[i];
+         x2 = X[i+stride];
+         X[i+stride] = c*x2 + s*x1;
+         X[i]        = c*x1 + ms*x2;
+      }
+   }
+}
+
+/* Same as exp_rotation1(), except that each of the four lanes of V holds a
+   different block, so V[4*i+k] is sample i of block k. */
+static void exp_rotation4_sse2(float *V, int len, int stride, float c, float s)
+{
+   int i;
+   __m128 c4, s4, ms4;
+   c4 = _mm_set1_ps(c);
+   s4 = _mm_set1_ps(s);
+   ms4 = _mm_set1_ps(-s);
+   if (stride == 1)
+   {
+      __m128 x1, x2, y;
+      if (len < 2)
+         return;
+      x1 = _mm_loadu_ps(&V[0]);
+      for (i=0;i<len-1;i++)
+      {
+         x2 = _mm_loadu_ps(&V[4*(i+1)]);
+         y = _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1));
+         _mm_storeu_ps(&V[4*i], _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2)));
+         x1 = y;
+      }
+      _mm_storeu_ps(&V[4*(len-1)], x1);
+      if (len < 3)
+         return;
+      x2 = _mm_loadu_ps(&V[4*(len-2)]);
+      for (i=len-3;i>=0;i--)
+      {
+         x1 = _mm_loadu_ps(&V[4*i]);
+         _mm_storeu_ps(&V[4*(i+1)], _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1)));
+         x2 = _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2));
+      }
+      _mm_storeu_ps(&V[0], x2);
+   } else {
+      for (i=0;i<len-stride;i++)
+      {
+         __m128 x1, x2;
+         x1 = _mm_loadu_ps(&V[4*i]);
+         x2 = _mm_loadu_ps(&V[4*(i+stride)]);
+         _mm_storeu_ps(&V[4*(i+stride)], _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1)));
+         _mm_storeu_ps(&V[4*i], _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2)));
+      }
+      for (i=len-2*stride-1;i>=0;i--)
+      {
+         __m128 x1, x2;
+         x1 = _mm_loadu_ps(&V[4*i]);
+         x2 = _mm_loadu_ps(&V[4*(i+stride)]);
+         _mm_storeu_ps(&V[4*(i+stride)], _mm_add_ps(_mm_mul_ps(c4, x2), _mm_mul_ps(s4, x1)));
+         _mm_storeu_ps(&V[4*i], _mm_add_ps(_mm_mul_ps(c4, x1), _mm_mul_ps(ms4, x2)));
+      }
+   }
+}
+
+/* The blocks are rotated four at a time, one per lane, so the serial
+   dependency along each block is spread over independent lanes. The
+   arithmetic is the same as exp_rotation1() so the result is bit-exact. */
+void exp_rotation_blocks_sse2(celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch)
+{
+   int b;
+   VARDECL(float, V);
+   SAVE_STACK;
+
+   (void)arch;
+   if (stride == 1)
+   {
+      if (dir < 0)
+      {
+         if (stride2)
+            exp_rotation1_sse2(X, len, stride2, s, c);
+         exp_rotation1_sse2(X, len, 1, c, s);
+      } else {
+         exp_rotation1_sse2(X, len, 1, c, -s);
+         if (stride2)
+            exp_rotation1_sse2(X, len, stride2, s, -c);
+      }
+      RESTORE_STACK;
+      return;
+   }
+   ALLOC(V, 4*len, float);
+   for (b=0;b<stride;b+=4)
+   {
+      int i, k;
+      int nb;
+      celt_norm *Xb;
+      nb = IMIN(4, stride-b);
+      Xb = X+b*len;
+      /* Missing blocks in the last group are left as zeros. */
+      for (i=0;i<len-3;i+=4)
+      {
+         __m128 x[4];
+         for (k=0;k<4;k++)
+            x[k] = k < nb ? _mm_loadu_ps(&Xb[k*len+i]) : _mm_setzero_ps();
+         _MM_TRANSPOSE4_PS(x[0], x[1], x[2], x[3]);
+         for (k=0;k<4;k++)
+            _mm_storeu_ps(&V[4*(i+k)], x[k]);
+      }
+      for (;i<len;i++)
+      {
+         float x[4] = {0, 0, 0, 0};
+         for (k=0;k<nb;k++)
+            x[k] = Xb[k*len+i];
+         _mm_storeu_ps(&V[4*i], _mm_loadu_ps(x));
+      }
+      if (dir < 0)
+      {
+         if (stride2)
+            exp_rotation4_sse2(V, len, stride2, s, c);
+         exp_rotation4_sse2(V, len, 1, c, s);
+      } else {
+         exp_rotation4_sse2(V, len, 1, c, -s);
+         if (stride2)
+            exp_rotation4_sse2(V, len, stride2, s, -c);
+      }
+      for (i=0;i<len-3;i+=4)
+      {
+         __m128 x[4];
+         for (k=0;k<4;k++)
+            x[k] = _mm_loadu_ps(&V[4*(i+k)]);
+         _MM_TRANSPOSE4_PS(x[0], x[1], x[2], x[3]);
+         for (k=0;k<nb;k++)
+            _mm_storeu_ps(&Xb[k*len+i], x[k]);
+      }
+      for (;i<len;i++)
+      {
+         for (k=0;k<nb;k++)
+            Xb[k*len+i] = V[4*i+k];
+      }
+   }
+   RESTORE_STACK;
+}
+
 #endif
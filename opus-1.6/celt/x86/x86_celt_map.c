@@ -30,10 +30,12 @@
 #endif
 
 #include "x86/x86cpu.h"
+#include "celt.h"
 #include "celt_lpc.h"
 #include "pitch.h"
 #include "pitch_sse.h"
 #include "vq.h"
+#include "mathops.h"
 
 #if defined(OPUS_HAVE_RTCD)
 
@@ -53,7 +55,8 @@ void (*const CELT_FIR_IMPL[OPUS_ARCHMASK + 1])(
   celt_fir_c,
   celt_fir_c,
   MAY_HAVE_SSE4_1(celt_fir), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_fir)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_fir), /* avx  */
+  MAY_HAVE_SSE4_1(celt_fir)  /* avx512 */
 };
 
 void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
@@ -66,13 +69,36 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   xcorr_kernel_c,
   xcorr_kernel_c,
   MAY_HAVE_SSE4_1(xcorr_kernel), /* sse4.1  */
-  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel), /* avx  */
+  MAY_HAVE_SSE4_1(xcorr_kernel)  /* avx512 */
 };
 
 #endif
 
-#if (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) ||  \
- (!defined(OPUS_X86_MAY_HAVE_SSE_4_1) && defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2))
+#if defined(OPUS_X86_MAY_HAVE_AVX512) && !defined(OPUS_X86_PRESUME_AVX512)
+
+opus_val32 (*const PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
+         const opus_val16 *_x,
+         const opus_val16 *_y,
+         opus_val32 *xcorr,
+         int len,
+         int max_pitch,
+         int arch
+) = {
+  celt_pitch_xcorr_c,                /* non-sse */
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  celt_pitch_xcorr_c,
+  MAY_HAVE_AVX512(celt_pitch_xcorr)  /* avx512 */
+};
+
+#endif
+
+#if !defined(OPUS_X86_PRESUME_AVX512) && \
+ ((defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) ||  \
+ (!defined(OPUS_X86_MAY_HAVE_SSE_4_1) && defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
+ defined(OPUS_X86_MAY_HAVE_AVX512))
 
 opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
          const opus_val16 *x,
@@ -83,14 +109,16 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   celt_inner_prod_c,
   MAY_HAVE_SSE2(celt_inner_prod),
   MAY_HAVE_SSE4_1(celt_inner_prod), /* sse4.1  */
-  MAY_HAVE_SSE4_1(celt_inner_prod)  /* avx  */
+  MAY_HAVE_SSE4_1(celt_inner_prod), /* avx  */
+  MAY_HAVE_AVX512(celt_inner_prod)  /* avx512 */
 };
 
 #endif
 
 # else
 
-#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)
+#if defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX512) && \
+ (!defined(OPUS_X86_PRESUME_AVX2) || defined(OPUS_X86_MAY_HAVE_AVX512))
 
 void (*const PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
          const float *_x,
@@ -104,7 +132,8 @@ void (*const PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1])(
   celt_pitch_xcorr_c,
   celt_pitch_xcorr_c,
   celt_pitch_xcorr_c,
-  MAY_HAVE_AVX2(celt_pitch_xcorr)
+  MAY_HAVE_AVX2(celt_pitch_xcorr),
+  MAY_HAVE_AVX512(celt_pitch_xcorr)  /* avx512 */
 };
 
 #endif
@@ -122,9 +151,15 @@ void (*const XCORR_KERNEL_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
   MAY_HAVE_SSE(xcorr_kernel),
-  MAY_HAVE_SSE(xcorr_kernel)
+  MAY_HAVE_SSE(xcorr_kernel),
+  MAY_HAVE_SSE(xcorr_kernel)  /* avx512 */
 };
 
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_AVX512) && \
+ (!defined(OPUS_X86_PRESUME_SSE) || defined(OPUS_X86_MAY_HAVE_AVX512))
+
 opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
          const opus_val16 *x,
          const opus_val16 *y,
@@ -134,7 +169,8 @@ opus_val32 (*const CELT_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
   MAY_HAVE_SSE(celt_inner_prod),
-  MAY_HAVE_SSE(celt_inner_prod)
+  MAY_HAVE_SSE(celt_inner_prod),
+  MAY_HAVE_AVX512(celt_inner_prod)  /* avx512 */
 };
 
 void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
@@ -149,7 +185,8 @@ void (*const DUAL_INNER_PROD_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
   MAY_HAVE_SSE(dual_inner_prod),
-  MAY_HAVE_SSE(dual_inner_prod)
+  MAY_HAVE_SSE(dual_inner_prod),
+  MAY_HAVE_AVX512(dual_inner_prod)  /* avx512 */
 };
 
 void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
@@ -165,13 +202,15 @@ void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
   MAY_HAVE_SSE(comb_filter_const),
-  MAY_HAVE_SSE(comb_filter_const)
+  MAY_HAVE_SSE(comb_filter_const),
+  MAY_HAVE_AVX512(comb_filter_const)  /* avx512 */
 };
 
 
 #endif
 
-#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)
+#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_AVX512) && \
+ (!defined(OPUS_X86_PRESUME_SSE2) || defined(OPUS_X86_MAY_HAVE_AVX512))
 opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
       celt_norm *_X, int *iy, int K, int N, int arch
 ) = {
@@ -179,9 +218,94 @@ opus_val16 (*const OP_PVQ_SEARCH_IMPL[OPUS_ARCHMASK + 1])(
   op_pvq_search_c,
   MAY_HAVE_SSE2(op_pvq_search),
   MAY_HAVE_SSE2(op_pvq_search),
-  MAY_HAVE_SSE2(op_pvq_search)
+  MAY_HAVE_SSE2(op_pvq_search),
+  MAY_HAVE_AVX512(op_pvq_search)  /* avx512 */
+};
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)
+
+void (*const TRANSIENT_ENERGY_IMPL[OPUS_ARCHMASK + 1])(
+      const celt_sig *in, int len, int C, opus_val16 forward_decay,
+      opus_val16 *tmp, opus_val32 *mean, opus_val16 *maxE
+) = {
+  transient_energy_c,                /* non-sse */
+  transient_energy_c,
+  MAY_HAVE_SSE2(transient_energy),
+  MAY_HAVE_SSE2(transient_energy),
+  MAY_HAVE_SSE2(transient_energy),
+  MAY_HAVE_SSE2(transient_energy)  /* avx512 */
+};
+
+void (*const TF_L1_METRICS_IMPL[OPUS_ARCHMASK + 1])(
+      const celt_norm *X, int N, int K, opus_val32 *L1
+) = {
+  tf_l1_metrics_c,                /* non-sse */
+  tf_l1_metrics_c,
+  MAY_HAVE_SSE2(tf_l1_metrics),
+  MAY_HAVE_SSE2(tf_l1_metrics),
+  MAY_HAVE_SSE2(tf_l1_metrics),
+  MAY_HAVE_SSE2(tf_l1_metrics)  /* avx512 */
+};
+
+void (*const EXP_ROTATION_BLOCKS_IMPL[OPUS_ARCHMASK + 1])(
+      celt_norm *X, int len, int stride, int stride2,
+      opus_val16 c, opus_val16 s, int dir, int arch
+) = {
+  exp_rotation_blocks_c,                /* non-sse */
+  exp_rotation_blocks_c,
+  MAY_HAVE_SSE2(exp_rotation_blocks),
+  MAY_HAVE_SSE2(exp_rotation_blocks),
+  MAY_HAVE_SSE2(exp_rotation_blocks),
+  MAY_HAVE_SSE2(exp_rotation_blocks)  /* avx512 */
 };
 #endif
 
 #endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(DISABLE_FLOAT_API) && !defined(OPUS_X86_PRESUME_AVX2) && \
+    !(defined(OPUS_X86_PRESUME_SSE2) && !defined(OPUS_X86_MAY_HAVE_AVX2))
+
+/* AVX2 hosts still get the SSE2 kernels when the AVX2 ones aren't built. */
+# if defined(OPUS_X86_MAY_HAVE_AVX2)
+#  define AVX2_OR_SSE2(name) name ## _avx2
+# else
+#  define AVX2_OR_SSE2(name) MAY_HAVE_SSE2(name)
+# endif
+
+void (*const CELT_FLOAT2INT16_IMPL[OPUS_ARCHMASK + 1])(
+      const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt
+) = {
+  celt_float2int16_c,                /* non-sse */
+  celt_float2int16_c,
+  MAY_HAVE_SSE2(celt_float2int16),
+  MAY_HAVE_SSE2(celt_float2int16),
+  AVX2_OR_SSE2(celt_float2int16),
+  AVX2_OR_SSE2(celt_float2int16)  /* avx512 */
+};
+
+int (*const CELT_FLOAT2INT16_CHECKWITHIN1_IMPL[OPUS_ARCHMASK + 1])(
+      const float * OPUS_RESTRICT in, short * OPUS_RESTRICT out, int cnt
+) = {
+  celt_float2int16_checkwithin1_c,   /* non-sse */
+  celt_float2int16_checkwithin1_c,
+  MAY_HAVE_SSE2(celt_float2int16_checkwithin1),
+  MAY_HAVE_SSE2(celt_float2int16_checkwithin1),
+  AVX2_OR_SSE2(celt_float2int16_checkwithin1),
+  AVX2_OR_SSE2(celt_float2int16_checkwithin1)  /* avx512 */
+};
+
+int (*const OPUS_LIMIT2_CHECKWITHIN1_IMPL[OPUS_ARCHMASK + 1])(
+      float *samples, int cnt
+) = {
+  opus_limit2_checkwithin1_c,        /* non-sse */
+  opus_limit2_checkwithin1_c,
+  MAY_HAVE_SSE2(opus_limit2_checkwithin1),
+  MAY_HAVE_SSE2(opus_limit2_checkwithin1),
+  AVX2_OR_SSE2(opus_limit2_checkwithin1),
+  AVX2_OR_SSE2(opus_limit2_checkwithin1)  /* avx512 */
+};
+
+#endif
+
 #endif
@@ -39,7 +39,8 @@
   ((defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) || \
-  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)))
+  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)) || \
+  (defined(OPUS_X86_MAY_HAVE_AVX512) && !defined(OPUS_X86_PRESUME_AVX512)))
 
 #if defined(_MSC_VER)
 
@@ -99,6 +100,18 @@ static void cpuid(unsigned int CPUInfo[4], unsigned int InfoType)
 
 #endif
 
+static unsigned int xgetbv0(void)
+{
+#if defined(_MSC_VER)
+    return (unsigned int)_xgetbv(0);
+#else
+    unsigned int eax, edx;
+    /* xgetbv, spelled out for assemblers that don't know it. */
+    __asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+    return eax;
+#endif
+}
+
 typedef struct CPU_Feature{
     /*  SIMD: 128-bit */
     int HW_SSE;
@@ -106,6 +119,8 @@ typedef struct CPU_Feature{
     int HW_SSE41;
     /*  SIMD: 256-bit */
     int HW_AVX2;
+    /*  SIMD: 512-bit */
+    int HW_AVX512;
 } CPU_Feature;
 
 static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
@@ -121,10 +136,21 @@ static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
         cpu_feature->HW_SSE = (info[3] & (1 << 25)) != 0;
         cpu_feature->HW_SSE2 = (info[3] & (1 << 26)) != 0;
         cpu_feature->HW_SSE41 = (info[2] & (1 << 19)) != 0;
-        cpu_feature->HW_AVX2 = (info[2] & (1 << 28)) != 0 && (info[2] & (1 << 12)) != 0;
+        /* AVX, FMA and F16C; the DNN code expands fp16 weights with vcvtph2ps. */
+        cpu_feature->HW_AVX2 = (info[2] & (1 << 28)) != 0 && (info[2] & (1 << 12)) != 0
+                && (info[2] & (1 << 29)) != 0;
+        cpu_feature->HW_AVX512 = 0;
         if (cpu_feature->HW_AVX2 && nIds >= 7) {
+            unsigned int ecx1 = info[2];
             cpuid(info, 7);
             cpu_feature->HW_AVX2 = cpu_feature->HW_AVX2 && (info[1] & (1 << 5)) != 0;
+            /* AVX512F, AVX512DQ, AVX512BW and AVX512VL. Unlike AVX, the OS
+               support for the opmask and ZMM state is checked too, as some
+               hypervisors hide it. */
+            if (cpu_feature->HW_AVX2 && (info[1] & 0xc0030000) == 0xc0030000
+                    && (ecx1 & (1 << 27)) != 0) {
+                cpu_feature->HW_AVX512 = (xgetbv0() & 0xe6) == 0xe6;
+            }
         } else {
             cpu_feature->HW_AVX2 = 0;
         }
@@ -134,6 +160,7 @@ static void opus_cpu_feature_check(CPU_Feature *cpu_feature)
         cpu_feature->HW_SSE2 = 0;
         cpu_feature->HW_SSE41 = 0;
         cpu_feature->HW_AVX2 = 0;
+        cpu_feature->HW_AVX512 = 0;
     }
 }
 
@@ -169,6 +196,16 @@ static int opus_select_arch_impl(void)
     }
     arch++;
 
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+    /* Only use that level when its kernels were built, so that the tables
+       don't need to fall back to the AVX2 ones. */
+    if (!cpu_feature.HW_AVX512)
+    {
+        return arch;
+    }
+    arch++;
+#endif
+
     return arch;
 }
 
@@ -181,4 +218,55 @@ int opus_select_arch(void) {
     return arch;
 }
 
+#ifdef OPUS_X86_CLONES
+
+int opus_select_x86_level(void)
+{
+    unsigned int info[4];
+    unsigned int ecx1, ebx7, ecx_ext;
+    unsigned int nIds;
+    unsigned int xcr0 = 0;
+    int arch;
+
+    /* Anything below SSE4.1 runs the baseline build. */
+    arch = opus_select_arch();
+    if (arch < 3)
+        return 1;
+    cpuid(info, 0);
+    nIds = info[0];
+    cpuid(info, 1);
+    ecx1 = info[2];
+    ebx7 = 0;
+    if (nIds >= 7) {
+        cpuid(info, 7);
+        ebx7 = info[1];
+    }
+    cpuid(info, 0x80000000);
+    ecx_ext = 0;
+    if (info[0] >= 0x80000001) {
+        cpuid(info, 0x80000001);
+        ecx_ext = info[2];
+    }
+    /* The rest of x86-64-v2: SSE3, SSSE3, CMPXCHG16B, SSE4.2, POPCNT and
+       LAHF/SAHF. */
+    if ((ecx1 & 0x00982201) != 0x00982201 || (ecx_ext & 1) == 0)
+        return 1;
+    /* OSXSAVE, so that XCR0 can be read for the register state the OS
+       saves. */
+    if (ecx1 & (1 << 27))
+        xcr0 = xgetbv0();
+    /* x86-64-v3 adds BMI1, BMI2, LZCNT and MOVBE to what the AVX2 arch level
+       already checks, plus OS support for the YMM state. */
+    if (arch < 4 || (ebx7 & 0x108) != 0x108 || (ecx_ext & (1 << 5)) == 0
+            || (ecx1 & (1 << 22)) == 0 || (xcr0 & 0x6) != 0x6)
+        return 2;
+    /* x86-64-v4: AVX512F, AVX512DQ, AVX512CD, AVX512BW and AVX512VL, and
+       the opmask and ZMM state. */
+    if ((ebx7 & 0xd0030000) != 0xd0030000 || (xcr0 & 0xe6) != 0xe6)
+        return 3;
+    return 4;
+}
+
+#endif
+
 #endif
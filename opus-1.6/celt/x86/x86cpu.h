@@ -52,12 +52,25 @@
 #  define MAY_HAVE_AVX2(name) name ## _c
 # endif
 
+# if defined(OPUS_X86_MAY_HAVE_AVX512)
+#  define MAY_HAVE_AVX512(name) name ## _avx512
+# else
+#  define MAY_HAVE_AVX512(name) name ## _c
+# endif
+
 # if defined(OPUS_HAVE_RTCD) && \
-  ((defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
+  (defined(OPUS_CLONE) || \
+  (defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE2) && !defined(OPUS_X86_PRESUME_SSE2)) || \
   (defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1)) || \
-  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)))
+  (defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX2)) || \
+  (defined(OPUS_X86_MAY_HAVE_AVX512) && !defined(OPUS_X86_PRESUME_AVX512)))
 int opus_select_arch(void);
+#  ifdef OPUS_X86_CLONES
+/* The x86-64 psABI microarchitecture level (1 to 4) of the host, for
+   picking one of the whole-library clones. */
+int opus_select_x86_level(void);
+#  endif
 # endif
 
 # if defined(OPUS_X86_MAY_HAVE_SSE2)
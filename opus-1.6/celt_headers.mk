@@ -24,7 +24,9 @@ celt/modes.h \
 celt/os_support.h \
 celt/pitch.h \
 celt/celt_lpc.h \
+celt/x86/celt_encoder_sse.h \
 celt/x86/celt_lpc_sse.h \
+celt/x86/mathops_sse.h \
 celt/quant_bands.h \
 celt/rate.h \
 celt/stack_alloc.h \
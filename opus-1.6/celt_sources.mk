@@ -26,6 +26,8 @@ CELT_SOURCES_SSE = \
 celt/x86/pitch_sse.c
 
 CELT_SOURCES_SSE2 = \
+celt/x86/celt_encoder_sse2.c \
+celt/x86/mathops_sse2.c \
 celt/x86/pitch_sse2.c \
 celt/x86/vq_sse2.c
 
@@ -34,8 +36,13 @@ celt/x86/celt_lpc_sse4_1.c \
 celt/x86/pitch_sse4_1.c
 
 CELT_SOURCES_AVX2 = \
+celt/x86/mathops_avx2.c \
 celt/x86/pitch_avx.c
 
+CELT_SOURCES_AVX512 = \
+celt/x86/pitch_avx512.c \
+celt/x86/vq_avx512.c
+
 CELT_SOURCES_ARM_RTCD = \
 celt/arm/armcpu.c \
 celt/arm/arm_celt_map.c
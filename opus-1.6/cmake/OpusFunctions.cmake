@@ -49,7 +49,7 @@ endfunction()
 include(CheckIncludeFile)
 
 # This function determines if the compiler has support for SSE, SSE2, SSE4.1, AVX,
-# AVX2 and FMA. Should the target systems potentially lack SSE support, the
+# AVX2, FMA and AVX-512. Should the target systems potentially lack SSE support, the
 # OPUS_MAY_HAVE_SSE option is recommended for use. If, however, the target system is
 # assured to support SSE, the OPUS_PRESUME_SSE option can be employed, thus
 # eliminating the necessity for an SSE runtime check.
@@ -118,15 +118,23 @@ function(opus_detect_sse COMPILER_SUPPORT_SIMD)
     if(MSVC)
       check_flag(AVX2 /arch:AVX2)
     else()
-      check_flag(AVX2 -mavx2 -mfma -mavx)
+      check_flag(AVX2 -mavx2 -mfma -mavx -mf16c)
+    endif()
+    if(MSVC)
+      check_flag(AVX512 /arch:AVX512)
+    else()
+      check_flag(AVX512 -mavx512f -mavx512bw -mavx512dq -mavx512vl -mavx2 -mfma -mavx -mf16c)
     endif()
   else()
     set(AVX2_SUPPORTED
         0
         PARENT_SCOPE)
+    set(AVX512_SUPPORTED
+        0
+        PARENT_SCOPE)
   endif()
 
-  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX2_SUPPORTED)
+  if(SSE1_SUPPORTED OR SSE2_SUPPORTED OR SSE4_1_SUPPORTED OR AVX2_SUPPORTED OR AVX512_SUPPORTED)
     set(COMPILER_SUPPORT_SIMD 1 PARENT_SCOPE)
   else()
     message(STATUS "No SIMD support in compiler")
@@ -229,3 +237,94 @@ function(get_opus_sources SOURCE_GROUP MAKE_FILE SOURCES)
 
   set(${SOURCES} ${list_var} PARENT_SCOPE)
 endfunction()
+
+# Builds every C source of the target again for each x86-64 microarchitecture
+# level the compiler supports, links each copy into a single relocatable
+# object, makes all of its symbols local except for the entry points listed
+# in src/opus_clones.h, and renames those with the level as a suffix. The
+# SIMD kernels, the model data, the CELT modes and code with global state are
+# left out and resolve to the baseline build. FMA contraction is disabled so
+# that every clone produces the same output as the baseline.
+# A clone only ever runs on a host with the SIMD levels its microarchitecture
+# level implies, so it presumes them: it calls the kernels the RTCD tables
+# would pick directly, and the compiler can inline them into their callers.
+function(add_opus_x86_clones target)
+  include(CheckCCompilerFlag)
+  if(NOT CMAKE_OBJCOPY)
+    message(FATAL_ERROR "OPUS_X86_CLONES requires objcopy")
+  endif()
+  if(OPUS_NONTHREADSAFE_PSEUDOSTACK)
+    message(FATAL_ERROR "OPUS_X86_CLONES cannot be used with OPUS_NONTHREADSAFE_PSEUDOSTACK")
+  endif()
+  set(entry_points opus_encode_native opus_decode_native
+                   opus_multistream_encode_native opus_multistream_decode_native
+                   opus_dred_process)
+
+  get_target_property(clone_sources ${target} SOURCES)
+  list(REMOVE_DUPLICATES clone_sources)
+  list(FILTER clone_sources INCLUDE REGEX "\\.c$")
+  list(FILTER clone_sources EXCLUDE REGEX "/(x86|arm)/|_data\\.c$")
+  # The states point to the static CELT modes, which must not be duplicated.
+  list(FILTER clone_sources EXCLUDE REGEX "celt/modes\\.c$")
+  list(FILTER clone_sources EXCLUDE REGEX "src/opus_clones\\.c$|src/opus_thread\\.c$|dnn/nnet_profile\\.c$")
+
+  set(keep_file ${CMAKE_CURRENT_BINARY_DIR}/opus_clones.keep)
+  string(REPLACE ";" "\n" keep_list "${entry_points}")
+  file(WRITE ${keep_file} "${keep_list}\n")
+
+  foreach(level v2 v3 v4)
+    string(TOUPPER ${level} LEVEL)
+    check_c_compiler_flag(-march=x86-64-${level} MARCH_X86_64_${LEVEL}_SUPPORTED)
+    if(NOT MARCH_X86_64_${LEVEL}_SUPPORTED)
+      continue()
+    endif()
+    set(clone ${target}_x86_64_${level})
+    set(level_sources ${clone_sources})
+    if(level STREQUAL v4)
+      # GCC forms fmaddsub from the complex multiplies in the FFT even with
+      # -ffp-contract=off, and nothing short of disabling AVX-512 stops it.
+      list(FILTER level_sources EXCLUDE REGEX "celt/kiss_fft\\.c$")
+    endif()
+    set(presumed SSE SSE2 SSE4_1)
+    if(NOT level STREQUAL v2)
+      list(APPEND presumed AVX2)
+    endif()
+    if(level STREQUAL v4)
+      list(APPEND presumed AVX512)
+    endif()
+    set(presume_defs "")
+    foreach(isa ${presumed})
+      list(APPEND presume_defs
+           "$<$<IN_LIST:OPUS_X86_MAY_HAVE_${isa},$<TARGET_PROPERTY:${target},COMPILE_DEFINITIONS>>:OPUS_X86_PRESUME_${isa}>")
+    endforeach()
+    add_library(${clone} OBJECT ${level_sources})
+    target_include_directories(${clone} PRIVATE $<TARGET_PROPERTY:${target},INCLUDE_DIRECTORIES>)
+    target_compile_definitions(${clone} PRIVATE $<TARGET_PROPERTY:${target},COMPILE_DEFINITIONS>
+                                                OPUS_X86_CLONES OPUS_CLONE ${presume_defs})
+    target_compile_options(${clone} PRIVATE $<TARGET_PROPERTY:${target},COMPILE_OPTIONS>
+                                            -march=x86-64-${level} -mno-fma -ffp-contract=off)
+    set_target_properties(${clone} PROPERTIES POSITION_INDEPENDENT_CODE ON
+                                              C_VISIBILITY_PRESET hidden)
+
+    set(map_file ${CMAKE_CURRENT_BINARY_DIR}/${clone}.map)
+    set(map_list "")
+    foreach(entry ${entry_points})
+      string(APPEND map_list "${entry} ${entry}_x86_64_${level}\n")
+    endforeach()
+    file(WRITE ${map_file} "${map_list}")
+
+    set(clone_object ${CMAKE_CURRENT_BINARY_DIR}/${clone}${CMAKE_C_OUTPUT_EXTENSION})
+    add_custom_command(OUTPUT ${clone_object}
+                       COMMAND ${CMAKE_C_COMPILER} -nostdlib -r -o ${clone}.r.o $<TARGET_OBJECTS:${clone}>
+                       COMMAND ${CMAKE_OBJCOPY} --keep-global-symbols=${keep_file} ${clone}.r.o ${clone}.l.o
+                       COMMAND ${CMAKE_OBJCOPY} --redefine-syms=${map_file} ${clone}.l.o ${clone_object}
+                       DEPENDS ${clone} $<TARGET_OBJECTS:${clone}> ${keep_file} ${map_file}
+                       WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+                       COMMAND_EXPAND_LISTS
+                       VERBATIM)
+    target_sources(${target} PRIVATE ${clone_object})
+    set_source_files_properties(${clone_object} PROPERTIES EXTERNAL_OBJECT TRUE GENERATED TRUE)
+    target_compile_definitions(${target} PRIVATE OPUS_X86_CLONE_${LEVEL})
+  endforeach()
+  target_compile_definitions(${target} PRIVATE OPUS_X86_CLONES)
+endfunction()
@@ -15,6 +15,7 @@ get_opus_sources(SILK_SOURCES_FIXED_SSE4_1 silk_sources.mk
                  silk_sources_fixed_sse4_1)
 get_opus_sources(SILK_SOURCES_AVX2 silk_sources.mk silk_sources_avx2)
 get_opus_sources(SILK_SOURCES_FLOAT_AVX2 silk_sources.mk silk_sources_float_avx2)
+get_opus_sources(SILK_SOURCES_FLOAT_AVX512 silk_sources.mk silk_sources_float_avx512)
 get_opus_sources(SILK_SOURCES_ARM_RTCD silk_sources.mk silk_sources_arm_rtcd)
 get_opus_sources(SILK_SOURCES_ARM_NEON_INTR silk_sources.mk
                  silk_sources_arm_neon_intr)
@@ -32,6 +33,7 @@ get_opus_sources(CELT_SOURCES_SSE celt_sources.mk celt_sources_sse)
 get_opus_sources(CELT_SOURCES_SSE2 celt_sources.mk celt_sources_sse2)
 get_opus_sources(CELT_SOURCES_SSE4_1 celt_sources.mk celt_sources_sse4_1)
 get_opus_sources(CELT_SOURCES_AVX2 celt_sources.mk celt_sources_avx2)
+get_opus_sources(CELT_SOURCES_AVX512 celt_sources.mk celt_sources_avx512)
 get_opus_sources(CELT_SOURCES_ARM_RTCD celt_sources.mk celt_sources_arm_rtcd)
 get_opus_sources(CELT_SOURCES_ARM_ASM celt_sources.mk celt_sources_arm_asm)
 get_opus_sources(CELT_AM_SOURCES_ARM_ASM celt_sources.mk
@@ -43,9 +45,11 @@ get_opus_sources(CELT_SOURCES_ARM_NE10 celt_sources.mk celt_sources_arm_ne10)
 get_opus_sources(DEEP_PLC_HEAD lpcnet_headers.mk deep_plc_headers)
 get_opus_sources(DRED_HEAD lpcnet_headers.mk dred_headers)
 get_opus_sources(OSCE_HEAD lpcnet_headers.mk osce_headers)
+get_opus_sources(NS_HEAD lpcnet_headers.mk ns_headers)
 get_opus_sources(DEEP_PLC_SOURCES lpcnet_sources.mk deep_plc_sources)
 get_opus_sources(DRED_SOURCES lpcnet_sources.mk dred_sources)
 get_opus_sources(OSCE_SOURCES lpcnet_sources.mk osce_sources)
+get_opus_sources(NS_SOURCES lpcnet_sources.mk ns_sources)
 get_opus_sources(DNN_SOURCES_X86_RTCD lpcnet_sources.mk dnn_sources_x86_rtcd)
 get_opus_sources(DNN_SOURCES_SSE2 lpcnet_sources.mk dnn_sources_sse2)
 get_opus_sources(DNN_SOURCES_SSE4_1 lpcnet_sources.mk dnn_sources_sse4_1)
@@ -57,6 +61,8 @@ get_opus_sources(DNN_SOURCES_ARM_RTCD lpcnet_sources.mk dnn_sources_arm_rtcd)
 get_opus_sources(opus_demo_SOURCES Makefile.am opus_demo_sources)
 get_opus_sources(opus_custom_demo_SOURCES Makefile.am opus_custom_demo_sources)
 get_opus_sources(opus_compare_SOURCES Makefile.am opus_compare_sources)
+get_opus_sources(opus_edit_SOURCES Makefile.am opus_edit_sources)
+get_opus_sources(opus_bulk_SOURCES Makefile.am opus_bulk_sources)
 get_opus_sources(tests_test_opus_api_SOURCES Makefile.am test_opus_api_sources)
 get_opus_sources(tests_test_opus_encode_SOURCES Makefile.am
                  test_opus_encode_sources)
@@ -66,7 +72,19 @@ get_opus_sources(tests_test_opus_decode_SOURCES Makefile.am
                  test_opus_decode_sources)
 get_opus_sources(tests_test_opus_padding_SOURCES Makefile.am
                  test_opus_padding_sources)
+get_opus_sources(tests_test_opus_gain_adjust_SOURCES Makefile.am
+                 test_opus_gain_adjust_sources)
+get_opus_sources(tests_test_opus_transrate_SOURCES Makefile.am
+                 test_opus_transrate_sources)
+get_opus_sources(tests_test_opus_stream_edit_SOURCES Makefile.am
+                 test_opus_stream_edit_sources)
+get_opus_sources(tests_test_opus_frame_duration_SOURCES Makefile.am
+                 test_opus_frame_duration_sources)
+get_opus_sources(tests_opus_kernel_bench_SOURCES Makefile.am
+                 opus_kernel_bench_sources)
 get_opus_sources(tests_test_opus_dred_SOURCES Makefile.am
                  test_opus_dred_sources)
+get_opus_sources(tests_test_opus_noise_suppression_SOURCES Makefile.am
+                 test_opus_noise_suppression_sources)
 get_opus_sources(tests_test_opus_custom_SOURCES Makefile.am
                  test_opus_custom_sources)
@@ -48,6 +48,19 @@ void (*const DNN_COMPUTE_LINEAR_IMPL[OPUS_ARCHMASK + 1])(
   MAY_HAVE_DOTPROD(compute_linear) /* dotprod  */
 };
 
+void (*const DNN_COMPUTE_GRU_IMPL[OPUS_ARCHMASK + 1])(
+         const LinearLayer *input_weights,
+         const LinearLayer *recurrent_weights,
+         float *state,
+         const float *in
+) = {
+  compute_gru_c,                /* default */
+  compute_gru_c,
+  compute_gru_c,
+  MAY_HAVE_NEON(compute_gru),   /* neon  */
+  MAY_HAVE_DOTPROD(compute_gru) /* dotprod  */
+};
+
 #endif
 
 #if (defined(OPUS_ARM_MAY_HAVE_DOTPROD) || defined(OPUS_ARM_MAY_HAVE_NEON)) && !defined(OPUS_ARM_PRESUME_NEON)
@@ -34,6 +34,9 @@
 void compute_linear_dotprod(const LinearLayer *linear, float *out, const float *in);
 void compute_linear_neon(const LinearLayer *linear, float *out, const float *in);
 
+void compute_gru_dotprod(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
+void compute_gru_neon(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
+
 void compute_activation_neon(float *output, const float *input, int N, int activation);
 void compute_activation_dotprod(float *output, const float *input, int N, int activation);
 
@@ -44,11 +47,15 @@ void compute_conv2d_dotprod(const Conv2dLayer *conv, float *out, float *mem, con
 
 #define OVERRIDE_COMPUTE_LINEAR
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_dotprod(linear, out, in))
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_dotprod(input_weights, recurrent_weights, state, in))
 
 #elif defined(OPUS_ARM_PRESUME_NEON_INTR) && !defined(OPUS_ARM_MAY_HAVE_DOTPROD)
 
 #define OVERRIDE_COMPUTE_LINEAR
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_neon(linear, out, in))
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_neon(input_weights, recurrent_weights, state, in))
 
 #elif defined(OPUS_HAVE_RTCD) && (defined(OPUS_ARM_MAY_HAVE_DOTPROD) || defined(OPUS_ARM_MAY_HAVE_NEON))
 
@@ -61,6 +68,16 @@ extern void (*const DNN_COMPUTE_LINEAR_IMPL[OPUS_ARCHMASK + 1])(
 #define compute_linear(linear, out, in, arch) \
     ((*DNN_COMPUTE_LINEAR_IMPL[(arch) & OPUS_ARCHMASK])(linear, out, in))
 
+extern void (*const DNN_COMPUTE_GRU_IMPL[OPUS_ARCHMASK + 1])(
+                    const LinearLayer *input_weights,
+                    const LinearLayer *recurrent_weights,
+                    float *state,
+                    const float *in
+                    );
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) \
+    ((*DNN_COMPUTE_GRU_IMPL[(arch) & OPUS_ARCHMASK])(input_weights, recurrent_weights, state, in))
+
 
 #endif
 
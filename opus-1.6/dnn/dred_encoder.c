@@ -57,6 +57,7 @@ int dred_encoder_load_model(DREDEnc* enc, const void *data, int len)
     WeightArray *list;
     int ret;
     parse_weights(&list, data, len);
+    DNN_PROFILE_MODEL("rdovaeenc");
     ret = init_rdovaeenc(&enc->model, list);
     opus_free(list);
     if (ret == 0) {
@@ -82,6 +83,7 @@ void dred_encoder_init(DREDEnc* enc, opus_int32 Fs, int channels)
     enc->channels = channels;
     enc->loaded = 0;
 #ifndef USE_WEIGHTS_FILE
+    DNN_PROFILE_MODEL("rdovaeenc");
     if (init_rdovaeenc(&enc->model, rdovaeenc_arrays) == 0) enc->loaded = 1;
 #endif
     dred_encoder_reset(enc);
@@ -177,6 +177,7 @@ void fargan_init(FARGANState *st)
   OPUS_CLEAR(st, 1);
   st->arch = opus_select_arch();
 #ifndef USE_WEIGHTS_FILE
+  DNN_PROFILE_MODEL("fargan");
   ret = init_fargan(&st->model, fargan_arrays);
 #else
   ret = 0;
@@ -188,6 +189,7 @@ int fargan_load_model(FARGANState *st, const void *data, int len) {
   WeightArray *list;
   int ret;
   parse_weights(&list, data, len);
+  DNN_PROFILE_MODEL("fargan");
   ret = init_fargan(&st->model, list);
   opus_free(list);
   if (ret == 0) return 0;
@@ -66,6 +66,8 @@
 #undef celt_assert
 #define celt_assert assert
 
+#define MAX_RNN_NEURONS_ALL IMAX(LOSSGEN_GRU1_STATE_SIZE, LOSSGEN_GRU2_STATE_SIZE)
+
 /* Directly include the C files we need since the symbols won't be exposed if we link in a shared object. */
 #include "parse_lpcnet_weights.c"
 #include "nnet_arch.h"
@@ -77,8 +79,6 @@
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_c(linear, out, in))
 #define compute_activation(output, input, N, activation, arch) ((void)(arch),compute_activation_c(output, input, N, activation))
 
-#define MAX_RNN_NEURONS_ALL IMAX(LOSSGEN_GRU1_STATE_SIZE, LOSSGEN_GRU2_STATE_SIZE)
-
 /* These two functions are copied from nnet.c to make sure we don't have linking issues. */
 void compute_generic_gru_lossgen(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int arch)
 {
@@ -157,6 +157,7 @@ void lossgen_init(LossGenState *st)
 {
   int ret;
   OPUS_CLEAR(st, 1);
+  DNN_PROFILE_MODEL("lossgen");
   ret = init_lossgen(&st->model, lossgen_arrays);
   celt_assert(ret == 0);
   (void)ret;
@@ -166,6 +167,7 @@ int lossgen_load_model(LossGenState *st, const void *data, int len) {
   WeightArray *list;
   int ret;
   parse_weights(&list, data, len);
+  DNN_PROFILE_MODEL("lossgen");
   ret = init_lossgen(&st->model, list);
   opus_free(list);
   if (ret == 0) return 0;
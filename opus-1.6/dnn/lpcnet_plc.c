@@ -62,6 +62,7 @@ int lpcnet_plc_init(LPCNetPLCState *st) {
   lpcnet_encoder_init(&st->enc);
   st->loaded = 0;
 #ifndef USE_WEIGHTS_FILE
+  DNN_PROFILE_MODEL("plcmodel");
   ret = init_plcmodel(&st->model, plcmodel_arrays);
   if (ret == 0) st->loaded = 1;
 #else
@@ -76,6 +77,7 @@ int lpcnet_plc_load_model(LPCNetPLCState *st, const void *data, int len) {
   WeightArray *list;
   int ret;
   parse_weights(&list, data, len);
+  DNN_PROFILE_MODEL("plcmodel");
   ret = init_plcmodel(&st->model, list);
   opus_free(list);
   if (ret == 0) {
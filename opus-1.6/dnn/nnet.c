@@ -36,15 +36,9 @@
 #include "arch.h"
 #include "nnet.h"
 #include "dred_rdovae_constants.h"
-#include "plc_data.h"
-#include "fargan.h"
 #include "os_support.h"
 #include "vec.h"
 
-#ifdef ENABLE_OSCE
-#include "osce.h"
-#endif
-
 #ifdef NO_OPTIMIZATIONS
 #if defined(_MSC_VER)
 #pragma message ("Compiling without any vectorization. This code will be very slow")
@@ -63,45 +57,9 @@ void compute_generic_dense(const LinearLayer *layer, float *output, const float
    compute_activation(output, output, layer->nb_outputs, activation, arch);
 }
 
-#ifdef ENABLE_OSCE
-#ifdef ENABLE_OSCE_BWE
-#define MAX_RNN_NEURONS_ALL IMAX(IMAX(IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS), OSCE_MAX_RNN_NEURONS), OSCE_BWE_MAX_RNN_NEURONS)
-#else
-#define MAX_RNN_NEURONS_ALL IMAX(IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS), OSCE_MAX_RNN_NEURONS)
-#endif
-#else
-#define MAX_RNN_NEURONS_ALL IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS)
-#endif
-
 void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int arch)
 {
-  int i;
-  int N;
-  float zrh[3*MAX_RNN_NEURONS_ALL];
-  float recur[3*MAX_RNN_NEURONS_ALL];
-  float *z;
-  float *r;
-  float *h;
-  celt_assert(3*recurrent_weights->nb_inputs == recurrent_weights->nb_outputs);
-  celt_assert(input_weights->nb_outputs == recurrent_weights->nb_outputs);
-  N = recurrent_weights->nb_inputs;
-  z = zrh;
-  r = &zrh[N];
-  h = &zrh[2*N];
-  celt_assert(recurrent_weights->nb_outputs <= 3*MAX_RNN_NEURONS_ALL);
-  celt_assert(in != state);
-  compute_linear(input_weights, zrh, in, arch);
-  compute_linear(recurrent_weights, recur, state, arch);
-  for (i=0;i<2*N;i++)
-     zrh[i] += recur[i];
-  compute_activation(zrh, zrh, 2*N, ACTIVATION_SIGMOID, arch);
-  for (i=0;i<N;i++)
-     h[i] += recur[2*N+i]*r[i];
-  compute_activation(h, h, N, ACTIVATION_TANH, arch);
-  for (i=0;i<N;i++)
-     h[i] = z[i]*state[i] + (1-z[i])*h[i];
-  for (i=0;i<N;i++)
-     state[i] = h[i];
+  compute_gru(input_weights, recurrent_weights, state, in, arch);
 }
 
 void compute_glu(const LinearLayer *layer, float *output, const float *input, int arch)
@@ -38,6 +38,7 @@
 #define ACTIVATION_SOFTMAX 4
 #define ACTIVATION_SWISH   5
 #define ACTIVATION_EXP 6
+#define ACTIVATION_VALIN 7
 
 #define WEIGHT_BLOB_VERSION 0
 #define WEIGHT_BLOCK_SIZE 64
@@ -52,6 +53,7 @@ typedef struct {
 #define WEIGHT_TYPE_int 1
 #define WEIGHT_TYPE_qweight 2
 #define WEIGHT_TYPE_int8 3
+#define WEIGHT_TYPE_float16 4
 
 typedef struct {
   char head[4];
@@ -68,11 +70,15 @@ typedef struct {
   const float *subias;
   const opus_int8 *weights;
   const float *float_weights;
+  const opus_uint16 *half_weights;
   const int *weights_idx;
   const float *diag;
   const float *scale;
   int nb_inputs;
   int nb_outputs;
+#ifdef ENABLE_DNN_PROFILE
+  int profile_id;
+#endif
 } LinearLayer;
 
 /* Generic sparse affine transformation. */
@@ -83,6 +89,9 @@ typedef struct {
   int out_channels;
   int ktime;
   int kheight;
+#ifdef ENABLE_DNN_PROFILE
+  int profile_id;
+#endif
 } Conv2dLayer;
 
 
@@ -105,6 +114,7 @@ extern const WeightArray fwgan_arrays[];
 extern const WeightArray fargan_arrays[];
 extern const WeightArray pitchdnn_arrays[];
 extern const WeightArray lossgen_arrays[];
+extern const WeightArray nsdnn_arrays[];
 
 int linear_init(LinearLayer *layer, const WeightArray *arrays,
   const char *bias,
@@ -127,6 +137,7 @@ int conv2d_init(Conv2dLayer *layer, const WeightArray *arrays,
 
 
 void compute_linear_c(const LinearLayer *linear, float *out, const float *in);
+void compute_gru_c(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
 void compute_activation_c(float *output, const float *input, int N, int activation);
 void compute_conv2d_c(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation);
 
@@ -143,6 +154,10 @@ void compute_conv2d_c(const Conv2dLayer *conv, float *out, float *mem, const flo
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_c(linear, out, in))
 #endif
 
+#ifndef OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_c(input_weights, recurrent_weights, state, in))
+#endif
+
 #ifndef OVERRIDE_COMPUTE_ACTIVATION
 #define compute_activation(output, input, N, activation, arch) ((void)(arch),compute_activation_c(output, input, N, activation))
 #endif
@@ -151,6 +166,30 @@ void compute_conv2d_c(const Conv2dLayer *conv, float *out, float *mem, const flo
 #define compute_conv2d(conv, out, mem, in, height, hstride, activation, arch) ((void)(arch),compute_conv2d_c(conv, out, mem, in, height, hstride, activation))
 #endif
 
+#ifdef ENABLE_DNN_PROFILE
+/* Per-layer profiling. Layers register under their weight array name when
+   initialized, attributed to the model set with DNN_PROFILE_MODEL(), and the
+   compute_linear(), compute_gru() and compute_conv2d() dispatches are wrapped
+   to accumulate calls, time, FLOPs and weight bytes. A report sorted by time
+   is printed to stderr at exit. Not thread-safe, for tuning only. */
+void dnn_profile_model(const char *model);
+int dnn_profile_register(const char *name, double flops, double bytes);
+void dnn_profile_linear(const LinearLayer *linear, float *out, const float *in, int arch);
+void dnn_profile_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int arch);
+void dnn_profile_conv2d(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation, int arch);
+#define DNN_PROFILE_MODEL(model) dnn_profile_model(model)
+#ifndef DNN_PROFILE_IMPL
+#undef compute_linear
+#define compute_linear(linear, out, in, arch) dnn_profile_linear(linear, out, in, arch)
+#undef compute_gru
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) dnn_profile_gru(input_weights, recurrent_weights, state, in, arch)
+#undef compute_conv2d
+#define compute_conv2d(conv, out, mem, in, height, hstride, activation, arch) dnn_profile_conv2d(conv, out, mem, in, height, hstride, activation, arch)
+#endif
+#else
+#define DNN_PROFILE_MODEL(model)
+#endif
+
 #if defined(__x86_64__) && !defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_MAY_HAVE_AVX2) &&!defined(SUPPRESS_PERF_WARNINGS)
 #if defined(_MSC_VER)
 #pragma message ("Only SSE and SSE2 are available. On newer machines, enable SSSE3/AVX/AVX2 to get better performance")
@@ -109,6 +109,8 @@ void RTCD_SUF(compute_activation_)(float *output, const float *input, int N, int
 #endif
    } else if (activation == ACTIVATION_EXP) {
       softmax(output, input, N);
+   } else if (activation == ACTIVATION_VALIN) {
+      vec_valin(output, input, N);
    } else {
       celt_assert(activation == ACTIVATION_LINEAR);
       if (input != output) {
@@ -130,6 +132,9 @@ void RTCD_SUF(compute_linear_) (const LinearLayer *linear, float *out, const flo
    if (linear->float_weights != NULL) {
      if (linear->weights_idx != NULL) sparse_sgemv8x4(out, linear->float_weights, linear->weights_idx, N, in);
      else sgemv(out, linear->float_weights, N, M, N, in);
+   } else if (linear->half_weights != NULL) {
+     if (linear->weights_idx != NULL) sparse_sgemv8x4_half(out, linear->half_weights, linear->weights_idx, N, in);
+     else sgemv_half(out, linear->half_weights, N, M, N, in);
    } else if (linear->weights != NULL) {
      if (linear->weights_idx != NULL) sparse_cgemv8x4(out, linear->weights, linear->weights_idx, linear->scale, N, M, in);
      else cgemv8x4(out, linear->weights, linear->scale, N, M, in);
@@ -153,6 +158,60 @@ void RTCD_SUF(compute_linear_) (const LinearLayer *linear, float *out, const flo
    }
 }
 
+/* Standalone users (lossgen) provide their own bound before including this. */
+#ifndef MAX_RNN_NEURONS_ALL
+#include "dred_rdovae_constants.h"
+#include "plc_data.h"
+#include "fargan.h"
+#ifdef ENABLE_OSCE
+#include "osce.h"
+#endif
+
+#ifdef ENABLE_OSCE
+#ifdef ENABLE_OSCE_BWE
+#define MAX_RNN_NEURONS_ALL IMAX(IMAX(IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS), OSCE_MAX_RNN_NEURONS), OSCE_BWE_MAX_RNN_NEURONS)
+#else
+#define MAX_RNN_NEURONS_ALL IMAX(IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS), OSCE_MAX_RNN_NEURONS)
+#endif
+#else
+#define MAX_RNN_NEURONS_ALL IMAX(IMAX(FARGAN_MAX_RNN_NEURONS, PLC_MAX_RNN_UNITS), DRED_MAX_RNN_NEURONS)
+#endif
+#endif
+
+#define GRU_BLOCK 8
+
+/* GRU with the gate math fused into a single sweep. The two projections are
+   computed first, then each block of neurons gets its z/r/h gates, the
+   activations and the state update while the block stays in registers. */
+void RTCD_SUF(compute_gru_)(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in)
+{
+   int i, j, N;
+   float zrh[3*MAX_RNN_NEURONS_ALL];
+   float recur[3*MAX_RNN_NEURONS_ALL];
+   N = recurrent_weights->nb_inputs;
+   celt_assert(3*N == recurrent_weights->nb_outputs);
+   celt_assert(input_weights->nb_outputs == recurrent_weights->nb_outputs);
+   celt_assert(N <= MAX_RNN_NEURONS_ALL);
+   celt_assert(in != state);
+   RTCD_SUF(compute_linear_)(input_weights, zrh, in);
+   RTCD_SUF(compute_linear_)(recurrent_weights, recur, state);
+   for (i=0;i<N;i+=GRU_BLOCK) {
+      float z[GRU_BLOCK], r[GRU_BLOCK], h[GRU_BLOCK];
+      int n = IMIN(GRU_BLOCK, N-i);
+      for (j=0;j<n;j++) {
+         z[j] = zrh[i+j] + recur[i+j];
+         r[j] = zrh[N+i+j] + recur[N+i+j];
+      }
+      vec_sigmoid(z, z, n);
+      vec_sigmoid(r, r, n);
+      for (j=0;j<n;j++)
+         h[j] = zrh[2*N+i+j] + recur[2*N+i+j]*r[j];
+      vec_tanh(h, h, n);
+      for (j=0;j<n;j++)
+         state[i+j] = z[j]*state[i+j] + (1-z[j])*h[j];
+   }
+}
+
 /* Computes non-padded convolution for input [ ksize1 x in_channels x (len2+ksize2) ],
    kernel [ out_channels x in_channels x ksize1 x ksize2 ],
    storing the output as [ out_channels x len2 ].
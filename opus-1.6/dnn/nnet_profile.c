@@ -0,0 +1,189 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Per-layer DNN profiler, see ENABLE_DNN_PROFILE in nnet.h. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define DNN_PROFILE_IMPL
+#include "nnet.h"
+
+#ifdef ENABLE_DNN_PROFILE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_PROFILE_ENTRIES 1024
+
+#define PROFILE_LINEAR 0
+#define PROFILE_GRU 1
+#define PROFILE_CONV2D 2
+
+typedef struct {
+  const char *model;
+  char name[64];
+  int kind;
+  double calls;
+  double time;
+  double flops;
+  double bytes;
+  double layer_flops;
+  double layer_bytes;
+} ProfileEntry;
+
+static ProfileEntry profile[MAX_PROFILE_ENTRIES];
+static int nb_entries;
+static const char *current_model = "unknown";
+
+static double profile_time(void)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+#else
+  return clock()*(1./CLOCKS_PER_SEC);
+#endif
+}
+
+static void profile_report(void)
+{
+  int order[MAX_PROFILE_ENTRIES];
+  int i, j, k;
+  int done[MAX_PROFILE_ENTRIES] = {0};
+  for (i=0;i<nb_entries;i++) {
+    const char *model;
+    double total=0;
+    int n=0;
+    if (done[i]) continue;
+    model = profile[i].model;
+    for (j=i;j<nb_entries;j++) {
+      if (!done[j] && strcmp(profile[j].model, model) == 0 && profile[j].calls > 0) {
+        /* Insertion sort by decreasing time. */
+        for (k=n;k>0 && profile[order[k-1]].time < profile[j].time;k--) order[k] = order[k-1];
+        order[k] = j;
+        n++;
+        total += profile[j].time;
+      }
+      if (strcmp(profile[j].model, model) == 0) done[j] = 1;
+    }
+    if (n == 0) continue;
+    fprintf(stderr, "DNN profile for %s: %.2f ms total\n", model, 1e3*total);
+    fprintf(stderr, "  %-32s %-6s %10s %10s %6s %10s %8s %10s %8s\n",
+        "layer", "kind", "calls", "ms", "%", "MFLOP", "GFLOP/s", "MB", "GB/s");
+    for (k=0;k<n;k++) {
+      static const char *kinds[] = {"linear", "gru", "conv2d"};
+      const ProfileEntry *e = &profile[order[k]];
+      char name[sizeof(e->name)];
+      char *suffix;
+      strcpy(name, e->name);
+      if ((suffix = strstr(name, "_weight")) != NULL) *suffix = 0;
+      else if ((suffix = strstr(name, "_bias")) != NULL) *suffix = 0;
+      fprintf(stderr, "  %-32s %-6s %10.0f %10.2f %6.1f %10.1f %8.2f %10.1f %8.2f\n",
+          name, kinds[e->kind], e->calls, 1e3*e->time, total > 0 ? 100*e->time/total : 0,
+          1e-6*e->flops, e->time > 0 ? 1e-9*e->flops/e->time : 0,
+          1e-6*e->bytes, e->time > 0 ? 1e-9*e->bytes/e->time : 0);
+    }
+  }
+}
+
+void dnn_profile_model(const char *model)
+{
+  current_model = model;
+}
+
+int dnn_profile_register(const char *name, double flops, double bytes)
+{
+  int i;
+  if (name == NULL) name = "unnamed";
+  /* Models are re-initialized on every reset, keep accumulating into the same entry. */
+  for (i=0;i<nb_entries;i++) {
+    if (strcmp(profile[i].model, current_model) == 0 && strncmp(profile[i].name, name, sizeof(profile[i].name)-1) == 0) return i;
+  }
+  if (nb_entries == MAX_PROFILE_ENTRIES) return -1;
+  if (nb_entries == 0) atexit(profile_report);
+  profile[i].model = current_model;
+  /* Copied, since names from a weights file point into the caller's blob. */
+  strncpy(profile[i].name, name, sizeof(profile[i].name)-1);
+  profile[i].layer_flops = flops;
+  profile[i].layer_bytes = bytes;
+  nb_entries++;
+  return i;
+}
+
+static void profile_add(int id, int kind, double time, double flops, double bytes)
+{
+  if (id < 0) return;
+  profile[id].kind = kind;
+  profile[id].calls++;
+  profile[id].time += time;
+  profile[id].flops += flops;
+  profile[id].bytes += bytes;
+}
+
+static double layer_flops(int id)
+{
+  return id < 0 ? 0 : profile[id].layer_flops;
+}
+
+static double layer_bytes(int id)
+{
+  return id < 0 ? 0 : profile[id].layer_bytes;
+}
+
+void dnn_profile_linear(const LinearLayer *linear, float *out, const float *in, int arch)
+{
+  double start = profile_time();
+  compute_linear(linear, out, in, arch);
+  profile_add(linear->profile_id, PROFILE_LINEAR, profile_time()-start,
+      layer_flops(linear->profile_id), layer_bytes(linear->profile_id));
+}
+
+void dnn_profile_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int arch)
+{
+  double start = profile_time();
+  compute_gru(input_weights, recurrent_weights, state, in, arch);
+  /* The fused GRU is accounted for as a whole on its input layer. */
+  profile_add(input_weights->profile_id, PROFILE_GRU, profile_time()-start,
+      layer_flops(input_weights->profile_id) + layer_flops(recurrent_weights->profile_id),
+      layer_bytes(input_weights->profile_id) + layer_bytes(recurrent_weights->profile_id));
+}
+
+void dnn_profile_conv2d(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation, int arch)
+{
+  double start = profile_time();
+  compute_conv2d(conv, out, mem, in, height, hstride, activation, arch);
+  profile_add(conv->profile_id, PROFILE_CONV2D, profile_time()-start,
+      height*layer_flops(conv->profile_id), layer_bytes(conv->profile_id));
+}
+
+#endif
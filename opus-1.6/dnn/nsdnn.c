@@ -0,0 +1,266 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Noise suppression pre-stage for the encoder. Each 10 ms hop, the network
+   sees the log energies of 22 bands of a 20 ms STFT and returns one gain per
+   band, which is interpolated across the bins before resynthesis. The built-in
+   weights are a hand-initialized model: a GRU whose units track the noise
+   floor and a smoothed level of each band, and a dense layer that gates each
+   band on the difference. nsdnn_weights.py writes them and documents the
+   model. A trained model with the same topology can replace it through the
+   weights blob. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include "nsdnn.h"
+#include "nnet.h"
+#include "arch.h"
+#include "os_support.h"
+
+#define SQUARE(x) ((x)*(x))
+
+#ifndef M_PI
+#define M_PI 3.141592653589793
+#endif
+
+/* Maps band energies in dB to the range in which the GRU candidate
+   activation is close to linear. */
+#define NS_FEATURE_OFFSET 45.f
+#define NS_FEATURE_SCALE .0025f
+
+#define NS_GAIN_FLOOR .03f
+#define NS_GAIN_RELEASE .6f
+
+/* Band edges in units of 4 bins (200 Hz at the 50 Hz resolution of the 20 ms
+   window). The first 18 are the eband5ms layout from freq.c, the rest extend it
+   to fullband. */
+static const opus_int16 ns_eband[NB_NS_BANDS] = {
+/*0  200 400 600 800  1k 1.2 1.4 1.6  2k 2.4 2.8 3.2  4k 4.8 5.6 6.8  8k 9.6  12 15.6 20k*/
+  0,  1,  2,  3,  4,  5,  6,  7,  8, 10, 12, 14, 16, 20, 24, 28, 34, 40, 48, 60, 78, 100
+};
+
+extern const kiss_fft_state kfft;
+extern const kiss_fft_state nsdnn_fft960;
+extern const kiss_fft_state nsdnn_fft480;
+extern const kiss_fft_state nsdnn_fft240;
+extern const kiss_fft_state nsdnn_fft160;
+
+/* Triangular band energies as in lpcn_compute_band_energy(), summed over the
+   channels and normalized by the band weight, so that bands cut off by the
+   Nyquist frequency are not biased. Bins above the last edge go to the last band. */
+static void compute_band_energy(float *bandE, kiss_fft_cpx X[][2*NS_MAX_FRAME], int C, int nyquist)
+{
+  int i, j, c;
+  float sum[NB_NS_BANDS] = {0};
+  float count[NB_NS_BANDS] = {0};
+  for (i=0;i<NB_NS_BANDS-1;i++)
+  {
+    int band_size;
+    band_size = (ns_eband[i+1]-ns_eband[i])*4;
+    for (j=0;j<band_size;j++) {
+      int bin;
+      float tmp=0;
+      float frac = (float)j/band_size;
+      bin = ns_eband[i]*4 + j;
+      if (bin > nyquist) break;
+      for (c=0;c<C;c++) tmp += SQUARE(X[c][bin].r) + SQUARE(X[c][bin].i);
+      sum[i] += (1-frac)*tmp;
+      sum[i+1] += frac*tmp;
+      count[i] += 1-frac;
+      count[i+1] += frac;
+    }
+  }
+  for (j=ns_eband[NB_NS_BANDS-1]*4;j<=nyquist;j++) {
+    for (c=0;c<C;c++) sum[NB_NS_BANDS-1] += SQUARE(X[c][j].r) + SQUARE(X[c][j].i);
+    count[NB_NS_BANDS-1] += 1;
+  }
+  for (i=0;i<NB_NS_BANDS;i++)
+  {
+    bandE[i] = count[i] > 0 ? sum[i]/(C*count[i]) : 0;
+  }
+}
+
+static void interp_band_gain(float *g, const float *bandE, int nyquist)
+{
+  int i, j;
+  for (i=0;i<NB_NS_BANDS-1;i++)
+  {
+    int band_size;
+    band_size = (ns_eband[i+1]-ns_eband[i])*4;
+    for (j=0;j<band_size;j++) {
+      int bin;
+      float frac = (float)j/band_size;
+      bin = ns_eband[i]*4 + j;
+      if (bin > nyquist) break;
+      g[bin] = (1-frac)*bandE[i] + frac*bandE[i+1];
+    }
+  }
+  for (j=ns_eband[NB_NS_BANDS-1]*4;j<=nyquist;j++) g[j] = bandE[NB_NS_BANDS-1];
+}
+
+static void ns_process_frame(NSDNNState *st, float *out, const float *in, int arch)
+{
+  int i, c;
+  int N, F, C;
+  kiss_fft_cpx x[2*NS_MAX_FRAME];
+  kiss_fft_cpx y[2*NS_MAX_FRAME];
+  kiss_fft_cpx X[NS_MAX_CHANNELS][2*NS_MAX_FRAME];
+  float bandE[NB_NS_BANDS];
+  float features[NB_NS_FEATURES+NS_GRU_STATE_SIZE];
+  float g[NB_NS_BANDS];
+  float gf[NS_MAX_FRAME+1];
+  F = st->frame_size;
+  N = 2*F;
+  C = st->channels;
+  for (c=0;c<C;c++) {
+    float *mem = &st->analysis_mem[c*NS_MAX_FRAME];
+    for (i=0;i<F;i++) {
+      x[i].r = st->half_window[i]*mem[i];
+      x[i].i = 0;
+      x[F+i].r = st->half_window[F-1-i]*in[i*C+c];
+      x[F+i].i = 0;
+      mem[i] = in[i*C+c];
+    }
+    opus_fft(st->kfft, x, X[c], 0);
+  }
+  compute_band_energy(bandE, X, C, F);
+  for (i=0;i<NB_NS_BANDS;i++) {
+    /* The FFT is scaled by 1/N, so 2*N*|X|^2 is the power per sample. */
+    features[i] = NS_FEATURE_SCALE*(10.f*(float)log10(2*N*bandE[i] + 1e-10f) + NS_FEATURE_OFFSET);
+  }
+  compute_generic_gru(&st->model.ns_gru_input, &st->model.ns_gru_recurrent, st->gru_state, features, arch);
+  OPUS_COPY(&features[NB_NS_FEATURES], st->gru_state, NS_GRU_STATE_SIZE);
+  compute_generic_dense(&st->model.ns_dense_gain, g, features, ACTIVATION_SIGMOID, arch);
+  for (i=0;i<NB_NS_BANDS;i++) {
+    /* Limit how fast the gain can drop to avoid chopping the tail of words. */
+    g[i] = MAX16(NS_GAIN_FLOOR, MAX16(g[i], NS_GAIN_RELEASE*st->gains[i]));
+    st->gains[i] = g[i];
+  }
+  interp_band_gain(gf, g, F);
+  for (c=0;c<C;c++) {
+    float *mem = &st->synthesis_mem[c*NS_MAX_FRAME];
+    for (i=0;i<=F;i++) {
+      x[i].r = gf[i]*X[c][i].r;
+      x[i].i = gf[i]*X[c][i].i;
+    }
+    for (;i<N;i++) {
+      x[i].r = x[N-i].r;
+      x[i].i = -x[N-i].i;
+    }
+    opus_fft(st->kfft, x, y, 0);
+    /* output in reverse order for IFFT. */
+    out[c] = mem[0] + N*st->half_window[0]*y[0].r;
+    for (i=1;i<F;i++) {
+      out[i*C+c] = mem[i] + N*st->half_window[i]*y[N-i].r;
+    }
+    for (i=0;i<F;i++) {
+      mem[i] = N*st->half_window[F-1-i]*y[F-i].r;
+    }
+  }
+}
+
+void nsdnn_process(NSDNNState *st, float *out, const float *in, int frame_size, int arch)
+{
+  int i;
+  celt_assert(st->loaded);
+  celt_assert(frame_size % st->frame_size == 0);
+  for (i=0;i<frame_size;i+=st->frame_size) {
+    ns_process_frame(st, &out[i*st->channels], &in[i*st->channels], arch);
+  }
+}
+
+void nsdnn_bypass(NSDNNState *st, float *out, const float *in, int frame_size)
+{
+  int i, c;
+  int F, C;
+  F = st->frame_size;
+  C = st->channels;
+  celt_assert(frame_size <= F);
+  for (c=0;c<C;c++) {
+    float *mem = &st->analysis_mem[c*NS_MAX_FRAME];
+    float *syn = &st->synthesis_mem[c*NS_MAX_FRAME];
+    for (i=0;i<frame_size;i++) out[i*C+c] = mem[i];
+    OPUS_MOVE(mem, &mem[frame_size], F-frame_size);
+    for (i=0;i<frame_size;i++) mem[F-frame_size+i] = in[i*C+c];
+    /* What the overlap-add would hold with a unity gain, so that the next
+       denoised hop cross-fades from the unprocessed signal. */
+    for (i=0;i<F;i++) syn[i] = st->half_window[F-1-i]*st->half_window[F-1-i]*mem[i];
+  }
+}
+
+void nsdnn_reset(NSDNNState *st)
+{
+  int i;
+  OPUS_CLEAR((char*)&st->NSDNN_RESET_START,
+            sizeof(NSDNNState)-
+            ((char*)&st->NSDNN_RESET_START - (char*)st));
+  for (i=0;i<NB_NS_BANDS;i++) st->gains[i] = 1;
+}
+
+int nsdnn_init(NSDNNState *st, opus_int32 Fs, int channels)
+{
+  int i;
+  st->loaded = 0;
+  if (channels < 1 || channels > NS_MAX_CHANNELS) return -1;
+  switch (Fs) {
+    case 48000: st->kfft = &nsdnn_fft960; break;
+    case 24000: st->kfft = &nsdnn_fft480; break;
+    case 16000: st->kfft = &kfft; break;
+    case 12000: st->kfft = &nsdnn_fft240; break;
+    case 8000: st->kfft = &nsdnn_fft160; break;
+    default: return -1;
+  }
+  st->Fs = Fs;
+  st->channels = channels;
+  st->frame_size = Fs/100;
+  celt_assert(2*st->frame_size == st->kfft->nfft);
+  for (i=0;i<st->frame_size;i++) {
+    /* Vorbis window, which is power-complementary with a 50% overlap. */
+    float tmp = (float)sin(.5*M_PI*(i+.5)/st->frame_size);
+    st->half_window[i] = (float)sin(.5*M_PI*tmp*tmp);
+  }
+#ifndef USE_WEIGHTS_FILE
+  DNN_PROFILE_MODEL("nsdnn");
+  if (init_nsdnn(&st->model, nsdnn_arrays) == 0) st->loaded = 1;
+#endif
+  nsdnn_reset(st);
+  return 0;
+}
+
+int nsdnn_load_model(NSDNNState *st, const void *data, int len)
+{
+  WeightArray *list;
+  int ret;
+  parse_weights(&list, data, len);
+  DNN_PROFILE_MODEL("nsdnn");
+  ret = init_nsdnn(&st->model, list);
+  opus_free(list);
+  if (ret == 0) st->loaded = 1;
+  return (ret == 0) ? 0 : -1;
+}
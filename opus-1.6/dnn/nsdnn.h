@@ -0,0 +1,71 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef NSDNN_H
+#define NSDNN_H
+
+#include "opus_types.h"
+#include "nsdnn_data.h"
+#include "kiss_fft.h"
+
+/* Noise suppression runs on a 10 ms hop with a 20 ms power-complementary
+   window, so it delays the signal by one hop. */
+#define NS_MAX_FRAME 480
+#define NS_MAX_CHANNELS 2
+#define NB_NS_BANDS 22
+#define NB_NS_FEATURES NB_NS_BANDS
+
+typedef struct {
+  NSDNN model;
+  int loaded;
+  opus_int32 Fs;
+  int channels;
+  int frame_size;
+  const kiss_fft_state *kfft;
+  float half_window[NS_MAX_FRAME];
+#define NSDNN_RESET_START analysis_mem
+  float analysis_mem[NS_MAX_CHANNELS*NS_MAX_FRAME];
+  float synthesis_mem[NS_MAX_CHANNELS*NS_MAX_FRAME];
+  float gru_state[NS_GRU_STATE_SIZE];
+  float gains[NB_NS_BANDS];
+} NSDNNState;
+
+/** Initializes the denoiser for Fs in {8,12,16,24,48} kHz and 1 or 2 channels. */
+int nsdnn_init(NSDNNState *st, opus_int32 Fs, int channels);
+
+int nsdnn_load_model(NSDNNState *st, const void *data, int len);
+
+void nsdnn_reset(NSDNNState *st);
+
+/** Denoises frame_size samples per channel (a multiple of Fs/100) of
+    interleaved audio from in to out. The output is delayed by Fs/100. */
+void nsdnn_process(NSDNNState *st, float *out, const float *in, int frame_size, int arch);
+
+/** Delays frame_size samples per channel (at most Fs/100) by Fs/100 without
+    denoising, for frames too short for the denoiser. */
+void nsdnn_bypass(NSDNNState *st, float *out, const float *in, int frame_size);
+
+#endif
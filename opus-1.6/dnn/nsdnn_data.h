@@ -0,0 +1,30 @@
+/* Auto generated by nsdnn_weights.py from a hand-initialized noise floor tracking model */
+
+
+#ifndef NSDNN_DATA_H
+#define NSDNN_DATA_H
+
+#include "nnet.h"
+
+
+#include "opus_types.h"
+
+#define NS_DENSE_GAIN_OUT_SIZE 22
+
+#define NS_GRU_OUT_SIZE 45
+
+#define NS_GRU_STATE_SIZE 45
+
+
+#define NSDNN_MAX_RNN_UNITS 45
+
+
+typedef struct {
+    LinearLayer ns_dense_gain;
+    LinearLayer ns_gru_input;
+    LinearLayer ns_gru_recurrent;
+} NSDNN;
+
+int init_nsdnn(NSDNN *model, const WeightArray *arrays);
+
+#endif /* NSDNN_DATA_H */
@@ -0,0 +1,750 @@
+/* The contents of this file was automatically generated from opus_fft_alloc() states of a
+   custom-modes build, as in lpcnet_tables.c */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include "kiss_fft.h"
+
+static const arch_fft_state arch_fft = {0, NULL};
+
+static const kiss_twiddle_cpx fft_twiddles960[960] = {
+{1.00000000f, -0.00000000f}, {0.999978602f, -0.00654493785f},
+{0.999914348f, -0.0130895954f}, {0.999807239f, -0.0196336918f},
+{0.999657333f, -0.0261769481f}, {0.999464571f, -0.0327190831f},
+{0.999229014f, -0.0392598175f}, {0.998950660f, -0.0457988679f},
+{0.998629510f, -0.0523359552f}, {0.998265624f, -0.0588708036f},
+{0.997858942f, -0.0654031262f}, {0.997409463f, -0.0719326511f},
+{0.996917307f, -0.0784590989f}, {0.996382475f, -0.0849821791f},
+{0.995804906f, -0.0915016159f}, {0.995184720f, -0.0980171412f},
+{0.994521916f, -0.104528464f}, {0.993816435f, -0.111035310f},
+{0.993068457f, -0.117537394f}, {0.992277920f, -0.124034449f},
+{0.991444886f, -0.130526185f}, {0.990569353f, -0.137012348f},
+{0.989651382f, -0.143492624f}, {0.988691032f, -0.149966761f},
+{0.987688363f, -0.156434461f}, {0.986643314f, -0.162895471f},
+{0.985556066f, -0.169349506f}, {0.984426558f, -0.175796285f},
+{0.983254910f, -0.182235524f}, {0.982041121f, -0.188666970f},
+{0.980785251f, -0.195090324f}, {0.979487419f, -0.201505318f},
+{0.978147626f, -0.207911685f}, {0.976765871f, -0.214309156f},
+{0.975342333f, -0.220697433f}, {0.973876953f, -0.227076262f},
+{0.972369909f, -0.233445361f}, {0.970821202f, -0.239804462f},
+{0.969230890f, -0.246153295f}, {0.967599094f, -0.252491564f},
+{0.965925813f, -0.258819044f}, {0.964211166f, -0.265135437f},
+{0.962455213f, -0.271440446f}, {0.960658073f, -0.277733833f},
+{0.958819747f, -0.284015357f}, {0.956940353f, -0.290284663f},
+{0.955019951f, -0.296541572f}, {0.953058660f, -0.302785784f},
+{0.951056540f, -0.309017003f}, {0.949013650f, -0.315234989f},
+{0.946930110f, -0.321439475f}, {0.944806039f, -0.327630192f},
+{0.942641497f, -0.333806872f}, {0.940436542f, -0.339969248f},
+{0.938191354f, -0.346117049f}, {0.935905933f, -0.352250040f},
+{0.933580399f, -0.358367950f}, {0.931214929f, -0.364470512f},
+{0.928809524f, -0.370557427f}, {0.926364362f, -0.376628488f},
+{0.923879504f, -0.382683426f}, {0.921355128f, -0.388721973f},
+{0.918791234f, -0.394743860f}, {0.916187942f, -0.400748819f},
+{0.913545430f, -0.406736642f}, {0.910863817f, -0.412707031f},
+{0.908143163f, -0.418659747f}, {0.905383646f, -0.424594522f},
+{0.902585268f, -0.430511087f}, {0.899748266f, -0.436409235f},
+{0.896872759f, -0.442288697f}, {0.893958807f, -0.448149204f},
+{0.891006529f, -0.453990489f}, {0.888016105f, -0.459812373f},
+{0.884987652f, -0.465614527f}, {0.881921291f, -0.471396744f},
+{0.878817141f, -0.477158755f}, {0.875675321f, -0.482900351f},
+{0.872496009f, -0.488621235f}, {0.869279325f, -0.494321197f},
+{0.866025388f, -0.500000000f}, {0.862734377f, -0.505657375f},
+{0.859406412f, -0.511293113f}, {0.856041610f, -0.516906917f},
+{0.852640152f, -0.522498548f}, {0.849202156f, -0.528067827f},
+{0.845727801f, -0.533614516f}, {0.842217207f, -0.539138317f},
+{0.838670552f, -0.544639051f}, {0.835087955f, -0.550116420f},
+{0.831469595f, -0.555570245f}, {0.827815652f, -0.561000228f},
+{0.824126184f, -0.566406250f}, {0.820401430f, -0.571787953f},
+{0.816641569f, -0.577145219f}, {0.812846661f, -0.582477689f},
+{0.809017003f, -0.587785244f}, {0.805152655f, -0.593067646f},
+{0.801253796f, -0.598324597f}, {0.797320664f, -0.603555918f},
+{0.793353319f, -0.608761430f}, {0.789352059f, -0.613940835f},
+{0.785316944f, -0.619093955f}, {0.781248152f, -0.624220550f},
+{0.777145982f, -0.629320383f}, {0.773010433f, -0.634393275f},
+{0.768841803f, -0.639438987f}, {0.764640272f, -0.644457340f},
+{0.760405958f, -0.649448037f}, {0.756139100f, -0.654410958f},
+{0.751839817f, -0.659345806f}, {0.747508347f, -0.664252460f},
+{0.743144810f, -0.669130623f}, {0.738749504f, -0.673980117f},
+{0.734322488f, -0.678800762f}, {0.729864061f, -0.683592319f},
+{0.725374401f, -0.688354552f}, {0.720853567f, -0.693087339f},
+{0.716301918f, -0.697790444f}, {0.711719632f, -0.702463686f},
+{0.707106769f, -0.707106769f}, {0.702463686f, -0.711719632f},
+{0.697790444f, -0.716301918f}, {0.693087339f, -0.720853567f},
+{0.688354552f, -0.725374401f}, {0.683592319f, -0.729864061f},
+{0.678800762f, -0.734322488f}, {0.673980117f, -0.738749504f},
+{0.669130623f, -0.743144810f}, {0.664252460f, -0.747508347f},
+{0.659345806f, -0.751839817f}, {0.654410958f, -0.756139100f},
+{0.649448037f, -0.760405958f}, {0.644457340f, -0.764640272f},
+{0.639438987f, -0.768841803f}, {0.634393275f, -0.773010433f},
+{0.629320383f, -0.777145982f}, {0.624220550f, -0.781248152f},
+{0.619093955f, -0.785316944f}, {0.613940835f, -0.789352059f},
+{0.608761430f, -0.793353319f}, {0.603555918f, -0.797320664f},
+{0.598324597f, -0.801253796f}, {0.593067646f, -0.805152655f},
+{0.587785244f, -0.809017003f}, {0.582477689f, -0.812846661f},
+{0.577145219f, -0.816641569f}, {0.571787953f, -0.820401430f},
+{0.566406250f, -0.824126184f}, {0.561000228f, -0.827815652f},
+{0.555570245f, -0.831469595f}, {0.550116420f, -0.835087955f},
+{0.544639051f, -0.838670552f}, {0.539138317f, -0.842217207f},
+{0.533614516f, -0.845727801f}, {0.528067827f, -0.849202156f},
+{0.522498548f, -0.852640152f}, {0.516906917f, -0.856041610f},
+{0.511293113f, -0.859406412f}, {0.505657375f, -0.862734377f},
+{0.500000000f, -0.866025388f}, {0.494321197f, -0.869279325f},
+{0.488621235f, -0.872496009f}, {0.482900351f, -0.875675321f},
+{0.477158755f, -0.878817141f}, {0.471396744f, -0.881921291f},
+{0.465614527f, -0.884987652f}, {0.459812373f, -0.888016105f},
+{0.453990489f, -0.891006529f}, {0.448149204f, -0.893958807f},
+{0.442288697f, -0.896872759f}, {0.436409235f, -0.899748266f},
+{0.430511087f, -0.902585268f}, {0.424594522f, -0.905383646f},
+{0.418659747f, -0.908143163f}, {0.412707031f, -0.910863817f},
+{0.406736642f, -0.913545430f}, {0.400748819f, -0.916187942f},
+{0.394743860f, -0.918791234f}, {0.388721973f, -0.921355128f},
+{0.382683426f, -0.923879504f}, {0.376628488f, -0.926364362f},
+{0.370557427f, -0.928809524f}, {0.364470512f, -0.931214929f},
+{0.358367950f, -0.933580399f}, {0.352250040f, -0.935905933f},
+{0.346117049f, -0.938191354f}, {0.339969248f, -0.940436542f},
+{0.333806872f, -0.942641497f}, {0.327630192f, -0.944806039f},
+{0.321439475f, -0.946930110f}, {0.315234989f, -0.949013650f},
+{0.309017003f, -0.951056540f}, {0.302785784f, -0.953058660f},
+{0.296541572f, -0.955019951f}, {0.290284663f, -0.956940353f},
+{0.284015357f, -0.958819747f}, {0.277733833f, -0.960658073f},
+{0.271440446f, -0.962455213f}, {0.265135437f, -0.964211166f},
+{0.258819044f, -0.965925813f}, {0.252491564f, -0.967599094f},
+{0.246153295f, -0.969230890f}, {0.239804462f, -0.970821202f},
+{0.233445361f, -0.972369909f}, {0.227076262f, -0.973876953f},
+{0.220697433f, -0.975342333f}, {0.214309156f, -0.976765871f},
+{0.207911685f, -0.978147626f}, {0.201505318f, -0.979487419f},
+{0.195090324f, -0.980785251f}, {0.188666970f, -0.982041121f},
+{0.182235524f, -0.983254910f}, {0.175796285f, -0.984426558f},
+{0.169349506f, -0.985556066f}, {0.162895471f, -0.986643314f},
+{0.156434461f, -0.987688363f}, {0.149966761f, -0.988691032f},
+{0.143492624f, -0.989651382f}, {0.137012348f, -0.990569353f},
+{0.130526185f, -0.991444886f}, {0.124034449f, -0.992277920f},
+{0.117537394f, -0.993068457f}, {0.111035310f, -0.993816435f},
+{0.104528464f, -0.994521916f}, {0.0980171412f, -0.995184720f},
+{0.0915016159f, -0.995804906f}, {0.0849821791f, -0.996382475f},
+{0.0784590989f, -0.996917307f}, {0.0719326511f, -0.997409463f},
+{0.0654031262f, -0.997858942f}, {0.0588708036f, -0.998265624f},
+{0.0523359552f, -0.998629510f}, {0.0457988679f, -0.998950660f},
+{0.0392598175f, -0.999229014f}, {0.0327190831f, -0.999464571f},
+{0.0261769481f, -0.999657333f}, {0.0196336918f, -0.999807239f},
+{0.0130895954f, -0.999914348f}, {0.00654493785f, -0.999978602f},
+{6.12323426e-17f, -1.00000000f}, {-0.00654493785f, -0.999978602f},
+{-0.0130895954f, -0.999914348f}, {-0.0196336918f, -0.999807239f},
+{-0.0261769481f, -0.999657333f}, {-0.0327190831f, -0.999464571f},
+{-0.0392598175f, -0.999229014f}, {-0.0457988679f, -0.998950660f},
+{-0.0523359552f, -0.998629510f}, {-0.0588708036f, -0.998265624f},
+{-0.0654031262f, -0.997858942f}, {-0.0719326511f, -0.997409463f},
+{-0.0784590989f, -0.996917307f}, {-0.0849821791f, -0.996382475f},
+{-0.0915016159f, -0.995804906f}, {-0.0980171412f, -0.995184720f},
+{-0.104528464f, -0.994521916f}, {-0.111035310f, -0.993816435f},
+{-0.117537394f, -0.993068457f}, {-0.124034449f, -0.992277920f},
+{-0.130526185f, -0.991444886f}, {-0.137012348f, -0.990569353f},
+{-0.143492624f, -0.989651382f}, {-0.149966761f, -0.988691032f},
+{-0.156434461f, -0.987688363f}, {-0.162895471f, -0.986643314f},
+{-0.169349506f, -0.985556066f}, {-0.175796285f, -0.984426558f},
+{-0.182235524f, -0.983254910f}, {-0.188666970f, -0.982041121f},
+{-0.195090324f, -0.980785251f}, {-0.201505318f, -0.979487419f},
+{-0.207911685f, -0.978147626f}, {-0.214309156f, -0.976765871f},
+{-0.220697433f, -0.975342333f}, {-0.227076262f, -0.973876953f},
+{-0.233445361f, -0.972369909f}, {-0.239804462f, -0.970821202f},
+{-0.246153295f, -0.969230890f}, {-0.252491564f, -0.967599094f},
+{-0.258819044f, -0.965925813f}, {-0.265135437f, -0.964211166f},
+{-0.271440446f, -0.962455213f}, {-0.277733833f, -0.960658073f},
+{-0.284015357f, -0.958819747f}, {-0.290284663f, -0.956940353f},
+{-0.296541572f, -0.955019951f}, {-0.302785784f, -0.953058660f},
+{-0.309017003f, -0.951056540f}, {-0.315234989f, -0.949013650f},
+{-0.321439475f, -0.946930110f}, {-0.327630192f, -0.944806039f},
+{-0.333806872f, -0.942641497f}, {-0.339969248f, -0.940436542f},
+{-0.346117049f, -0.938191354f}, {-0.352250040f, -0.935905933f},
+{-0.358367950f, -0.933580399f}, {-0.364470512f, -0.931214929f},
+{-0.370557427f, -0.928809524f}, {-0.376628488f, -0.926364362f},
+{-0.382683426f, -0.923879504f}, {-0.388721973f, -0.921355128f},
+{-0.394743860f, -0.918791234f}, {-0.400748819f, -0.916187942f},
+{-0.406736642f, -0.913545430f}, {-0.412707031f, -0.910863817f},
+{-0.418659747f, -0.908143163f}, {-0.424594522f, -0.905383646f},
+{-0.430511087f, -0.902585268f}, {-0.436409235f, -0.899748266f},
+{-0.442288697f, -0.896872759f}, {-0.448149204f, -0.893958807f},
+{-0.453990489f, -0.891006529f}, {-0.459812373f, -0.888016105f},
+{-0.465614527f, -0.884987652f}, {-0.471396744f, -0.881921291f},
+{-0.477158755f, -0.878817141f}, {-0.482900351f, -0.875675321f},
+{-0.488621235f, -0.872496009f}, {-0.494321197f, -0.869279325f},
+{-0.500000000f, -0.866025388f}, {-0.505657375f, -0.862734377f},
+{-0.511293113f, -0.859406412f}, {-0.516906917f, -0.856041610f},
+{-0.522498548f, -0.852640152f}, {-0.528067827f, -0.849202156f},
+{-0.533614516f, -0.845727801f}, {-0.539138317f, -0.842217207f},
+{-0.544639051f, -0.838670552f}, {-0.550116420f, -0.835087955f},
+{-0.555570245f, -0.831469595f}, {-0.561000228f, -0.827815652f},
+{-0.566406250f, -0.824126184f}, {-0.571787953f, -0.820401430f},
+{-0.577145219f, -0.816641569f}, {-0.582477689f, -0.812846661f},
+{-0.587785244f, -0.809017003f}, {-0.593067646f, -0.805152655f},
+{-0.598324597f, -0.801253796f}, {-0.603555918f, -0.797320664f},
+{-0.608761430f, -0.793353319f}, {-0.613940835f, -0.789352059f},
+{-0.619093955f, -0.785316944f}, {-0.624220550f, -0.781248152f},
+{-0.629320383f, -0.777145982f}, {-0.634393275f, -0.773010433f},
+{-0.639438987f, -0.768841803f}, {-0.644457340f, -0.764640272f},
+{-0.649448037f, -0.760405958f}, {-0.654410958f, -0.756139100f},
+{-0.659345806f, -0.751839817f}, {-0.664252460f, -0.747508347f},
+{-0.669130623f, -0.743144810f}, {-0.673980117f, -0.738749504f},
+{-0.678800762f, -0.734322488f}, {-0.683592319f, -0.729864061f},
+{-0.688354552f, -0.725374401f}, {-0.693087339f, -0.720853567f},
+{-0.697790444f, -0.716301918f}, {-0.702463686f, -0.711719632f},
+{-0.707106769f, -0.707106769f}, {-0.711719632f, -0.702463686f},
+{-0.716301918f, -0.697790444f}, {-0.720853567f, -0.693087339f},
+{-0.725374401f, -0.688354552f}, {-0.729864061f, -0.683592319f},
+{-0.734322488f, -0.678800762f}, {-0.738749504f, -0.673980117f},
+{-0.743144810f, -0.669130623f}, {-0.747508347f, -0.664252460f},
+{-0.751839817f, -0.659345806f}, {-0.756139100f, -0.654410958f},
+{-0.760405958f, -0.649448037f}, {-0.764640272f, -0.644457340f},
+{-0.768841803f, -0.639438987f}, {-0.773010433f, -0.634393275f},
+{-0.777145982f, -0.629320383f}, {-0.781248152f, -0.624220550f},
+{-0.785316944f, -0.619093955f}, {-0.789352059f, -0.613940835f},
+{-0.793353319f, -0.608761430f}, {-0.797320664f, -0.603555918f},
+{-0.801253796f, -0.598324597f}, {-0.805152655f, -0.593067646f},
+{-0.809017003f, -0.587785244f}, {-0.812846661f, -0.582477689f},
+{-0.816641569f, -0.577145219f}, {-0.820401430f, -0.571787953f},
+{-0.824126184f, -0.566406250f}, {-0.827815652f, -0.561000228f},
+{-0.831469595f, -0.555570245f}, {-0.835087955f, -0.550116420f},
+{-0.838670552f, -0.544639051f}, {-0.842217207f, -0.539138317f},
+{-0.845727801f, -0.533614516f}, {-0.849202156f, -0.528067827f},
+{-0.852640152f, -0.522498548f}, {-0.856041610f, -0.516906917f},
+{-0.859406412f, -0.511293113f}, {-0.862734377f, -0.505657375f},
+{-0.866025388f, -0.500000000f}, {-0.869279325f, -0.494321197f},
+{-0.872496009f, -0.488621235f}, {-0.875675321f, -0.482900351f},
+{-0.878817141f, -0.477158755f}, {-0.881921291f, -0.471396744f},
+{-0.884987652f, -0.465614527f}, {-0.888016105f, -0.459812373f},
+{-0.891006529f, -0.453990489f}, {-0.893958807f, -0.448149204f},
+{-0.896872759f, -0.442288697f}, {-0.899748266f, -0.436409235f},
+{-0.902585268f, -0.430511087f}, {-0.905383646f, -0.424594522f},
+{-0.908143163f, -0.418659747f}, {-0.910863817f, -0.412707031f},
+{-0.913545430f, -0.406736642f}, {-0.916187942f, -0.400748819f},
+{-0.918791234f, -0.394743860f}, {-0.921355128f, -0.388721973f},
+{-0.923879504f, -0.382683426f}, {-0.926364362f, -0.376628488f},
+{-0.928809524f, -0.370557427f}, {-0.931214929f, -0.364470512f},
+{-0.933580399f, -0.358367950f}, {-0.935905933f, -0.352250040f},
+{-0.938191354f, -0.346117049f}, {-0.940436542f, -0.339969248f},
+{-0.942641497f, -0.333806872f}, {-0.944806039f, -0.327630192f},
+{-0.946930110f, -0.321439475f}, {-0.949013650f, -0.315234989f},
+{-0.951056540f, -0.309017003f}, {-0.953058660f, -0.302785784f},
+{-0.955019951f, -0.296541572f}, {-0.956940353f, -0.290284663f},
+{-0.958819747f, -0.284015357f}, {-0.960658073f, -0.277733833f},
+{-0.962455213f, -0.271440446f}, {-0.964211166f, -0.265135437f},
+{-0.965925813f, -0.258819044f}, {-0.967599094f, -0.252491564f},
+{-0.969230890f, -0.246153295f}, {-0.970821202f, -0.239804462f},
+{-0.972369909f, -0.233445361f}, {-0.973876953f, -0.227076262f},
+{-0.975342333f, -0.220697433f}, {-0.976765871f, -0.214309156f},
+{-0.978147626f, -0.207911685f}, {-0.979487419f, -0.201505318f},
+{-0.980785251f, -0.195090324f}, {-0.982041121f, -0.188666970f},
+{-0.983254910f, -0.182235524f}, {-0.984426558f, -0.175796285f},
+{-0.985556066f, -0.169349506f}, {-0.986643314f, -0.162895471f},
+{-0.987688363f, -0.156434461f}, {-0.988691032f, -0.149966761f},
+{-0.989651382f, -0.143492624f}, {-0.990569353f, -0.137012348f},
+{-0.991444886f, -0.130526185f}, {-0.992277920f, -0.124034449f},
+{-0.993068457f, -0.117537394f}, {-0.993816435f, -0.111035310f},
+{-0.994521916f, -0.104528464f}, {-0.995184720f, -0.0980171412f},
+{-0.995804906f, -0.0915016159f}, {-0.996382475f, -0.0849821791f},
+{-0.996917307f, -0.0784590989f}, {-0.997409463f, -0.0719326511f},
+{-0.997858942f, -0.0654031262f}, {-0.998265624f, -0.0588708036f},
+{-0.998629510f, -0.0523359552f}, {-0.998950660f, -0.0457988679f},
+{-0.999229014f, -0.0392598175f}, {-0.999464571f, -0.0327190831f},
+{-0.999657333f, -0.0261769481f}, {-0.999807239f, -0.0196336918f},
+{-0.999914348f, -0.0130895954f}, {-0.999978602f, -0.00654493785f},
+{-1.00000000f, -1.22464685e-16f}, {-0.999978602f, 0.00654493785f},
+{-0.999914348f, 0.0130895954f}, {-0.999807239f, 0.0196336918f},
+{-0.999657333f, 0.0261769481f}, {-0.999464571f, 0.0327190831f},
+{-0.999229014f, 0.0392598175f}, {-0.998950660f, 0.0457988679f},
+{-0.998629510f, 0.0523359552f}, {-0.998265624f, 0.0588708036f},
+{-0.997858942f, 0.0654031262f}, {-0.997409463f, 0.0719326511f},
+{-0.996917307f, 0.0784590989f}, {-0.996382475f, 0.0849821791f},
+{-0.995804906f, 0.0915016159f}, {-0.995184720f, 0.0980171412f},
+{-0.994521916f, 0.104528464f}, {-0.993816435f, 0.111035310f},
+{-0.993068457f, 0.117537394f}, {-0.992277920f, 0.124034449f},
+{-0.991444886f, 0.130526185f}, {-0.990569353f, 0.137012348f},
+{-0.989651382f, 0.143492624f}, {-0.988691032f, 0.149966761f},
+{-0.987688363f, 0.156434461f}, {-0.986643314f, 0.162895471f},
+{-0.985556066f, 0.169349506f}, {-0.984426558f, 0.175796285f},
+{-0.983254910f, 0.182235524f}, {-0.982041121f, 0.188666970f},
+{-0.980785251f, 0.195090324f}, {-0.979487419f, 0.201505318f},
+{-0.978147626f, 0.207911685f}, {-0.976765871f, 0.214309156f},
+{-0.975342333f, 0.220697433f}, {-0.973876953f, 0.227076262f},
+{-0.972369909f, 0.233445361f}, {-0.970821202f, 0.239804462f},
+{-0.969230890f, 0.246153295f}, {-0.967599094f, 0.252491564f},
+{-0.965925813f, 0.258819044f}, {-0.964211166f, 0.265135437f},
+{-0.962455213f, 0.271440446f}, {-0.960658073f, 0.277733833f},
+{-0.958819747f, 0.284015357f}, {-0.956940353f, 0.290284663f},
+{-0.955019951f, 0.296541572f}, {-0.953058660f, 0.302785784f},
+{-0.951056540f, 0.309017003f}, {-0.949013650f, 0.315234989f},
+{-0.946930110f, 0.321439475f}, {-0.944806039f, 0.327630192f},
+{-0.942641497f, 0.333806872f}, {-0.940436542f, 0.339969248f},
+{-0.938191354f, 0.346117049f}, {-0.935905933f, 0.352250040f},
+{-0.933580399f, 0.358367950f}, {-0.931214929f, 0.364470512f},
+{-0.928809524f, 0.370557427f}, {-0.926364362f, 0.376628488f},
+{-0.923879504f, 0.382683426f}, {-0.921355128f, 0.388721973f},
+{-0.918791234f, 0.394743860f}, {-0.916187942f, 0.400748819f},
+{-0.913545430f, 0.406736642f}, {-0.910863817f, 0.412707031f},
+{-0.908143163f, 0.418659747f}, {-0.905383646f, 0.424594522f},
+{-0.902585268f, 0.430511087f}, {-0.899748266f, 0.436409235f},
+{-0.896872759f, 0.442288697f}, {-0.893958807f, 0.448149204f},
+{-0.891006529f, 0.453990489f}, {-0.888016105f, 0.459812373f},
+{-0.884987652f, 0.465614527f}, {-0.881921291f, 0.471396744f},
+{-0.878817141f, 0.477158755f}, {-0.875675321f, 0.482900351f},
+{-0.872496009f, 0.488621235f}, {-0.869279325f, 0.494321197f},
+{-0.866025388f, 0.500000000f}, {-0.862734377f, 0.505657375f},
+{-0.859406412f, 0.511293113f}, {-0.856041610f, 0.516906917f},
+{-0.852640152f, 0.522498548f}, {-0.849202156f, 0.528067827f},
+{-0.845727801f, 0.533614516f}, {-0.842217207f, 0.539138317f},
+{-0.838670552f, 0.544639051f}, {-0.835087955f, 0.550116420f},
+{-0.831469595f, 0.555570245f}, {-0.827815652f, 0.561000228f},
+{-0.824126184f, 0.566406250f}, {-0.820401430f, 0.571787953f},
+{-0.816641569f, 0.577145219f}, {-0.812846661f, 0.582477689f},
+{-0.809017003f, 0.587785244f}, {-0.805152655f, 0.593067646f},
+{-0.801253796f, 0.598324597f}, {-0.797320664f, 0.603555918f},
+{-0.793353319f, 0.608761430f}, {-0.789352059f, 0.613940835f},
+{-0.785316944f, 0.619093955f}, {-0.781248152f, 0.624220550f},
+{-0.777145982f, 0.629320383f}, {-0.773010433f, 0.634393275f},
+{-0.768841803f, 0.639438987f}, {-0.764640272f, 0.644457340f},
+{-0.760405958f, 0.649448037f}, {-0.756139100f, 0.654410958f},
+{-0.751839817f, 0.659345806f}, {-0.747508347f, 0.664252460f},
+{-0.743144810f, 0.669130623f}, {-0.738749504f, 0.673980117f},
+{-0.734322488f, 0.678800762f}, {-0.729864061f, 0.683592319f},
+{-0.725374401f, 0.688354552f}, {-0.720853567f, 0.693087339f},
+{-0.716301918f, 0.697790444f}, {-0.711719632f, 0.702463686f},
+{-0.707106769f, 0.707106769f}, {-0.702463686f, 0.711719632f},
+{-0.697790444f, 0.716301918f}, {-0.693087339f, 0.720853567f},
+{-0.688354552f, 0.725374401f}, {-0.683592319f, 0.729864061f},
+{-0.678800762f, 0.734322488f}, {-0.673980117f, 0.738749504f},
+{-0.669130623f, 0.743144810f}, {-0.664252460f, 0.747508347f},
+{-0.659345806f, 0.751839817f}, {-0.654410958f, 0.756139100f},
+{-0.649448037f, 0.760405958f}, {-0.644457340f, 0.764640272f},
+{-0.639438987f, 0.768841803f}, {-0.634393275f, 0.773010433f},
+{-0.629320383f, 0.777145982f}, {-0.624220550f, 0.781248152f},
+{-0.619093955f, 0.785316944f}, {-0.613940835f, 0.789352059f},
+{-0.608761430f, 0.793353319f}, {-0.603555918f, 0.797320664f},
+{-0.598324597f, 0.801253796f}, {-0.593067646f, 0.805152655f},
+{-0.587785244f, 0.809017003f}, {-0.582477689f, 0.812846661f},
+{-0.577145219f, 0.816641569f}, {-0.571787953f, 0.820401430f},
+{-0.566406250f, 0.824126184f}, {-0.561000228f, 0.827815652f},
+{-0.555570245f, 0.831469595f}, {-0.550116420f, 0.835087955f},
+{-0.544639051f, 0.838670552f}, {-0.539138317f, 0.842217207f},
+{-0.533614516f, 0.845727801f}, {-0.528067827f, 0.849202156f},
+{-0.522498548f, 0.852640152f}, {-0.516906917f, 0.856041610f},
+{-0.511293113f, 0.859406412f}, {-0.505657375f, 0.862734377f},
+{-0.500000000f, 0.866025388f}, {-0.494321197f, 0.869279325f},
+{-0.488621235f, 0.872496009f}, {-0.482900351f, 0.875675321f},
+{-0.477158755f, 0.878817141f}, {-0.471396744f, 0.881921291f},
+{-0.465614527f, 0.884987652f}, {-0.459812373f, 0.888016105f},
+{-0.453990489f, 0.891006529f}, {-0.448149204f, 0.893958807f},
+{-0.442288697f, 0.896872759f}, {-0.436409235f, 0.899748266f},
+{-0.430511087f, 0.902585268f}, {-0.424594522f, 0.905383646f},
+{-0.418659747f, 0.908143163f}, {-0.412707031f, 0.910863817f},
+{-0.406736642f, 0.913545430f}, {-0.400748819f, 0.916187942f},
+{-0.394743860f, 0.918791234f}, {-0.388721973f, 0.921355128f},
+{-0.382683426f, 0.923879504f}, {-0.376628488f, 0.926364362f},
+{-0.370557427f, 0.928809524f}, {-0.364470512f, 0.931214929f},
+{-0.358367950f, 0.933580399f}, {-0.352250040f, 0.935905933f},
+{-0.346117049f, 0.938191354f}, {-0.339969248f, 0.940436542f},
+{-0.333806872f, 0.942641497f}, {-0.327630192f, 0.944806039f},
+{-0.321439475f, 0.946930110f}, {-0.315234989f, 0.949013650f},
+{-0.309017003f, 0.951056540f}, {-0.302785784f, 0.953058660f},
+{-0.296541572f, 0.955019951f}, {-0.290284663f, 0.956940353f},
+{-0.284015357f, 0.958819747f}, {-0.277733833f, 0.960658073f},
+{-0.271440446f, 0.962455213f}, {-0.265135437f, 0.964211166f},
+{-0.258819044f, 0.965925813f}, {-0.252491564f, 0.967599094f},
+{-0.246153295f, 0.969230890f}, {-0.239804462f, 0.970821202f},
+{-0.233445361f, 0.972369909f}, {-0.227076262f, 0.973876953f},
+{-0.220697433f, 0.975342333f}, {-0.214309156f, 0.976765871f},
+{-0.207911685f, 0.978147626f}, {-0.201505318f, 0.979487419f},
+{-0.195090324f, 0.980785251f}, {-0.188666970f, 0.982041121f},
+{-0.182235524f, 0.983254910f}, {-0.175796285f, 0.984426558f},
+{-0.169349506f, 0.985556066f}, {-0.162895471f, 0.986643314f},
+{-0.156434461f, 0.987688363f}, {-0.149966761f, 0.988691032f},
+{-0.143492624f, 0.989651382f}, {-0.137012348f, 0.990569353f},
+{-0.130526185f, 0.991444886f}, {-0.124034449f, 0.992277920f},
+{-0.117537394f, 0.993068457f}, {-0.111035310f, 0.993816435f},
+{-0.104528464f, 0.994521916f}, {-0.0980171412f, 0.995184720f},
+{-0.0915016159f, 0.995804906f}, {-0.0849821791f, 0.996382475f},
+{-0.0784590989f, 0.996917307f}, {-0.0719326511f, 0.997409463f},
+{-0.0654031262f, 0.997858942f}, {-0.0588708036f, 0.998265624f},
+{-0.0523359552f, 0.998629510f}, {-0.0457988679f, 0.998950660f},
+{-0.0392598175f, 0.999229014f}, {-0.0327190831f, 0.999464571f},
+{-0.0261769481f, 0.999657333f}, {-0.0196336918f, 0.999807239f},
+{-0.0130895954f, 0.999914348f}, {-0.00654493785f, 0.999978602f},
+{-1.83697015e-16f, 1.00000000f}, {0.00654493785f, 0.999978602f},
+{0.0130895954f, 0.999914348f}, {0.0196336918f, 0.999807239f},
+{0.0261769481f, 0.999657333f}, {0.0327190831f, 0.999464571f},
+{0.0392598175f, 0.999229014f}, {0.0457988679f, 0.998950660f},
+{0.0523359552f, 0.998629510f}, {0.0588708036f, 0.998265624f},
+{0.0654031262f, 0.997858942f}, {0.0719326511f, 0.997409463f},
+{0.0784590989f, 0.996917307f}, {0.0849821791f, 0.996382475f},
+{0.0915016159f, 0.995804906f}, {0.0980171412f, 0.995184720f},
+{0.104528464f, 0.994521916f}, {0.111035310f, 0.993816435f},
+{0.117537394f, 0.993068457f}, {0.124034449f, 0.992277920f},
+{0.130526185f, 0.991444886f}, {0.137012348f, 0.990569353f},
+{0.143492624f, 0.989651382f}, {0.149966761f, 0.988691032f},
+{0.156434461f, 0.987688363f}, {0.162895471f, 0.986643314f},
+{0.169349506f, 0.985556066f}, {0.175796285f, 0.984426558f},
+{0.182235524f, 0.983254910f}, {0.188666970f, 0.982041121f},
+{0.195090324f, 0.980785251f}, {0.201505318f, 0.979487419f},
+{0.207911685f, 0.978147626f}, {0.214309156f, 0.976765871f},
+{0.220697433f, 0.975342333f}, {0.227076262f, 0.973876953f},
+{0.233445361f, 0.972369909f}, {0.239804462f, 0.970821202f},
+{0.246153295f, 0.969230890f}, {0.252491564f, 0.967599094f},
+{0.258819044f, 0.965925813f}, {0.265135437f, 0.964211166f},
+{0.271440446f, 0.962455213f}, {0.277733833f, 0.960658073f},
+{0.284015357f, 0.958819747f}, {0.290284663f, 0.956940353f},
+{0.296541572f, 0.955019951f}, {0.302785784f, 0.953058660f},
+{0.309017003f, 0.951056540f}, {0.315234989f, 0.949013650f},
+{0.321439475f, 0.946930110f}, {0.327630192f, 0.944806039f},
+{0.333806872f, 0.942641497f}, {0.339969248f, 0.940436542f},
+{0.346117049f, 0.938191354f}, {0.352250040f, 0.935905933f},
+{0.358367950f, 0.933580399f}, {0.364470512f, 0.931214929f},
+{0.370557427f, 0.928809524f}, {0.376628488f, 0.926364362f},
+{0.382683426f, 0.923879504f}, {0.388721973f, 0.921355128f},
+{0.394743860f, 0.918791234f}, {0.400748819f, 0.916187942f},
+{0.406736642f, 0.913545430f}, {0.412707031f, 0.910863817f},
+{0.418659747f, 0.908143163f}, {0.424594522f, 0.905383646f},
+{0.430511087f, 0.902585268f}, {0.436409235f, 0.899748266f},
+{0.442288697f, 0.896872759f}, {0.448149204f, 0.893958807f},
+{0.453990489f, 0.891006529f}, {0.459812373f, 0.888016105f},
+{0.465614527f, 0.884987652f}, {0.471396744f, 0.881921291f},
+{0.477158755f, 0.878817141f}, {0.482900351f, 0.875675321f},
+{0.488621235f, 0.872496009f}, {0.494321197f, 0.869279325f},
+{0.500000000f, 0.866025388f}, {0.505657375f, 0.862734377f},
+{0.511293113f, 0.859406412f}, {0.516906917f, 0.856041610f},
+{0.522498548f, 0.852640152f}, {0.528067827f, 0.849202156f},
+{0.533614516f, 0.845727801f}, {0.539138317f, 0.842217207f},
+{0.544639051f, 0.838670552f}, {0.550116420f, 0.835087955f},
+{0.555570245f, 0.831469595f}, {0.561000228f, 0.827815652f},
+{0.566406250f, 0.824126184f}, {0.571787953f, 0.820401430f},
+{0.577145219f, 0.816641569f}, {0.582477689f, 0.812846661f},
+{0.587785244f, 0.809017003f}, {0.593067646f, 0.805152655f},
+{0.598324597f, 0.801253796f}, {0.603555918f, 0.797320664f},
+{0.608761430f, 0.793353319f}, {0.613940835f, 0.789352059f},
+{0.619093955f, 0.785316944f}, {0.624220550f, 0.781248152f},
+{0.629320383f, 0.777145982f}, {0.634393275f, 0.773010433f},
+{0.639438987f, 0.768841803f}, {0.644457340f, 0.764640272f},
+{0.649448037f, 0.760405958f}, {0.654410958f, 0.756139100f},
+{0.659345806f, 0.751839817f}, {0.664252460f, 0.747508347f},
+{0.669130623f, 0.743144810f}, {0.673980117f, 0.738749504f},
+{0.678800762f, 0.734322488f}, {0.683592319f, 0.729864061f},
+{0.688354552f, 0.725374401f}, {0.693087339f, 0.720853567f},
+{0.697790444f, 0.716301918f}, {0.702463686f, 0.711719632f},
+{0.707106769f, 0.707106769f}, {0.711719632f, 0.702463686f},
+{0.716301918f, 0.697790444f}, {0.720853567f, 0.693087339f},
+{0.725374401f, 0.688354552f}, {0.729864061f, 0.683592319f},
+{0.734322488f, 0.678800762f}, {0.738749504f, 0.673980117f},
+{0.743144810f, 0.669130623f}, {0.747508347f, 0.664252460f},
+{0.751839817f, 0.659345806f}, {0.756139100f, 0.654410958f},
+{0.760405958f, 0.649448037f}, {0.764640272f, 0.644457340f},
+{0.768841803f, 0.639438987f}, {0.773010433f, 0.634393275f},
+{0.777145982f, 0.629320383f}, {0.781248152f, 0.624220550f},
+{0.785316944f, 0.619093955f}, {0.789352059f, 0.613940835f},
+{0.793353319f, 0.608761430f}, {0.797320664f, 0.603555918f},
+{0.801253796f, 0.598324597f}, {0.805152655f, 0.593067646f},
+{0.809017003f, 0.587785244f}, {0.812846661f, 0.582477689f},
+{0.816641569f, 0.577145219f}, {0.820401430f, 0.571787953f},
+{0.824126184f, 0.566406250f}, {0.827815652f, 0.561000228f},
+{0.831469595f, 0.555570245f}, {0.835087955f, 0.550116420f},
+{0.838670552f, 0.544639051f}, {0.842217207f, 0.539138317f},
+{0.845727801f, 0.533614516f}, {0.849202156f, 0.528067827f},
+{0.852640152f, 0.522498548f}, {0.856041610f, 0.516906917f},
+{0.859406412f, 0.511293113f}, {0.862734377f, 0.505657375f},
+{0.866025388f, 0.500000000f}, {0.869279325f, 0.494321197f},
+{0.872496009f, 0.488621235f}, {0.875675321f, 0.482900351f},
+{0.878817141f, 0.477158755f}, {0.881921291f, 0.471396744f},
+{0.884987652f, 0.465614527f}, {0.888016105f, 0.459812373f},
+{0.891006529f, 0.453990489f}, {0.893958807f, 0.448149204f},
+{0.896872759f, 0.442288697f}, {0.899748266f, 0.436409235f},
+{0.902585268f, 0.430511087f}, {0.905383646f, 0.424594522f},
+{0.908143163f, 0.418659747f}, {0.910863817f, 0.412707031f},
+{0.913545430f, 0.406736642f}, {0.916187942f, 0.400748819f},
+{0.918791234f, 0.394743860f}, {0.921355128f, 0.388721973f},
+{0.923879504f, 0.382683426f}, {0.926364362f, 0.376628488f},
+{0.928809524f, 0.370557427f}, {0.931214929f, 0.364470512f},
+{0.933580399f, 0.358367950f}, {0.935905933f, 0.352250040f},
+{0.938191354f, 0.346117049f}, {0.940436542f, 0.339969248f},
+{0.942641497f, 0.333806872f}, {0.944806039f, 0.327630192f},
+{0.946930110f, 0.321439475f}, {0.949013650f, 0.315234989f},
+{0.951056540f, 0.309017003f}, {0.953058660f, 0.302785784f},
+{0.955019951f, 0.296541572f}, {0.956940353f, 0.290284663f},
+{0.958819747f, 0.284015357f}, {0.960658073f, 0.277733833f},
+{0.962455213f, 0.271440446f}, {0.964211166f, 0.265135437f},
+{0.965925813f, 0.258819044f}, {0.967599094f, 0.252491564f},
+{0.969230890f, 0.246153295f}, {0.970821202f, 0.239804462f},
+{0.972369909f, 0.233445361f}, {0.973876953f, 0.227076262f},
+{0.975342333f, 0.220697433f}, {0.976765871f, 0.214309156f},
+{0.978147626f, 0.207911685f}, {0.979487419f, 0.201505318f},
+{0.980785251f, 0.195090324f}, {0.982041121f, 0.188666970f},
+{0.983254910f, 0.182235524f}, {0.984426558f, 0.175796285f},
+{0.985556066f, 0.169349506f}, {0.986643314f, 0.162895471f},
+{0.987688363f, 0.156434461f}, {0.988691032f, 0.149966761f},
+{0.989651382f, 0.143492624f}, {0.990569353f, 0.137012348f},
+{0.991444886f, 0.130526185f}, {0.992277920f, 0.124034449f},
+{0.993068457f, 0.117537394f}, {0.993816435f, 0.111035310f},
+{0.994521916f, 0.104528464f}, {0.995184720f, 0.0980171412f},
+{0.995804906f, 0.0915016159f}, {0.996382475f, 0.0849821791f},
+{0.996917307f, 0.0784590989f}, {0.997409463f, 0.0719326511f},
+{0.997858942f, 0.0654031262f}, {0.998265624f, 0.0588708036f},
+{0.998629510f, 0.0523359552f}, {0.998950660f, 0.0457988679f},
+{0.999229014f, 0.0392598175f}, {0.999464571f, 0.0327190831f},
+{0.999657333f, 0.0261769481f}, {0.999807239f, 0.0196336918f},
+{0.999914348f, 0.0130895954f}, {0.999978602f, 0.00654493785f},
+};
+
+static const kiss_twiddle_cpx fft_twiddles160[160] = {
+{1.00000000f, -0.00000000f}, {0.999229014f, -0.0392598175f},
+{0.996917307f, -0.0784590989f}, {0.993068457f, -0.117537394f},
+{0.987688363f, -0.156434461f}, {0.980785251f, -0.195090324f},
+{0.972369909f, -0.233445361f}, {0.962455213f, -0.271440446f},
+{0.951056540f, -0.309017003f}, {0.938191354f, -0.346117049f},
+{0.923879504f, -0.382683426f}, {0.908143163f, -0.418659747f},
+{0.891006529f, -0.453990489f}, {0.872496009f, -0.488621235f},
+{0.852640152f, -0.522498548f}, {0.831469595f, -0.555570245f},
+{0.809017003f, -0.587785244f}, {0.785316944f, -0.619093955f},
+{0.760405958f, -0.649448037f}, {0.734322488f, -0.678800762f},
+{0.707106769f, -0.707106769f}, {0.678800762f, -0.734322488f},
+{0.649448037f, -0.760405958f}, {0.619093955f, -0.785316944f},
+{0.587785244f, -0.809017003f}, {0.555570245f, -0.831469595f},
+{0.522498548f, -0.852640152f}, {0.488621235f, -0.872496009f},
+{0.453990489f, -0.891006529f}, {0.418659747f, -0.908143163f},
+{0.382683426f, -0.923879504f}, {0.346117049f, -0.938191354f},
+{0.309017003f, -0.951056540f}, {0.271440446f, -0.962455213f},
+{0.233445361f, -0.972369909f}, {0.195090324f, -0.980785251f},
+{0.156434461f, -0.987688363f}, {0.117537394f, -0.993068457f},
+{0.0784590989f, -0.996917307f}, {0.0392598175f, -0.999229014f},
+{6.12323426e-17f, -1.00000000f}, {-0.0392598175f, -0.999229014f},
+{-0.0784590989f, -0.996917307f}, {-0.117537394f, -0.993068457f},
+{-0.156434461f, -0.987688363f}, {-0.195090324f, -0.980785251f},
+{-0.233445361f, -0.972369909f}, {-0.271440446f, -0.962455213f},
+{-0.309017003f, -0.951056540f}, {-0.346117049f, -0.938191354f},
+{-0.382683426f, -0.923879504f}, {-0.418659747f, -0.908143163f},
+{-0.453990489f, -0.891006529f}, {-0.488621235f, -0.872496009f},
+{-0.522498548f, -0.852640152f}, {-0.555570245f, -0.831469595f},
+{-0.587785244f, -0.809017003f}, {-0.619093955f, -0.785316944f},
+{-0.649448037f, -0.760405958f}, {-0.678800762f, -0.734322488f},
+{-0.707106769f, -0.707106769f}, {-0.734322488f, -0.678800762f},
+{-0.760405958f, -0.649448037f}, {-0.785316944f, -0.619093955f},
+{-0.809017003f, -0.587785244f}, {-0.831469595f, -0.555570245f},
+{-0.852640152f, -0.522498548f}, {-0.872496009f, -0.488621235f},
+{-0.891006529f, -0.453990489f}, {-0.908143163f, -0.418659747f},
+{-0.923879504f, -0.382683426f}, {-0.938191354f, -0.346117049f},
+{-0.951056540f, -0.309017003f}, {-0.962455213f, -0.271440446f},
+{-0.972369909f, -0.233445361f}, {-0.980785251f, -0.195090324f},
+{-0.987688363f, -0.156434461f}, {-0.993068457f, -0.117537394f},
+{-0.996917307f, -0.0784590989f}, {-0.999229014f, -0.0392598175f},
+{-1.00000000f, -1.22464685e-16f}, {-0.999229014f, 0.0392598175f},
+{-0.996917307f, 0.0784590989f}, {-0.993068457f, 0.117537394f},
+{-0.987688363f, 0.156434461f}, {-0.980785251f, 0.195090324f},
+{-0.972369909f, 0.233445361f}, {-0.962455213f, 0.271440446f},
+{-0.951056540f, 0.309017003f}, {-0.938191354f, 0.346117049f},
+{-0.923879504f, 0.382683426f}, {-0.908143163f, 0.418659747f},
+{-0.891006529f, 0.453990489f}, {-0.872496009f, 0.488621235f},
+{-0.852640152f, 0.522498548f}, {-0.831469595f, 0.555570245f},
+{-0.809017003f, 0.587785244f}, {-0.785316944f, 0.619093955f},
+{-0.760405958f, 0.649448037f}, {-0.734322488f, 0.678800762f},
+{-0.707106769f, 0.707106769f}, {-0.678800762f, 0.734322488f},
+{-0.649448037f, 0.760405958f}, {-0.619093955f, 0.785316944f},
+{-0.587785244f, 0.809017003f}, {-0.555570245f, 0.831469595f},
+{-0.522498548f, 0.852640152f}, {-0.488621235f, 0.872496009f},
+{-0.453990489f, 0.891006529f}, {-0.418659747f, 0.908143163f},
+{-0.382683426f, 0.923879504f}, {-0.346117049f, 0.938191354f},
+{-0.309017003f, 0.951056540f}, {-0.271440446f, 0.962455213f},
+{-0.233445361f, 0.972369909f}, {-0.195090324f, 0.980785251f},
+{-0.156434461f, 0.987688363f}, {-0.117537394f, 0.993068457f},
+{-0.0784590989f, 0.996917307f}, {-0.0392598175f, 0.999229014f},
+{-1.83697015e-16f, 1.00000000f}, {0.0392598175f, 0.999229014f},
+{0.0784590989f, 0.996917307f}, {0.117537394f, 0.993068457f},
+{0.156434461f, 0.987688363f}, {0.195090324f, 0.980785251f},
+{0.233445361f, 0.972369909f}, {0.271440446f, 0.962455213f},
+{0.309017003f, 0.951056540f}, {0.346117049f, 0.938191354f},
+{0.382683426f, 0.923879504f}, {0.418659747f, 0.908143163f},
+{0.453990489f, 0.891006529f}, {0.488621235f, 0.872496009f},
+{0.522498548f, 0.852640152f}, {0.555570245f, 0.831469595f},
+{0.587785244f, 0.809017003f}, {0.619093955f, 0.785316944f},
+{0.649448037f, 0.760405958f}, {0.678800762f, 0.734322488f},
+{0.707106769f, 0.707106769f}, {0.734322488f, 0.678800762f},
+{0.760405958f, 0.649448037f}, {0.785316944f, 0.619093955f},
+{0.809017003f, 0.587785244f}, {0.831469595f, 0.555570245f},
+{0.852640152f, 0.522498548f}, {0.872496009f, 0.488621235f},
+{0.891006529f, 0.453990489f}, {0.908143163f, 0.418659747f},
+{0.923879504f, 0.382683426f}, {0.938191354f, 0.346117049f},
+{0.951056540f, 0.309017003f}, {0.962455213f, 0.271440446f},
+{0.972369909f, 0.233445361f}, {0.980785251f, 0.195090324f},
+{0.987688363f, 0.156434461f}, {0.993068457f, 0.117537394f},
+{0.996917307f, 0.0784590989f}, {0.999229014f, 0.0392598175f},
+};
+
+static const opus_int16 fft_bitrev960[960] = {
+0, 192, 384, 576, 768, 64, 256, 448, 640, 832, 128, 320, 512, 704, 896,
+16, 208, 400, 592, 784, 80, 272, 464, 656, 848, 144, 336, 528, 720, 912,
+32, 224, 416, 608, 800, 96, 288, 480, 672, 864, 160, 352, 544, 736, 928,
+48, 240, 432, 624, 816, 112, 304, 496, 688, 880, 176, 368, 560, 752, 944,
+4, 196, 388, 580, 772, 68, 260, 452, 644, 836, 132, 324, 516, 708, 900,
+20, 212, 404, 596, 788, 84, 276, 468, 660, 852, 148, 340, 532, 724, 916,
+36, 228, 420, 612, 804, 100, 292, 484, 676, 868, 164, 356, 548, 740, 932,
+52, 244, 436, 628, 820, 116, 308, 500, 692, 884, 180, 372, 564, 756, 948,
+8, 200, 392, 584, 776, 72, 264, 456, 648, 840, 136, 328, 520, 712, 904,
+24, 216, 408, 600, 792, 88, 280, 472, 664, 856, 152, 344, 536, 728, 920,
+40, 232, 424, 616, 808, 104, 296, 488, 680, 872, 168, 360, 552, 744, 936,
+56, 248, 440, 632, 824, 120, 312, 504, 696, 888, 184, 376, 568, 760, 952,
+12, 204, 396, 588, 780, 76, 268, 460, 652, 844, 140, 332, 524, 716, 908,
+28, 220, 412, 604, 796, 92, 284, 476, 668, 860, 156, 348, 540, 732, 924,
+44, 236, 428, 620, 812, 108, 300, 492, 684, 876, 172, 364, 556, 748, 940,
+60, 252, 444, 636, 828, 124, 316, 508, 700, 892, 188, 380, 572, 764, 956,
+1, 193, 385, 577, 769, 65, 257, 449, 641, 833, 129, 321, 513, 705, 897,
+17, 209, 401, 593, 785, 81, 273, 465, 657, 849, 145, 337, 529, 721, 913,
+33, 225, 417, 609, 801, 97, 289, 481, 673, 865, 161, 353, 545, 737, 929,
+49, 241, 433, 625, 817, 113, 305, 497, 689, 881, 177, 369, 561, 753, 945,
+5, 197, 389, 581, 773, 69, 261, 453, 645, 837, 133, 325, 517, 709, 901,
+21, 213, 405, 597, 789, 85, 277, 469, 661, 853, 149, 341, 533, 725, 917,
+37, 229, 421, 613, 805, 101, 293, 485, 677, 869, 165, 357, 549, 741, 933,
+53, 245, 437, 629, 821, 117, 309, 501, 693, 885, 181, 373, 565, 757, 949,
+9, 201, 393, 585, 777, 73, 265, 457, 649, 841, 137, 329, 521, 713, 905,
+25, 217, 409, 601, 793, 89, 281, 473, 665, 857, 153, 345, 537, 729, 921,
+41, 233, 425, 617, 809, 105, 297, 489, 681, 873, 169, 361, 553, 745, 937,
+57, 249, 441, 633, 825, 121, 313, 505, 697, 889, 185, 377, 569, 761, 953,
+13, 205, 397, 589, 781, 77, 269, 461, 653, 845, 141, 333, 525, 717, 909,
+29, 221, 413, 605, 797, 93, 285, 477, 669, 861, 157, 349, 541, 733, 925,
+45, 237, 429, 621, 813, 109, 301, 493, 685, 877, 173, 365, 557, 749, 941,
+61, 253, 445, 637, 829, 125, 317, 509, 701, 893, 189, 381, 573, 765, 957,
+2, 194, 386, 578, 770, 66, 258, 450, 642, 834, 130, 322, 514, 706, 898,
+18, 210, 402, 594, 786, 82, 274, 466, 658, 850, 146, 338, 530, 722, 914,
+34, 226, 418, 610, 802, 98, 290, 482, 674, 866, 162, 354, 546, 738, 930,
+50, 242, 434, 626, 818, 114, 306, 498, 690, 882, 178, 370, 562, 754, 946,
+6, 198, 390, 582, 774, 70, 262, 454, 646, 838, 134, 326, 518, 710, 902,
+22, 214, 406, 598, 790, 86, 278, 470, 662, 854, 150, 342, 534, 726, 918,
+38, 230, 422, 614, 806, 102, 294, 486, 678, 870, 166, 358, 550, 742, 934,
+54, 246, 438, 630, 822, 118, 310, 502, 694, 886, 182, 374, 566, 758, 950,
+10, 202, 394, 586, 778, 74, 266, 458, 650, 842, 138, 330, 522, 714, 906,
+26, 218, 410, 602, 794, 90, 282, 474, 666, 858, 154, 346, 538, 730, 922,
+42, 234, 426, 618, 810, 106, 298, 490, 682, 874, 170, 362, 554, 746, 938,
+58, 250, 442, 634, 826, 122, 314, 506, 698, 890, 186, 378, 570, 762, 954,
+14, 206, 398, 590, 782, 78, 270, 462, 654, 846, 142, 334, 526, 718, 910,
+30, 222, 414, 606, 798, 94, 286, 478, 670, 862, 158, 350, 542, 734, 926,
+46, 238, 430, 622, 814, 110, 302, 494, 686, 878, 174, 366, 558, 750, 942,
+62, 254, 446, 638, 830, 126, 318, 510, 702, 894, 190, 382, 574, 766, 958,
+3, 195, 387, 579, 771, 67, 259, 451, 643, 835, 131, 323, 515, 707, 899,
+19, 211, 403, 595, 787, 83, 275, 467, 659, 851, 147, 339, 531, 723, 915,
+35, 227, 419, 611, 803, 99, 291, 483, 675, 867, 163, 355, 547, 739, 931,
+51, 243, 435, 627, 819, 115, 307, 499, 691, 883, 179, 371, 563, 755, 947,
+7, 199, 391, 583, 775, 71, 263, 455, 647, 839, 135, 327, 519, 711, 903,
+23, 215, 407, 599, 791, 87, 279, 471, 663, 855, 151, 343, 535, 727, 919,
+39, 231, 423, 615, 807, 103, 295, 487, 679, 871, 167, 359, 551, 743, 935,
+55, 247, 439, 631, 823, 119, 311, 503, 695, 887, 183, 375, 567, 759, 951,
+11, 203, 395, 587, 779, 75, 267, 459, 651, 843, 139, 331, 523, 715, 907,
+27, 219, 411, 603, 795, 91, 283, 475, 667, 859, 155, 347, 539, 731, 923,
+43, 235, 427, 619, 811, 107, 299, 491, 683, 875, 171, 363, 555, 747, 939,
+59, 251, 443, 635, 827, 123, 315, 507, 699, 891, 187, 379, 571, 763, 955,
+15, 207, 399, 591, 783, 79, 271, 463, 655, 847, 143, 335, 527, 719, 911,
+31, 223, 415, 607, 799, 95, 287, 479, 671, 863, 159, 351, 543, 735, 927,
+47, 239, 431, 623, 815, 111, 303, 495, 687, 879, 175, 367, 559, 751, 943,
+63, 255, 447, 639, 831, 127, 319, 511, 703, 895, 191, 383, 575, 767, 959,
+};
+
+static const opus_int16 fft_bitrev480[480] = {
+0, 96, 192, 288, 384, 32, 128, 224, 320, 416, 64, 160, 256, 352, 448,
+8, 104, 200, 296, 392, 40, 136, 232, 328, 424, 72, 168, 264, 360, 456,
+16, 112, 208, 304, 400, 48, 144, 240, 336, 432, 80, 176, 272, 368, 464,
+24, 120, 216, 312, 408, 56, 152, 248, 344, 440, 88, 184, 280, 376, 472,
+4, 100, 196, 292, 388, 36, 132, 228, 324, 420, 68, 164, 260, 356, 452,
+12, 108, 204, 300, 396, 44, 140, 236, 332, 428, 76, 172, 268, 364, 460,
+20, 116, 212, 308, 404, 52, 148, 244, 340, 436, 84, 180, 276, 372, 468,
+28, 124, 220, 316, 412, 60, 156, 252, 348, 444, 92, 188, 284, 380, 476,
+1, 97, 193, 289, 385, 33, 129, 225, 321, 417, 65, 161, 257, 353, 449,
+9, 105, 201, 297, 393, 41, 137, 233, 329, 425, 73, 169, 265, 361, 457,
+17, 113, 209, 305, 401, 49, 145, 241, 337, 433, 81, 177, 273, 369, 465,
+25, 121, 217, 313, 409, 57, 153, 249, 345, 441, 89, 185, 281, 377, 473,
+5, 101, 197, 293, 389, 37, 133, 229, 325, 421, 69, 165, 261, 357, 453,
+13, 109, 205, 301, 397, 45, 141, 237, 333, 429, 77, 173, 269, 365, 461,
+21, 117, 213, 309, 405, 53, 149, 245, 341, 437, 85, 181, 277, 373, 469,
+29, 125, 221, 317, 413, 61, 157, 253, 349, 445, 93, 189, 285, 381, 477,
+2, 98, 194, 290, 386, 34, 130, 226, 322, 418, 66, 162, 258, 354, 450,
+10, 106, 202, 298, 394, 42, 138, 234, 330, 426, 74, 170, 266, 362, 458,
+18, 114, 210, 306, 402, 50, 146, 242, 338, 434, 82, 178, 274, 370, 466,
+26, 122, 218, 314, 410, 58, 154, 250, 346, 442, 90, 186, 282, 378, 474,
+6, 102, 198, 294, 390, 38, 134, 230, 326, 422, 70, 166, 262, 358, 454,
+14, 110, 206, 302, 398, 46, 142, 238, 334, 430, 78, 174, 270, 366, 462,
+22, 118, 214, 310, 406, 54, 150, 246, 342, 438, 86, 182, 278, 374, 470,
+30, 126, 222, 318, 414, 62, 158, 254, 350, 446, 94, 190, 286, 382, 478,
+3, 99, 195, 291, 387, 35, 131, 227, 323, 419, 67, 163, 259, 355, 451,
+11, 107, 203, 299, 395, 43, 139, 235, 331, 427, 75, 171, 267, 363, 459,
+19, 115, 211, 307, 403, 51, 147, 243, 339, 435, 83, 179, 275, 371, 467,
+27, 123, 219, 315, 411, 59, 155, 251, 347, 443, 91, 187, 283, 379, 475,
+7, 103, 199, 295, 391, 39, 135, 231, 327, 423, 71, 167, 263, 359, 455,
+15, 111, 207, 303, 399, 47, 143, 239, 335, 431, 79, 175, 271, 367, 463,
+23, 119, 215, 311, 407, 55, 151, 247, 343, 439, 87, 183, 279, 375, 471,
+31, 127, 223, 319, 415, 63, 159, 255, 351, 447, 95, 191, 287, 383, 479,
+};
+
+static const opus_int16 fft_bitrev240[240] = {
+0, 48, 96, 144, 192, 16, 64, 112, 160, 208, 32, 80, 128, 176, 224,
+4, 52, 100, 148, 196, 20, 68, 116, 164, 212, 36, 84, 132, 180, 228,
+8, 56, 104, 152, 200, 24, 72, 120, 168, 216, 40, 88, 136, 184, 232,
+12, 60, 108, 156, 204, 28, 76, 124, 172, 220, 44, 92, 140, 188, 236,
+1, 49, 97, 145, 193, 17, 65, 113, 161, 209, 33, 81, 129, 177, 225,
+5, 53, 101, 149, 197, 21, 69, 117, 165, 213, 37, 85, 133, 181, 229,
+9, 57, 105, 153, 201, 25, 73, 121, 169, 217, 41, 89, 137, 185, 233,
+13, 61, 109, 157, 205, 29, 77, 125, 173, 221, 45, 93, 141, 189, 237,
+2, 50, 98, 146, 194, 18, 66, 114, 162, 210, 34, 82, 130, 178, 226,
+6, 54, 102, 150, 198, 22, 70, 118, 166, 214, 38, 86, 134, 182, 230,
+10, 58, 106, 154, 202, 26, 74, 122, 170, 218, 42, 90, 138, 186, 234,
+14, 62, 110, 158, 206, 30, 78, 126, 174, 222, 46, 94, 142, 190, 238,
+3, 51, 99, 147, 195, 19, 67, 115, 163, 211, 35, 83, 131, 179, 227,
+7, 55, 103, 151, 199, 23, 71, 119, 167, 215, 39, 87, 135, 183, 231,
+11, 59, 107, 155, 203, 27, 75, 123, 171, 219, 43, 91, 139, 187, 235,
+15, 63, 111, 159, 207, 31, 79, 127, 175, 223, 47, 95, 143, 191, 239,
+};
+
+static const opus_int16 fft_bitrev160[160] = {
+0, 32, 64, 96, 128, 8, 40, 72, 104, 136, 16, 48, 80, 112, 144,
+24, 56, 88, 120, 152, 4, 36, 68, 100, 132, 12, 44, 76, 108, 140,
+20, 52, 84, 116, 148, 28, 60, 92, 124, 156, 1, 33, 65, 97, 129,
+9, 41, 73, 105, 137, 17, 49, 81, 113, 145, 25, 57, 89, 121, 153,
+5, 37, 69, 101, 133, 13, 45, 77, 109, 141, 21, 53, 85, 117, 149,
+29, 61, 93, 125, 157, 2, 34, 66, 98, 130, 10, 42, 74, 106, 138,
+18, 50, 82, 114, 146, 26, 58, 90, 122, 154, 6, 38, 70, 102, 134,
+14, 46, 78, 110, 142, 22, 54, 86, 118, 150, 30, 62, 94, 126, 158,
+3, 35, 67, 99, 131, 11, 43, 75, 107, 139, 19, 51, 83, 115, 147,
+27, 59, 91, 123, 155, 7, 39, 71, 103, 135, 15, 47, 79, 111, 143,
+23, 55, 87, 119, 151, 31, 63, 95, 127, 159, };
+
+const kiss_fft_state nsdnn_fft960 = {
+960, /* nfft */
+0.0010416667f, /* scale */
+-1, /* shift */
+{5, 192, 3, 64, 4, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0, }, /* factors */
+fft_bitrev960, /* bitrev*/
+fft_twiddles960, /* twiddles*/
+(arch_fft_state *)&arch_fft, /* arch_fft*/
+};
+
+const kiss_fft_state nsdnn_fft480 = {
+480, /* nfft */
+0.0020833334f, /* scale */
+1, /* shift */
+{5, 96, 3, 32, 4, 8, 2, 4, 4, 1, 0, 0, 0, 0, 0, 0, }, /* factors */
+fft_bitrev480, /* bitrev*/
+fft_twiddles960, /* twiddles*/
+(arch_fft_state *)&arch_fft, /* arch_fft*/
+};
+
+const kiss_fft_state nsdnn_fft240 = {
+240, /* nfft */
+0.0041666669f, /* scale */
+2, /* shift */
+{5, 48, 3, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, }, /* factors */
+fft_bitrev240, /* bitrev*/
+fft_twiddles960, /* twiddles*/
+(arch_fft_state *)&arch_fft, /* arch_fft*/
+};
+
+const kiss_fft_state nsdnn_fft160 = {
+160, /* nfft */
+0.0062500001f, /* scale */
+-1, /* shift */
+{5, 32, 4, 8, 2, 4, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, }, /* factors */
+fft_bitrev160, /* bitrev*/
+fft_twiddles160, /* twiddles*/
+(arch_fft_state *)&arch_fft, /* arch_fft*/
+};
+
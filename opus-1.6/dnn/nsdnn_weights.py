@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# opus/dnn/nsdnn_weights.py
+#
+# Writes nsdnn_data.c and nsdnn_data.h, the built-in weights of the noise
+# suppression pre-stage (nsdnn.c). The model is not trained: the weights are
+# set by hand so that the network implements a noise floor tracker.
+#
+# Usage: nsdnn_weights.py <output dir> [param=value...]
+#
+# Topology (fixed by nsdnn.c):
+#   x[22]  band log energies, x_b = .0025*(dB_b + 45)
+#   GRU    22 -> 45 units, z*h + (1-z)*tanh(...) update as in compute_gru()
+#   dense  [x, h] (67) -> 22 band gains, sigmoid
+#
+# In feature units tanh(x) ~= x, so the GRU units hold levels in dB/400:
+#   n_b (units 0-21)   noise floor of band b. The update gate is
+#                      sigmoid(alpha*(dB_b - floor_b) + beta - gamma*(1 - t)),
+#                      so the floor follows the level down quickly and only
+#                      creeps up while the band stays above it.
+#   s_b (units 22-43)  level of band b, smoothed with a constant gate zs.
+#   t   (unit 44)      warm-up ramp from 0 to ~1 over about a second. While it
+#                      is low the floors adapt fast and the gains stay open.
+# The gain of band b is sigmoid(k*(level_b - floor_b - d0) + mu*(1 - t)), with
+# the levels in dB, so a band passes once it is d0 dB above its floor.
+#
+# A trained model with the same layer names and sizes can be loaded at run
+# time through OPUS_SET_DNN_BLOB instead.
+
+import math
+import sys
+
+if len(sys.argv) < 2:
+  sys.exit('Usage: {} <output dir> [param=value...]'.format(sys.argv[0]))
+
+# alpha, k: slopes per dB; beta, gamma, mu: gate offsets; tz, th: warm-up
+# unit gate and target; d0: gate threshold in dB; zs: level smoothing.
+params = dict(alpha=0.25, beta=2.5, gamma=8.0, tz=4.6, th=3.0, k=0.5, d0=10.0, mu=10.0, zs=0.5)
+for arg in sys.argv[2:]:
+  name, value = arg.split('=')
+  if name not in params:
+    sys.exit('Unknown parameter "{}"'.format(name))
+  params[name] = float(value)
+out_dir = sys.argv[1]
+
+NB_BANDS = 22
+NB_UNITS = 45
+LEVEL = NB_BANDS       # first smoothed level unit
+WARMUP = 2*NB_BANDS    # warm-up unit
+SCALE = 400.0          # dB per feature unit
+
+A = params['alpha']*SCALE
+K = params['k']*SCALE
+
+# Weights are column-major: w[j*nb_outputs + i] maps input j to output i.
+# GRU outputs are laid out as [z, r, h], NB_UNITS each.
+gru_in_w = [0.0]*(NB_BANDS*3*NB_UNITS)
+gru_in_b = [0.0]*(3*NB_UNITS)
+gru_rec_w = [0.0]*(NB_UNITS*3*NB_UNITS)
+gru_rec_b = [0.0]*(3*NB_UNITS)
+for b in range(NB_BANDS):
+  # Floor: z = alpha*(x_b - n_b) + beta - gamma + gamma*t, candidate x_b.
+  gru_in_w[b*3*NB_UNITS + b] = A
+  gru_in_b[b] = params['beta'] - params['gamma']
+  gru_rec_w[b*3*NB_UNITS + b] = -A
+  gru_rec_w[WARMUP*3*NB_UNITS + b] = params['gamma']
+  gru_in_w[b*3*NB_UNITS + 2*NB_UNITS + b] = 1.0
+  # Level: constant gate zs, candidate x_b.
+  gru_in_b[LEVEL + b] = math.log(params['zs']/(1 - params['zs']))
+  gru_in_w[b*3*NB_UNITS + 2*NB_UNITS + LEVEL + b] = 1.0
+gru_in_b[WARMUP] = params['tz']
+gru_in_b[2*NB_UNITS + WARMUP] = params['th']
+
+# Gain: k*(s_b - n_b) - mu*t - k*d0 + mu, on the inputs [x, h].
+NB_DENSE_IN = NB_BANDS + NB_UNITS
+dense_w = [0.0]*(NB_DENSE_IN*NB_BANDS)
+dense_b = [0.0]*NB_BANDS
+for b in range(NB_BANDS):
+  dense_w[(NB_BANDS + LEVEL + b)*NB_BANDS + b] = K
+  dense_w[(NB_BANDS + b)*NB_BANDS + b] = -K
+  dense_w[(NB_BANDS + WARMUP)*NB_BANDS + b] = -params['mu']
+  dense_b[b] = -params['k']*params['d0'] + params['mu']
+
+layers = [('ns_dense_gain', dense_w, dense_b, NB_DENSE_IN, NB_BANDS),
+          ('ns_gru_input', gru_in_w, gru_in_b, NB_BANDS, 3*NB_UNITS),
+          ('ns_gru_recurrent', gru_rec_w, gru_rec_b, NB_UNITS, 3*NB_UNITS)]
+
+def c_array(name, values):
+  lines = [','.join(repr(float(v)) for v in values[i:i+8]) for i in range(0, len(values), 8)]
+  return ('#ifndef USE_WEIGHTS_FILE\n\n'
+          '#define WEIGHTS_{0}_DEFINED\n'
+          '#define WEIGHTS_{0}_TYPE WEIGHT_TYPE_float\n'
+          'static const float {0}[{1}] = {{\n'
+          '{2}\n}};\n\n\n'
+          '#endif /* USE_WEIGHTS_FILE */\n\n').format(name, len(values), ',\n'.join(lines))
+
+header = '/* Auto generated by nsdnn_weights.py from a hand-initialized noise floor tracking model */\n\n\n'
+
+source = header + '#ifdef HAVE_CONFIG_H\n#include "config.h"\n#endif\n\n#include "nsdnn_data.h"\n\n\n'
+names = []
+for name, w, b, nb_inputs, nb_outputs in layers:
+  source += c_array(name + '_weights_float', w)
+  source += c_array(name + '_bias', b)
+  names += [name + '_weights_float', name + '_bias']
+source += '#ifndef USE_WEIGHTS_FILE\nconst WeightArray nsdnn_arrays[] = {\n'
+for name in names:
+  source += '#ifdef WEIGHTS_{0}_DEFINED\n{{"{0}", WEIGHTS_{0}_TYPE,sizeof({0}),{0}}},\n#endif\n'.format(name)
+source += '{NULL,0,0,NULL}\n};\n#endif /* USE_WEIGHTS_FILE */\n\n'
+source += '#ifndef DUMP_BINARY_WEIGHTS\nint init_nsdnn(NSDNN *model,const WeightArray *arrays) {\n'
+for name, w, b, nb_inputs, nb_outputs in layers:
+  source += ('if (linear_init(&model->{0},arrays,"{0}_bias",NULL,NULL,"{0}_weights_float",'
+             'NULL,NULL,NULL,{1},{2})) return 1;\n').format(name, nb_inputs, nb_outputs)
+source += 'return 0;\n}\n#endif /* DUMP_BINARY_WEIGHTS */\n'
+
+with open(out_dir + '/nsdnn_data.c', 'w', encoding='utf8') as f:
+  f.write(source)
+
+with open(out_dir + '/nsdnn_data.h', 'w', encoding='utf8') as f:
+  f.write(header
+          + '#ifndef NSDNN_DATA_H\n#define NSDNN_DATA_H\n\n#include "nnet.h"\n\n\n#include "opus_types.h"\n\n'
+          + '#define NS_DENSE_GAIN_OUT_SIZE {0}\n\n#define NS_GRU_OUT_SIZE {1}\n\n#define NS_GRU_STATE_SIZE {1}\n\n\n'.format(NB_BANDS, NB_UNITS)
+          + '#define NSDNN_MAX_RNN_UNITS {0}\n\n\n'.format(NB_UNITS)
+          + 'typedef struct {\n' + ''.join('    LinearLayer {0};\n'.format(l[0]) for l in layers) + '} NSDNN;\n\n'
+          + 'int init_nsdnn(NSDNN *model, const WeightArray *arrays);\n\n#endif /* NSDNN_DATA_H */\n')
@@ -144,6 +144,7 @@ static int init_lace(LACE *hLACE, const WeightArray *weights)
     OPUS_CLEAR(hLACE, 1);
     celt_assert(weights != NULL);
 
+    DNN_PROFILE_MODEL("lace");
     ret = init_lacelayers(&hLACE->layers, weights);
 
     compute_overlap_window(hLACE->window, LACE_OVERLAP_SIZE);
@@ -409,6 +410,7 @@ static int init_nolace(NoLACE *hNoLACE, const WeightArray *weights)
     OPUS_CLEAR(hNoLACE, 1);
     celt_assert(weights != NULL);
 
+    DNN_PROFILE_MODEL("nolace");
     ret = init_nolacelayers(&hNoLACE->layers, weights);
 
     compute_overlap_window(hNoLACE->window, NOLACE_OVERLAP_SIZE);
@@ -953,49 +955,53 @@ static void bbwe_feature_net(
     }
 }
 
-static float hq_2x_even[3] = {0.026641845703125, 0.228668212890625, -0.4036407470703125};
-static float hq_2x_odd[3]  = {0.104583740234375, 0.3932037353515625, -0.152496337890625};
+/* The resamplers below are written so that the compiler can vectorize them
+   (the three output phases of the 3/2 interpolator along time, the 2x
+   allpass upsampler across channels and even/odd branches), with the
+   arithmetic of the scalar reference kept in the same order. */
+#if OPUS_GNUC_PREREQ(5,1)
+#define BBWENET_POP_OPTIONS
+#pragma GCC push_options
+#pragma GCC optimize("tree-vectorize")
+#endif
+
+/* 2x allpass coefficients, one lane per channel for the even and odd
+   branches (lanes 3 and 7 are padding); the third stage is stored as 1 + a */
+#define UPSAMP_LANES 8
+static const float hq_2x_lanes[3][UPSAMP_LANES] = {
+    {0.026641845703125f, 0.026641845703125f, 0.026641845703125f, 0.f,
+     0.104583740234375f, 0.104583740234375f, 0.104583740234375f, 0.f},
+    {0.228668212890625f, 0.228668212890625f, 0.228668212890625f, 0.f,
+     0.3932037353515625f, 0.3932037353515625f, 0.3932037353515625f, 0.f},
+    {0.5963592529296875f, 0.5963592529296875f, 0.5963592529296875f, 0.f,
+     0.847503662109375f, 0.847503662109375f, 0.847503662109375f, 0.f}
+};
 
-static float frac_01_24[8] = {
+static const float frac_01_24[8] = {
     0.00576782, -0.01831055,  0.01882935,  0.9328308,
     0.09143066, -0.04196167,  0.01296997, -0.00140381
 };
 
-static float frac_17_24[8] = {
+static const float frac_17_24[8] = {
     -3.14331055e-03,  2.73437500e-02, -1.06414795e-01,  3.64685059e-01,
     8.03863525e-01, -1.02233887e-01,  1.61437988e-02, -1.22070312e-04
 };
 
-static float frac_09_24[8] = {
+static const float frac_09_24[8] = {
     -0.00146484,  0.02313232, -0.12072754,  0.7315979,
     0.4621277, -0.12075806,  0.0295105 , -0.00326538
 };
 
-static void apply_valin_activation(float *x, int len)
-{
-    int i;
-    float y[2 * BBWENET_TDSHAPE2_FRAME_SIZE];
-    celt_assert(len <= 2 * BBWENET_TDSHAPE2_FRAME_SIZE);
-    for (i = 0; i < len; i++)
-    {
-        y[i] = fabs(x[i]) + 1e-6f;
-    }
-    for (i = 0; i < len; i++)
-    {
-        y[i] = celt_log(y[i]);
-    }
-    for (i = 0; i < len; i++)
-    {
-        x[i] *= celt_sin(y[i]);
-    }
-}
-
 
 #define DELAY_SAMPLES 8 /* ToDo: this probably should be 7, bug in python code? */
 static void interpol_3_2(resamp_state *state, float *x_out, const float *x_in, int num_samples)
 {
-    int i_sample, i_out = 0;
+    int i, j, n = num_samples / 2;
     float buffer[8 * BBWENET_FRAME_SIZE16 + DELAY_SAMPLES];
+    float even[4 * BBWENET_FRAME_SIZE16 + DELAY_SAMPLES / 2];
+    float odd[4 * BBWENET_FRAME_SIZE16 + DELAY_SAMPLES / 2];
+    float y0[4 * BBWENET_FRAME_SIZE16], y1[4 * BBWENET_FRAME_SIZE16], y2[4 * BBWENET_FRAME_SIZE16];
+    const float *c0 = frac_01_24, *c1 = frac_17_24, *c2 = frac_09_24;
 
     celt_assert(num_samples > 1);
     celt_assert(num_samples < 8 * BBWENET_FRAME_SIZE16);
@@ -1004,98 +1010,118 @@ static void interpol_3_2(resamp_state *state, float *x_out, const float *x_in, i
     OPUS_COPY(buffer, state->interpol_buffer, DELAY_SAMPLES);
     OPUS_COPY(buffer + DELAY_SAMPLES, x_in, num_samples);
 
-    for (i_sample = 0; i_sample < num_samples; i_sample+=2)
-    {
-        x_out[i_out++] = buffer[i_sample + 0] * frac_01_24[0] +
-                         buffer[i_sample + 1] * frac_01_24[1] +
-                         buffer[i_sample + 2] * frac_01_24[2] +
-                         buffer[i_sample + 3] * frac_01_24[3] +
-                         buffer[i_sample + 4] * frac_01_24[4] +
-                         buffer[i_sample + 5] * frac_01_24[5] +
-                         buffer[i_sample + 6] * frac_01_24[6] +
-                         buffer[i_sample + 7] * frac_01_24[7];
-
-        x_out[i_out++] = buffer[i_sample + 0] * frac_17_24[0] +
-                         buffer[i_sample + 1] * frac_17_24[1] +
-                         buffer[i_sample + 2] * frac_17_24[2] +
-                         buffer[i_sample + 3] * frac_17_24[3] +
-                         buffer[i_sample + 4] * frac_17_24[4] +
-                         buffer[i_sample + 5] * frac_17_24[5] +
-                         buffer[i_sample + 6] * frac_17_24[6] +
-                         buffer[i_sample + 7] * frac_17_24[7];
-
-        x_out[i_out++] = buffer[i_sample + 1] * frac_09_24[0] +
-                         buffer[i_sample + 2] * frac_09_24[1] +
-                         buffer[i_sample + 3] * frac_09_24[2] +
-                         buffer[i_sample + 4] * frac_09_24[3] +
-                         buffer[i_sample + 5] * frac_09_24[4] +
-                         buffer[i_sample + 6] * frac_09_24[5] +
-                         buffer[i_sample + 7] * frac_09_24[6] +
-                         buffer[i_sample + 8] * frac_09_24[7];
+    /* split the input into its two polyphase components so that each output
+       phase becomes a contiguous 8-tap FIR */
+    for (i = 0; i < n + DELAY_SAMPLES / 2; i++)
+    {
+        even[i] = buffer[2 * i];
+        odd[i] = buffer[2 * i + 1];
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        y0[j] = even[j] * c0[0] + odd[j] * c0[1] + even[j + 1] * c0[2] + odd[j + 1] * c0[3] +
+                even[j + 2] * c0[4] + odd[j + 2] * c0[5] + even[j + 3] * c0[6] + odd[j + 3] * c0[7];
+    }
+    for (j = 0; j < n; j++)
+    {
+        y1[j] = even[j] * c1[0] + odd[j] * c1[1] + even[j + 1] * c1[2] + odd[j + 1] * c1[3] +
+                even[j + 2] * c1[4] + odd[j + 2] * c1[5] + even[j + 3] * c1[6] + odd[j + 3] * c1[7];
+    }
+    for (j = 0; j < n; j++)
+    {
+        y2[j] = odd[j] * c2[0] + even[j + 1] * c2[1] + odd[j + 1] * c2[2] + even[j + 2] * c2[3] +
+                odd[j + 2] * c2[4] + even[j + 3] * c2[5] + odd[j + 3] * c2[6] + even[j + 4] * c2[7];
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        x_out[3 * j + 0] = y0[j];
+        x_out[3 * j + 1] = y1[j];
+        x_out[3 * j + 2] = y2[j];
     }
 
     /* copy last samples to buffer */
     OPUS_COPY(state->interpol_buffer, buffer + num_samples, DELAY_SAMPLES);
 }
 
-static void upsamp_2x(resamp_state *state, float *x_out, const float *x_in, int num_samples)
+/* 2x upsampling of three channels at once, stored one after the other with
+   a stride of num_samples (input) and 2*num_samples (output) */
+static void upsamp_2x_3ch(resamp_state *state, float *x_out, const float *x_in, int num_samples)
 {
-    float buffer [4 * BBWENET_FRAME_SIZE16];
-    float *S_even = state->upsamp_buffer[0];
-    float *S_odd = state->upsamp_buffer[1];
-    int k;
-    float x, X, Y, tmp1, tmp2, tmp3;
+    float S0[UPSAMP_LANES], S1[UPSAMP_LANES], S2[UPSAMP_LANES];
+    float x[UPSAMP_LANES], y[UPSAMP_LANES];
+    float X, Y, tmp1, tmp2;
+    int k, l, i_channel;
 
     celt_assert(num_samples > 1);
     celt_assert(num_samples < 4 * BBWENET_FRAME_SIZE16);
 
-    OPUS_COPY(buffer, x_in, num_samples);
+    OPUS_CLEAR(S0, UPSAMP_LANES);
+    OPUS_CLEAR(S1, UPSAMP_LANES);
+    OPUS_CLEAR(S2, UPSAMP_LANES);
+    OPUS_CLEAR(x, UPSAMP_LANES);
+    for (i_channel = 0; i_channel < 3; i_channel++)
+    {
+        S0[i_channel] = state[i_channel].upsamp_buffer[0][0];
+        S1[i_channel] = state[i_channel].upsamp_buffer[0][1];
+        S2[i_channel] = state[i_channel].upsamp_buffer[0][2];
+        S0[4 + i_channel] = state[i_channel].upsamp_buffer[1][0];
+        S1[4 + i_channel] = state[i_channel].upsamp_buffer[1][1];
+        S2[4 + i_channel] = state[i_channel].upsamp_buffer[1][2];
+    }
 
     for (k = 0; k < num_samples; k++)
     {
-        x = buffer[k];
-        /* even sample, first pass, */
-        Y = x - S_even[0];
-        X = Y * hq_2x_even[0];
-        tmp1 = S_even[0] + X;
-        S_even[0] = x + X;
-
-        /* ...second pass, */
-        Y = tmp1 - S_even[1];
-        X = Y * hq_2x_even[1];
-        tmp2 = S_even[1] + X;
-        S_even[1] = tmp1 + X;
-
-        /* ...third pass */
-        Y = tmp2 - S_even[2];
-        X = Y * (1 + hq_2x_even[2]);
-        tmp3 = S_even[2] + X;
-        S_even[2] = tmp2 + X;
-
-        x_out[2 * k] = tmp3;
-
-        /* odd sample, first pass, */
-        Y = x - S_odd[0];
-        X = Y * hq_2x_odd[0];
-        tmp1 = S_odd[0] + X;
-        S_odd[0] = x + X;
-
-        /* ...second pass, */
-        Y = tmp1 - S_odd[1];
-        X = Y * hq_2x_odd[1];
-        tmp2 = S_odd[1] + X;
-        S_odd[1] = tmp1 + X;
-
-        /* ...third pass */
-        Y = tmp2 - S_odd[2];
-        X = Y * (1 + hq_2x_odd[2]);
-        tmp3 = S_odd[2] + X;
-        S_odd[2] = tmp2 + X;
-
-        x_out[2 * k + 1] = tmp3;
+        for (i_channel = 0; i_channel < 3; i_channel++)
+        {
+            x[i_channel] = x[4 + i_channel] = x_in[i_channel * num_samples + k];
+        }
+
+        for (l = 0; l < UPSAMP_LANES; l++)
+        {
+            /* first pass, */
+            Y = x[l] - S0[l];
+            X = Y * hq_2x_lanes[0][l];
+            tmp1 = S0[l] + X;
+            S0[l] = x[l] + X;
+
+            /* ...second pass, */
+            Y = tmp1 - S1[l];
+            X = Y * hq_2x_lanes[1][l];
+            tmp2 = S1[l] + X;
+            S1[l] = tmp1 + X;
+
+            /* ...third pass */
+            Y = tmp2 - S2[l];
+            X = Y * hq_2x_lanes[2][l];
+            y[l] = S2[l] + X;
+            S2[l] = tmp2 + X;
+        }
+
+        for (i_channel = 0; i_channel < 3; i_channel++)
+        {
+            x_out[2 * i_channel * num_samples + 2 * k] = y[i_channel];
+            x_out[2 * i_channel * num_samples + 2 * k + 1] = y[4 + i_channel];
+        }
+    }
+
+    for (i_channel = 0; i_channel < 3; i_channel++)
+    {
+        state[i_channel].upsamp_buffer[0][0] = S0[i_channel];
+        state[i_channel].upsamp_buffer[0][1] = S1[i_channel];
+        state[i_channel].upsamp_buffer[0][2] = S2[i_channel];
+        state[i_channel].upsamp_buffer[1][0] = S0[4 + i_channel];
+        state[i_channel].upsamp_buffer[1][1] = S1[4 + i_channel];
+        state[i_channel].upsamp_buffer[1][2] = S2[4 + i_channel];
     }
 }
 
+#ifdef BBWENET_POP_OPTIONS
+#pragma GCC pop_options
+#undef BBWENET_POP_OPTIONS
+#endif
+
 static void bbwenet_process_frames(
     BBWENet *hBBWENET,
     BBWENetState *state,
@@ -1189,15 +1215,12 @@ static void bbwenet_process_frames(
         /* 2x upsampling on individual channels */
         celt_assert(BBWENET_AF1_OUT_CHANNELS == 3);
         celt_assert(2 * BBWENET_AF1_FRAME_SIZE == BBWENET_TDSHAPE1_FRAME_SIZE);
-        for (i_channel = 0; i_channel < 3; i_channel ++)
-        {
-            upsamp_2x(
-                &state->resampler_state[i_channel],
-                x_buffer2 + i_subframe * BBWENET_TDSHAPE1_FRAME_SIZE * BBWENET_AF1_OUT_CHANNELS + i_channel * BBWENET_TDSHAPE1_FRAME_SIZE,
-                x_buffer1 + i_subframe * BBWENET_AF1_FRAME_SIZE * BBWENET_AF1_OUT_CHANNELS + i_channel * BBWENET_AF1_FRAME_SIZE,
-                BBWENET_AF1_FRAME_SIZE
-            );
-        }
+        upsamp_2x_3ch(
+            state->resampler_state,
+            x_buffer2 + i_subframe * BBWENET_TDSHAPE1_FRAME_SIZE * BBWENET_AF1_OUT_CHANNELS,
+            x_buffer1 + i_subframe * BBWENET_AF1_FRAME_SIZE * BBWENET_AF1_OUT_CHANNELS,
+            BBWENET_AF1_FRAME_SIZE
+        );
 
 #ifdef DEBUG_BBWENET
         fwrite(x_buffer2 + i_subframe * BBWENET_AF1_OUT_CHANNELS * BBWENET_TDSHAPE1_FRAME_SIZE, sizeof(float), BBWENET_TDSHAPE1_FRAME_SIZE, f_up2_1);
@@ -1226,9 +1249,12 @@ static void bbwenet_process_frames(
 #endif
 
         /* non-linear activation of third channel (in place)*/
-        apply_valin_activation(
+        compute_activation(
             x_buffer2 + i_subframe * BBWENET_AF1_OUT_CHANNELS * BBWENET_TDSHAPE1_FRAME_SIZE + 2 * BBWENET_TDSHAPE1_FRAME_SIZE,
-            BBWENET_TDSHAPE1_FRAME_SIZE
+            x_buffer2 + i_subframe * BBWENET_AF1_OUT_CHANNELS * BBWENET_TDSHAPE1_FRAME_SIZE + 2 * BBWENET_TDSHAPE1_FRAME_SIZE,
+            BBWENET_TDSHAPE1_FRAME_SIZE,
+            ACTIVATION_VALIN,
+            arch
         );
 #ifdef DEBUG_BBWENET
         fwrite(x_buffer2 + i_subframe * BBWENET_AF1_OUT_CHANNELS * BBWENET_TDSHAPE1_FRAME_SIZE + 2 * BBWENET_TDSHAPE1_FRAME_SIZE, sizeof(float), BBWENET_TDSHAPE1_FRAME_SIZE, f2_up_func);
@@ -1308,9 +1334,12 @@ static void bbwenet_process_frames(
 #endif
 
         /* non-linear activation of third channel (in place)*/
-        apply_valin_activation(
+        compute_activation(
             x_buffer2 + i_subframe * BBWENET_AF2_OUT_CHANNELS * BBWENET_TDSHAPE2_FRAME_SIZE + 2 * BBWENET_TDSHAPE2_FRAME_SIZE,
-            BBWENET_TDSHAPE2_FRAME_SIZE
+            x_buffer2 + i_subframe * BBWENET_AF2_OUT_CHANNELS * BBWENET_TDSHAPE2_FRAME_SIZE + 2 * BBWENET_TDSHAPE2_FRAME_SIZE,
+            BBWENET_TDSHAPE2_FRAME_SIZE,
+            ACTIVATION_VALIN,
+            arch
         );
 #ifdef DEBUG_BBWENET
         fwrite(x_buffer2 + i_subframe * BBWENET_AF2_OUT_CHANNELS * BBWENET_TDSHAPE2_FRAME_SIZE + 2 * BBWENET_TDSHAPE2_FRAME_SIZE, sizeof(float), BBWENET_TDSHAPE2_FRAME_SIZE, f_up15_func);
@@ -1364,6 +1393,7 @@ static int init_bbwenet(BBWENet *hBBWENET, const WeightArray *weights)
     OPUS_CLEAR(hBBWENET, 1);
     celt_assert(weights != NULL);
 
+    DNN_PROFILE_MODEL("bbwenet");
     ret = init_bbwenetlayers(&hBBWENET->layers, weights);
 
     compute_overlap_window(hBBWENET->window16, BBWENET_AF1_OVERLAP_SIZE);
@@ -1502,12 +1532,6 @@ void osce_bwe(
 
     osce_bwe_calculate_features(&psOSCEBWE->features, features, xq16, xq16_len);
 
-#if 0
-    /* just upsampling for now */
-    upsamp_2x(&psOSCEBWE->state.bbwenet.resampler_state[0], out_buffer, in_buffer, xq16_len);
-    interpol_3_2(&psOSCEBWE->state.bbwenet.resampler_state[0], out_buffer, out_buffer, 2 * xq16_len);
-
-#else
     /* process frames */
     bbwenet_process_frames(
         &model->bbwenet,
@@ -1518,7 +1542,6 @@ void osce_bwe(
         num_frames,
         arch
     );
-#endif
 
     /* scale and delay output */
     OPUS_COPY(xq48, psOSCEBWE->state.bbwenet.outbut_buffer, OSCE_BWE_OUTPUT_DELAY);
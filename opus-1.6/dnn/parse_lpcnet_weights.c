@@ -89,6 +89,12 @@ static const void *find_array_check(const WeightArray *arrays, const char *name,
   else return NULL;
 }
 
+static const void *find_half_array_check(const WeightArray *arrays, const char *name, int size) {
+  const WeightArray *a = find_array_entry(arrays, name);
+  if (a->name && a->type == WEIGHT_TYPE_float16 && a->size == size) return a->data;
+  else return NULL;
+}
+
 static const void *opt_array_check(const WeightArray *arrays, const char *name, int size, int *error) {
   const WeightArray *a = find_array_entry(arrays, name);
   *error = (a->name != NULL && a->size != size);
@@ -121,6 +127,22 @@ static const void *find_idx_check(const WeightArray *arrays, const char *name, i
   return a->data;
 }
 
+/* Dense layers can be made block-sparse when the weights blob is written, in
+   which case the index is stored as <weights>_idx, without the _int8/_float
+   suffix. */
+static const char *implicit_idx_name(const WeightArray *arrays, const char *weights, char *name, int size)
+{
+  const char *suffix;
+  int len;
+  if (weights == NULL || (suffix = strrchr(weights, '_')) == NULL) return NULL;
+  if (strcmp(suffix, "_int8") != 0 && strcmp(suffix, "_float") != 0) return NULL;
+  len = suffix - weights;
+  if (len + (int)sizeof("_idx") > size) return NULL;
+  memcpy(name, weights, len);
+  strcpy(name + len, "_idx");
+  return ((const WeightArray*)find_array_entry(arrays, name))->name != NULL ? name : NULL;
+}
+
 int linear_init(LinearLayer *layer, const WeightArray *arrays,
   const char *bias,
   const char *subias,
@@ -133,10 +155,13 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
   int nb_outputs)
 {
   int err;
+  int total_blocks = 0;
+  char idx_name[sizeof(((WeightHead*)0)->name)];
   layer->bias = NULL;
   layer->subias = NULL;
   layer->weights = NULL;
   layer->float_weights = NULL;
+  layer->half_weights = NULL;
   layer->weights_idx = NULL;
   layer->diag = NULL;
   layer->scale = NULL;
@@ -146,15 +171,18 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
   if (subias != NULL) {
     if ((layer->subias = find_array_check(arrays, subias, nb_outputs*sizeof(layer->subias[0]))) == NULL) return 1;
   }
+  if (weights_idx == NULL) {
+    weights_idx = implicit_idx_name(arrays, weights != NULL ? weights : float_weights, idx_name, sizeof(idx_name));
+  }
   if (weights_idx != NULL) {
-    int total_blocks;
     if ((layer->weights_idx = find_idx_check(arrays, weights_idx, nb_inputs, nb_outputs, &total_blocks)) == NULL) return 1;
     if (weights != NULL) {
       if ((layer->weights = find_array_check(arrays, weights, SPARSE_BLOCK_SIZE*total_blocks*sizeof(layer->weights[0]))) == NULL) return 1;
     }
     if (float_weights != NULL) {
       layer->float_weights = opt_array_check(arrays, float_weights, SPARSE_BLOCK_SIZE*total_blocks*sizeof(layer->float_weights[0]), &err);
-      if (err) return 1;
+      /* The float weights may have been stored as fp16 in the blob. */
+      if (err && (layer->half_weights = find_half_array_check(arrays, float_weights, SPARSE_BLOCK_SIZE*total_blocks*sizeof(layer->half_weights[0]))) == NULL) return 1;
     }
   } else {
     if (weights != NULL) {
@@ -162,7 +190,7 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
     }
     if (float_weights != NULL) {
       layer->float_weights = opt_array_check(arrays, float_weights, nb_inputs*nb_outputs*sizeof(layer->float_weights[0]), &err);
-      if (err) return 1;
+      if (err && (layer->half_weights = find_half_array_check(arrays, float_weights, nb_inputs*nb_outputs*sizeof(layer->half_weights[0]))) == NULL) return 1;
     }
   }
   if (diag != NULL) {
@@ -173,6 +201,19 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
   }
   layer->nb_inputs = nb_inputs;
   layer->nb_outputs = nb_outputs;
+#ifdef ENABLE_DNN_PROFILE
+  {
+    double nb_weights, bytes;
+    nb_weights = layer->weights_idx != NULL ? SPARSE_BLOCK_SIZE*(double)total_blocks : nb_inputs*(double)nb_outputs;
+    if (layer->float_weights != NULL) bytes = nb_weights*sizeof(float);
+    else if (layer->half_weights != NULL) bytes = nb_weights*sizeof(opus_uint16);
+    else bytes = nb_weights*sizeof(opus_int8);
+    /* The block index is read alongside the weights. */
+    if (layer->weights_idx != NULL) bytes += (nb_outputs/8 + total_blocks)*sizeof(int);
+    layer->profile_id = dnn_profile_register(weights != NULL ? weights : float_weights != NULL ? float_weights : bias,
+        2*nb_weights, bytes);
+  }
+#endif
   return 0;
 }
 
@@ -198,6 +239,11 @@ int conv2d_init(Conv2dLayer *layer, const WeightArray *arrays,
   layer->out_channels = out_channels;
   layer->ktime = ktime;
   layer->kheight = kheight;
+#ifdef ENABLE_DNN_PROFILE
+  /* Per output row; scaled by the height at call time. */
+  layer->profile_id = dnn_profile_register(float_weights != NULL ? float_weights : bias,
+      2.*in_channels*out_channels*ktime*kheight, in_channels*out_channels*ktime*kheight*sizeof(float));
+#endif
   return 0;
 }
 
@@ -61,6 +61,7 @@ void pitchdnn_init(PitchDNNState *st)
   int ret;
   OPUS_CLEAR(st, 1);
 #ifndef USE_WEIGHTS_FILE
+  DNN_PROFILE_MODEL("pitchdnn");
   ret = init_pitchdnn(&st->model, pitchdnn_arrays);
 #else
   ret = 0;
@@ -72,6 +73,7 @@ int pitchdnn_load_model(PitchDNNState *st, const void *data, int len) {
   WeightArray *list;
   int ret;
   parse_weights(&list, data, len);
+  DNN_PROFILE_MODEL("pitchdnn");
   ret = init_pitchdnn(&st->model, list);
   opus_free(list);
   if (ret == 0) return 0;
@@ -34,6 +34,54 @@
 #include "arch.h"
 #include "x86/x86_arch_macros.h"
 
+/* Constants for the activation used by the BBWENet signal path,
+   y = x*celt_sin(log(|x| + 1e-6)) with celt_sin(t) = celt_cos_norm2(pi/2*t - 1).
+   The log uses the exponent/mantissa split with a Cephes polynomial on
+   [sqrt(.5), sqrt(2)), the cosine is the celt_cos_norm2() polynomial. */
+#define VALIN_LOG_P0 7.0376836292e-2f
+#define VALIN_LOG_P1 -1.1514610310e-1f
+#define VALIN_LOG_P2 1.1676998740e-1f
+#define VALIN_LOG_P3 -1.2420140846e-1f
+#define VALIN_LOG_P4 1.4249322787e-1f
+#define VALIN_LOG_P5 -1.6668057665e-1f
+#define VALIN_LOG_P6 2.0000714765e-1f
+#define VALIN_LOG_P7 -2.4999993993e-1f
+#define VALIN_LOG_P8 3.3333331174e-1f
+#define VALIN_COS_A0 9.999999403953552246093750000000e-01f
+#define VALIN_COS_A2 -1.233698248863220214843750000000000f
+#define VALIN_COS_A4 2.536507546901702880859375000000e-01f
+#define VALIN_COS_A6 -2.08106283098459243774414062500e-02f
+#define VALIN_COS_A8 8.581906440667808055877685546875e-04f
+
+/* IEEE half-precision conversion for weights stored as fp16. Weights are
+   finite and small, so infinities and NaNs are not handled. Scaling by 2^112
+   rebiases the exponent and takes care of half denormals. */
+static inline float half_to_float(opus_uint16 h)
+{
+   union {float f; opus_uint32 i;} u;
+   u.i = (opus_uint32)(h&0x7fff)<<13;
+   u.f *= 5.192296858534828e+33f;
+   u.i |= (opus_uint32)(h&0x8000)<<16;
+   return u.f;
+}
+
+static inline opus_uint16 float_to_half(float x)
+{
+   union {float f; opus_uint32 i;} u;
+   opus_uint32 sign, h, rem;
+   u.f = x;
+   sign = (u.i>>16)&0x8000;
+   u.i &= 0x7fffffff;
+   /* Saturate to the largest finite half. */
+   if (u.f >= 65504.f) return sign|0x7bff;
+   /* Below 2^-14 the half is denormal, with a step of 2^-24. */
+   if (u.f < 6.103515625e-05f) return sign|(opus_uint16)floor(.5+u.f*16777216.f);
+   u.i -= 0x38000000;
+   h = u.i>>13;
+   rem = u.i&0x1fff;
+   if (rem > 0x1000 || (rem == 0x1000 && (h&1))) h++;
+   return sign|h;
+}
 
 #if defined(__AVX__) || defined(__SSE2__)
 #include "vec_avx.h"
@@ -180,6 +228,41 @@ static inline void sparse_sgemv8x4(float *out, const float *w, const int *idx, i
    }
 }
 
+static inline void sgemv_half(float *out, const opus_uint16 *weights, int rows, int cols, int col_stride, const float *x)
+{
+   int i, j;
+   OPUS_CLEAR(out, rows);
+   for (j=0;j<cols;j++)
+   {
+      const opus_uint16 * restrict w;
+      float xj;
+      w = &weights[j*col_stride];
+      xj = x[j];
+      for (i=0;i<rows;i++) out[i] += half_to_float(w[i])*xj;
+   }
+}
+
+static inline void sparse_sgemv8x4_half(float *out, const opus_uint16 *w, const int *idx, int rows, const float *x)
+{
+   int i, j, k;
+   OPUS_CLEAR(out, rows);
+   for (i=0;i<rows;i+=8)
+   {
+      int cols;
+      cols = *idx++;
+      for (j=0;j<cols;j++)
+      {
+         int pos;
+         float * restrict y;
+         pos = (*idx++);
+         y = &out[i];
+         for (k=0;k<8;k++) y[k] += half_to_float(w[k])*x[pos] + half_to_float(w[8+k])*x[pos+1]
+                                 + half_to_float(w[16+k])*x[pos+2] + half_to_float(w[24+k])*x[pos+3];
+         w += 32;
+      }
+   }
+}
+
 #ifdef USE_SU_BIAS
 static inline void sparse_cgemv8x4(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, int cols, const float *_x)
 {
@@ -380,6 +463,50 @@ static inline void vec_sigmoid(float *y, const float *x, int N)
         y[i] = sigmoid_approx(x[i]);
     }
 }
+
+static inline float valin_approx(float x)
+{
+   int e;
+   float a, m, f, z, p, t, sign;
+   union {
+      float f;
+      opus_uint32 i;
+   } u;
+   a = (float)fabs(x) + 1e-6f;
+   u.f = a;
+   e = (int)(u.i>>23) - 127;
+   u.i = (u.i & 0x007fffff) | 0x3f800000;
+   m = u.f;
+   if (m > 1.41421356f) {
+      m *= .5f;
+      e++;
+   }
+   f = m - 1.f;
+   z = f*f;
+   p = fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(VALIN_LOG_P0, f, VALIN_LOG_P1), f, VALIN_LOG_P2),
+         f, VALIN_LOG_P3), f, VALIN_LOG_P4), f, VALIN_LOG_P5), f, VALIN_LOG_P6), f, VALIN_LOG_P7), f, VALIN_LOG_P8);
+   p = fmadd(-.5f, z, p*f*z);
+   t = fmadd((float)e, 0.6931471805599453f, f + p);
+   t = fmadd(t, 1.5707963267948966f, -1.f);
+   t -= 4.f*(float)floor(.25f*(t + 1.f));
+   sign = 1.f;
+   if (t > 1.f) {
+      t -= 2.f;
+      sign = -1.f;
+   }
+   z = t*t;
+   p = fmadd(fmadd(fmadd(fmadd(VALIN_COS_A8, z, VALIN_COS_A6), z, VALIN_COS_A4), z, VALIN_COS_A2), z, VALIN_COS_A0);
+   return x*sign*p;
+}
+
+static inline void vec_valin(float *y, const float *x, int N)
+{
+    int i;
+    for (i=0;i<N;i++)
+    {
+        y[i] = valin_approx(x[i]);
+    }
+}
 #endif
 
 #define SCALE (128.f*127.f)
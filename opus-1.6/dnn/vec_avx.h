@@ -622,6 +622,132 @@ static inline void vec_sigmoid(float *y, const float *x, int N)
 
 #endif
 
+static inline __m128 valin4_approx(__m128 X)
+{
+   const __m128 one = _mm_set1_ps(1.f);
+   const __m128 half = _mm_set1_ps(.5f);
+   __m128 A, M, E, F, Z, P, T, Q, mask;
+   __m128i I;
+   A = _mm_add_ps(_mm_and_ps(X, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))), _mm_set1_ps(1e-6f));
+   /* log(a) = e*log(2) + log(m), m in [sqrt(.5), sqrt(2)) */
+   I = _mm_castps_si128(A);
+   E = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(I, 23), _mm_set1_epi32(127)));
+   M = _mm_or_ps(_mm_and_ps(A, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))), one);
+   mask = _mm_cmpgt_ps(M, _mm_set1_ps(1.41421356f));
+   M = _mm_sub_ps(M, _mm_and_ps(mask, _mm_mul_ps(M, half)));
+   E = _mm_add_ps(E, _mm_and_ps(mask, one));
+   F = _mm_sub_ps(M, one);
+   Z = _mm_mul_ps(F, F);
+   P = _mm_fmadd_ps(_mm_set1_ps(VALIN_LOG_P0), F, _mm_set1_ps(VALIN_LOG_P1));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P2));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P3));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P4));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P5));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P6));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P7));
+   P = _mm_fmadd_ps(P, F, _mm_set1_ps(VALIN_LOG_P8));
+   P = _mm_mul_ps(_mm_mul_ps(P, F), Z);
+   P = _mm_fmadd_ps(_mm_set1_ps(-.5f), Z, P);
+   T = _mm_fmadd_ps(E, _mm_set1_ps(0.6931471805599453f), _mm_add_ps(F, P));
+   /* cos(pi/2*t) with t = pi/2*log(a) - 1, reduced to [-1, 1] */
+   T = _mm_fmadd_ps(T, _mm_set1_ps(1.5707963267948966f), _mm_set1_ps(-1.f));
+   Q = _mm_floor_ps(_mm_mul_ps(_mm_set1_ps(.25f), _mm_add_ps(T, one)));
+   T = _mm_fmadd_ps(Q, _mm_set1_ps(-4.f), T);
+   mask = _mm_cmpgt_ps(T, one);
+   T = _mm_sub_ps(T, _mm_and_ps(mask, _mm_set1_ps(2.f)));
+   Z = _mm_mul_ps(T, T);
+   P = _mm_fmadd_ps(_mm_set1_ps(VALIN_COS_A8), Z, _mm_set1_ps(VALIN_COS_A6));
+   P = _mm_fmadd_ps(P, Z, _mm_set1_ps(VALIN_COS_A4));
+   P = _mm_fmadd_ps(P, Z, _mm_set1_ps(VALIN_COS_A2));
+   P = _mm_fmadd_ps(P, Z, _mm_set1_ps(VALIN_COS_A0));
+   P = _mm_xor_ps(P, _mm_and_ps(mask, _mm_set1_ps(-0.f)));
+   return _mm_mul_ps(X, P);
+}
+
+static inline float valin_approx(float x)
+{
+   float out[4];
+   __m128 X, Y;
+   X = _mm_set1_ps(x);
+   Y = valin4_approx(X);
+   _mm_storeu_ps(out, Y);
+   return out[0];
+}
+
+#ifdef __AVX2__
+static inline __m256 valin8_approx(__m256 X)
+{
+   const __m256 one = _mm256_set1_ps(1.f);
+   const __m256 half = _mm256_set1_ps(.5f);
+   __m256 A, M, E, F, Z, P, T, Q, mask;
+   __m256i I;
+   A = _mm256_add_ps(_mm256_and_ps(X, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))), _mm256_set1_ps(1e-6f));
+   I = _mm256_castps_si256(A);
+   E = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(I, 23), _mm256_set1_epi32(127)));
+   M = _mm256_or_ps(_mm256_and_ps(A, _mm256_castsi256_ps(_mm256_set1_epi32(0x007fffff))), one);
+   mask = _mm256_cmp_ps(M, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+   M = _mm256_sub_ps(M, _mm256_and_ps(mask, _mm256_mul_ps(M, half)));
+   E = _mm256_add_ps(E, _mm256_and_ps(mask, one));
+   F = _mm256_sub_ps(M, one);
+   Z = _mm256_mul_ps(F, F);
+   P = _mm256_fmadd_ps(_mm256_set1_ps(VALIN_LOG_P0), F, _mm256_set1_ps(VALIN_LOG_P1));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P2));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P3));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P4));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P5));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P6));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P7));
+   P = _mm256_fmadd_ps(P, F, _mm256_set1_ps(VALIN_LOG_P8));
+   P = _mm256_mul_ps(_mm256_mul_ps(P, F), Z);
+   P = _mm256_fmadd_ps(_mm256_set1_ps(-.5f), Z, P);
+   T = _mm256_fmadd_ps(E, _mm256_set1_ps(0.6931471805599453f), _mm256_add_ps(F, P));
+   T = _mm256_fmadd_ps(T, _mm256_set1_ps(1.5707963267948966f), _mm256_set1_ps(-1.f));
+   Q = _mm256_floor_ps(_mm256_mul_ps(_mm256_set1_ps(.25f), _mm256_add_ps(T, one)));
+   T = _mm256_fmadd_ps(Q, _mm256_set1_ps(-4.f), T);
+   mask = _mm256_cmp_ps(T, one, _CMP_GT_OQ);
+   T = _mm256_sub_ps(T, _mm256_and_ps(mask, _mm256_set1_ps(2.f)));
+   Z = _mm256_mul_ps(T, T);
+   P = _mm256_fmadd_ps(_mm256_set1_ps(VALIN_COS_A8), Z, _mm256_set1_ps(VALIN_COS_A6));
+   P = _mm256_fmadd_ps(P, Z, _mm256_set1_ps(VALIN_COS_A4));
+   P = _mm256_fmadd_ps(P, Z, _mm256_set1_ps(VALIN_COS_A2));
+   P = _mm256_fmadd_ps(P, Z, _mm256_set1_ps(VALIN_COS_A0));
+   P = _mm256_xor_ps(P, _mm256_and_ps(mask, _mm256_set1_ps(-0.f)));
+   return _mm256_mul_ps(X, P);
+}
+
+static inline void vec_valin(float *y, const float *x, int N)
+{
+    int i;
+    for (i=0;i<N-7;i+=8)
+    {
+        __m256 X, Y;
+        X = _mm256_loadu_ps(&x[i]);
+        Y = valin8_approx(X);
+        _mm256_storeu_ps(&y[i], Y);
+    }
+    for (;i<N;i++)
+    {
+        y[i] = valin_approx(x[i]);
+    }
+}
+#else
+static inline void vec_valin(float *y, const float *x, int N)
+{
+    int i;
+    for (i=0;i<N-3;i+=4)
+    {
+        __m128 X, Y;
+        X = _mm_loadu_ps(&x[i]);
+        Y = valin4_approx(X);
+        _mm_storeu_ps(&y[i], Y);
+    }
+    for (;i<N;i++)
+    {
+        y[i] = valin_approx(x[i]);
+    }
+}
+#endif
+
 #if defined(__AVXVNNI__) || defined(__AVX512VNNI__)
 
 #define opus_mm256_dpbusds_epi32(src, a, b) _mm256_dpbusds_epi32(src, a, b)
@@ -777,6 +903,139 @@ static inline void sparse_sgemv8x4(float *out, const float *weights, const int *
    }
 }
 
+/* Expands 4 (resp. 8) fp16 weights to floats, with vcvtph2ps when F16C is
+   available and with the half_to_float() bit manipulation otherwise. */
+static inline __m128 half4_load(const opus_uint16 *src)
+{
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+   return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)(const void*)src));
+#else
+   __m128i h;
+   /* Put the half in the upper 16 bits, then shift the exponent and mantissa
+      in place and drop the copies of the sign bit the shift leaves behind. */
+   h = _mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)(const void*)src));
+   h = _mm_and_si128(_mm_srai_epi32(h, 3), _mm_set1_epi32((int)0x8fffe000));
+   return _mm_mul_ps(_mm_castsi128_ps(h), _mm_set1_ps(5.192296858534828e+33f));
+#endif
+}
+
+static inline __m256 half8_load(const opus_uint16 *src)
+{
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+   return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(const void*)src));
+#else
+   __m256 ret;
+   ret = _mm256_insertf128_ps(_mm256_setzero_ps(), half4_load(src), 0);
+   return _mm256_insertf128_ps(ret, half4_load(src+4), 1);
+#endif
+}
+
+static inline void sgemv_half(float *out, const opus_uint16 *weights, int rows, int cols, int col_stride, const float *x)
+{
+  int i, j;
+  i=0;
+  for (;i<rows-15;i+=16)
+  {
+     float *y;
+     __m256 vy0, vy8;
+     y = &out[i];
+     vy0 = _mm256_setzero_ps();
+     vy8 = _mm256_setzero_ps();
+     for (j=0;j<cols;j++)
+     {
+        __m256 vxj;
+        __m256 vw;
+        vxj = _mm256_broadcast_ss(&x[j]);
+
+        vw = half8_load(&weights[j*col_stride + i]);
+        vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+
+        vw = half8_load(&weights[j*col_stride + i + 8]);
+        vy8 = _mm256_fmadd_ps(vw, vxj, vy8);
+     }
+     _mm256_storeu_ps (&y[0], vy0);
+     _mm256_storeu_ps (&y[8], vy8);
+  }
+  for (;i<rows-7;i+=8)
+  {
+     float *y;
+     __m256 vy0;
+     y = &out[i];
+     vy0 = _mm256_setzero_ps();
+     for (j=0;j<cols;j++)
+     {
+        __m256 vxj;
+        __m256 vw;
+        vxj = _mm256_broadcast_ss(&x[j]);
+
+        vw = half8_load(&weights[j*col_stride + i]);
+        vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+     }
+     _mm256_storeu_ps (&y[0], vy0);
+  }
+  for (;i<rows-3;i+=4)
+  {
+     float *y;
+     __m128 vy0;
+     y = &out[i];
+     vy0 = _mm_setzero_ps();
+     for (j=0;j<cols;j++)
+     {
+        __m128 vxj;
+        __m128 vw;
+        vxj = _mm_set1_ps(x[j]);
+
+        vw = half4_load(&weights[j*col_stride + i]);
+        vy0 = _mm_fmadd_ps(vw, vxj, vy0);
+     }
+     _mm_storeu_ps (&y[0], vy0);
+  }
+  for (;i<rows;i++)
+  {
+    out[i] = 0;
+    for (j=0;j<cols;j++) out[i] += half_to_float(weights[j*col_stride + i])*x[j];
+  }
+}
+
+static inline void sparse_sgemv8x4_half(float *out, const opus_uint16 *weights, const int *idx, int rows, const float *x)
+{
+   int i, j;
+   for (i=0;i<rows;i+=8)
+   {
+      float *y;
+      int cols;
+      __m256 vy0;
+      y = &out[i];
+      vy0 = _mm256_setzero_ps();
+      cols = *idx++;
+      for (j=0;j<cols;j++)
+      {
+         int id;
+         __m256 vxj;
+         __m256 vw;
+         id = *idx++;
+         vxj = _mm256_broadcast_ss(&x[id]);
+         vw = half8_load(&weights[0]);
+         vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+
+         vxj = _mm256_broadcast_ss(&x[id+1]);
+         vw = half8_load(&weights[8]);
+         vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+
+         vxj = _mm256_broadcast_ss(&x[id+2]);
+         vw = half8_load(&weights[16]);
+         vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+
+         vxj = _mm256_broadcast_ss(&x[id+3]);
+         vw = half8_load(&weights[24]);
+         vy0 = _mm256_fmadd_ps(vw, vxj, vy0);
+
+         weights += 32;
+      }
+      _mm256_storeu_ps (&y[0], vy0);
+   }
+}
+
 static inline void sparse_cgemv8x4(float *_out, const opus_int8 *w, const int *idx, const float *scale, int rows, int cols, const float *_x)
 {
    int i, j;
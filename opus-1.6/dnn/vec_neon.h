@@ -124,6 +124,52 @@ static inline float32x4_t sigmoid4_approx(float32x4_t X)
   return vmaxq_f32(min_out, vminq_f32(max_out, num));
 }
 
+static inline float32x4_t valin4_approx(float32x4_t X)
+{
+  const float32x4_t one = vdupq_n_f32(1.f);
+  const uint32x4_t one_bits = vreinterpretq_u32_f32(one);
+  float32x4_t A, M, E, F, Z, P, T, Q;
+  uint32x4_t mask;
+  int32x4_t I;
+  A = vaddq_f32(vabsq_f32(X), vdupq_n_f32(1e-6f));
+  /* log(a) = e*log(2) + log(m), m in [sqrt(.5), sqrt(2)) */
+  I = vreinterpretq_s32_f32(A);
+  E = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(I, 23), vdupq_n_s32(127)));
+  M = vreinterpretq_f32_s32(vorrq_s32(vandq_s32(I, vdupq_n_s32(0x007fffff)), vdupq_n_s32(0x3f800000)));
+  mask = vcgtq_f32(M, vdupq_n_f32(1.41421356f));
+  M = vbslq_f32(mask, vmulq_n_f32(M, .5f), M);
+  E = vaddq_f32(E, vreinterpretq_f32_u32(vandq_u32(mask, one_bits)));
+  F = vsubq_f32(M, one);
+  Z = vmulq_f32(F, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P1), vdupq_n_f32(VALIN_LOG_P0), F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P2), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P3), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P4), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P5), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P6), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P7), P, F);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_LOG_P8), P, F);
+  P = vmulq_f32(vmulq_f32(P, F), Z);
+  P = vmlaq_f32(P, vdupq_n_f32(-.5f), Z);
+  T = vmlaq_f32(vaddq_f32(F, P), E, vdupq_n_f32(0.6931471805599453f));
+  /* cos(pi/2*t) with t = pi/2*log(a) - 1, reduced to [-1, 1] */
+  T = vmlaq_f32(vdupq_n_f32(-1.f), T, vdupq_n_f32(1.5707963267948966f));
+  Q = vmulq_n_f32(vaddq_f32(T, one), .25f);
+  /* floor() from truncation, correcting negative non-integers */
+  F = vcvtq_f32_s32(vcvtq_s32_f32(Q));
+  Q = vsubq_f32(F, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(F, Q), one_bits)));
+  T = vmlaq_f32(T, Q, vdupq_n_f32(-4.f));
+  mask = vcgtq_f32(T, one);
+  T = vsubq_f32(T, vreinterpretq_f32_u32(vandq_u32(mask, vreinterpretq_u32_f32(vdupq_n_f32(2.f)))));
+  Z = vmulq_f32(T, T);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_COS_A6), vdupq_n_f32(VALIN_COS_A8), Z);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_COS_A4), P, Z);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_COS_A2), P, Z);
+  P = vmlaq_f32(vdupq_n_f32(VALIN_COS_A0), P, Z);
+  P = vbslq_f32(mask, vnegq_f32(P), P);
+  return vmulq_f32(X, P);
+}
+
 static inline float lpcnet_exp(float x)
 {
    float out[4];
@@ -203,6 +249,27 @@ static inline void vec_sigmoid(float *y, const float *x, int N)
         y[i] = (ex)/(ex+1);
     }
 }
+
+static inline void vec_valin(float *y, const float *x, int N)
+{
+    int i;
+    for (i=0;i<N-3;i+=4)
+    {
+        float32x4_t X, Y;
+        X = vld1q_f32(&x[i]);
+        Y = valin4_approx(X);
+        vst1q_f32(&y[i], Y);
+    }
+    for (;i<N;i++)
+    {
+        float out[4];
+        float32x4_t X, Y;
+        X = vdupq_n_f32(x[i]);
+        Y = valin4_approx(X);
+        vst1q_f32(out, Y);
+        y[i] = out[0];
+    }
+}
 #endif
 
 static inline void sgemv16x1(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
@@ -358,6 +425,80 @@ static inline void sparse_sgemv8x4(float *out, const float *w, const int *idx, i
    }
 }
 
+/* Expands 4 fp16 weights to floats. AArch64 always has the fp16 conversion,
+   ARMv7 NEON falls back to the half_to_float() bit manipulation. */
+static inline float32x4_t half4_load(const opus_uint16 *src)
+{
+#if defined(__aarch64__)
+   return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src)));
+#else
+   int32x4_t h;
+   h = vreinterpretq_s32_u32(vshll_n_u16(vld1_u16(src), 16));
+   h = vandq_s32(vshrq_n_s32(h, 3), vdupq_n_s32((int)0x8fffe000));
+   return vmulq_n_f32(vreinterpretq_f32_s32(h), 5.192296858534828e+33f);
+#endif
+}
+
+static inline void sgemv_half(float *out, const opus_uint16 *weights, int rows, int cols, int col_stride, const float *x)
+{
+   int i, j;
+   i=0;
+   for (;i<rows-7;i+=8)
+   {
+      float32x4_t y0_3 = vdupq_n_f32(0);
+      float32x4_t y4_7 = vdupq_n_f32(0);
+      for (j=0;j<cols;j++)
+      {
+         const opus_uint16 * restrict w;
+         float32x4_t xj;
+         w = &weights[j*col_stride + i];
+         xj = vld1q_dup_f32(&x[j]);
+         y0_3 = vmlaq_f32(y0_3, half4_load(&w[0]), xj);
+         y4_7 = vmlaq_f32(y4_7, half4_load(&w[4]), xj);
+      }
+      vst1q_f32(&out[i], y0_3);
+      vst1q_f32(&out[i+4], y4_7);
+   }
+   for (;i<rows;i++)
+   {
+      out[i] = 0;
+      for (j=0;j<cols;j++) out[i] += half_to_float(weights[j*col_stride + i])*x[j];
+   }
+}
+
+static inline void sparse_sgemv8x4_half(float *out, const opus_uint16 *w, const int *idx, int rows, const float *x)
+{
+   int i, j;
+   for (i=0;i<rows;i+=8)
+   {
+      int cols;
+      float32x4_t y0_3 = vdupq_n_f32(0);
+      float32x4_t y4_7 = vdupq_n_f32(0);
+      cols = *idx++;
+      for (j=0;j<cols;j++)
+      {
+         int pos;
+         float32x4_t xj;
+         pos = (*idx++);
+         xj = vld1q_dup_f32(&x[pos]);
+         y0_3 = vmlaq_f32(y0_3, half4_load(&w[0]), xj);
+         y4_7 = vmlaq_f32(y4_7, half4_load(&w[4]), xj);
+         xj = vld1q_dup_f32(&x[pos+1]);
+         y0_3 = vmlaq_f32(y0_3, half4_load(&w[8]), xj);
+         y4_7 = vmlaq_f32(y4_7, half4_load(&w[12]), xj);
+         xj = vld1q_dup_f32(&x[pos+2]);
+         y0_3 = vmlaq_f32(y0_3, half4_load(&w[16]), xj);
+         y4_7 = vmlaq_f32(y4_7, half4_load(&w[20]), xj);
+         xj = vld1q_dup_f32(&x[pos+3]);
+         y0_3 = vmlaq_f32(y0_3, half4_load(&w[24]), xj);
+         y4_7 = vmlaq_f32(y4_7, half4_load(&w[28]), xj);
+         w += 32;
+      }
+      vst1q_f32(&out[i], y0_3);
+      vst1q_f32(&out[i+4], y4_7);
+   }
+}
+
 
 #define SCALE (128.f*127.f)
 #define SCALE_1 (1.f/128.f/127.f)
@@ -29,11 +29,13 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stddef.h>
 #include "nnet.h"
 #include "os_support.h"
 #include "arch.h"
+#include "vec.h"
 
 /* This is a bit of a hack because we need to build nnet_data.c and plc_data.c without USE_WEIGHTS_FILE,
    but USE_WEIGHTS_FILE is defined in config.h. */
@@ -49,48 +51,334 @@
 #ifdef ENABLE_OSCE
 #include "lace_data.c"
 #include "nolace_data.c"
+#ifdef ENABLE_OSCE_BWE
+#include "bbwenet_data.c"
 #endif
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+#include "nsdnn_data.c"
+#endif
+
+static int use_fp16 = 0;
+static int use_sparse = 0;
+static float sparse_thresh = 0;
+
+/* Layers with fewer dropped 8x4 blocks than this stay dense, as the block
+   index costs more than the skipped MACs. */
+#define SPARSE_MIN_RATIO .25f
+
+#define MAX_DENSE_LAYERS 256
+
+/* Dense layers of the model being written, as seen by linear_init(). */
+typedef struct {
+  const char *weights;
+  const char *float_weights;
+  const char *scale;
+  int nb_inputs;
+  int nb_outputs;
+} DenseLayer;
+
+static DenseLayer dense_layers[MAX_DENSE_LAYERS];
+static int nb_dense_layers;
+static double model_macs;
+static double saved_macs;
+static float max_sparse_err;
+static int nb_sparse_layers;
+
+static int count_sparse_blocks(const WeightArray *arrays, const char *name)
+{
+  int blocks = 0;
+  while (arrays->name && strcmp(arrays->name, name) != 0) arrays++;
+  if (arrays->name) {
+    const int *idx = arrays->data;
+    int remain = arrays->size/sizeof(int);
+    while (remain > 0) {
+      blocks += *idx;
+      remain -= *idx+1;
+      idx += *idx+1;
+    }
+  }
+  return blocks;
+}
+
+/* The generated init_*() functions are only used to learn the layer shapes. */
+int linear_init(LinearLayer *layer, const WeightArray *arrays,
+  const char *bias,
+  const char *subias,
+  const char *weights,
+  const char *float_weights,
+  const char *weights_idx,
+  const char *diag,
+  const char *scale,
+  int nb_inputs,
+  int nb_outputs)
+{
+  (void)layer;
+  (void)bias;
+  (void)subias;
+  (void)diag;
+  if (weights_idx != NULL) {
+    model_macs += 32.*count_sparse_blocks(arrays, weights_idx);
+    return 0;
+  }
+  model_macs += (double)nb_inputs*nb_outputs;
+  /* Embedding tables are indexed directly rather than multiplied. */
+  if ((weights != NULL || float_weights != NULL) && (float_weights == NULL || strstr(float_weights, "embed") == NULL)
+      && nb_dense_layers < MAX_DENSE_LAYERS) {
+    dense_layers[nb_dense_layers].weights = weights;
+    dense_layers[nb_dense_layers].float_weights = float_weights;
+    dense_layers[nb_dense_layers].scale = scale;
+    dense_layers[nb_dense_layers].nb_inputs = nb_inputs;
+    dense_layers[nb_dense_layers].nb_outputs = nb_outputs;
+    nb_dense_layers++;
+  }
+  return 0;
+}
+
+int conv2d_init(Conv2dLayer *layer, const WeightArray *arrays,
+  const char *bias,
+  const char *float_weights,
+  int in_channels,
+  int out_channels,
+  int ktime,
+  int kheight)
+{
+  (void)layer;
+  (void)arrays;
+  (void)bias;
+  (void)float_weights;
+  (void)in_channels;
+  (void)out_channels;
+  (void)ktime;
+  (void)kheight;
+  return 0;
+}
+
+/* Dense float weights are stored as fp16 with -fp16. Embedding tables are
+   read directly by the models rather than through compute_linear(), so they
+   stay float. */
+static int store_as_fp16(const char *name, int type)
+{
+  const char *suffix = "_weights_float";
+  size_t len = strlen(name);
+  return use_fp16 && type == WEIGHT_TYPE_float
+      && len > strlen(suffix) && strcmp(name + len - strlen(suffix), suffix) == 0
+      && strstr(name, "embed") == NULL;
+}
+
+static void write_array(const char *name, int type, int size, const void *data, FILE *fout)
+{
+  WeightHead h;
+  unsigned char zeros[WEIGHT_BLOCK_SIZE] = {0};
+  opus_uint16 *half = NULL;
+  if (strlen(name) >= sizeof(h.name) - 1) {
+    printf("[write_weights] warning: name %s too long\n", name);
+  }
+  memcpy(h.head, "DNNw", 4);
+  h.version = WEIGHT_BLOB_VERSION;
+  h.type = type;
+  h.size = size;
+  if (store_as_fp16(name, type)) {
+    int j;
+    int n = size/sizeof(float);
+    const float *w = data;
+    half = malloc(n*sizeof(*half));
+    for (j=0;j<n;j++) half[j] = float_to_half(w[j]);
+    h.type = WEIGHT_TYPE_float16;
+    h.size = n*sizeof(*half);
+    data = half;
+  }
+  h.block_size = (h.size+WEIGHT_BLOCK_SIZE-1)/WEIGHT_BLOCK_SIZE*WEIGHT_BLOCK_SIZE;
+  OPUS_CLEAR(h.name, sizeof(h.name));
+  strncpy(h.name, name, sizeof(h.name));
+  h.name[sizeof(h.name)-1] = 0;
+  celt_assert(sizeof(h) == WEIGHT_BLOCK_SIZE);
+  fwrite(&h, 1, WEIGHT_BLOCK_SIZE, fout);
+  fwrite(data, 1, h.size, fout);
+  fwrite(zeros, 1, h.block_size-h.size, fout);
+  free(half);
+}
+
+static const WeightArray *find_array(const WeightArray *list, const char *name)
+{
+  if (name == NULL) return NULL;
+  while (list->name && strcmp(list->name, name) != 0) list++;
+  return list->name ? list : NULL;
+}
+
+/* Repacks a dense layer into the 8x4 block-sparse layout consumed by
+   sparse_sgemv8x4() and sparse_cgemv8x4(), dropping the blocks whose weights
+   are all within sparse_thresh (relative to the largest weight) of zero. The index is stored next to the
+   weights, with the "_float" or "_int8" suffix replaced by "_idx", which is
+   where linear_init() looks for it. Returns 0 when the layer is not worth
+   converting. */
+static int write_sparse(const DenseLayer *l, const WeightArray *a, const float *scale, FILE *fout)
+{
+  int i, j, k;
+  int rows = l->nb_outputs;
+  int cols = l->nb_inputs;
+  int is_float = a->type == WEIGHT_TYPE_float;
+  int total_blocks, kept_blocks;
+  int elem = is_float ? sizeof(float) : sizeof(opus_int8);
+  unsigned char *packed;
+  int *idx;
+  int nb_packed, nb_idx;
+  char idx_name[sizeof(((WeightHead*)0)->name)];
+  size_t len = strlen(a->name) - (is_float ? strlen("_float") : strlen("_int8"));
+  float *x, *out, *ref;
+  float err, maxref;
+  float thresh;
+  if ((rows&7) || (cols&3) || cols > MAX_INPUTS || len+strlen("_idx") >= sizeof(idx_name)) return 0;
+  if (a->size != rows*cols*elem || (!is_float && scale == NULL)) return 0;
+  /* The threshold is relative to the largest weight of the layer. */
+  thresh = 0;
+  for (i=0;i<rows*cols;i++) {
+    if (is_float) thresh = MAX16(thresh, (float)fabs(((const float*)a->data)[i]));
+    else thresh = MAX16(thresh, (float)fabs(((const opus_int8*)a->data)[i]*scale[i/(8*cols)*8 + (i&31)/4]));
+  }
+  thresh *= sparse_thresh;
+  packed = malloc(rows*cols*elem);
+  idx = malloc((rows/8*(cols/4+1))*sizeof(*idx));
+  nb_packed = nb_idx = 0;
+  total_blocks = rows/8*cols/4;
+  kept_blocks = 0;
+  for (i=0;i<rows;i+=8) {
+    int *count = &idx[nb_idx++];
+    *count = 0;
+    for (j=0;j<cols;j+=4) {
+      float block[32];
+      float maxw = 0;
+      if (is_float) {
+        /* Dense float weights are column-major, sparse blocks are 4 columns of 8. */
+        const float *w = a->data;
+        for (k=0;k<32;k++) block[k] = w[(j+k/8)*rows + i + (k&7)];
+      } else {
+        /* Int8 weights already come in 8x4 blocks, 4 inputs per row. */
+        const opus_int8 *w = (const opus_int8*)a->data + (i/8*(cols/4) + j/4)*32;
+        for (k=0;k<32;k++) block[k] = w[k]*scale[i+k/4];
+      }
+      for (k=0;k<32;k++) maxw = MAX16(maxw, (float)fabs(block[k]));
+      if (maxw <= thresh) continue;
+      if (is_float) memcpy(&packed[nb_packed], block, sizeof(block));
+      else memcpy(&packed[nb_packed], (const opus_int8*)a->data + (i/8*(cols/4) + j/4)*32, 32);
+      nb_packed += 32*elem;
+      idx[nb_idx++] = j;
+      (*count)++;
+      kept_blocks++;
+    }
+  }
+  if (kept_blocks > (1-SPARSE_MIN_RATIO)*total_blocks) {
+    free(packed);
+    free(idx);
+    return 0;
+  }
+  /* Check the sparse layer against the dense one on a random input. */
+  x = malloc(cols*sizeof(*x));
+  out = malloc(rows*sizeof(*out));
+  ref = malloc(rows*sizeof(*ref));
+  for (j=0;j<cols;j++) x[j] = (float)rand()/RAND_MAX - .5f;
+  if (is_float) {
+    sgemv(ref, a->data, rows, cols, rows, x);
+    sparse_sgemv8x4(out, (const float*)(void*)packed, idx, rows, x);
+  } else {
+    cgemv8x4(ref, a->data, scale, rows, cols, x);
+    sparse_cgemv8x4(out, (const opus_int8*)packed, idx, scale, rows, cols, x);
+  }
+  err = 0;
+  maxref = 1e-9f;
+  for (i=0;i<rows;i++) {
+    err = MAX16(err, (float)fabs(out[i]-ref[i]));
+    maxref = MAX16(maxref, (float)fabs(ref[i]));
+  }
+  err /= maxref;
+  memcpy(idx_name, a->name, len);
+  strcpy(idx_name+len, "_idx");
+  write_array(a->name, a->type, nb_packed, packed, fout);
+  write_array(idx_name, WEIGHT_TYPE_int, nb_idx*sizeof(*idx), idx, fout);
+  fprintf(stderr, "  %-40s %4dx%-4d %5.1f%% blocks dropped, err %g\n", a->name, cols, rows,
+      100.f*(total_blocks-kept_blocks)/total_blocks, err);
+  saved_macs += 32.*(total_blocks-kept_blocks);
+  max_sparse_err = MAX16(max_sparse_err, err);
+  nb_sparse_layers++;
+  free(x);
+  free(out);
+  free(ref);
+  free(packed);
+  free(idx);
+  return 1;
+}
 
 void write_weights(const WeightArray *list, FILE *fout)
 {
   int i=0;
-  unsigned char zeros[WEIGHT_BLOCK_SIZE] = {0};
   while (list[i].name != NULL) {
-    WeightHead h;
-    if (strlen(list[i].name) >= sizeof(h.name) - 1) {
-      printf("[write_weights] warning: name %s too long\n", list[i].name);
+    int done = 0;
+    if (use_sparse) {
+      int j;
+      for (j=0;j<nb_dense_layers;j++) {
+        const DenseLayer *l = &dense_layers[j];
+        const WeightArray *w = find_array(list, l->weights);
+        const WeightArray *fw = find_array(list, l->float_weights);
+        const WeightArray *sc = find_array(list, l->scale);
+        /* A layer with both int8 and float weights would need both repacked. */
+        if (w != NULL && fw != NULL) continue;
+        if (w == &list[i] || fw == &list[i]) {
+          done = write_sparse(l, &list[i], sc ? sc->data : NULL, fout);
+          break;
+        }
+      }
     }
-    memcpy(h.head, "DNNw", 4);
-    h.version = WEIGHT_BLOB_VERSION;
-    h.type = list[i].type;
-    h.size = list[i].size;
-    h.block_size = (h.size+WEIGHT_BLOCK_SIZE-1)/WEIGHT_BLOCK_SIZE*WEIGHT_BLOCK_SIZE;
-    OPUS_CLEAR(h.name, sizeof(h.name));
-    strncpy(h.name, list[i].name, sizeof(h.name));
-    h.name[sizeof(h.name)-1] = 0;
-    celt_assert(sizeof(h) == WEIGHT_BLOCK_SIZE);
-    fwrite(&h, 1, WEIGHT_BLOCK_SIZE, fout);
-    fwrite(list[i].data, 1, h.size, fout);
-    fwrite(zeros, 1, h.block_size-h.size, fout);
+    if (!done) write_array(list[i].name, list[i].type, list[i].size, list[i].data, fout);
     i++;
   }
 }
 
-int main(void)
+#define WRITE_MODEL(name, type, init, arrays) do { \
+    static type model; \
+    nb_dense_layers = nb_sparse_layers = 0; \
+    model_macs = saved_macs = max_sparse_err = 0; \
+    if (use_sparse) fprintf(stderr, "%s:\n", name); \
+    init(&model, arrays); \
+    write_weights(arrays, fout); \
+    if (use_sparse) fprintf(stderr, "%s: %d layers made sparse, %.0f of %.0f MACs saved (%.1f%%), max err %g\n", \
+        name, nb_sparse_layers, saved_macs, model_macs, 100.*saved_macs/model_macs, max_sparse_err); \
+  } while (0)
+
+int main(int argc, char **argv)
 {
-  FILE *fout = fopen("weights_blob.bin", "w");
-  write_weights(pitchdnn_arrays, fout);
-  write_weights(fargan_arrays, fout);
-  write_weights(plcmodel_arrays, fout);
-  write_weights(rdovaeenc_arrays, fout);
-  write_weights(rdovaedec_arrays, fout);
+  FILE *fout;
+  int i;
+  for (i=1;i<argc;i++) {
+    if (strcmp(argv[i], "-fp16") == 0) use_fp16 = 1;
+    else if (strcmp(argv[i], "-sparse") == 0 && i+1 < argc) {
+      use_sparse = 1;
+      sparse_thresh = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [-fp16] [-sparse <threshold>]\n", argv[0]);
+      return 1;
+    }
+  }
+  fout = fopen("weights_blob.bin", "w");
+  WRITE_MODEL("pitchdnn", PitchDNN, init_pitchdnn, pitchdnn_arrays);
+  WRITE_MODEL("fargan", FARGAN, init_fargan, fargan_arrays);
+  WRITE_MODEL("plc", PLCModel, init_plcmodel, plcmodel_arrays);
+  WRITE_MODEL("rdovae_enc", RDOVAEEnc, init_rdovaeenc, rdovaeenc_arrays);
+  WRITE_MODEL("rdovae_dec", RDOVAEDec, init_rdovaedec, rdovaedec_arrays);
 #ifdef ENABLE_OSCE
 #ifndef DISABLE_LACE
-  write_weights(lacelayers_arrays, fout);
+  WRITE_MODEL("lace", LACELayers, init_lacelayers, lacelayers_arrays);
 #endif
 #ifndef DISABLE_NOLACE
-  write_weights(nolacelayers_arrays, fout);
+  WRITE_MODEL("nolace", NOLACELayers, init_nolacelayers, nolacelayers_arrays);
+#endif
+#ifdef ENABLE_OSCE_BWE
+#ifndef DISABLE_BBWENET
+  WRITE_MODEL("bbwenet", BBWENETLayers, init_bbwenetlayers, bbwenetlayers_arrays);
+#endif
+#endif
 #endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+  WRITE_MODEL("nsdnn", NSDNN, init_nsdnn, nsdnn_arrays);
 #endif
   fclose(fout);
   return 0;
@@ -33,18 +33,21 @@
 
 #if defined(OPUS_X86_MAY_HAVE_SSE2)
 void compute_linear_sse2(const LinearLayer *linear, float *out, const float *in);
+void compute_gru_sse2(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
 void compute_activation_sse2(float *output, const float *input, int N, int activation);
 void compute_conv2d_sse2(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation);
 #endif
 
 #if defined(OPUS_X86_MAY_HAVE_SSE4_1)
 void compute_linear_sse4_1(const LinearLayer *linear, float *out, const float *in);
+void compute_gru_sse4_1(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
 void compute_activation_sse4_1(float *output, const float *input, int N, int activation);
 void compute_conv2d_sse4_1(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation);
 #endif
 
 #if defined(OPUS_X86_MAY_HAVE_AVX2)
 void compute_linear_avx2(const LinearLayer *linear, float *out, const float *in);
+void compute_gru_avx2(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
 void compute_activation_avx2(float *output, const float *input, int N, int activation);
 void compute_conv2d_avx2(const Conv2dLayer *conv, float *out, float *mem, const float *in, int height, int hstride, int activation);
 #endif
@@ -54,6 +57,8 @@ void compute_conv2d_avx2(const Conv2dLayer *conv, float *out, float *mem, const
 
 #define OVERRIDE_COMPUTE_LINEAR
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_avx2(linear, out, in))
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_avx2(input_weights, recurrent_weights, state, in))
 #define OVERRIDE_COMPUTE_ACTIVATION
 #define compute_activation(output, input, N, activation, arch) ((void)(arch),compute_activation_avx2(output, input, N, activation))
 #define OVERRIDE_COMPUTE_CONV2D
@@ -63,6 +68,8 @@ void compute_conv2d_avx2(const Conv2dLayer *conv, float *out, float *mem, const
 
 #define OVERRIDE_COMPUTE_LINEAR
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_sse4_1(linear, out, in))
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_sse4_1(input_weights, recurrent_weights, state, in))
 #define OVERRIDE_COMPUTE_ACTIVATION
 #define compute_activation(output, input, N, activation, arch) ((void)(arch),compute_activation_sse4_1(output, input, N, activation))
 #define OVERRIDE_COMPUTE_CONV2D
@@ -72,6 +79,8 @@ void compute_conv2d_avx2(const Conv2dLayer *conv, float *out, float *mem, const
 
 #define OVERRIDE_COMPUTE_LINEAR
 #define compute_linear(linear, out, in, arch) ((void)(arch),compute_linear_sse2(linear, out, in))
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) ((void)(arch),compute_gru_sse2(input_weights, recurrent_weights, state, in))
 #define OVERRIDE_COMPUTE_ACTIVATION
 #define compute_activation(output, input, N, activation, arch) ((void)(arch),compute_activation_sse2(output, input, N, activation))
 #define OVERRIDE_COMPUTE_CONV2D
@@ -89,6 +98,17 @@ extern void (*const DNN_COMPUTE_LINEAR_IMPL[OPUS_ARCHMASK + 1])(
     ((*DNN_COMPUTE_LINEAR_IMPL[(arch) & OPUS_ARCHMASK])(linear, out, in))
 
 
+extern void (*const DNN_COMPUTE_GRU_IMPL[OPUS_ARCHMASK + 1])(
+                    const LinearLayer *input_weights,
+                    const LinearLayer *recurrent_weights,
+                    float *state,
+                    const float *in
+                    );
+#define OVERRIDE_COMPUTE_GRU
+#define compute_gru(input_weights, recurrent_weights, state, in, arch) \
+    ((*DNN_COMPUTE_GRU_IMPL[(arch) & OPUS_ARCHMASK])(input_weights, recurrent_weights, state, in))
+
+
 extern void (*const DNN_COMPUTE_ACTIVATION_IMPL[OPUS_ARCHMASK + 1])(
                     float *output,
                     const float *input,
@@ -1168,6 +1168,221 @@ OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_multistream_packet_unpad(uns
 
 /**@}*/
 
+/** @defgroup opus_gain_adjuster Gain adjuster
+  * @{
+  *
+  * The gain adjuster changes the level of an Opus stream, e.g. in a
+  * conferencing bridge, without a full decode and re-encode where the
+  * bitstream allows it.
+  *
+  * For mono SILK-only packets, the subframe gain indices are offset directly
+  * in the compressed domain and the packet is entropy coded again with all
+  * other parameters and the excitation copied through. The gain is then
+  * rounded to the SILK gain quantization step of about 1.37 dB, and the result
+  * decodes exactly like the original packet with the gain applied. All other
+  * packets (CELT, hybrid, stereo, or SILK with a redundant CELT frame) are
+  * decoded with the gain applied and encoded again in the same mode,
+  * bandwidth, and frame size at the same bitrate, because changing the CELT
+  * band energies changes the bit allocation of everything that follows.
+  * Padding and extensions are not carried over.
+  *
+  * A gain adjuster processes a single stream: packets must be submitted in
+  * order, as the SILK gains are delta coded across packets.
+  */
+
+typedef struct OpusGainAdjuster OpusGainAdjuster;
+
+/** Gets the size of an <code>OpusGainAdjuster</code> structure.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @returns The size in bytes, or 0 for an invalid channel count.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_gain_adjuster_get_size(int channels);
+
+/** Initializes a previously allocated gain adjuster state.
+  * The state must be at least the size returned by opus_gain_adjuster_get_size().
+  * @param[in] st <tt>OpusGainAdjuster*</tt>: Gain adjuster state.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @returns #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT int opus_gain_adjuster_init(OpusGainAdjuster *st, int channels) OPUS_ARG_NONNULL(1);
+
+/** Allocates and initializes a gain adjuster state.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @param[out] error <tt>int*</tt>: #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusGainAdjuster *opus_gain_adjuster_create(int channels, int *error);
+
+/** Frees an <code>OpusGainAdjuster</code> allocated by opus_gain_adjuster_create().
+  * @param[in] st <tt>OpusGainAdjuster*</tt>: State to be freed.
+  */
+OPUS_EXPORT void opus_gain_adjuster_destroy(OpusGainAdjuster *st);
+
+/** Applies a gain to the next packet of the stream.
+  * @param[in] st <tt>OpusGainAdjuster*</tt>: Gain adjuster state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input packet.
+  * @param len <tt>opus_int32</tt>: Number of bytes in the input packet.
+  * @param gain_Q8 <tt>int</tt>: Gain in dB, in Q8 format, as for #OPUS_SET_GAIN.
+  * @param[out] out <tt>unsigned char*</tt>: Output packet.
+  * @param maxlen <tt>opus_int32</tt>: Size of the output buffer.
+  * @returns The length of the output packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  * @retval #OPUS_BAD_ARG An argument was out of range.
+  * @retval #OPUS_BUFFER_TOO_SMALL \a maxlen was insufficient to contain the output packet.
+  * @retval #OPUS_INVALID_PACKET \a data did not contain a valid Opus packet.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_gain_adjuster_process(OpusGainAdjuster *st, const unsigned char *data, opus_int32 len, int gain_Q8, unsigned char *out, opus_int32 maxlen) OPUS_ARG_NONNULL(1);
+
+/**@}*/
+
+/** @defgroup opus_transrater Transrater
+  * @{
+  *
+  * The transrater re-encodes an Opus stream at a different bitrate, e.g. when
+  * the bandwidth available to a receiver drops, at a fraction of the cost of a
+  * separate decode and encode.
+  *
+  * Each frame is decoded and encoded again in the same mode, bandwidth, and
+  * frame size, and the encoder reuses the side information of the decoded
+  * frame instead of running its own searches: for mono SILK, the signal type,
+  * pitch lags, LTP codebook vectors, and quantized NLSFs; for CELT, the
+  * postfilter pitch, tf resolution, and spreading. The tonality analysis is
+  * skipped as well. Gains, excitation, and CELT band energies and shapes are
+  * quantized again for the new bitrate. Padding and extensions are
+  * not carried over.
+  *
+  * A transrater processes a single stream: packets must be submitted in order.
+  */
+
+typedef struct OpusTransrater OpusTransrater;
+
+/** Gets the size of an <code>OpusTransrater</code> structure.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @returns The size in bytes, or 0 for an invalid channel count.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_transrater_get_size(int channels);
+
+/** Initializes a previously allocated transrater state.
+  * The state must be at least the size returned by opus_transrater_get_size().
+  * @param[in] st <tt>OpusTransrater*</tt>: Transrater state.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @returns #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT int opus_transrater_init(OpusTransrater *st, int channels) OPUS_ARG_NONNULL(1);
+
+/** Allocates and initializes a transrater state.
+  * @param channels <tt>int</tt>: Number of channels of the stream. This must be 1 or 2.
+  * @param[out] error <tt>int*</tt>: #OPUS_OK Success or @ref opus_errorcodes
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT OpusTransrater *opus_transrater_create(int channels, int *error);
+
+/** Frees an <code>OpusTransrater</code> allocated by opus_transrater_create().
+  * @param[in] st <tt>OpusTransrater*</tt>: State to be freed.
+  */
+OPUS_EXPORT void opus_transrater_destroy(OpusTransrater *st);
+
+/** Re-encodes the next packet of the stream at the given bitrate.
+  * @param[in] st <tt>OpusTransrater*</tt>: Transrater state.
+  * @param[in] data <tt>const unsigned char*</tt>: Input packet.
+  * @param len <tt>opus_int32</tt>: Number of bytes in the input packet.
+  * @param bitrate <tt>opus_int32</tt>: Target bitrate in bits per second, as for #OPUS_SET_BITRATE.
+  * @param[out] out <tt>unsigned char*</tt>: Output packet.
+  * @param maxlen <tt>opus_int32</tt>: Size of the output buffer.
+  * @returns The length of the output packet (in bytes) on success or a
+  *          negative error code (see @ref opus_errorcodes) on failure.
+  * @retval #OPUS_BAD_ARG An argument was out of range.
+  * @retval #OPUS_BUFFER_TOO_SMALL \a maxlen was insufficient to contain the output packet.
+  * @retval #OPUS_INVALID_PACKET \a data did not contain a valid Opus packet.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT opus_int32 opus_transrater_process(OpusTransrater *st, const unsigned char *data, opus_int32 len, opus_int32 bitrate, unsigned char *out, opus_int32 maxlen) OPUS_ARG_NONNULL(1);
+
+/**@}*/
+
+/** @defgroup opus_stream_edit Stream editing
+  * @{
+  *
+  * These functions cut and concatenate Opus streams without decoding and
+  * re-encoding them as a whole. A stream is a sequence of packets together
+  * with its pre-skip, the number of decoded samples to discard at the start,
+  * and its end trim, the number of decoded samples to discard at the end, as
+  * carried by the granule positions of an Ogg Opus stream. All positions and
+  * durations are in samples at 48 kHz, and positions inside a stream count
+  * from the first sample after the pre-skip.
+  *
+  * A cut keeps the packets that cover the requested range untouched, except
+  * for the first and last ones, from which the frames outside the range are
+  * dropped with opus_repacketizer_out_range(). The decoder is given
+  * #OPUS_STREAM_EDIT_PREROLL samples before the start of the range to
+  * converge, and the new pre-skip and end trim make the edges sample
+  * accurate.
+  *
+  * A splice joins two streams with a short crossfade. Only the audio around
+  * the seam is decoded, crossfaded and encoded again; all the other packets
+  * of both streams are used as they are.
+  *
+  * Both only look at the packets near the edit, apart from reading the TOC
+  * byte of the packets before a cut, so editing a long stream only costs
+  * the time to handle a few packets.
+  */
+
+/** Number of samples decoded before the start of a cut so that the decoder
+  * converges, as recommended for seeking in Ogg Opus (80 ms). */
+#define OPUS_STREAM_EDIT_PREROLL 3840
+
+/** Cuts a range of samples out of a stream.
+  * The output stream is the packet <code>out</code>, the packets
+  * <code>packets[range[0]+1]</code> to <code>packets[range[1]-1]</code> as
+  * they are, and then the packet <code>out+out_lens[0]</code>. When the
+  * output fits in a single input packet, <code>range[0]==range[1]</code> and
+  * <code>out_lens[1]</code> is 0.
+  * @param[in] packets <tt>const unsigned char*const*</tt>: Packets of the stream.
+  * @param[in] lens <tt>const opus_int32*</tt>: Length of each packet in bytes.
+  * @param nb_packets <tt>int</tt>: Number of packets.
+  * @param pre_skip <tt>int</tt>: Pre-skip of the stream.
+  * @param start <tt>opus_int64</tt>: First sample to keep.
+  * @param end <tt>opus_int64</tt>: Sample following the last one to keep.
+  * @param[out] out <tt>unsigned char*</tt>: Buffer for the new first and last packets.
+  * @param maxlen <tt>opus_int32</tt>: Size of the output buffer.
+  * @param[out] out_lens <tt>opus_int32[2]</tt>: Lengths of the new first and last packets.
+  * @param[out] range <tt>int[2]</tt>: Index of the input packets replaced by the new first and last packets.
+  * @param[out] trims <tt>int[2]</tt>: Pre-skip and end trim of the output stream.
+  * @returns #OPUS_OK on success or a negative error code (see @ref opus_errorcodes) on failure.
+  * @retval #OPUS_BAD_ARG The range was empty or extended past the end of the stream.
+  * @retval #OPUS_BUFFER_TOO_SMALL \a maxlen was insufficient to contain the new packets.
+  * @retval #OPUS_INVALID_PACKET A packet of the stream was not a valid Opus packet.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_stream_cut(const unsigned char *const *packets, const opus_int32 *lens, int nb_packets, int pre_skip, opus_int64 start, opus_int64 end, unsigned char *out, opus_int32 maxlen, opus_int32 out_lens[2], int range[2], int trims[2]) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(7) OPUS_ARG_NONNULL(9) OPUS_ARG_NONNULL(10) OPUS_ARG_NONNULL(11);
+
+/** Joins two streams with a crossfade.
+  * The output stream is <code>a[0]</code> to <code>a[range[0]-1]</code>,
+  * the returned seam packets, and <code>b[range[1]]</code> to the last packet
+  * of the second stream. Its pre-skip is the one of the first stream and its
+  * end trim the one of the second stream, and it is as long as both streams
+  * minus the crossfade. The crossfade is lengthened by up to 119 samples so
+  * that the seam is a whole number of 2.5 ms frames.
+  * @param[in] a <tt>const unsigned char*const*</tt>: Packets of the first stream.
+  * @param[in] a_lens <tt>const opus_int32*</tt>: Length of each packet of the first stream.
+  * @param a_count <tt>int</tt>: Number of packets in the first stream.
+  * @param a_end_trim <tt>int</tt>: End trim of the first stream.
+  * @param[in] b <tt>const unsigned char*const*</tt>: Packets of the second stream.
+  * @param[in] b_lens <tt>const opus_int32*</tt>: Length of each packet of the second stream.
+  * @param b_count <tt>int</tt>: Number of packets in the second stream.
+  * @param b_pre_skip <tt>int</tt>: Pre-skip of the second stream.
+  * @param channels <tt>int</tt>: Number of channels (1 or 2) to decode and encode the seam with.
+  * @param crossfade <tt>int</tt>: Length of the crossfade, at most 48000 samples.
+  * @param[out] out <tt>unsigned char*</tt>: Buffer for the seam packets, stored back to back.
+  * @param maxlen <tt>opus_int32</tt>: Size of the output buffer.
+  * @param[out] out_lens <tt>opus_int32*</tt>: Length of each seam packet.
+  * @param max_packets <tt>int</tt>: Number of entries in \a out_lens.
+  * @param[out] range <tt>int[2]</tt>: Number of packets kept from the first stream and index of the first packet kept from the second one.
+  * @returns The number of seam packets on success or a negative error code (see @ref opus_errorcodes) on failure.
+  * @retval #OPUS_BAD_ARG An argument was out of range, or a stream was too short for the crossfade.
+  * @retval #OPUS_BUFFER_TOO_SMALL \a maxlen or \a max_packets was insufficient to contain the seam.
+  * @retval #OPUS_INVALID_PACKET A packet of either stream was not a valid Opus packet.
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_stream_splice(const unsigned char *const *a, const opus_int32 *a_lens, int a_count, int a_end_trim, const unsigned char *const *b, const opus_int32 *b_lens, int b_count, int b_pre_skip, int channels, int crossfade, unsigned char *out, opus_int32 maxlen, opus_int32 *out_lens, int max_packets, int range[2]) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(2) OPUS_ARG_NONNULL(5) OPUS_ARG_NONNULL(6) OPUS_ARG_NONNULL(11) OPUS_ARG_NONNULL(13) OPUS_ARG_NONNULL(15);
+
+/**@}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -179,6 +179,13 @@ extern "C" {
 #define OPUS_GET_QEXT_REQUEST 4057
 #define OPUS_SET_IGNORE_EXTENSIONS_REQUEST 4058
 #define OPUS_GET_IGNORE_EXTENSIONS_REQUEST 4059
+#define OPUS_GET_FRAME_ANALYSIS_REQUEST 4061
+#define OPUS_SET_SHADOW_DECODE_REQUEST 4062
+#define OPUS_GET_SHADOW_DECODE_REQUEST 4063
+#define OPUS_SET_PARALLEL_ANALYSIS_REQUEST 4064
+#define OPUS_GET_PARALLEL_ANALYSIS_REQUEST 4065
+#define OPUS_SET_NOISE_SUPPRESSION_REQUEST 4066
+#define OPUS_GET_NOISE_SUPPRESSION_REQUEST 4067
 
 /** Defines for the presence of extended APIs. */
 #define OPUS_HAVE_OPUS_PROJECTION_H
@@ -194,12 +201,14 @@ extern "C" {
 #define opus_check_uint8_ptr(ptr) (ptr)
 #define opus_check_val16_ptr(ptr) (ptr)
 #define opus_check_void_ptr(ptr) (ptr)
+#define opus_check_frame_analysis_ptr(ptr) (ptr)
 #else
 #define opus_check_int_ptr(ptr) ((ptr) + ((ptr) - (opus_int32*)(ptr)))
 #define opus_check_uint_ptr(ptr) ((ptr) + ((ptr) - (opus_uint32*)(ptr)))
 #define opus_check_uint8_ptr(ptr) ((ptr) + ((ptr) - (opus_uint8*)(ptr)))
 #define opus_check_val16_ptr(ptr) ((ptr) + ((ptr) - (opus_val16*)(ptr)))
 #define opus_check_void_ptr(x) ((void)((void *)0 == (x)), (x))
+#define opus_check_frame_analysis_ptr(ptr) ((ptr) + ((ptr) - (OpusFrameAnalysis*)(ptr)))
 #endif
 /** @endcond */
 
@@ -243,6 +252,7 @@ extern "C" {
 #define OPUS_FRAMESIZE_80_MS                 5007 /**< Use 80 ms frames */
 #define OPUS_FRAMESIZE_100_MS                5008 /**< Use 100 ms frames */
 #define OPUS_FRAMESIZE_120_MS                5009 /**< Use 120 ms frames */
+#define OPUS_FRAMESIZE_ADAPTIVE              5010 /**< Pick 20, 40 or 60 ms frames from the signal */
 
 /**@}*/
 
@@ -593,6 +603,15 @@ extern "C" {
   * packet. The part of the audio that was not encoded needs to be resent to the
   * encoder for the next call. Do not use this option unless you <b>really</b>
   * know what you are doing.
+  *
+  * With OPUS_FRAMESIZE_ADAPTIVE, the caller passes up to 60 ms of audio and
+  * the encoder uses it as look-ahead to pick 20, 40 or 60 ms for the packet:
+  * long packets while the signal is steady, short ones around onsets and
+  * changes in voice activity or signal type. The amount of audio passed in
+  * is therefore the latency cap. The choice relies on the signal analysis
+  * (complexity 7 or more, 10 in fixed-point builds, at 16 to 48 kHz) and
+  * falls back to 20 ms packets without it or with noise suppression enabled.
+  * This value is not supported by the multistream encoder.
   * @see OPUS_GET_EXPERT_FRAME_DURATION
   * @param[in] x <tt>opus_int32</tt>: Allowed values:
   * <dl>
@@ -606,6 +625,7 @@ extern "C" {
   * <dt>OPUS_FRAMESIZE_80_MS</dt><dd>Use 80 ms frames.</dd>
   * <dt>OPUS_FRAMESIZE_100_MS</dt><dd>Use 100 ms frames.</dd>
   * <dt>OPUS_FRAMESIZE_120_MS</dt><dd>Use 120 ms frames.</dd>
+  * <dt>OPUS_FRAMESIZE_ADAPTIVE</dt><dd>Pick 20, 40 or 60 ms frames from the signal.</dd>
   * </dl>
   * @hideinitializer */
 #define OPUS_SET_EXPERT_FRAME_DURATION(x) OPUS_SET_EXPERT_FRAME_DURATION_REQUEST, opus_check_int(x)
@@ -623,6 +643,7 @@ extern "C" {
   * <dt>OPUS_FRAMESIZE_80_MS</dt><dd>Use 80 ms frames.</dd>
   * <dt>OPUS_FRAMESIZE_100_MS</dt><dd>Use 100 ms frames.</dd>
   * <dt>OPUS_FRAMESIZE_120_MS</dt><dd>Use 120 ms frames.</dd>
+  * <dt>OPUS_FRAMESIZE_ADAPTIVE</dt><dd>Pick 20, 40 or 60 ms frames from the signal.</dd>
   * </dl>
   * @hideinitializer */
 #define OPUS_GET_EXPERT_FRAME_DURATION(x) OPUS_GET_EXPERT_FRAME_DURATION_REQUEST, opus_check_int_ptr(x)
@@ -666,6 +687,101 @@ extern "C" {
   * @hideinitializer */
 #define OPUS_GET_QEXT(x) OPUS_GET_QEXT_REQUEST, opus_check_int_ptr(x)
 
+/** Number of band energies reported in #OpusFrameAnalysis. */
+#define OPUS_FRAME_ANALYSIS_BANDS 21
+
+/** Analysis results for the last frame encoded by an encoder.
+  * @see OPUS_GET_FRAME_ANALYSIS */
+typedef struct OpusFrameAnalysis {
+   /** 1 if the frame was classified as active (speech or music), 0 otherwise. */
+   opus_int32 vad;
+   /** Non-zero if the probabilities below come from the tonality analysis.
+       The analysis only runs at complexity 7 or higher (or 10 for 8 kHz to 16 kHz input)
+       and is not available when the library is built without the float API. */
+   opus_int32 analysis_valid;
+   /** Probability that the frame contains speech or music, in Q15. */
+   opus_int32 activity_probability;
+   /** Probability that the frame contains music rather than speech, in Q15. */
+   opus_int32 music_probability;
+   /** Tonality estimate of the frame, in Q15. */
+   opus_int32 tonality;
+   /** Audio bandwidth detected in the input (one of the OPUS_BANDWIDTH_* values),
+       or 0 if unknown. */
+   opus_int32 bandwidth;
+   /** Pitch period at 48 kHz of the last SILK subframe, or 0 if the frame was not
+       voiced or not coded with SILK. */
+   opus_int32 pitch;
+   /** Number of valid entries in band_energy (0 for SILK-only frames). */
+   opus_int32 band_count;
+   /** Log2 amplitude of each CELT band in Q8 (i.e. 256 units per 6.02 dB), on the
+       scale used by the CELT energy quantizer, maximized across channels. */
+   opus_int16 band_energy[OPUS_FRAME_ANALYSIS_BANDS];
+} OpusFrameAnalysis;
+
+/** Gets the analysis of the last frame encoded, so that applications needing
+  * a VAD, a speech/music classifier or a spectrum display can reuse the work
+  * the encoder already does rather than analyzing the PCM again.
+  * When a packet contains several frames, the last one is reported.
+  *
+  * This CTL is only implemented for encoder instances.
+  *
+  * @param[out] x <tt>OpusFrameAnalysis *</tt>: Returns the analysis results.
+  * @hideinitializer */
+#define OPUS_GET_FRAME_ANALYSIS(x) OPUS_GET_FRAME_ANALYSIS_REQUEST, opus_check_frame_analysis_ptr(x)
+
+/** If set to 1, hybrid frames run the signal analysis of the CELT layer on a
+  * helper thread while the SILK layer is being encoded. The bitstream is
+  * identical either way; only the latency of each encode call changes.
+  * The helper thread is shared by all encoders in the process, so frames fall
+  * back to serial processing whenever it is busy.
+  *
+  * This CTL is only implemented when the library is built with thread support
+  * and returns OPUS_UNIMPLEMENTED otherwise.
+  * @see OPUS_GET_PARALLEL_ANALYSIS
+  * @param[in] x <tt>opus_int32</tt>: Allowed values:
+  * <dl>
+  * <dt>0</dt><dd>Serial analysis (default).</dd>
+  * <dt>1</dt><dd>Parallel analysis.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_SET_PARALLEL_ANALYSIS(x) OPUS_SET_PARALLEL_ANALYSIS_REQUEST, opus_check_int(x)
+/** Gets the encoder's configured parallel analysis setting.
+  * @see OPUS_SET_PARALLEL_ANALYSIS
+  * @param[out] x <tt>opus_int32 *</tt>: Returns one of the following values:
+  * <dl>
+  * <dt>0</dt><dd>Serial analysis (default).</dd>
+  * <dt>1</dt><dd>Parallel analysis.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_GET_PARALLEL_ANALYSIS(x) OPUS_GET_PARALLEL_ANALYSIS_REQUEST, opus_check_int_ptr(x)
+
+/** If set to 1, the encoder runs a small recurrent network that attenuates
+  * stationary background noise before encoding. Removing the noise floor lets
+  * VBR lower the rate in noisy conditions and lets DTX engage in pauses.
+  * The denoiser works on 10 ms hops, so it adds Fs/100 samples of lookahead
+  * (reflected in OPUS_GET_LOOKAHEAD). 2.5 and 5 ms frames are delayed by the
+  * same amount but not denoised.
+  *
+  * This CTL is only implemented when the library is built with noise
+  * suppression support and returns OPUS_UNIMPLEMENTED otherwise.
+  * @see OPUS_GET_NOISE_SUPPRESSION
+  * @param[in] x <tt>opus_int32</tt>: Allowed values:
+  * <dl>
+  * <dt>0</dt><dd>Disable noise suppression (default).</dd>
+  * <dt>1</dt><dd>Enable noise suppression.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_SET_NOISE_SUPPRESSION(x) OPUS_SET_NOISE_SUPPRESSION_REQUEST, opus_check_int(x)
+/** Gets the encoder's configured noise suppression setting.
+  * @see OPUS_SET_NOISE_SUPPRESSION
+  * @param[out] x <tt>opus_int32 *</tt>: Returns one of the following values:
+  * <dl>
+  * <dt>0</dt><dd>Noise suppression disabled (default).</dd>
+  * <dt>1</dt><dd>Noise suppression enabled.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_GET_NOISE_SUPPRESSION(x) OPUS_GET_NOISE_SUPPRESSION_REQUEST, opus_check_int_ptr(x)
+
 /**@}*/
 
 /** @defgroup opus_genericctls Generic CTLs
@@ -836,6 +952,29 @@ extern "C" {
   * @hideinitializer */
 #define OPUS_GET_IGNORE_EXTENSIONS(x) OPUS_GET_IGNORE_EXTENSIONS_REQUEST, opus_check_int_ptr(x)
 
+/** Configures shadow decoding.
+  * In shadow mode, the decoder parses every packet and keeps its internal
+  * state up to date, but skips the work that only affects the output
+  * (synthesis, de-emphasis, resampling, enhancement, gain and soft clipping).
+  * The decoded audio is replaced with silence. This is meant for streams that
+  * must stay ready to be played at any time but are not currently heard,
+  * e.g. inactive participants in a large conference.
+  * When shadow mode is disabled again, the first frame decoded is faded in.
+  * The range coder state (see #OPUS_GET_FINAL_RANGE) is the same as for
+  * normal decoding.
+  * This setting survives decoder reset.
+  * @param[in] x <tt>opus_int32</tt>: Allowed values:
+  * <dl>
+  * <dt>0</dt><dd>Normal decoding (default).</dd>
+  * <dt>1</dt><dd>Shadow decoding.</dd>
+  * </dl>
+  * @hideinitializer */
+#define OPUS_SET_SHADOW_DECODE(x) OPUS_SET_SHADOW_DECODE_REQUEST, opus_check_int(x)
+/** Gets whether the decoder is in shadow mode. @see OPUS_SET_SHADOW_DECODE
+  * @param[out] x <tt>opus_int32 *</tt>: 1 if shadow decoding is enabled, 0 otherwise.
+  * @hideinitializer */
+#define OPUS_GET_SHADOW_DECODE(x) OPUS_GET_SHADOW_DECODE_REQUEST, opus_check_int_ptr(x)
+
 /**@}*/
 
 /** @defgroup opus_libinfo Opus library information functions
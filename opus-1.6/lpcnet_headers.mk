@@ -40,6 +40,10 @@ dnn/lace_data.h \
 dnn/nolace_data.h \
 dnn/bbwenet_data.h
 
+NS_HEAD = \
+dnn/nsdnn.h \
+dnn/nsdnn_data.h
+
 LOSSGEN_HEAD = \
 dnn/lossgen.h \
 dnn/lossgen_data.h
@@ -8,6 +8,7 @@ dnn/lpcnet_plc.c \
 dnn/lpcnet_tables.c \
 dnn/nnet.c \
 dnn/nnet_default.c \
+dnn/nnet_profile.c \
 dnn/plc_data.c \
 dnn/parse_lpcnet_weights.c \
 dnn/pitchdnn.c \
@@ -31,6 +32,11 @@ dnn/lace_data.c \
 dnn/nolace_data.c \
 dnn/bbwenet_data.c
 
+NS_SOURCES = \
+dnn/nsdnn.c \
+dnn/nsdnn_data.c \
+dnn/nsdnn_tables.c
+
 LOSSGEN_SOURCES = \
 dnn/lossgen.c \
 dnn/lossgen_data.c
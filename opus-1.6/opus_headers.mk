@@ -5,4 +5,6 @@ include/opus_projection.h \
 src/opus_private.h \
 src/analysis.h \
 src/mapping_matrix.h \
+src/opus_thread.h \
+src/opus_clones.h \
 src/mlp.h
@@ -7,9 +7,14 @@ src/opus_multistream.c \
 src/opus_multistream_encoder.c \
 src/opus_multistream_decoder.c \
 src/repacketizer.c \
+src/opus_gain_adjuster.c \
+src/opus_transrater.c \
+src/opus_stream_edit.c \
 src/opus_projection_encoder.c \
 src/opus_projection_decoder.c \
-src/mapping_matrix.c
+src/mapping_matrix.c \
+src/opus_thread.c \
+src/opus_clones.c
 
 OPUS_SOURCES_FLOAT = \
 src/analysis.c \
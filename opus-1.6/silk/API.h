@@ -139,6 +139,44 @@ opus_int silk_Decode(                                   /* O    Returns error co
     int                             arch                /* I    Run-time architecture                           */
 );
 
+/****************************************/
+/* Gain rewriter functions              */
+/****************************************/
+
+/*****************************************************/
+/* Get size in bytes of the Silk gain rewriter state */
+/*****************************************************/
+opus_int silk_Get_Gain_Rewriter_Size(                   /* O    Returns error code                              */
+    opus_int                        *rewSizeBytes       /* O    Number of bytes in SILK gain rewriter state     */
+);
+
+/*********************************/
+/* Init and Reset gain rewriter  */
+/*********************************/
+opus_int silk_InitGainRewriter(                         /* O    Returns error code                              */
+    void                            *rewState           /* I/O  State                                           */
+);
+
+/* Sets the last gain index of the input and output streams, 10 for both after a decoder reset                  */
+opus_int silk_ResetGainRewriter(                        /* O    Returns error code                              */
+    void                            *rewState,          /* I/O  State                                           */
+    opus_int                        prevGainIndexIn,    /* I    Last gain index of the input stream             */
+    opus_int                        prevGainIndexOut    /* I    Last gain index of the output stream            */
+);
+
+/*************************************************************/
+/* Offset the gains of a mono payload without decoding it    */
+/*************************************************************/
+/* All other parameters and the excitation are copied through, so the output decodes exactly like the input   */
+/* with its subframe gains offset by the given gain, rounded to the gain quantization step of ~1.37 dB          */
+opus_int silk_RewriteGains(                             /* O    Returns error code                              */
+    void                            *rewState,          /* I/O  State                                           */
+    const silk_DecControlStruct     *decControl,        /* I    Payload size and internal sampling rate         */
+    opus_int                        gain_Q8,            /* I    Gain offset in dB (Q8)                          */
+    ec_dec                          *psRangeDec,        /* I/O  Input payload                                   */
+    ec_enc                          *psRangeEnc         /* I/O  Output payload                                  */
+);
+
 #if 0
 /**************************************/
 /* Get table of contents for a packet */
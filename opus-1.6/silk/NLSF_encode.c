@@ -42,7 +42,8 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
     const opus_int16            *pW_Q2,                         /* I    NLSF weight vector [ LPC_ORDER ]            */
     const opus_int              NLSF_mu_Q20,                    /* I    Rate weight for the RD optimization         */
     const opus_int              nSurvivors,                     /* I    Max survivors after first stage             */
-    const opus_int              signalType                      /* I    Signal type: 0/1/2                          */
+    const opus_int              signalType,                     /* I    Signal type: 0/1/2                          */
+    int                         arch                            /* I    Run-time architecture                       */
 )
 {
     opus_int         i, s, ind1, bestIndex, prob_Q8, bits_q7;
@@ -68,7 +69,7 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
 
     /* First stage: VQ */
     ALLOC( err_Q24, psNLSF_CB->nVectors, opus_int32 );
-    silk_NLSF_VQ( err_Q24, pNLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order );
+    silk_NLSF_VQ( err_Q24, pNLSF_Q15, psNLSF_CB->CB1_NLSF_Q8, psNLSF_CB->CB1_Wght_Q9, psNLSF_CB->nVectors, psNLSF_CB->order, arch );
 
     /* Sort the quantization errors */
     ALLOC( tempIndices1, nSurvivors, opus_int );
@@ -96,7 +97,7 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
 
         /* Trellis quantizer */
         RD_Q25[ s ] = silk_NLSF_del_dec_quant( &tempIndices2[ s * MAX_LPC_ORDER ], res_Q10, W_adj_Q5, pred_Q8, ec_ix,
-            psNLSF_CB->ec_Rates_Q5, psNLSF_CB->quantStepSize_Q16, psNLSF_CB->invQuantStepSize_Q6, NLSF_mu_Q20, psNLSF_CB->order );
+            psNLSF_CB->ec_Rates_Q5, psNLSF_CB->quantStepSize_Q16, psNLSF_CB->invQuantStepSize_Q6, NLSF_mu_Q20, psNLSF_CB->order, arch );
 
         /* Add rate for first stage */
         iCDF_ptr = &psNLSF_CB->CB1_iCDF[ ( signalType >> 1 ) * psNLSF_CB->nVectors ];
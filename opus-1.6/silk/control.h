@@ -35,6 +35,8 @@ extern "C"
 {
 #endif
 
+struct silk_param_hints;
+
 /* Decoder API flags */
 #define FLAG_DECODE_NORMAL                      0
 #define FLAG_PACKET_LOST                        1
@@ -101,6 +103,9 @@ typedef struct {
     /* I: Make frames as independent as possible (but still use LPC)                        */
     opus_int reducedDependency;
 
+    /* I:   Side information of decoded frames to reuse instead of analysing the input, or NULL */
+    const struct silk_param_hints *paramHints;
+
     /* O:   Internal sampling rate used, in Hertz; 8000/12000/16000                         */
     opus_int32 internalSampleRate;
 
@@ -121,6 +126,9 @@ typedef struct {
 
     /* O: SILK offset (dithering) */
     opus_int offset;
+
+    /* O:   Last gain index of the first channel, as the decoder has it after this packet  */
+    opus_int lastGainIndex;
 } silk_EncControlStruct;
 
 /**************************************************************************/
@@ -145,9 +153,18 @@ typedef struct {
     /* O:   Pitch lag of previous frame (0 if unvoiced), measured in samples at 48 kHz      */
     opus_int prevPitchLag;
 
+    /* O:   Last gain index of the first channel                                            */
+    opus_int lastGainIndex;
+
     /* I:   Enable Deep PLC                                                                 */
     opus_int enable_deep_plc;
 
+    /* I:   Only update the decoder state without producing output samples; 0/1              */
+    opus_int shadow_decode;
+
+    /* O:   Side information of the decoded frames, if not NULL                             */
+    struct silk_param_hints *paramHints;
+
 #ifdef ENABLE_OSCE
     /* I: OSCE method */
     opus_int osce_method;
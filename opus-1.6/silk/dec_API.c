@@ -50,6 +50,7 @@ typedef struct {
     opus_int                         nChannelsAPI;
     opus_int                         nChannelsInternal;
     opus_int                         prev_decode_only_middle;
+    opus_int                         prev_shadow_decode;
 #ifdef ENABLE_OSCE
     OSCEModel                        osce_model;
 #endif
@@ -102,6 +103,7 @@ opus_int silk_ResetDecoder(                              /* O    Returns error c
     silk_memset(&((silk_decoder *)decState)->sStereo, 0, sizeof(((silk_decoder *)decState)->sStereo));
     /* Not strictly needed, but it's cleaner that way */
     ((silk_decoder *)decState)->prev_decode_only_middle = 0;
+    ((silk_decoder *)decState)->prev_shadow_decode = 0;
 
     return ret;
 }
@@ -127,6 +129,7 @@ opus_int silk_InitDecoder(                              /* O    Returns error co
     silk_memset(&((silk_decoder *)decState)->sStereo, 0, sizeof(((silk_decoder *)decState)->sStereo));
     /* Not strictly needed, but it's cleaner that way */
     ((silk_decoder *)decState)->prev_decode_only_middle = 0;
+    ((silk_decoder *)decState)->prev_shadow_decode = 0;
 
     return ret;
 }
@@ -146,7 +149,7 @@ opus_int silk_Decode(                                   /* O    Returns error co
     int                             arch                /* I    Run-time architecture                           */
 )
 {
-    opus_int   i, n, decode_only_middle = 0, ret = SILK_NO_ERROR;
+    opus_int   i, n, nChannelsOut, decode_only_middle = 0, ret = SILK_NO_ERROR;
     opus_int32 nSamplesOutDec, LBRR_symbol;
     opus_int16 *samplesOut1_tmp[ 2 ];
     VARDECL( opus_int16, samplesOut1_tmp_storage1 );
@@ -366,6 +369,19 @@ opus_int silk_Decode(                                   /* O    Returns error co
         channel_state[ n ].nFramesDecoded++;
     }
 
+    /* Export the side information of the frame for reuse by an encoder */
+    if( decControl->paramHints != NULL ) {
+        silk_param_hints *psHints = decControl->paramHints;
+        if( lostFlag == FLAG_DECODE_NORMAL && decControl->nChannelsInternal == 1 ) {
+            psHints->indices[ channel_state[ 0 ].nFramesDecoded - 1 ] = channel_state[ 0 ].indices;
+            psHints->nFrames  = channel_state[ 0 ].nFramesDecoded;
+            psHints->fs_kHz   = channel_state[ 0 ].fs_kHz;
+            psHints->nb_subfr = channel_state[ 0 ].nb_subfr;
+        } else {
+            psHints->nFrames  = 0;
+        }
+    }
+
     if( decControl->nChannelsAPI == 2 && decControl->nChannelsInternal == 2 ) {
         /* Convert Mid/Side to Left/Right */
         silk_stereo_MS_to_LR( &psDec->sStereo, samplesOut1_tmp[ 0 ], samplesOut1_tmp[ 1 ], MS_pred_Q13, channel_state[ 0 ].fs_kHz, nSamplesOutDec );
@@ -382,7 +398,24 @@ opus_int silk_Decode(                                   /* O    Returns error co
     ALLOC( samplesOut2_tmp, *nSamplesOut, opus_int16 );
     resample_out_ptr = samplesOut2_tmp;
 
-    for( n = 0; n < silk_min( decControl->nChannelsAPI, decControl->nChannelsInternal ); n++ ) {
+    if( decControl->shadow_decode ) {
+        /* The decoder state is up to date; skip resampling and output */
+        nChannelsOut = 0;
+    } else {
+        nChannelsOut = silk_min( decControl->nChannelsAPI, decControl->nChannelsInternal );
+        if( psDec->prev_shadow_decode ) {
+            /* The resampler memory is stale after shadow decoding, restart it from silence */
+            for( n = 0; n < DECODER_NUM_CHANNELS; n++ ) {
+                if( channel_state[ n ].fs_kHz > 0 ) {
+                    ret += silk_resampler_init( &channel_state[ n ].resampler_state,
+                        silk_SMULBB( channel_state[ n ].fs_kHz, 1000 ), channel_state[ n ].fs_API_hz, 0 );
+                }
+            }
+        }
+    }
+    psDec->prev_shadow_decode = decControl->shadow_decode;
+
+    for( n = 0; n < nChannelsOut; n++ ) {
 
 #ifdef ENABLE_OSCE_BWE
         /* Resample or extend decoded signal to API_sampleRate */
@@ -430,11 +463,13 @@ opus_int silk_Decode(                                   /* O    Returns error co
     }
 
 #ifdef ENABLE_OSCE_BWE
-    decControl->prev_osce_extended_mode = decControl->osce_extended_mode;
+    /* The bandwidth extension state is not updated in shadow mode, so make
+       sure it restarts cleanly once we produce output again */
+    decControl->prev_osce_extended_mode = decControl->shadow_decode ? OSCE_MODE_SILK_ONLY : decControl->osce_extended_mode;
 #endif
 
     /* Create two channel output from mono stream */
-    if( decControl->nChannelsAPI == 2 && decControl->nChannelsInternal == 1 ) {
+    if( decControl->nChannelsAPI == 2 && decControl->nChannelsInternal == 1 && !decControl->shadow_decode ) {
         if ( stereo_to_mono ){
             /* Resample right channel for newly collapsed stereo just in case
                we weren't doing collapsing when switching to mono */
@@ -466,6 +501,7 @@ opus_int silk_Decode(                                   /* O    Returns error co
     } else {
        psDec->prev_decode_only_middle = decode_only_middle;
     }
+    decControl->lastGainIndex = channel_state[ 0 ].LastGainIndex;
     RESTORE_STACK;
     return ret;
 }
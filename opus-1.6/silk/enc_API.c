@@ -522,6 +522,14 @@ opus_int silk_Encode(                                   /* O    Returns error co
                     } else {
                         condCoding = CODE_CONDITIONALLY;
                     }
+                    /* Reuse the side information of the matching decoded frame, if any */
+                    psEnc->state_Fxx[ n ].sCmn.psHintIndices = NULL;
+                    if( encControl->paramHints != NULL && encControl->nChannelsInternal == 1 && !prefillFlag &&
+                        encControl->paramHints->fs_kHz == psEnc->state_Fxx[ n ].sCmn.fs_kHz &&
+                        encControl->paramHints->nb_subfr == psEnc->state_Fxx[ n ].sCmn.nb_subfr &&
+                        psEnc->state_Fxx[ n ].sCmn.nFramesEncoded < encControl->paramHints->nFrames ) {
+                        psEnc->state_Fxx[ n ].sCmn.psHintIndices = &encControl->paramHints->indices[ psEnc->state_Fxx[ n ].sCmn.nFramesEncoded ];
+                    }
                     if( ( ret = silk_encode_frame_Fxx( &psEnc->state_Fxx[ n ], nBytesOut, psRangeEnc, condCoding, maxBits, useCBR ) ) != 0 ) {
                         silk_assert( 0 );
                     }
@@ -596,6 +604,7 @@ opus_int silk_Encode(                                   /* O    Returns error co
     encControl->offset = silk_Quantization_Offsets_Q10
                          [ psEnc->state_Fxx[0].sCmn.indices.signalType >> 1 ]
                          [ psEnc->state_Fxx[0].sCmn.indices.quantOffsetType ];
+    encControl->lastGainIndex = psEnc->state_Fxx[ 0 ].sShape.LastGainIndex;
     RESTORE_STACK;
     return ret;
 }
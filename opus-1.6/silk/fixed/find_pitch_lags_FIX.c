@@ -112,7 +112,10 @@ void silk_find_pitch_lags_FIX(
     /*****************************************/
     silk_LPC_analysis_filter( res, x, A_Q12, buf_len, psEnc->sCmn.pitchEstimationLPCOrder, psEnc->sCmn.arch );
 
-    if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 ) {
+    if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 &&
+        psEnc->sCmn.psHintIndices != NULL ) {
+        psEnc->LTPCorr_Q15 = silk_reuse_pitch_lags( &psEnc->sCmn, psEncCtrl->pitchL );
+    } else if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 ) {
         /* Threshold for pitch estimator */
         thrhld_Q13 = SILK_FIX_CONST( 0.6, 13 );
         thrhld_Q13 = silk_SMLABB( thrhld_Q13, SILK_FIX_CONST( -0.004, 13 ), psEnc->sCmn.pitchEstimationLPCOrder );
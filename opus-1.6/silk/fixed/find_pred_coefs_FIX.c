@@ -90,9 +90,14 @@ void silk_find_pred_coefs_FIX(
         silk_find_LTP_FIX( XXLTP_Q17, xXLTP_Q17, res_pitch,
             psEncCtrl->pitchL, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr, psEnc->sCmn.arch );
 
-        /* Quantize LTP gain parameters */
+        /* Quantize LTP gain parameters, or evaluate those of the decoded frame */
+        if( psEnc->sCmn.psHintIndices != NULL ) {
+            psEnc->sCmn.indices.PERIndex = psEnc->sCmn.psHintIndices->PERIndex;
+            silk_memcpy( psEnc->sCmn.indices.LTPIndex, psEnc->sCmn.psHintIndices->LTPIndex, sizeof( psEnc->sCmn.indices.LTPIndex ) );
+        }
         silk_quant_LTP_gains( psEncCtrl->LTPCoef_Q14, psEnc->sCmn.indices.LTPIndex, &psEnc->sCmn.indices.PERIndex,
-            &psEnc->sCmn.sum_log_gain_Q7, &psEncCtrl->LTPredCodGain_Q7, XXLTP_Q17, xXLTP_Q17, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr, psEnc->sCmn.arch );
+            &psEnc->sCmn.sum_log_gain_Q7, &psEncCtrl->LTPredCodGain_Q7, XXLTP_Q17, xXLTP_Q17, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr,
+            psEnc->sCmn.psHintIndices != NULL, psEnc->sCmn.arch );
 
         /* Control LTP scaling */
         silk_LTP_scale_ctrl_FIX( psEnc, psEncCtrl, condCoding );
@@ -131,8 +136,16 @@ void silk_find_pred_coefs_FIX(
                 silk_SMLAWB( SILK_FIX_CONST( 0.25, 18 ), SILK_FIX_CONST( 0.75, 18 ), psEncCtrl->coding_quality_Q14 ) ), 14 );
     }
 
-    /* LPC_in_pre contains the LTP-filtered input for voiced, and the unfiltered input for unvoiced */
-    silk_find_LPC_FIX( &psEnc->sCmn, NLSF_Q15, LPC_in_pre, minInvGain_Q30 );
+    if( psEnc->sCmn.psHintIndices != NULL ) {
+        /* The NLSFs of the decoded frame are reused by silk_process_NLSFs() */
+        psEnc->sCmn.indices.NLSFInterpCoef_Q2 = 4;
+        if( psEnc->sCmn.useInterpolatedNLSFs && !psEnc->sCmn.first_frame_after_reset ) {
+            psEnc->sCmn.indices.NLSFInterpCoef_Q2 = psEnc->sCmn.psHintIndices->NLSFInterpCoef_Q2;
+        }
+    } else {
+        /* LPC_in_pre contains the LTP-filtered input for voiced, and the unfiltered input for unvoiced */
+        silk_find_LPC_FIX( &psEnc->sCmn, NLSF_Q15, LPC_in_pre, minInvGain_Q30 );
+    }
 
     /* Quantize LSFs */
     silk_process_NLSFs( &psEnc->sCmn, psEncCtrl->PredCoef_Q12, NLSF_Q15, psEnc->sCmn.prev_NLSFq_Q15 );
@@ -104,7 +104,10 @@ void silk_find_pitch_lags_FLP(
     /*****************************************/
     silk_LPC_analysis_filter_FLP( res, A, x_buf, buf_len, psEnc->sCmn.pitchEstimationLPCOrder );
 
-    if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 ) {
+    if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 &&
+        psEnc->sCmn.psHintIndices != NULL ) {
+        psEnc->LTPCorr = silk_reuse_pitch_lags( &psEnc->sCmn, psEncCtrl->pitchL ) * ( 1.0f / 32768.0f );
+    } else if( psEnc->sCmn.indices.signalType != TYPE_NO_VOICE_ACTIVITY && psEnc->sCmn.first_frame_after_reset == 0 ) {
         /* Threshold for pitch estimator */
         thrhld  = 0.6f;
         thrhld -= 0.004f * psEnc->sCmn.pitchEstimationLPCOrder;
@@ -65,9 +65,14 @@ void silk_find_pred_coefs_FLP(
         /* LTP analysis */
         silk_find_LTP_FLP( XXLTP, xXLTP, res_pitch, psEncCtrl->pitchL, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr, psEnc->sCmn.arch );
 
-        /* Quantize LTP gain parameters */
+        /* Quantize LTP gain parameters, or evaluate those of the decoded frame */
+        if( psEnc->sCmn.psHintIndices != NULL ) {
+            psEnc->sCmn.indices.PERIndex = psEnc->sCmn.psHintIndices->PERIndex;
+            silk_memcpy( psEnc->sCmn.indices.LTPIndex, psEnc->sCmn.psHintIndices->LTPIndex, sizeof( psEnc->sCmn.indices.LTPIndex ) );
+        }
         silk_quant_LTP_gains_FLP( psEncCtrl->LTPCoef, psEnc->sCmn.indices.LTPIndex, &psEnc->sCmn.indices.PERIndex,
-            &psEnc->sCmn.sum_log_gain_Q7, &psEncCtrl->LTPredCodGain, XXLTP, xXLTP, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr, psEnc->sCmn.arch );
+            &psEnc->sCmn.sum_log_gain_Q7, &psEncCtrl->LTPredCodGain, XXLTP, xXLTP, psEnc->sCmn.subfr_length, psEnc->sCmn.nb_subfr,
+            psEnc->sCmn.psHintIndices != NULL, psEnc->sCmn.arch );
 
         /* Control LTP scaling */
         silk_LTP_scale_ctrl_FLP( psEnc, psEncCtrl, condCoding );
@@ -101,8 +106,16 @@ void silk_find_pred_coefs_FLP(
         minInvGain /= 0.25f + 0.75f * psEncCtrl->coding_quality;
     }
 
-    /* LPC_in_pre contains the LTP-filtered input for voiced, and the unfiltered input for unvoiced */
-    silk_find_LPC_FLP( &psEnc->sCmn, NLSF_Q15, LPC_in_pre, minInvGain, psEnc->sCmn.arch );
+    if( psEnc->sCmn.psHintIndices != NULL ) {
+        /* The NLSFs of the decoded frame are reused by silk_process_NLSFs() */
+        psEnc->sCmn.indices.NLSFInterpCoef_Q2 = 4;
+        if( psEnc->sCmn.useInterpolatedNLSFs && !psEnc->sCmn.first_frame_after_reset ) {
+            psEnc->sCmn.indices.NLSFInterpCoef_Q2 = psEnc->sCmn.psHintIndices->NLSFInterpCoef_Q2;
+        }
+    } else {
+        /* LPC_in_pre contains the LTP-filtered input for voiced, and the unfiltered input for unvoiced */
+        silk_find_LPC_FLP( &psEnc->sCmn, NLSF_Q15, LPC_in_pre, minInvGain, psEnc->sCmn.arch );
+    }
 
     /* Quantize LSFs */
     silk_process_NLSFs_FLP( &psEnc->sCmn, psEncCtrl->PredCoef, NLSF_Q15, psEnc->sCmn.prev_NLSFq_Q15 );
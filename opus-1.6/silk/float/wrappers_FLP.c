@@ -174,14 +174,15 @@ void silk_NSQ_wrapper_FLP(
 /***********************************************/
 void silk_quant_LTP_gains_FLP(
     silk_float                      B[ MAX_NB_SUBFR * LTP_ORDER ],      /* O    Quantized LTP gains                            */
-    opus_int8                       cbk_index[ MAX_NB_SUBFR ],          /* O    Codebook index                              */
-    opus_int8                       *periodicity_index,                 /* O    Periodicity index                           */
+    opus_int8                       cbk_index[ MAX_NB_SUBFR ],          /* I/O  Codebook index                              */
+    opus_int8                       *periodicity_index,                 /* I/O  Periodicity index                           */
     opus_int32                      *sum_log_gain_Q7,                   /* I/O  Cumulative max prediction gain  */
     silk_float                      *pred_gain_dB,                        /* O    LTP prediction gain                            */
     const silk_float                XX[ MAX_NB_SUBFR * LTP_ORDER * LTP_ORDER ], /* I    Correlation matrix                    */
     const silk_float                xX[ MAX_NB_SUBFR * LTP_ORDER ],        /* I    Correlation vector                            */
     const opus_int                    subfr_len,                            /* I    Number of samples per subframe                */
     const opus_int                    nb_subfr,                           /* I    Number of subframes                            */
+    const opus_int                  use_indices,                        /* I    Only evaluate the input indices             */
     int                             arch                                /* I    Run-time architecture                       */
 )
 {
@@ -199,7 +200,7 @@ void silk_quant_LTP_gains_FLP(
         xX_Q17[ i ] = (opus_int32)silk_float2int( xX[ i ] * 131072.0f );
     } while ( ++i < nb_subfr * LTP_ORDER );
 
-    silk_quant_LTP_gains( B_Q14, cbk_index, periodicity_index, sum_log_gain_Q7, &pred_gain_dB_Q7, XX_Q17, xX_Q17, subfr_len, nb_subfr, arch );
+    silk_quant_LTP_gains( B_Q14, cbk_index, periodicity_index, sum_log_gain_Q7, &pred_gain_dB_Q7, XX_Q17, xX_Q17, subfr_len, nb_subfr, use_indices, arch );
 
     for( i = 0; i < nb_subfr * LTP_ORDER; i++ ) {
         B[ i ] = (silk_float)B_Q14[ i ] * ( 1.0f / 16384.0f );
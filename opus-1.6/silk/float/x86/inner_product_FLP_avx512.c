@@ -0,0 +1,79 @@
+/***********************************************************************
+Copyright (c) 2006-2011, Skype Limited. All rights reserved.
+              2023 Amazon
+              2026 The opuslib authors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SigProc_FLP.h"
+#include <immintrin.h>
+
+#if defined(OPUS_X86_MAY_HAVE_AVX512)
+
+/* inner product of two silk_float arrays, with result as double. This stays
+   on 256-bit AVX-512VL vectors: the products are widened to double, so a zmm
+   register only holds 8 of them, and with the short LTP and LPC vectors this
+   is called on, 512-bit FMAs gain less than the clock they can cost. What
+   AVX-512 brings is the masked tail in place of the scalar loop. */
+double silk_inner_product_FLP_avx512(
+    const silk_float    *data1,
+    const silk_float    *data2,
+    opus_int            dataSize
+)
+{
+    opus_int i;
+    __m256d accum1, accum2, accum3, accum4;
+    __m128d sum;
+
+    /* 4x unrolled loop */
+    accum1 = accum2 = accum3 = accum4 = _mm256_setzero_pd();
+    for( i = 0; i < dataSize - 15; i += 16 ) {
+        accum1 = _mm256_fmadd_pd( _mm256_cvtps_pd( _mm_loadu_ps( &data1[ i ] ) ),
+                                  _mm256_cvtps_pd( _mm_loadu_ps( &data2[ i ] ) ), accum1 );
+        accum2 = _mm256_fmadd_pd( _mm256_cvtps_pd( _mm_loadu_ps( &data1[ i + 4 ] ) ),
+                                  _mm256_cvtps_pd( _mm_loadu_ps( &data2[ i + 4 ] ) ), accum2 );
+        accum3 = _mm256_fmadd_pd( _mm256_cvtps_pd( _mm_loadu_ps( &data1[ i + 8 ] ) ),
+                                  _mm256_cvtps_pd( _mm_loadu_ps( &data2[ i + 8 ] ) ), accum3 );
+        accum4 = _mm256_fmadd_pd( _mm256_cvtps_pd( _mm_loadu_ps( &data1[ i + 12 ] ) ),
+                                  _mm256_cvtps_pd( _mm_loadu_ps( &data2[ i + 12 ] ) ), accum4 );
+    }
+    /* remaining products, with masked loads for the last partial vector */
+    for( ; i < dataSize; i += 4 ) {
+        __mmask8 m;
+        m = dataSize - i >= 4 ? (__mmask8)0xf : (__mmask8)( ( 1u << ( dataSize - i ) ) - 1 );
+        accum1 = _mm256_fmadd_pd( _mm256_cvtps_pd( _mm_maskz_loadu_ps( m, &data1[ i ] ) ),
+                                  _mm256_cvtps_pd( _mm_maskz_loadu_ps( m, &data2[ i ] ) ), accum1 );
+    }
+    accum1 = _mm256_add_pd( _mm256_add_pd( accum1, accum2 ), _mm256_add_pd( accum3, accum4 ) );
+    sum = _mm_add_pd( _mm256_castpd256_pd128( accum1 ), _mm256_extractf128_pd( accum1, 1 ) );
+    sum = _mm_add_sd( sum, _mm_unpackhi_pd( sum, sum ) );
+    return _mm_cvtsd_f64( sum );
+}
+
+#endif
@@ -35,6 +35,72 @@ POSSIBILITY OF SUCH DAMAGE.
 #define SCALE_Q16               ( ( 65536 * ( N_LEVELS_QGAIN - 1 ) ) / ( ( ( MAX_QGAIN_DB - MIN_QGAIN_DB ) * 128 ) / 6 ) )
 #define INV_SCALE_Q16           ( ( 65536 * ( ( ( MAX_QGAIN_DB - MIN_QGAIN_DB ) * 128 ) / 6 ) ) / ( N_LEVELS_QGAIN - 1 ) )
 
+/* Delta codes one absolute gain index and updates the previous index */
+static OPUS_INLINE opus_int8 silk_gain_index_code(
+    opus_int                    ind,                            /* I    absolute gain index                         */
+    opus_int8                   *prev_ind,                      /* I/O  last index                                  */
+    const opus_int              full                            /* I    code as full index if 1                     */
+)
+{
+    opus_int double_step_size_threshold;
+
+    if( full ) {
+        /* Full index */
+        ind = silk_LIMIT_int( ind, *prev_ind + MIN_DELTA_GAIN_QUANT, N_LEVELS_QGAIN - 1 );
+        *prev_ind = ind;
+    } else {
+        /* Delta index */
+        ind = ind - *prev_ind;
+
+        /* Double the quantization step size for large gain increases, so that the max gain level can be reached */
+        double_step_size_threshold = 2 * MAX_DELTA_GAIN_QUANT - N_LEVELS_QGAIN + *prev_ind;
+        if( ind > double_step_size_threshold ) {
+            ind = double_step_size_threshold + silk_RSHIFT( ind - double_step_size_threshold + 1, 1 );
+        }
+
+        ind = silk_LIMIT_int( ind, MIN_DELTA_GAIN_QUANT, MAX_DELTA_GAIN_QUANT );
+
+        /* Accumulate deltas */
+        if( ind > double_step_size_threshold ) {
+            *prev_ind += silk_LSHIFT( ind, 1 ) - double_step_size_threshold;
+            *prev_ind = silk_min_int( *prev_ind, N_LEVELS_QGAIN - 1 );
+        } else {
+            *prev_ind += ind;
+        }
+
+        /* Shift to make non-negative */
+        ind -= MIN_DELTA_GAIN_QUANT;
+    }
+    return (opus_int8)ind;
+}
+
+/* Decodes one gain index to an absolute gain index, stored in the previous index */
+static OPUS_INLINE void silk_gain_index_decode(
+    const opus_int8             ind,                            /* I    gain index                                  */
+    opus_int8                   *prev_ind,                      /* I/O  last index                                  */
+    const opus_int              full                            /* I    full index if 1                             */
+)
+{
+    opus_int ind_tmp, double_step_size_threshold;
+
+    if( full ) {
+        /* Gain index is not allowed to go down more than 16 steps (~21.8 dB) */
+        *prev_ind = silk_max_int( ind, *prev_ind - 16 );
+    } else {
+        /* Delta index */
+        ind_tmp = ind + MIN_DELTA_GAIN_QUANT;
+
+        /* Accumulate deltas */
+        double_step_size_threshold = 2 * MAX_DELTA_GAIN_QUANT - N_LEVELS_QGAIN + *prev_ind;
+        if( ind_tmp > double_step_size_threshold ) {
+            *prev_ind += silk_LSHIFT( ind_tmp, 1 ) - double_step_size_threshold;
+        } else {
+            *prev_ind += ind_tmp;
+        }
+    }
+    *prev_ind = silk_LIMIT_int( *prev_ind, 0, N_LEVELS_QGAIN - 1 );
+}
+
 /* Gain scalar quantization with hysteresis, uniform on log scale */
 void silk_gains_quant(
     opus_int8                   ind[ MAX_NB_SUBFR ],            /* O    gain indices                                */
@@ -44,46 +110,20 @@ void silk_gains_quant(
     const opus_int              nb_subfr                        /* I    number of subframes                         */
 )
 {
-    opus_int k, double_step_size_threshold;
+    opus_int k, ind_tmp;
 
     for( k = 0; k < nb_subfr; k++ ) {
         /* Convert to log scale, scale, floor() */
-        ind[ k ] = silk_SMULWB( SCALE_Q16, silk_lin2log( gain_Q16[ k ] ) - OFFSET );
+        ind_tmp = silk_SMULWB( SCALE_Q16, silk_lin2log( gain_Q16[ k ] ) - OFFSET );
 
         /* Round towards previous quantized gain (hysteresis) */
-        if( ind[ k ] < *prev_ind ) {
-            ind[ k ]++;
+        if( ind_tmp < *prev_ind ) {
+            ind_tmp++;
         }
-        ind[ k ] = silk_LIMIT_int( ind[ k ], 0, N_LEVELS_QGAIN - 1 );
+        ind_tmp = silk_LIMIT_int( ind_tmp, 0, N_LEVELS_QGAIN - 1 );
 
         /* Compute delta indices and limit */
-        if( k == 0 && conditional == 0 ) {
-            /* Full index */
-            ind[ k ] = silk_LIMIT_int( ind[ k ], *prev_ind + MIN_DELTA_GAIN_QUANT, N_LEVELS_QGAIN - 1 );
-            *prev_ind = ind[ k ];
-        } else {
-            /* Delta index */
-            ind[ k ] = ind[ k ] - *prev_ind;
-
-            /* Double the quantization step size for large gain increases, so that the max gain level can be reached */
-            double_step_size_threshold = 2 * MAX_DELTA_GAIN_QUANT - N_LEVELS_QGAIN + *prev_ind;
-            if( ind[ k ] > double_step_size_threshold ) {
-                ind[ k ] = double_step_size_threshold + silk_RSHIFT( ind[ k ] - double_step_size_threshold + 1, 1 );
-            }
-
-            ind[ k ] = silk_LIMIT_int( ind[ k ], MIN_DELTA_GAIN_QUANT, MAX_DELTA_GAIN_QUANT );
-
-            /* Accumulate deltas */
-            if( ind[ k ] > double_step_size_threshold ) {
-                *prev_ind += silk_LSHIFT( ind[ k ], 1 ) - double_step_size_threshold;
-                *prev_ind = silk_min_int( *prev_ind, N_LEVELS_QGAIN - 1 );
-            } else {
-                *prev_ind += ind[ k ];
-            }
-
-            /* Shift to make non-negative */
-            ind[ k ] -= MIN_DELTA_GAIN_QUANT;
-        }
+        ind[ k ] = silk_gain_index_code( ind_tmp, prev_ind, k == 0 && conditional == 0 );
 
         /* Scale and convert to linear scale */
         gain_Q16[ k ] = silk_log2lin( silk_min_32( silk_SMULWB( INV_SCALE_Q16, *prev_ind ) + OFFSET, 3967 ) ); /* 3967 = 31 in Q7 */
@@ -99,31 +139,42 @@ void silk_gains_dequant(
     const opus_int              nb_subfr                        /* I    number of subframes                          */
 )
 {
-    opus_int   k, ind_tmp, double_step_size_threshold;
+    opus_int   k;
 
     for( k = 0; k < nb_subfr; k++ ) {
-        if( k == 0 && conditional == 0 ) {
-            /* Gain index is not allowed to go down more than 16 steps (~21.8 dB) */
-            *prev_ind = silk_max_int( ind[ k ], *prev_ind - 16 );
-        } else {
-            /* Delta index */
-            ind_tmp = ind[ k ] + MIN_DELTA_GAIN_QUANT;
-
-            /* Accumulate deltas */
-            double_step_size_threshold = 2 * MAX_DELTA_GAIN_QUANT - N_LEVELS_QGAIN + *prev_ind;
-            if( ind_tmp > double_step_size_threshold ) {
-                *prev_ind += silk_LSHIFT( ind_tmp, 1 ) - double_step_size_threshold;
-            } else {
-                *prev_ind += ind_tmp;
-            }
-        }
-        *prev_ind = silk_LIMIT_int( *prev_ind, 0, N_LEVELS_QGAIN - 1 );
+        silk_gain_index_decode( ind[ k ], prev_ind, k == 0 && conditional == 0 );
 
         /* Scale and convert to linear scale */
         gain_Q16[ k ] = silk_log2lin( silk_min_32( silk_SMULWB( INV_SCALE_Q16, *prev_ind ) + OFFSET, 3967 ) ); /* 3967 = 31 in Q7 */
     }
 }
 
+/* Gain index offset: decodes gain indices, adds a number of quantization steps and codes them again */
+void silk_gains_offset(
+    opus_int8                   ind[ MAX_NB_SUBFR ],            /* I/O  gain indices                                */
+    opus_int8                   *prev_ind_in,                   /* I/O  last index of the input stream              */
+    opus_int8                   *prev_ind_out,                  /* I/O  last index of the output stream             */
+    const opus_int              steps,                          /* I    gain offset in quantization steps           */
+    const opus_int              conditional,                    /* I    first gain is delta coded if 1              */
+    const opus_int              nb_subfr                        /* I    number of subframes                         */
+)
+{
+    opus_int k, full, ind_out;
+
+    for( k = 0; k < nb_subfr; k++ ) {
+        full = k == 0 && conditional == 0;
+        silk_gain_index_decode( ind[ k ], prev_ind_in, full );
+        ind_out = silk_LIMIT_int( *prev_ind_in + steps, 0, N_LEVELS_QGAIN - 1 );
+        if( full ) {
+            /* Only limit the drop from the last index as much as the decoder does, not as the encoder does */
+            ind[ k ] = (opus_int8)ind_out;
+            silk_gain_index_decode( ind[ k ], prev_ind_out, 1 );
+        } else {
+            ind[ k ] = silk_gain_index_code( ind_out, prev_ind_out, 0 );
+        }
+    }
+}
+
 /* Compute unique identifier of gain indices vector */
 opus_int32 silk_gains_ID(                                       /* O    returns unique identifier of gains          */
     const opus_int8             ind[ MAX_NB_SUBFR ],            /* I    gain indices                                */
@@ -192,6 +192,16 @@ void silk_gains_dequant(
     const opus_int              nb_subfr                        /* I    number of subframes                          */
 );
 
+/* Gain index offset: decodes gain indices, adds a number of quantization steps and codes them again */
+void silk_gains_offset(
+    opus_int8                   ind[ MAX_NB_SUBFR ],            /* I/O  gain indices                                */
+    opus_int8                   *prev_ind_in,                   /* I/O  last index of the input stream              */
+    opus_int8                   *prev_ind_out,                  /* I/O  last index of the output stream             */
+    const opus_int              steps,                          /* I    gain offset in quantization steps           */
+    const opus_int              conditional,                    /* I    first gain is delta coded if 1              */
+    const opus_int              nb_subfr                        /* I    number of subframes                         */
+);
+
 /* Compute unique identifier of gain indices vector */
 opus_int32 silk_gains_ID(                                       /* O    returns unique identifier of gains          */
     const opus_int8             ind[ MAX_NB_SUBFR ],            /* I    gain indices                                */
@@ -210,14 +220,15 @@ void silk_interpolate(
 /* LTP tap quantizer */
 void silk_quant_LTP_gains(
     opus_int16                  B_Q14[ MAX_NB_SUBFR * LTP_ORDER ],          /* O    Quantized LTP gains             */
-    opus_int8                   cbk_index[ MAX_NB_SUBFR ],                  /* O    Codebook Index                  */
-    opus_int8                   *periodicity_index,                         /* O    Periodicity Index               */
+    opus_int8                   cbk_index[ MAX_NB_SUBFR ],                  /* I/O  Codebook Index                  */
+    opus_int8                   *periodicity_index,                         /* I/O  Periodicity Index               */
     opus_int32                  *sum_gain_dB_Q7,                            /* I/O  Cumulative max prediction gain  */
     opus_int                    *pred_gain_dB_Q7,                           /* O    LTP prediction gain             */
     const opus_int32            XX_Q17[ MAX_NB_SUBFR*LTP_ORDER*LTP_ORDER ], /* I    Correlation matrix in Q18       */
     const opus_int32            xX_Q17[ MAX_NB_SUBFR*LTP_ORDER ],           /* I    Correlation vector in Q18       */
     const opus_int              subfr_len,                                  /* I    Number of samples per subframe  */
     const opus_int              nb_subfr,                                   /* I    Number of subframes             */
+    const opus_int              use_indices,                                /* I    Only evaluate the input indices */
     int                         arch                                        /* I    Run-time architecture           */
 );
 
@@ -324,6 +335,12 @@ void silk_LP_variable_cutoff(
     const opus_int              frame_length                    /* I    Frame length                                */
 );
 
+/* Take the pitch lags from the side information of a decoded frame instead of running the pitch estimator */
+opus_int silk_reuse_pitch_lags(                                 /* O    Normalized correlation at the lag (Q15)     */
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    opus_int                    pitchL[ MAX_NB_SUBFR ]          /* O    Pitch lags                                  */
+);
+
 /******************/
 /* NLSF Quantizer */
 /******************/
@@ -342,12 +359,13 @@ opus_int32 silk_NLSF_encode(                                    /* O    Returns
     const opus_int16            *pW_QW,                         /* I    NLSF weight vector [ LPC_ORDER ]            */
     const opus_int              NLSF_mu_Q20,                    /* I    Rate weight for the RD optimization         */
     const opus_int              nSurvivors,                     /* I    Max survivors after first stage             */
-    const opus_int              signalType                      /* I    Signal type: 0/1/2                          */
+    const opus_int              signalType,                     /* I    Signal type: 0/1/2                          */
+    int                         arch                            /* I    Run-time architecture                       */
 );
 
 /* Compute quantization errors for an LPC_order element input vector for a VQ codebook */
-void silk_NLSF_VQ(
-    opus_int32                  err_Q26[],                      /* O    Quantization errors [K]                     */
+void silk_NLSF_VQ_c(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
     const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
     const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
     const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
@@ -355,8 +373,13 @@ void silk_NLSF_VQ(
     const opus_int              LPC_order                       /* I    Number of LPCs                              */
 );
 
+#if !defined(OVERRIDE_silk_NLSF_VQ)
+#define silk_NLSF_VQ(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order, arch) \
+    ((void)(arch),silk_NLSF_VQ_c(err_Q24, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order))
+#endif
+
 /* Delayed-decision quantizer for NLSF residuals */
-opus_int32 silk_NLSF_del_dec_quant(                             /* O    Returns RD value in Q25                     */
+opus_int32 silk_NLSF_del_dec_quant_c(                           /* O    Returns RD value in Q25                     */
     opus_int8                   indices[],                      /* O    Quantization indices [ order ]              */
     const opus_int16            x_Q10[],                        /* I    Input [ order ]                             */
     const opus_int16            w_Q5[],                         /* I    Weights [ order ]                           */
@@ -369,6 +392,13 @@ opus_int32 silk_NLSF_del_dec_quant(                             /* O    Returns
     const opus_int16            order                           /* I    Number of input values                      */
 );
 
+#if !defined(OVERRIDE_silk_NLSF_del_dec_quant)
+#define silk_NLSF_del_dec_quant(indices, x_Q10, w_Q5, pred_coef_Q8, ec_ix, ec_rates_Q5, quant_step_size_Q16, \
+                                inv_quant_step_size_Q6, mu_Q20, order, arch) \
+    ((void)(arch),silk_NLSF_del_dec_quant_c(indices, x_Q10, w_Q5, pred_coef_Q8, ec_ix, ec_rates_Q5, quant_step_size_Q16, \
+                                            inv_quant_step_size_Q6, mu_Q20, order))
+#endif
+
 /* Unpack predictor values and indices for entropy coding tables */
 void silk_NLSF_unpack(
           opus_int16            ec_ix[],                        /* O    Indices to entropy tables [ LPC_ORDER ]     */
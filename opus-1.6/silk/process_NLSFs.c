@@ -50,43 +50,49 @@ void silk_process_NLSFs(
     silk_assert( psEncC->speech_activity_Q8 <= SILK_FIX_CONST( 1.0, 8 ) );
     celt_assert( psEncC->useInterpolatedNLSFs == 1 || psEncC->indices.NLSFInterpCoef_Q2 == ( 1 << 2 ) );
 
-    /***********************/
-    /* Calculate mu values */
-    /***********************/
-    /* NLSF_mu  = 0.003 - 0.0015 * psEnc->speech_activity; */
-    NLSF_mu_Q20 = silk_SMLAWB( SILK_FIX_CONST( 0.003, 20 ), SILK_FIX_CONST( -0.001, 28 ), psEncC->speech_activity_Q8 );
-    if( psEncC->nb_subfr == 2 ) {
-        /* Multiply by 1.5 for 10 ms packets */
-        NLSF_mu_Q20 = silk_ADD_RSHIFT( NLSF_mu_Q20, NLSF_mu_Q20, 1 );
-    }
+    doInterpolate = ( psEncC->useInterpolatedNLSFs == 1 ) && ( psEncC->indices.NLSFInterpCoef_Q2 < 4 );
+    if( psEncC->psHintIndices != NULL ) {
+        /* Reuse the quantized NLSFs of the decoded frame */
+        silk_memcpy( psEncC->indices.NLSFIndices, psEncC->psHintIndices->NLSFIndices, sizeof( psEncC->indices.NLSFIndices ) );
+        silk_NLSF_decode( pNLSF_Q15, psEncC->indices.NLSFIndices, psEncC->psNLSF_CB );
+    } else {
+        /***********************/
+        /* Calculate mu values */
+        /***********************/
+        /* NLSF_mu  = 0.003 - 0.0015 * psEnc->speech_activity; */
+        NLSF_mu_Q20 = silk_SMLAWB( SILK_FIX_CONST( 0.003, 20 ), SILK_FIX_CONST( -0.001, 28 ), psEncC->speech_activity_Q8 );
+        if( psEncC->nb_subfr == 2 ) {
+            /* Multiply by 1.5 for 10 ms packets */
+            NLSF_mu_Q20 = silk_ADD_RSHIFT( NLSF_mu_Q20, NLSF_mu_Q20, 1 );
+        }
 
-    celt_assert( NLSF_mu_Q20 >  0 );
-    silk_assert( NLSF_mu_Q20 <= SILK_FIX_CONST( 0.005, 20 ) );
+        celt_assert( NLSF_mu_Q20 >  0 );
+        silk_assert( NLSF_mu_Q20 <= SILK_FIX_CONST( 0.005, 20 ) );
 
-    /* Calculate NLSF weights */
-    silk_NLSF_VQ_weights_laroia( pNLSFW_QW, pNLSF_Q15, psEncC->predictLPCOrder );
+        /* Calculate NLSF weights */
+        silk_NLSF_VQ_weights_laroia( pNLSFW_QW, pNLSF_Q15, psEncC->predictLPCOrder );
 
-    /* Update NLSF weights for interpolated NLSFs */
-    doInterpolate = ( psEncC->useInterpolatedNLSFs == 1 ) && ( psEncC->indices.NLSFInterpCoef_Q2 < 4 );
-    if( doInterpolate ) {
-        /* Calculate the interpolated NLSF vector for the first half */
-        silk_interpolate( pNLSF0_temp_Q15, prev_NLSFq_Q15, pNLSF_Q15,
-            psEncC->indices.NLSFInterpCoef_Q2, psEncC->predictLPCOrder );
+        /* Update NLSF weights for interpolated NLSFs */
+        if( doInterpolate ) {
+            /* Calculate the interpolated NLSF vector for the first half */
+            silk_interpolate( pNLSF0_temp_Q15, prev_NLSFq_Q15, pNLSF_Q15,
+                psEncC->indices.NLSFInterpCoef_Q2, psEncC->predictLPCOrder );
 
-        /* Calculate first half NLSF weights for the interpolated NLSFs */
-        silk_NLSF_VQ_weights_laroia( pNLSFW0_temp_QW, pNLSF0_temp_Q15, psEncC->predictLPCOrder );
+            /* Calculate first half NLSF weights for the interpolated NLSFs */
+            silk_NLSF_VQ_weights_laroia( pNLSFW0_temp_QW, pNLSF0_temp_Q15, psEncC->predictLPCOrder );
 
-        /* Update NLSF weights with contribution from first half */
-        i_sqr_Q15 = silk_LSHIFT( silk_SMULBB( psEncC->indices.NLSFInterpCoef_Q2, psEncC->indices.NLSFInterpCoef_Q2 ), 11 );
-        for( i = 0; i < psEncC->predictLPCOrder; i++ ) {
-            pNLSFW_QW[ i ] = silk_ADD16( silk_RSHIFT( pNLSFW_QW[ i ], 1 ), silk_RSHIFT(
-                  silk_SMULBB( pNLSFW0_temp_QW[ i ], i_sqr_Q15 ), 16) );
-            silk_assert( pNLSFW_QW[ i ] >= 1 );
+            /* Update NLSF weights with contribution from first half */
+            i_sqr_Q15 = silk_LSHIFT( silk_SMULBB( psEncC->indices.NLSFInterpCoef_Q2, psEncC->indices.NLSFInterpCoef_Q2 ), 11 );
+            for( i = 0; i < psEncC->predictLPCOrder; i++ ) {
+                pNLSFW_QW[ i ] = silk_ADD16( silk_RSHIFT( pNLSFW_QW[ i ], 1 ), silk_RSHIFT(
+                      silk_SMULBB( pNLSFW0_temp_QW[ i ], i_sqr_Q15 ), 16) );
+                silk_assert( pNLSFW_QW[ i ] >= 1 );
+            }
         }
-    }
 
-    silk_NLSF_encode( psEncC->indices.NLSFIndices, pNLSF_Q15, psEncC->psNLSF_CB, pNLSFW_QW,
-        NLSF_mu_Q20, psEncC->NLSF_MSVQ_Survivors, psEncC->indices.signalType );
+        silk_NLSF_encode( psEncC->indices.NLSFIndices, pNLSF_Q15, psEncC->psNLSF_CB, pNLSFW_QW,
+            NLSF_mu_Q20, psEncC->NLSF_MSVQ_Survivors, psEncC->indices.signalType, psEncC->arch );
+    }
 
     /* Convert quantized NLSFs back to LPC coefficients */
     silk_NLSF2A( PredCoef_Q12[ 1 ], pNLSF_Q15, psEncC->predictLPCOrder, psEncC->arch );
@@ -34,18 +34,19 @@ POSSIBILITY OF SUCH DAMAGE.
 
 void silk_quant_LTP_gains(
     opus_int16                  B_Q14[ MAX_NB_SUBFR * LTP_ORDER ],          /* O    Quantized LTP gains             */
-    opus_int8                   cbk_index[ MAX_NB_SUBFR ],                  /* O    Codebook Index                  */
-    opus_int8                   *periodicity_index,                         /* O    Periodicity Index               */
+    opus_int8                   cbk_index[ MAX_NB_SUBFR ],                  /* I/O  Codebook Index                  */
+    opus_int8                   *periodicity_index,                         /* I/O  Periodicity Index               */
     opus_int32                  *sum_log_gain_Q7,                           /* I/O  Cumulative max prediction gain  */
     opus_int                    *pred_gain_dB_Q7,                           /* O    LTP prediction gain             */
     const opus_int32            XX_Q17[ MAX_NB_SUBFR*LTP_ORDER*LTP_ORDER ], /* I    Correlation matrix in Q18       */
     const opus_int32            xX_Q17[ MAX_NB_SUBFR*LTP_ORDER ],           /* I    Correlation vector in Q18       */
     const opus_int              subfr_len,                                  /* I    Number of samples per subframe  */
     const opus_int              nb_subfr,                                   /* I    Number of subframes             */
+    const opus_int              use_indices,                                /* I    Only evaluate the input indices */
     int                         arch                                        /* I    Run-time architecture           */
 )
 {
-    opus_int             j, k, cbk_size;
+    opus_int             j, k, cbk_size, first;
     opus_int8            temp_idx[ MAX_NB_SUBFR ];
     const opus_uint8     *cl_ptr_Q5;
     const opus_int8      *cbk_ptr_Q7;
@@ -61,11 +62,16 @@ void silk_quant_LTP_gains(
     /***************************************************/
     min_rate_dist_Q7 = silk_int32_MAX;
     best_sum_log_gain_Q7 = 0;
+    res_nrg_Q15 = 0;
     for( k = 0; k < 3; k++ ) {
         /* Safety margin for pitch gain control, to take into account factors
            such as state rescaling/rewhitening. */
         opus_int32 gain_safety = SILK_FIX_CONST( 0.4, 7 );
 
+        if( use_indices && k != *periodicity_index ) {
+            continue;
+        }
+
         cl_ptr_Q5  = silk_LTP_gain_BITS_Q5_ptrs[ k ];
         cbk_ptr_Q7 = silk_LTP_vq_ptrs_Q7[        k ];
         cbk_gain_ptr_Q7 = silk_LTP_vq_gain_ptrs_Q7[ k ];
@@ -81,6 +87,13 @@ void silk_quant_LTP_gains(
         for( j = 0; j < nb_subfr; j++ ) {
             max_gain_Q7 = silk_log2lin( ( SILK_FIX_CONST( MAX_SUM_LOG_GAIN_DB / 6.0, 7 ) - sum_log_gain_tmp_Q7 )
                                         + SILK_FIX_CONST( 7, 7 ) ) - gain_safety;
+            /* With given indices, the search is restricted to a single codebook vector */
+            first = 0;
+            if( use_indices ) {
+                first = cbk_index[ j ];
+                cbk_size = 1;
+                gain_Q7 = cbk_gain_ptr_Q7[ first ];
+            }
             silk_VQ_WMat_EC(
                 &temp_idx[ j ],         /* O    index of best codebook vector                           */
                 &res_nrg_Q15_subfr,     /* O    residual energy                                         */
@@ -88,14 +101,15 @@ void silk_quant_LTP_gains(
                 &gain_Q7,               /* O    sum of absolute LTP coefficients                        */
                 XX_Q17_ptr,             /* I    correlation matrix                                      */
                 xX_Q17_ptr,             /* I    correlation vector                                      */
-                cbk_ptr_Q7,             /* I    codebook                                                */
-                cbk_gain_ptr_Q7,        /* I    codebook effective gains                                */
-                cl_ptr_Q5,              /* I    code length for each codebook vector                    */
+                cbk_ptr_Q7 + first * LTP_ORDER, /* I    codebook                                        */
+                cbk_gain_ptr_Q7 + first,  /* I    codebook effective gains                              */
+                cl_ptr_Q5 + first,      /* I    code length for each codebook vector                    */
                 subfr_len,              /* I    number of samples per subframe                          */
                 max_gain_Q7,            /* I    maximum sum of absolute LTP coefficients                */
                 cbk_size,               /* I    number of vectors in codebook                           */
                 arch                    /* I    Run-time architecture                                   */
             );
+            temp_idx[ j ] += first;
 
             res_nrg_Q15  = silk_ADD_POS_SAT32( res_nrg_Q15, res_nrg_Q15_subfr );
             rate_dist_Q7 = silk_ADD_POS_SAT32( rate_dist_Q7, rate_dist_Q7_subfr );
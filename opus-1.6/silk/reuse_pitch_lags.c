@@ -0,0 +1,71 @@
+/***********************************************************************
+Copyright (c) 2006-2011, Skype Limited. All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "main.h"
+
+/* Take the pitch lags from the side information of a decoded frame instead of running the pitch estimator */
+opus_int silk_reuse_pitch_lags(                                 /* O    Normalized correlation at the lag (Q15)     */
+    silk_encoder_state          *psEncC,                        /* I/O  Encoder state                               */
+    opus_int                    pitchL[ MAX_NB_SUBFR ]          /* O    Pitch lags                                  */
+)
+{
+    opus_int         j, k, sum_Q7;
+    const opus_int8  *cbk_ptr_Q7;
+    const SideInfoIndices *psHint = psEncC->psHintIndices;
+
+    celt_assert( psHint != NULL );
+
+    if( psHint->signalType != TYPE_VOICED ) {
+        silk_memset( pitchL, 0, MAX_NB_SUBFR * sizeof( opus_int ) );
+        psEncC->indices.lagIndex = 0;
+        psEncC->indices.contourIndex = 0;
+        psEncC->indices.signalType = TYPE_UNVOICED;
+        return 0;
+    }
+
+    psEncC->indices.lagIndex = psHint->lagIndex;
+    psEncC->indices.contourIndex = psHint->contourIndex;
+    psEncC->indices.signalType = TYPE_VOICED;
+    silk_decode_pitch( psHint->lagIndex, psHint->contourIndex, pitchL, psEncC->fs_kHz, psEncC->nb_subfr );
+
+    /* The DC gain of the decoded LTP filters approximates the normalized correlation */
+    cbk_ptr_Q7 = silk_LTP_vq_ptrs_Q7[ psHint->PERIndex ];
+    sum_Q7 = 0;
+    for( j = 0; j < psEncC->nb_subfr; j++ ) {
+        for( k = 0; k < LTP_ORDER; k++ ) {
+            sum_Q7 += cbk_ptr_Q7[ psHint->LTPIndex[ j ] * LTP_ORDER + k ];
+        }
+    }
+    sum_Q7 = silk_DIV32_16( sum_Q7, psEncC->nb_subfr );
+    /* Like the estimator's correlation, this must stay below 1.0 */
+    return silk_LIMIT( silk_LSHIFT( sum_Q7, 8 ), 0, silk_int16_MAX );
+}
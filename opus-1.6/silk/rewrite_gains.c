@@ -0,0 +1,247 @@
+/***********************************************************************
+Copyright (c) 2006-2011, Skype Limited. All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "API.h"
+#include "main.h"
+#include "structs.h"
+
+/*****************************************************/
+/* Get size in bytes of the Silk gain rewriter state */
+/*****************************************************/
+opus_int silk_Get_Gain_Rewriter_Size(                   /* O    Returns error code                              */
+    opus_int                        *rewSizeBytes       /* O    Number of bytes in SILK gain rewriter state     */
+)
+{
+    *rewSizeBytes = sizeof( silk_gain_rewriter );
+
+    return SILK_NO_ERROR;
+}
+
+/*********************************/
+/* Init and Reset gain rewriter  */
+/*********************************/
+opus_int silk_InitGainRewriter(                         /* O    Returns error code                              */
+    void                            *rewState           /* I/O  State                                           */
+)
+{
+    opus_int ret;
+    silk_gain_rewriter *psRew = (silk_gain_rewriter *)rewState;
+
+    silk_memset( &psRew->sEnc, 0, sizeof( psRew->sEnc ) );
+    ret = silk_init_decoder( &psRew->sDec );
+    ret += silk_ResetGainRewriter( rewState, 10, 10 );
+
+    return ret;
+}
+
+opus_int silk_ResetGainRewriter(                        /* O    Returns error code                              */
+    void                            *rewState,          /* I/O  State                                           */
+    opus_int                        prevGainIndexIn,    /* I    Last gain index of the input stream             */
+    opus_int                        prevGainIndexOut    /* I    Last gain index of the output stream            */
+)
+{
+    silk_gain_rewriter *psRew = (silk_gain_rewriter *)rewState;
+
+    psRew->prevGainIndexIn  = (opus_int8)prevGainIndexIn;
+    psRew->prevGainIndexOut = (opus_int8)prevGainIndexOut;
+
+    return SILK_NO_ERROR;
+}
+
+/* Copies one frame's parameters from the input to the output payload, offsetting its gains */
+static opus_int silk_rewrite_frame(
+    silk_gain_rewriter              *psRew,             /* I/O  State                                           */
+    ec_dec                          *psRangeDec,        /* I/O  Input payload                                   */
+    ec_enc                          *psRangeEnc,        /* I/O  Output payload                                  */
+    opus_int8                       *prevGainIndexIn,   /* I/O  Last gain index of the input stream             */
+    opus_int8                       *prevGainIndexOut,  /* I/O  Last gain index of the output stream            */
+    opus_int                        gainSteps,          /* I    Gain offset in quantization steps               */
+    opus_int                        FrameIndex,         /* I    Frame number                                    */
+    opus_int                        LBRR,               /* I    Flag indicating LBRR data is being copied       */
+    opus_int                        condCoding          /* I    The type of conditional coding to use           */
+)
+{
+    opus_int   i;
+    opus_int16 pulses_dec[ MAX_FRAME_LENGTH ];
+    opus_int8  pulses[ MAX_FRAME_LENGTH ];
+    silk_decoder_state *psDec = &psRew->sDec;
+    silk_encoder_state *psEnc = &psRew->sEnc;
+    SideInfoIndices    *psIndices = LBRR ? &psEnc->indices_LBRR[ FrameIndex ] : &psEnc->indices;
+
+    /* The encoder follows the decoder's conditional coding state */
+    psEnc->ec_prevSignalType = psDec->ec_prevSignalType;
+    psEnc->ec_prevLagIndex   = psDec->ec_prevLagIndex;
+
+    silk_decode_indices( psDec, psRangeDec, FrameIndex, LBRR, condCoding );
+    silk_decode_pulses( psRangeDec, pulses_dec, psDec->indices.signalType,
+        psDec->indices.quantOffsetType, psDec->frame_length );
+
+    /* The encoder keeps its pulses in 8 bits, which any payload it produced fits in */
+    for( i = 0; i < psDec->frame_length; i++ ) {
+        if( pulses_dec[ i ] > silk_int8_MAX || pulses_dec[ i ] < silk_int8_MIN ) {
+            return SILK_DEC_PAYLOAD_ERROR;
+        }
+        pulses[ i ] = (opus_int8)pulses_dec[ i ];
+    }
+
+    *psIndices = psDec->indices;
+    silk_gains_offset( psIndices->GainsIndices, prevGainIndexIn, prevGainIndexOut, gainSteps,
+        condCoding == CODE_CONDITIONALLY, psDec->nb_subfr );
+
+    silk_encode_indices( psEnc, psRangeEnc, FrameIndex, LBRR, condCoding );
+    silk_encode_pulses( psRangeEnc, psIndices->signalType, psIndices->quantOffsetType, pulses, psDec->frame_length );
+
+    return SILK_NO_ERROR;
+}
+
+/*************************************************************/
+/* Offset the gains of a mono payload without decoding it    */
+/*************************************************************/
+opus_int silk_RewriteGains(                             /* O    Returns error code                              */
+    void                            *rewState,          /* I/O  State                                           */
+    const silk_DecControlStruct     *decControl,        /* I    Payload size and internal sampling rate         */
+    opus_int                        gain_Q8,            /* I    Gain offset in dB (Q8)                          */
+    ec_dec                          *psRangeDec,        /* I/O  Input payload                                   */
+    ec_enc                          *psRangeEnc         /* I/O  Output payload                                  */
+)
+{
+    opus_int   i, fs_kHz, condCoding, flags, nBits, gainSteps, ret = SILK_NO_ERROR;
+    opus_int32 LBRR_symbol, steps_num, steps_den;
+    opus_int8  LBRRprevGainIndexIn, LBRRprevGainIndexOut;
+    opus_uint8 iCDF[ 2 ] = { 0, 0 };
+    silk_gain_rewriter *psRew = (silk_gain_rewriter *)rewState;
+    silk_decoder_state *psDec = &psRew->sDec;
+    silk_encoder_state *psEnc = &psRew->sEnc;
+
+    if( decControl->nChannelsInternal != 1 ) {
+        return SILK_DEC_PAYLOAD_ERROR;
+    }
+
+    if( decControl->payloadSize_ms == 10 ) {
+        psDec->nFramesPerPacket = 1;
+        psDec->nb_subfr = 2;
+    } else if( decControl->payloadSize_ms == 20 ) {
+        psDec->nFramesPerPacket = 1;
+        psDec->nb_subfr = 4;
+    } else if( decControl->payloadSize_ms == 40 ) {
+        psDec->nFramesPerPacket = 2;
+        psDec->nb_subfr = 4;
+    } else if( decControl->payloadSize_ms == 60 ) {
+        psDec->nFramesPerPacket = 3;
+        psDec->nb_subfr = 4;
+    } else {
+        return SILK_DEC_INVALID_FRAME_SIZE;
+    }
+    fs_kHz = ( decControl->internalSampleRate >> 10 ) + 1;
+    if( fs_kHz != 8 && fs_kHz != 12 && fs_kHz != 16 ) {
+        return SILK_DEC_INVALID_SAMPLING_FREQUENCY;
+    }
+
+    /* Round the gain offset to quantization steps; the quantizer counts 6 dB per octave */
+    steps_num = silk_MUL( silk_abs( gain_Q8 ), 6 * ( N_LEVELS_QGAIN - 1 ) );
+    steps_den = silk_SMULBB( SILK_FIX_CONST( 6.0206, 8 ), MAX_QGAIN_DB - MIN_QGAIN_DB );
+    gainSteps = silk_DIV32( steps_num + silk_RSHIFT( steps_den, 1 ), steps_den );
+    if( gain_Q8 < 0 ) {
+        gainSteps = -gainSteps;
+    }
+
+    /* A change of internal rate resets the gain history of the decoder */
+    if( fs_kHz != psDec->fs_kHz ) {
+        silk_ResetGainRewriter( rewState, 10, 10 );
+    }
+    ret += silk_decoder_set_fs( psDec, fs_kHz, silk_SMULBB( fs_kHz, 1000 ) );
+
+    psEnc->nb_subfr                = psDec->nb_subfr;
+    psEnc->fs_kHz                  = psDec->fs_kHz;
+    psEnc->predictLPCOrder         = psDec->LPC_order;
+    psEnc->psNLSF_CB               = psDec->psNLSF_CB;
+    psEnc->pitch_lag_low_bits_iCDF = psDec->pitch_lag_low_bits_iCDF;
+    psEnc->pitch_contour_iCDF      = psDec->pitch_contour_iCDF;
+
+    /* Decode VAD flags and LBRR flag */
+    for( i = 0; i < psDec->nFramesPerPacket; i++ ) {
+        psDec->VAD_flags[ i ] = ec_dec_bit_logp( psRangeDec, 1 );
+    }
+    psDec->LBRR_flag = ec_dec_bit_logp( psRangeDec, 1 );
+
+    /* Create space at start of payload for VAD and FEC flags, as the encoder does */
+    nBits = psDec->nFramesPerPacket + 1;
+    iCDF[ 0 ] = 256 - silk_RSHIFT( 256, nBits );
+    ec_enc_icdf( psRangeEnc, 0, iCDF, 8 );
+
+    /* Copy LBRR flags */
+    silk_memset( psDec->LBRR_flags, 0, sizeof( psDec->LBRR_flags ) );
+    if( psDec->LBRR_flag ) {
+        if( psDec->nFramesPerPacket == 1 ) {
+            psDec->LBRR_flags[ 0 ] = 1;
+        } else {
+            LBRR_symbol = ec_dec_icdf( psRangeDec, silk_LBRR_flags_iCDF_ptr[ psDec->nFramesPerPacket - 2 ], 8 ) + 1;
+            ec_enc_icdf( psRangeEnc, LBRR_symbol - 1, silk_LBRR_flags_iCDF_ptr[ psDec->nFramesPerPacket - 2 ], 8 );
+            for( i = 0; i < psDec->nFramesPerPacket; i++ ) {
+                psDec->LBRR_flags[ i ] = silk_RSHIFT( LBRR_symbol, i ) & 1;
+            }
+        }
+    }
+
+    /* Copy LBRR frames. Their first gain is decoded against whatever state the receiver has after
+       a loss, so it is kept as an absolute index */
+    LBRRprevGainIndexIn = LBRRprevGainIndexOut = 0;
+    for( i = 0; i < psDec->nFramesPerPacket && ret == SILK_NO_ERROR; i++ ) {
+        if( psDec->LBRR_flags[ i ] ) {
+            if( i > 0 && psDec->LBRR_flags[ i - 1 ] ) {
+                condCoding = CODE_CONDITIONALLY;
+            } else {
+                condCoding = CODE_INDEPENDENTLY;
+                LBRRprevGainIndexIn = LBRRprevGainIndexOut = 0;
+            }
+            ret = silk_rewrite_frame( psRew, psRangeDec, psRangeEnc, &LBRRprevGainIndexIn, &LBRRprevGainIndexOut,
+                gainSteps, i, 1, condCoding );
+        }
+    }
+
+    /* Copy regular frames */
+    for( i = 0; i < psDec->nFramesPerPacket && ret == SILK_NO_ERROR; i++ ) {
+        condCoding = i == 0 ? CODE_INDEPENDENTLY : CODE_CONDITIONALLY;
+        ret = silk_rewrite_frame( psRew, psRangeDec, psRangeEnc, &psRew->prevGainIndexIn, &psRew->prevGainIndexOut,
+            gainSteps, i, 0, condCoding );
+    }
+
+    /* Insert VAD and FEC flags at beginning of bitstream */
+    flags = 0;
+    for( i = 0; i < psDec->nFramesPerPacket; i++ ) {
+        flags = silk_LSHIFT( flags, 1 ) | psDec->VAD_flags[ i ];
+    }
+    flags = silk_LSHIFT( flags, 1 ) | psDec->LBRR_flag;
+    ec_enc_patch_initial_bits( psRangeEnc, flags, nBits );
+
+    return ret;
+}
@@ -144,6 +144,14 @@ typedef struct {
     opus_int8                    Seed;
 } SideInfoIndices;
 
+/* Side information of the frames of a decoded packet, for reuse by an encoder */
+typedef struct silk_param_hints {
+    opus_int                     nFrames;                           /* Number of frames with valid indices (0 if none)                  */
+    opus_int                     fs_kHz;                            /* Internal sampling frequency (kHz)                                */
+    opus_int                     nb_subfr;                          /* Number of 5 ms subframes in a frame                              */
+    SideInfoIndices              indices[ MAX_FRAMES_PER_PACKET ];
+} silk_param_hints;
+
 /********************************/
 /* Encoder state                */
 /********************************/
@@ -207,6 +215,7 @@ typedef struct {
 
     SideInfoIndices              indices;
     opus_int8                    pulses[ MAX_FRAME_LENGTH ];
+    const SideInfoIndices        *psHintIndices;                    /* Indices of a decoded frame to reuse instead of searching, or NULL */
 
     int                          arch;
 
@@ -357,6 +366,16 @@ typedef struct {
     opus_int                    LTP_scale_Q14;
 } silk_decoder_control;
 
+/************************/
+/* Gain rewriter state  */
+/************************/
+typedef struct {
+    silk_decoder_state          sDec;                               /* Parses the input payload                                         */
+    silk_encoder_state          sEnc;                               /* Codes the output payload                                         */
+    opus_int8                   prevGainIndexIn;                    /* Last gain index of the input stream                              */
+    opus_int8                   prevGainIndexOut;                   /* Last gain index of the output stream                             */
+} silk_gain_rewriter;
+
 
 #ifdef __cplusplus
 }
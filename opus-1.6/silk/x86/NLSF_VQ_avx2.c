@@ -0,0 +1,122 @@
+/***********************************************************************
+Copyright (c) 2026 The opuslib authors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "main.h"
+#include "celt/x86/x86cpu.h"
+
+/* Compute quantization errors for an LPC_order element input vector for a VQ codebook.
+   Each codebook vector is processed as (up to) 16 lanes; the predictive error term
+   for index m uses the weighted difference at m + 1, obtained with a lane rotation. */
+void silk_NLSF_VQ_avx2(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+)
+{
+    opus_int         i, m;
+    opus_int32       tmp_in[ 8 ], tmp_cb[ 8 ], tmp_w[ 8 ];
+    const opus_int16 *w_Q9_ptr;
+    const opus_uint8 *cb_Q8_ptr;
+    __m256i          in_lo, in_hi, rot1;
+
+    celt_assert( ( LPC_order & 1 ) == 0 );
+    celt_assert( LPC_order > 8 && LPC_order <= 16 );
+
+    in_lo = _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)(const void *)in_Q15 ) );
+    silk_memset( tmp_in, 0, sizeof( tmp_in ) );
+    for( m = 8; m < LPC_order; m++ ) {
+        tmp_in[ m - 8 ] = in_Q15[ m ];
+    }
+    in_hi = _mm256_loadu_si256( (const __m256i *)(const void *)tmp_in );
+    rot1 = _mm256_setr_epi32( 1, 2, 3, 4, 5, 6, 7, 0 );
+    silk_memset( tmp_cb, 0, sizeof( tmp_cb ) );
+    silk_memset( tmp_w, 0, sizeof( tmp_w ) );
+
+    /* Loop over codebook */
+    cb_Q8_ptr = pCB_Q8;
+    w_Q9_ptr = pWght_Q9;
+    for( i = 0; i < K; i++ ) {
+        __m256i cb_lo, cb_hi, w_lo, w_hi, diffw_lo, diffw_hi, next_lo, next_hi, err;
+        __m128i sum;
+
+        cb_lo = _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i *)(const void *)cb_Q8_ptr ) );
+        w_lo = _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)(const void *)w_Q9_ptr ) );
+        if( LPC_order == 16 ) {
+            cb_hi = _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i *)(const void *)&cb_Q8_ptr[ 8 ] ) );
+            w_hi = _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)(const void *)&w_Q9_ptr[ 8 ] ) );
+        } else {
+            for( m = 8; m < LPC_order; m++ ) {
+                tmp_cb[ m - 8 ] = cb_Q8_ptr[ m ];
+                tmp_w[ m - 8 ] = w_Q9_ptr[ m ];
+            }
+            cb_hi = _mm256_loadu_si256( (const __m256i *)(const void *)tmp_cb );
+            w_hi = _mm256_loadu_si256( (const __m256i *)(const void *)tmp_w );
+        }
+
+        /* Weighted differences, zero past LPC_order */
+        diffw_lo = _mm256_mullo_epi32( _mm256_sub_epi32( in_lo, _mm256_slli_epi32( cb_lo, 7 ) ), w_lo );
+        diffw_hi = _mm256_mullo_epi32( _mm256_sub_epi32( in_hi, _mm256_slli_epi32( cb_hi, 7 ) ), w_hi );
+
+        /* Prediction from index m + 1 */
+        next_lo = _mm256_permutevar8x32_epi32( diffw_lo, rot1 );
+        next_hi = _mm256_permutevar8x32_epi32( diffw_hi, rot1 );
+        next_lo = _mm256_blend_epi32( next_lo, next_hi, 0x80 );
+        next_hi = _mm256_blend_epi32( next_hi, _mm256_setzero_si256(), 0x80 );
+
+        /* Weighted absolute predictive quantization error */
+        err = _mm256_add_epi32(
+            _mm256_abs_epi32( _mm256_sub_epi32( diffw_lo, _mm256_srai_epi32( next_lo, 1 ) ) ),
+            _mm256_abs_epi32( _mm256_sub_epi32( diffw_hi, _mm256_srai_epi32( next_hi, 1 ) ) ) );
+        sum = _mm_add_epi32( _mm256_castsi256_si128( err ), _mm256_extracti128_si256( err, 1 ) );
+        sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        err_Q24[ i ] = _mm_cvtsi128_si32( sum );
+        silk_assert( err_Q24[ i ] >= 0 );
+
+        cb_Q8_ptr += LPC_order;
+        w_Q9_ptr += LPC_order;
+    }
+
+#ifdef OPUS_CHECK_ASM
+    {
+        opus_int32 err_Q24_c[ NLSF_VQ_MAX_VECTORS ];
+        celt_assert( K <= NLSF_VQ_MAX_VECTORS );
+        silk_NLSF_VQ_c( err_Q24_c, in_Q15, pCB_Q8, pWght_Q9, K, LPC_order );
+        for( i = 0; i < K; i++ ) {
+            silk_assert( err_Q24[ i ] == err_Q24_c[ i ] );
+        }
+    }
+#endif
+}
@@ -0,0 +1,246 @@
+/***********************************************************************
+Copyright (c) 2026 The opuslib authors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "main.h"
+#include <immintrin.h>
+#include "main.h"
+#include "celt/x86/x86cpu.h"
+
+/* silk_SMULBB() of each lane of x with a constant. The constant is kept in the low 16 bits
+   only, so that _mm256_madd_epi16() multiplies the (opus_int16) part of x and nothing else. */
+static OPUS_INLINE __m256i silk_smulbb_epi32( __m256i x, __m256i c16 )
+{
+    return _mm256_madd_epi16( x, c16 );
+}
+
+static OPUS_INLINE __m256i silk_set1_c16( opus_int32 c )
+{
+    return _mm256_set1_epi32( c & 0xFFFF );
+}
+
+/* Index of the first set lane of a comparison mask, which must not be empty. */
+static OPUS_INLINE opus_int silk_first_lane( __m128i mask )
+{
+    opus_int32 bits;
+    bits = _mm_movemask_ps( _mm_castsi128_ps( mask ) );
+    return 31 - silk_CLZ32( bits & -bits );
+}
+
+/* Delayed-decision quantizer for NLSF residuals.
+   The survivors are independent of each other, so they are evaluated together: lane j holds
+   the candidate ind_tmp of survivor j and lane j + NLSF_QUANT_DEL_DEC_STATES the candidate
+   ind_tmp + 1, which matches the RD_Q25[] and prev_out_Q10[] layout of the C version. Both
+   candidates are functions of t = ind_tmp or ind_tmp + 1 alone: the reconstruction level is
+   ( ( t << 10 ) - sign( t ) * NLSF_QUANT_LEVEL_ADJ ) * step and the rate is read from the
+   table for |t| < NLSF_QUANT_MAX_AMPLITUDE and linear beyond. The pruning of the survivors
+   swaps one survivor at a time, as in the C version, but finds the pair with vector min/max. */
+opus_int32 silk_NLSF_del_dec_quant_avx2(                        /* O    Returns RD value in Q25                     */
+    opus_int8                   indices[],                      /* O    Quantization indices [ order ]              */
+    const opus_int16            x_Q10[],                        /* I    Input [ order ]                             */
+    const opus_int16            w_Q5[],                         /* I    Weights [ order ]                           */
+    const opus_uint8            pred_coef_Q8[],                 /* I    Backward predictor coefs [ order ]          */
+    const opus_int16            ec_ix[],                        /* I    Indices to entropy coding tables [ order ]  */
+    const opus_uint8            ec_rates_Q5[],                  /* I    Rates []                                    */
+    const opus_int              quant_step_size_Q16,            /* I    Quantization step size                      */
+    const opus_int16            inv_quant_step_size_Q6,         /* I    Inverse quantization step size              */
+    const opus_int32            mu_Q20,                         /* I    R/D tradeoff                                */
+    const opus_int16            order                           /* I    Number of input values                      */
+)
+{
+    opus_int         i, j, nStates, ind_tmp, ind_min_max, ind_max_min;
+    opus_int32       min_Q25, min_max_Q25, max_min_Q25;
+    opus_int32       ind_sort[         NLSF_QUANT_DEL_DEC_STATES ];
+    opus_int8        ind[              NLSF_QUANT_DEL_DEC_STATES ][ MAX_LPC_ORDER ];
+    opus_int32       ind_tmp4[         NLSF_QUANT_DEL_DEC_STATES ];
+    opus_int32       prev_out_Q10[ 2 * NLSF_QUANT_DEL_DEC_STATES ];
+    opus_int32       RD_Q25[       2 * NLSF_QUANT_DEL_DEC_STATES ];
+    opus_int32       RD_min_Q25[       NLSF_QUANT_DEL_DEC_STATES ];
+    opus_int32       RD_max_Q25[       NLSF_QUANT_DEL_DEC_STATES ];
+    const opus_uint8 *rates_Q5;
+    __m256i          upper, step, inv_step, mu, adj, ind_lo, ind_hi;
+    __m256i          rate_lin0, rate_lin43, rate_bytes, rate_max_t;
+
+    silk_assert( NLSF_QUANT_DEL_DEC_STATES == 4 );
+
+    upper      = _mm256_setr_epi32( 0, 0, 0, 0, 1, 1, 1, 1 );
+    step       = silk_set1_c16( quant_step_size_Q16 );
+    inv_step   = silk_set1_c16( inv_quant_step_size_Q6 );
+    mu         = silk_set1_c16( mu_Q20 );
+    adj        = _mm256_set1_epi32( SILK_FIX_CONST( NLSF_QUANT_LEVEL_ADJ, 10 ) );
+    ind_lo     = _mm256_set1_epi32( -NLSF_QUANT_MAX_AMPLITUDE_EXT );
+    ind_hi     = _mm256_set1_epi32( NLSF_QUANT_MAX_AMPLITUDE_EXT - 1 );
+    rate_lin0  = _mm256_set1_epi32( 280 - 43 * NLSF_QUANT_MAX_AMPLITUDE );
+    rate_lin43 = _mm256_set1_epi32( 43 );
+    rate_bytes = _mm256_set1_epi32( (opus_int32)0x80808000 );
+    rate_max_t = _mm256_set1_epi32( NLSF_QUANT_MAX_AMPLITUDE - 1 );
+
+    silk_memset( RD_Q25, 0, sizeof( RD_Q25 ) );
+    silk_memset( prev_out_Q10, 0, sizeof( prev_out_Q10 ) );
+    nStates = 1;
+    for( i = order - 1; i >= 0; i-- ) {
+        __m256i in, prev, pred, res, t, abs_t, out, diff, rate, rate_tab, RD;
+        __m128i row;
+
+        rates_Q5 = &ec_rates_Q5[ ec_ix[ i ] ];
+        in = _mm256_set1_epi32( x_Q10[ i ] );
+
+        /* Candidate indices of each survivor, duplicated into both halves */
+        prev = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)(const void *)prev_out_Q10 ) );
+        pred = _mm256_srai_epi32( silk_smulbb_epi32( prev, silk_set1_c16( pred_coef_Q8[ i ] ) ), 8 );
+        res = _mm256_sub_epi32( in, pred );
+        t = _mm256_srai_epi32( silk_smulbb_epi32( res, inv_step ), 16 );
+        t = _mm256_min_epi32( _mm256_max_epi32( t, ind_lo ), ind_hi );
+        _mm_storeu_si128( (__m128i *)(void *)ind_tmp4, _mm256_castsi256_si128( t ) );
+        t = _mm256_add_epi32( t, upper );
+
+        /* Reconstruction levels. Like the opus_int16 values of the C version, they are only
+           meaningful in the low 16 bits, which is all the products below look at. */
+        out = _mm256_sub_epi32( _mm256_slli_epi32( t, 10 ), _mm256_sign_epi32( adj, t ) );
+        out = _mm256_add_epi32( _mm256_srai_epi32( silk_smulbb_epi32( out, step ), 16 ), pred );
+
+        /* Rates */
+        row = _mm_loadl_epi64( (const __m128i *)(const void *)rates_Q5 );
+        row = _mm_insert_epi8( row, rates_Q5[ 2 * NLSF_QUANT_MAX_AMPLITUDE ], 8 );
+        abs_t = _mm256_abs_epi32( t );
+        rate_tab = _mm256_shuffle_epi8( _mm256_broadcastsi128_si256( row ),
+            _mm256_or_si256( _mm256_and_si256( _mm256_add_epi32( t, _mm256_set1_epi32( NLSF_QUANT_MAX_AMPLITUDE ) ),
+                                               _mm256_set1_epi32( 0xFF ) ), rate_bytes ) );
+        rate = _mm256_add_epi32( rate_lin0, _mm256_mullo_epi32( rate_lin43, abs_t ) );
+        rate = _mm256_blendv_epi8( rate_tab, rate, _mm256_cmpgt_epi32( abs_t, rate_max_t ) );
+
+        /* RD for both candidates */
+        RD = _mm256_broadcastsi128_si256( _mm_loadu_si128( (const __m128i *)(const void *)RD_Q25 ) );
+        diff = _mm256_sub_epi32( in, out );
+        diff = _mm256_madd_epi16( diff, _mm256_and_si256( diff, _mm256_set1_epi32( 0xFFFF ) ) );
+        RD = _mm256_add_epi32( RD, _mm256_mullo_epi32( diff, _mm256_set1_epi32( w_Q5[ i ] ) ) );
+        RD = _mm256_add_epi32( RD, silk_smulbb_epi32( rate, mu ) );
+
+        for( j = 0; j < NLSF_QUANT_DEL_DEC_STATES; j++ ) {
+            ind[ j ][ i ] = (opus_int8)ind_tmp4[ j ];
+        }
+        if( nStates <= NLSF_QUANT_DEL_DEC_STATES/2 ) {
+            /* Pack the nStates survivors of each half next to each other */
+            __m256i perm;
+            perm = nStates == 1 ? _mm256_setr_epi32( 0, 4, 0, 0, 0, 0, 0, 0 )
+                                : _mm256_setr_epi32( 0, 1, 4, 5, 0, 0, 0, 0 );
+            _mm256_storeu_si256( (__m256i *)(void *)prev_out_Q10, _mm256_permutevar8x32_epi32( out, perm ) );
+            _mm256_storeu_si256( (__m256i *)(void *)RD_Q25, _mm256_permutevar8x32_epi32( RD, perm ) );
+
+            /* double number of states and copy */
+            for( j = 0; j < nStates; j++ ) {
+                ind[ j + nStates ][ i ] = ind[ j ][ i ] + 1;
+            }
+            nStates = silk_LSHIFT( nStates, 1 );
+            for( j = nStates; j < NLSF_QUANT_DEL_DEC_STATES; j++ ) {
+                ind[ j ][ i ] = ind[ j - nStates ][ i ];
+            }
+        } else {
+            /* sort lower and upper half of RD_Q25, pairwise */
+            __m128i RD0, RD1, out0, out1, swap;
+            RD0 = _mm256_castsi256_si128( RD );
+            RD1 = _mm256_extracti128_si256( RD, 1 );
+            out0 = _mm256_castsi256_si128( out );
+            out1 = _mm256_extracti128_si256( out, 1 );
+            swap = _mm_cmpgt_epi32( RD0, RD1 );
+            _mm_storeu_si128( (__m128i *)(void *)RD_min_Q25, _mm_min_epi32( RD0, RD1 ) );
+            _mm_storeu_si128( (__m128i *)(void *)RD_max_Q25, _mm_max_epi32( RD0, RD1 ) );
+            _mm_storeu_si128( (__m128i *)(void *)RD_Q25, _mm_min_epi32( RD0, RD1 ) );
+            _mm_storeu_si128( (__m128i *)(void *)&RD_Q25[ NLSF_QUANT_DEL_DEC_STATES ], _mm_max_epi32( RD0, RD1 ) );
+            _mm_storeu_si128( (__m128i *)(void *)prev_out_Q10, _mm_blendv_epi8( out0, out1, swap ) );
+            _mm_storeu_si128( (__m128i *)(void *)&prev_out_Q10[ NLSF_QUANT_DEL_DEC_STATES ], _mm_blendv_epi8( out1, out0, swap ) );
+            _mm_storeu_si128( (__m128i *)(void *)ind_sort, _mm_or_si128( _mm_setr_epi32( 0, 1, 2, 3 ),
+                _mm_and_si128( swap, _mm_set1_epi32( NLSF_QUANT_DEL_DEC_STATES ) ) ) );
+
+            /* compare the highest RD values of the winning half with the lowest one in the losing half, and copy if necessary */
+            /* afterwards ind_sort[] will contain the indices of the NLSF_QUANT_DEL_DEC_STATES winning RD values */
+            while( 1 ) {
+                __m128i RD_max, RD_min, m;
+                /* First minimum of RD_max_Q25[] and first maximum of RD_min_Q25[], as found by the
+                   scalar search of the C version */
+                RD_max = _mm_loadu_si128( (const __m128i *)(const void *)RD_max_Q25 );
+                RD_min = _mm_loadu_si128( (const __m128i *)(const void *)RD_min_Q25 );
+                m = _mm_min_epi32( RD_max, _mm_shuffle_epi32( RD_max, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+                m = _mm_min_epi32( m, _mm_shuffle_epi32( m, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+                min_max_Q25 = _mm_cvtsi128_si32( m );
+                ind_min_max = silk_first_lane( _mm_cmpeq_epi32( RD_max, m ) );
+                m = _mm_max_epi32( RD_min, _mm_shuffle_epi32( RD_min, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+                m = _mm_max_epi32( m, _mm_shuffle_epi32( m, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+                max_min_Q25 = silk_max_32( _mm_cvtsi128_si32( m ), 0 );
+                if( min_max_Q25 >= max_min_Q25 ) {
+                    break;
+                }
+                ind_max_min = max_min_Q25 > 0 ? silk_first_lane( _mm_cmpeq_epi32( RD_min, m ) ) : 0;
+                /* copy ind_min_max to ind_max_min */
+                ind_sort[     ind_max_min ] = ind_sort[     ind_min_max ] ^ NLSF_QUANT_DEL_DEC_STATES;
+                RD_Q25[       ind_max_min ] = RD_Q25[       ind_min_max + NLSF_QUANT_DEL_DEC_STATES ];
+                prev_out_Q10[ ind_max_min ] = prev_out_Q10[ ind_min_max + NLSF_QUANT_DEL_DEC_STATES ];
+                RD_min_Q25[   ind_max_min ] = 0;
+                RD_max_Q25[   ind_min_max ] = silk_int32_MAX;
+                silk_memcpy( ind[ ind_max_min ], ind[ ind_min_max ], MAX_LPC_ORDER * sizeof( opus_int8 ) );
+            }
+            /* increment index if it comes from the upper half */
+            for( j = 0; j < NLSF_QUANT_DEL_DEC_STATES; j++ ) {
+                ind[ j ][ i ] += silk_RSHIFT( ind_sort[ j ], NLSF_QUANT_DEL_DEC_STATES_LOG2 );
+            }
+        }
+    }
+
+    /* last sample: find winner, copy indices and return RD value */
+    ind_tmp = 0;
+    min_Q25 = silk_int32_MAX;
+    for( j = 0; j < 2 * NLSF_QUANT_DEL_DEC_STATES; j++ ) {
+        if( min_Q25 > RD_Q25[ j ] ) {
+            min_Q25 = RD_Q25[ j ];
+            ind_tmp = j;
+        }
+    }
+    for( j = 0; j < order; j++ ) {
+        indices[ j ] = ind[ ind_tmp & ( NLSF_QUANT_DEL_DEC_STATES - 1 ) ][ j ];
+        silk_assert( indices[ j ] >= -NLSF_QUANT_MAX_AMPLITUDE_EXT );
+        silk_assert( indices[ j ] <=  NLSF_QUANT_MAX_AMPLITUDE_EXT );
+    }
+    indices[ 0 ] += silk_RSHIFT( ind_tmp, NLSF_QUANT_DEL_DEC_STATES_LOG2 );
+    silk_assert( indices[ 0 ] <= NLSF_QUANT_MAX_AMPLITUDE_EXT );
+    silk_assert( min_Q25 >= 0 );
+
+#ifdef OPUS_CHECK_ASM
+    {
+        opus_int8  indices_c[ MAX_LPC_ORDER ];
+        opus_int32 min_Q25_c;
+        min_Q25_c = silk_NLSF_del_dec_quant_c( indices_c, x_Q10, w_Q5, pred_coef_Q8, ec_ix, ec_rates_Q5,
+            quant_step_size_Q16, inv_quant_step_size_Q6, mu_Q20, order );
+        silk_assert( min_Q25 == min_Q25_c );
+        silk_assert( !memcmp( indices, indices_c, order * sizeof( *indices ) ) );
+    }
+#endif
+    return min_Q25;
+}
@@ -0,0 +1,220 @@
+/***********************************************************************
+Copyright (c) 2026 The opuslib authors
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions
+are met:
+- Redistributions of source code must retain the above copyright notice,
+this list of conditions and the following disclaimer.
+- Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in the
+documentation and/or other materials provided with the distribution.
+- Neither the name of Internet Society, IETF or IETF Trust, nor the
+names of specific contributors, may be used to endorse or promote
+products derived from this software without specific prior written
+permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+#include "main.h"
+#include "celt/x86/x86cpu.h"
+
+/* pshufb masks extracting column j of eight consecutive 5-element codebook
+   rows from bytes [0,16), [16,32) and [32,40) of the block. */
+static const opus_int8 cb_column_shuffle[ LTP_ORDER ][ 3 ][ 16 ] = {
+    { {  0,  5, 10, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1,  4,  9, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1, -1, -1, -1,  3, -1, -1, -1, -1, -1, -1, -1, -1 } },
+    { {  1,  6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1,  0,  5, 10, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1, -1, -1, -1,  4, -1, -1, -1, -1, -1, -1, -1, -1 } },
+    { {  2,  7, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1,  1,  6, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1, -1, -1,  0,  5, -1, -1, -1, -1, -1, -1, -1, -1 } },
+    { {  3,  8, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1,  2,  7, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1, -1, -1,  1,  6, -1, -1, -1, -1, -1, -1, -1, -1 } },
+    { {  4,  9, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1,  3,  8, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+      { -1, -1, -1, -1, -1, -1,  2,  7, -1, -1, -1, -1, -1, -1, -1, -1 } }
+};
+
+/* silk_SMLAWB() on eight lanes, using the split form so that it stays in 32 bits */
+static OPUS_INLINE __m256i silk_SMLAWB_avx2( __m256i a32, __m256i b32, __m256i c16 )
+{
+    __m256i hi, lo;
+    hi = _mm256_mullo_epi32( _mm256_srai_epi32( b32, 16 ), c16 );
+    lo = _mm256_mullo_epi32( _mm256_and_si256( b32, _mm256_set1_epi32( 0x0000FFFF ) ), c16 );
+    return _mm256_add_epi32( a32, _mm256_add_epi32( hi, _mm256_srai_epi32( lo, 16 ) ) );
+}
+
+#define MLA( a, b, c ) _mm256_add_epi32( a, _mm256_mullo_epi32( b, c ) )
+
+/* Entropy constrained matrix-weighted VQ, hard-coded to 5-element vectors, for a single input data vector.
+   The residual energy is computed for eight codebook vectors at a time; the rate-distortion
+   decision is then made in codebook order exactly like the C version. */
+void silk_VQ_WMat_EC_avx2(
+    opus_int8                   *ind,                           /* O    index of best codebook vector               */
+    opus_int32                  *res_nrg_Q15,                   /* O    best residual energy                        */
+    opus_int32                  *rate_dist_Q8,                  /* O    best total bitrate                          */
+    opus_int                    *gain_Q7,                       /* O    sum of absolute LTP coefficients            */
+    const opus_int32            *XX_Q17,                        /* I    correlation matrix                          */
+    const opus_int32            *xX_Q17,                        /* I    correlation vector                          */
+    const opus_int8             *cb_Q7,                         /* I    codebook                                    */
+    const opus_uint8            *cb_gain_Q7,                    /* I    codebook effective gain                     */
+    const opus_uint8            *cl_Q5,                         /* I    code length for each codebook vector        */
+    const opus_int              subfr_len,                      /* I    number of samples per subframe              */
+    const opus_int32            max_gain_Q7,                    /* I    maximum sum of absolute LTP coefficients    */
+    const opus_int              L                               /* I    number of vectors in codebook               */
+)
+{
+    opus_int   i, j, k, n, gain_tmp_Q7;
+    opus_int32 sum1_Q15[ 8 ];
+    opus_int32 bits_res_Q8, bits_tot_Q8;
+    opus_int8  cb_tail_Q7[ 8 * LTP_ORDER ];
+    __m256i    v_XX[ 25 ], v_neg_xX_Q24[ LTP_ORDER ], v_cb[ LTP_ORDER ];
+    __m256i    v_sum1_Q15, v_sum2_Q24;
+
+    /* Negate and convert to new Q domain */
+    for( j = 0; j < LTP_ORDER; j++ ) {
+        v_neg_xX_Q24[ j ] = _mm256_set1_epi32( -silk_LSHIFT32( xX_Q17[ j ], 7 ) );
+    }
+    for( j = 0; j < LTP_ORDER * LTP_ORDER; j++ ) {
+        v_XX[ j ] = _mm256_set1_epi32( XX_Q17[ j ] );
+    }
+
+    /* Loop over codebook */
+    *rate_dist_Q8 = silk_int32_MAX;
+    *res_nrg_Q15 = silk_int32_MAX;
+    /* If things go really bad, at least *ind is set to something safe. */
+    *ind = 0;
+    for( k = 0; k < L; k += 8 ) {
+        const opus_int8 *cb_blk_Q7;
+        __m128i v_lo, v_mid, v_hi;
+
+        n = silk_min_int( 8, L - k );
+        cb_blk_Q7 = &cb_Q7[ k * LTP_ORDER ];
+        if( n < 8 ) {
+            /* Pad the last block with zero vectors, their results are ignored */
+            silk_memset( cb_tail_Q7, 0, sizeof( cb_tail_Q7 ) );
+            silk_memcpy( cb_tail_Q7, cb_blk_Q7, n * LTP_ORDER * sizeof( opus_int8 ) );
+            cb_blk_Q7 = cb_tail_Q7;
+        }
+
+        /* Transpose 8 rows of the codebook into one vector per column */
+        v_lo  = _mm_loadu_si128( (const __m128i *)(const void *)&cb_blk_Q7[ 0 ] );
+        v_mid = _mm_loadu_si128( (const __m128i *)(const void *)&cb_blk_Q7[ 16 ] );
+        v_hi  = _mm_loadl_epi64( (const __m128i *)(const void *)&cb_blk_Q7[ 32 ] );
+        for( j = 0; j < LTP_ORDER; j++ ) {
+            __m128i v_col;
+            v_col = _mm_shuffle_epi8( v_lo, _mm_loadu_si128( (const __m128i *)(const void *)cb_column_shuffle[ j ][ 0 ] ) );
+            v_col = _mm_or_si128( v_col, _mm_shuffle_epi8( v_mid, _mm_loadu_si128( (const __m128i *)(const void *)cb_column_shuffle[ j ][ 1 ] ) ) );
+            v_col = _mm_or_si128( v_col, _mm_shuffle_epi8( v_hi, _mm_loadu_si128( (const __m128i *)(const void *)cb_column_shuffle[ j ][ 2 ] ) ) );
+            v_cb[ j ] = _mm256_cvtepi8_epi32( v_col );
+        }
+
+        /* Weighted rate */
+        /* Quantization error: 1 - 2 * xX * cb + cb' * XX * cb */
+        v_sum1_Q15 = _mm256_set1_epi32( SILK_FIX_CONST( 1.001, 15 ) );
+
+        /* first row of XX_Q17 */
+        v_sum2_Q24 = MLA( v_neg_xX_Q24[ 0 ], v_XX[  1 ], v_cb[ 1 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  2 ], v_cb[ 2 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  3 ], v_cb[ 3 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  4 ], v_cb[ 4 ] );
+        v_sum2_Q24 = _mm256_slli_epi32( v_sum2_Q24, 1 );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  0 ], v_cb[ 0 ] );
+        v_sum1_Q15 = silk_SMLAWB_avx2( v_sum1_Q15, v_sum2_Q24, v_cb[ 0 ] );
+
+        /* second row of XX_Q17 */
+        v_sum2_Q24 = MLA( v_neg_xX_Q24[ 1 ], v_XX[  7 ], v_cb[ 2 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  8 ], v_cb[ 3 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  9 ], v_cb[ 4 ] );
+        v_sum2_Q24 = _mm256_slli_epi32( v_sum2_Q24, 1 );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[  6 ], v_cb[ 1 ] );
+        v_sum1_Q15 = silk_SMLAWB_avx2( v_sum1_Q15, v_sum2_Q24, v_cb[ 1 ] );
+
+        /* third row of XX_Q17 */
+        v_sum2_Q24 = MLA( v_neg_xX_Q24[ 2 ], v_XX[ 13 ], v_cb[ 3 ] );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[ 14 ], v_cb[ 4 ] );
+        v_sum2_Q24 = _mm256_slli_epi32( v_sum2_Q24, 1 );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[ 12 ], v_cb[ 2 ] );
+        v_sum1_Q15 = silk_SMLAWB_avx2( v_sum1_Q15, v_sum2_Q24, v_cb[ 2 ] );
+
+        /* fourth row of XX_Q17 */
+        v_sum2_Q24 = MLA( v_neg_xX_Q24[ 3 ], v_XX[ 19 ], v_cb[ 4 ] );
+        v_sum2_Q24 = _mm256_slli_epi32( v_sum2_Q24, 1 );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[ 18 ], v_cb[ 3 ] );
+        v_sum1_Q15 = silk_SMLAWB_avx2( v_sum1_Q15, v_sum2_Q24, v_cb[ 3 ] );
+
+        /* last row of XX_Q17 */
+        v_sum2_Q24 = _mm256_slli_epi32( v_neg_xX_Q24[ 4 ], 1 );
+        v_sum2_Q24 = MLA( v_sum2_Q24,        v_XX[ 24 ], v_cb[ 4 ] );
+        v_sum1_Q15 = silk_SMLAWB_avx2( v_sum1_Q15, v_sum2_Q24, v_cb[ 4 ] );
+
+        _mm256_storeu_si256( (__m256i *)(void *)sum1_Q15, v_sum1_Q15 );
+
+        /* find best, in codebook order so that ties resolve like the C version */
+        for( i = 0; i < n; i++ ) {
+            opus_int32 penalty;
+            if( sum1_Q15[ i ] >= 0 ) {
+                gain_tmp_Q7 = cb_gain_Q7[ k + i ];
+                /* Penalty for too large gain */
+                penalty = silk_LSHIFT32( silk_max( silk_SUB32( gain_tmp_Q7, max_gain_Q7 ), 0 ), 11 );
+                /* Translate residual energy to bits using high-rate assumption (6 dB ==> 1 bit/sample) */
+                bits_res_Q8 = silk_SMULBB( subfr_len, silk_lin2log( sum1_Q15[ i ] + penalty) - (15 << 7) );
+                /* In the following line we reduce the codelength component by half ("-1"); seems to slightly improve quality */
+                bits_tot_Q8 = silk_ADD_LSHIFT32( bits_res_Q8, cl_Q5[ k + i ], 3-1 );
+                if( bits_tot_Q8 <= *rate_dist_Q8 ) {
+                    *rate_dist_Q8 = bits_tot_Q8;
+                    *res_nrg_Q15 = sum1_Q15[ i ] + penalty;
+                    *ind = (opus_int8)( k + i );
+                    *gain_Q7 = gain_tmp_Q7;
+                }
+            }
+        }
+    }
+
+#ifdef OPUS_CHECK_ASM
+    {
+        opus_int8  ind_c = 0;
+        opus_int32 res_nrg_Q15_c = 0;
+        opus_int32 rate_dist_Q8_c = 0;
+        opus_int   gain_Q7_c = 0;
+
+        silk_VQ_WMat_EC_c(
+            &ind_c,
+            &res_nrg_Q15_c,
+            &rate_dist_Q8_c,
+            &gain_Q7_c,
+            XX_Q17,
+            xX_Q17,
+            cb_Q7,
+            cb_gain_Q7,
+            cl_Q5,
+            subfr_len,
+            max_gain_Q7,
+            L
+        );
+
+        silk_assert( *ind == ind_c );
+        silk_assert( *res_nrg_Q15 == res_nrg_Q15_c );
+        silk_assert( *rate_dist_Q8 == rate_dist_Q8_c );
+        silk_assert( *gain_Q7 == gain_Q7_c );
+    }
+#endif
+}
@@ -53,7 +53,8 @@ opus_int64 (*const SILK_INNER_PROD16_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_inner_prod16_c,
   silk_inner_prod16_c,
   MAY_HAVE_SSE4_1( silk_inner_prod16 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_inner_prod16 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_inner_prod16 )  /* avx512 */
 };
 
 #endif
@@ -66,7 +67,8 @@ opus_int (*const SILK_VAD_GETSA_Q8_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VAD_GetSA_Q8_c,
   silk_VAD_GetSA_Q8_c,
   MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 ), /* avx */
+  MAY_HAVE_SSE4_1( silk_VAD_GetSA_Q8 )  /* avx512 */
 };
 
 void (*const SILK_NSQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
@@ -90,9 +92,17 @@ void (*const SILK_NSQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_NSQ_c,
   silk_NSQ_c,
   MAY_HAVE_SSE4_1( silk_NSQ ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ ), /* avx */
+  MAY_HAVE_SSE4_1( silk_NSQ )  /* avx512 */
 };
 
+/* Without the AVX2 kernel, AVX-capable CPUs still get the SSE4.1 one. */
+#if defined(OPUS_X86_MAY_HAVE_AVX2)
+# define MAY_HAVE_AVX2_OR_SSE4_1(name) name ## _avx2
+#else
+# define MAY_HAVE_AVX2_OR_SSE4_1(name) MAY_HAVE_SSE4_1(name)
+#endif
+
 void (*const SILK_VQ_WMAT_EC_IMPL[ OPUS_ARCHMASK + 1 ] )(
     opus_int8                   *ind,                           /* O    index of best codebook vector               */
     opus_int32                  *res_nrg_Q15,                   /* O    best residual energy                        */
@@ -111,7 +121,44 @@ void (*const SILK_VQ_WMAT_EC_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_VQ_WMat_EC_c,
   silk_VQ_WMat_EC_c,
   MAY_HAVE_SSE4_1( silk_VQ_WMat_EC ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_VQ_WMat_EC )  /* avx */
+  MAY_HAVE_AVX2_OR_SSE4_1( silk_VQ_WMat_EC ), /* avx */
+  MAY_HAVE_AVX2_OR_SSE4_1( silk_VQ_WMat_EC )  /* avx512 */
+};
+
+void (*const SILK_NLSF_VQ_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int32                  err_Q24[],                      /* O    Quantization errors [K]                     */
+    const opus_int16            in_Q15[],                       /* I    Input vectors to be quantized [LPC_order]   */
+    const opus_uint8            pCB_Q8[],                       /* I    Codebook vectors [K*LPC_order]              */
+    const opus_int16            pWght_Q9[],                     /* I    Codebook weights [K*LPC_order]              */
+    const opus_int              K,                              /* I    Number of codebook vectors                  */
+    const opus_int              LPC_order                       /* I    Number of LPCs                              */
+) = {
+  silk_NLSF_VQ_c,                  /* non-sse */
+  silk_NLSF_VQ_c,
+  silk_NLSF_VQ_c,
+  silk_NLSF_VQ_c, /* sse4.1 */
+  MAY_HAVE_AVX2( silk_NLSF_VQ ), /* avx */
+  MAY_HAVE_AVX2( silk_NLSF_VQ )  /* avx512 */
+};
+
+opus_int32 (*const SILK_NLSF_DEL_DEC_QUANT_IMPL[ OPUS_ARCHMASK + 1 ] )(
+    opus_int8                   indices[],                      /* O    Quantization indices [ order ]              */
+    const opus_int16            x_Q10[],                        /* I    Input [ order ]                             */
+    const opus_int16            w_Q5[],                         /* I    Weights [ order ]                           */
+    const opus_uint8            pred_coef_Q8[],                 /* I    Backward predictor coefs [ order ]          */
+    const opus_int16            ec_ix[],                        /* I    Indices to entropy coding tables [ order ]  */
+    const opus_uint8            ec_rates_Q5[],                  /* I    Rates []                                    */
+    const opus_int              quant_step_size_Q16,            /* I    Quantization step size                      */
+    const opus_int16            inv_quant_step_size_Q6,         /* I    Inverse quantization step size              */
+    const opus_int32            mu_Q20,                         /* I    R/D tradeoff                                */
+    const opus_int16            order                           /* I    Number of input values                      */
+) = {
+  silk_NLSF_del_dec_quant_c,                  /* non-sse */
+  silk_NLSF_del_dec_quant_c,
+  silk_NLSF_del_dec_quant_c,
+  silk_NLSF_del_dec_quant_c, /* sse4.1 */
+  MAY_HAVE_AVX2( silk_NLSF_del_dec_quant ), /* avx */
+  MAY_HAVE_AVX2( silk_NLSF_del_dec_quant )  /* avx512 */
 };
 
 void (*const SILK_NSQ_DEL_DEC_IMPL[ OPUS_ARCHMASK + 1 ] )(
@@ -135,7 +182,8 @@ void (*const SILK_NSQ_DEL_DEC_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_NSQ_del_dec_c,
   silk_NSQ_del_dec_c,
   MAY_HAVE_SSE4_1( silk_NSQ_del_dec ), /* sse4.1 */
-  MAY_HAVE_AVX2( silk_NSQ_del_dec )  /* avx */
+  MAY_HAVE_AVX2( silk_NSQ_del_dec ), /* avx */
+  MAY_HAVE_AVX2( silk_NSQ_del_dec )  /* avx512 */
 };
 
 #if defined(FIXED_POINT)
@@ -155,12 +203,17 @@ void (*const SILK_BURG_MODIFIED_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_burg_modified_c,
   silk_burg_modified_c,
   MAY_HAVE_SSE4_1( silk_burg_modified ), /* sse4.1 */
-  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx */
+  MAY_HAVE_SSE4_1( silk_burg_modified ), /* avx */
+  MAY_HAVE_SSE4_1( silk_burg_modified )  /* avx512 */
 };
 
 #endif
 
-#ifndef FIXED_POINT
+#endif
+
+/* This one also dispatches when AVX2 is presumed, to pick up the AVX-512 kernel. */
+#if defined(OPUS_HAVE_RTCD) && !defined(FIXED_POINT) && !defined(OPUS_X86_PRESUME_AVX512) && \
+    (!defined(OPUS_X86_PRESUME_AVX2) || defined(OPUS_X86_MAY_HAVE_AVX512))
 
 double (*const SILK_INNER_PRODUCT_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
     const silk_float    *data1,
@@ -171,9 +224,8 @@ double (*const SILK_INNER_PRODUCT_FLP_IMPL[ OPUS_ARCHMASK + 1 ] )(
   silk_inner_product_FLP_c,
   silk_inner_product_FLP_c,
   silk_inner_product_FLP_c, /* sse4.1 */
-  MAY_HAVE_AVX2( silk_inner_product_FLP )  /* avx */
+  MAY_HAVE_AVX2( silk_inner_product_FLP ), /* avx */
+  MAY_HAVE_AVX512( silk_inner_product_FLP )  /* avx512 */
 };
 
 #endif
-
-#endif
@@ -13,6 +13,7 @@ silk/enc_API.c \
 silk/encode_indices.c \
 silk/encode_pulses.c \
 silk/gain_quant.c \
+silk/rewrite_gains.c \
 silk/interpolate.c \
 silk/LP_variable_cutoff.c \
 silk/NLSF_decode.c \
@@ -50,6 +51,7 @@ silk/bwexpander_32.c \
 silk/bwexpander.c \
 silk/debug.c \
 silk/decode_pitch.c \
+silk/reuse_pitch_lags.c \
 silk/inner_prod_aligned.c \
 silk/lin2log.c \
 silk/log2lin.c \
@@ -87,7 +89,10 @@ silk/x86/VAD_sse4_1.c \
 silk/x86/VQ_WMat_EC_sse4_1.c
 
 SILK_SOURCES_AVX2 =  \
-silk/x86/NSQ_del_dec_avx2.c
+silk/x86/NSQ_del_dec_avx2.c \
+silk/x86/NLSF_VQ_avx2.c \
+silk/x86/NLSF_del_dec_quant_avx2.c \
+silk/x86/VQ_WMat_EC_avx2.c
 
 SILK_SOURCES_ARM_RTCD = \
 silk/arm/arm_silk_map.c
@@ -161,4 +166,7 @@ silk/float/schur_FLP.c \
 silk/float/sort_FLP.c
 
 SILK_SOURCES_FLOAT_AVX2 = \
-silk/float/x86/inner_product_FLP_avx2.c
\ No newline at end of file
+silk/float/x86/inner_product_FLP_avx2.c
+
+SILK_SOURCES_FLOAT_AVX512 = \
+silk/float/x86/inner_product_FLP_avx512.c
\ No newline at end of file
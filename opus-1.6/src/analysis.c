@@ -54,6 +54,10 @@
 
 #define TRANSITION_PENALTY 10
 
+/* Energy rise from one analysis frame to the next (natural log, i.e. ~10 dB)
+   treated as an onset by tonality_select_frame_size(). */
+#define ONSET_THRESHOLD 2.3f
+
 static const float dct_table[128] = {
         0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f,
         0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f, 0.250000f,
@@ -469,6 +473,7 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
     float frame_probs[2];
     float alpha, alphaE, alphaE2;
     float frame_loudness;
+    float frame_E=0, prev_frame_E=0;
     float bandwidth_mask;
     int is_masked[NB_TBANDS+1];
     int bandwidth=0;
@@ -553,6 +558,7 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
        if (prev_pos < 0)
           prev_pos += DETECT_SIZE;
        OPUS_COPY(info, &tonal->info[prev_pos], 1);
+       info->energy_rise = 0;
        RESTORE_STACK;
        return;
     }
@@ -668,6 +674,8 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
 #endif
 
        tonal->E[tonal->E_count][b] = E;
+       frame_E += E;
+       prev_frame_E += tonal->E[(tonal->E_count+NB_FRAMES-1)%NB_FRAMES][b];
        frame_noisiness += nE/(1e-15f+E);
 
        frame_loudness += (float)sqrt(E+1e-10f);
@@ -888,6 +896,7 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
 
     slope /= 8*8;
     info->tonality_slope = slope;
+    info->energy_rise = tonal->count ? MAX32(0, (float)log((frame_E+1e-10f)/(prev_frame_E+1e-10f))) : 0;
 
     tonal->E_count = (tonal->E_count+1)%NB_FRAMES;
     tonal->count = IMIN(tonal->count+1, ANALYSIS_COUNT_MAX);
@@ -951,6 +960,39 @@ static void tonality_analysis(TonalityAnalysisState *tonal, const CELTMode *celt
     RESTORE_STACK;
 }
 
+int tonality_select_frame_size(TonalityAnalysisState *tonal, int max_frame_size)
+{
+   int i;
+   int pos;
+   int nb_frames;
+   const AnalysisInfo *first;
+   nb_frames = max_frame_size/(tonal->Fs/50);
+   pos = tonal->read_pos;
+   if (pos == tonal->write_pos || !tonal->info[pos].valid)
+      return tonal->Fs/50;
+   first = &tonal->info[pos];
+   /* Extend the packet one 20 ms frame at a time until we run out of
+      look-ahead or the next frame starts something new: an onset, a change
+      in voice activity or a change between speech and music. Those frames
+      are better off starting a new packet, where the mode and bandwidth can
+      change without waiting for the end of a long one. */
+   for (i=1;i<nb_frames;i++)
+   {
+      const AnalysisInfo *info;
+      pos++;
+      if (pos==DETECT_SIZE)
+         pos = 0;
+      if (pos == tonal->write_pos)
+         break;
+      info = &tonal->info[pos];
+      if (!info->valid || info->energy_rise > ONSET_THRESHOLD
+            || ABS16(info->activity_probability - first->activity_probability) > .5f
+            || ABS16(info->music_prob - first->music_prob) > .5f)
+         break;
+   }
+   return i*(tonal->Fs/50);
+}
+
 void run_analysis(TonalityAnalysisState *analysis, const CELTMode *celt_mode, const void *analysis_pcm,
                  int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
                  int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info)
@@ -96,6 +96,10 @@ void tonality_analysis_reset(TonalityAnalysisState *analysis);
 
 void tonality_get_info(TonalityAnalysisState *tonal, AnalysisInfo *info_out, int len);
 
+/* Returns the longest multiple of 20 ms, up to max_frame_size, that the
+   analyzed look-ahead shows to be steady enough for a single packet. */
+int tonality_select_frame_size(TonalityAnalysisState *tonal, int max_frame_size);
+
 void run_analysis(TonalityAnalysisState *analysis, const CELTMode *celt_mode, const void *analysis_pcm,
                  int analysis_frame_size, int frame_size, int c1, int c2, int C, opus_int32 Fs,
                  int lsb_depth, downmix_func downmix, AnalysisInfo *analysis_info);
@@ -0,0 +1,608 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Encodes or decodes many files in parallel, for archive migration and
+   batch ingestion. The files use the same formats as opus_demo -e/-d. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "opus.h"
+
+#define MAX_PACKET 1500
+#define MAX_FRAME_SIZE (6*960)
+#define MAX_THREADS 256
+/* Files are read and written in large blocks so that concurrent workers
+   keep the disk busy with few system calls. */
+#define IO_BLOCK (4<<20)
+/* IPv4 + UDP + RTP headers, counted in the transport bitrate */
+#define TRANSPORT_OVERHEAD 40
+
+typedef struct {
+    const char *in;
+    const char *out;
+} Job;
+
+/* Each worker owns a contiguous range of the jobs. It takes jobs from the
+   front of its range and, once that is empty, steals from the back of the
+   others' ranges. */
+typedef struct {
+    pthread_mutex_t lock;
+    int head;
+    int tail;
+} JobQueue;
+
+typedef struct {
+    int decode;
+    int application;
+    opus_int32 Fs;
+    int channels;
+    opus_int32 bitrate;
+    int complexity;
+    int frame_size;
+    int adaptive;
+    int cbr;
+    int nb_threads;
+    Job *jobs;
+    JobQueue *queues;
+} BulkConfig;
+
+typedef struct {
+    const BulkConfig *cfg;
+    int id;
+    pthread_t thread;
+    OpusEncoder *enc;
+    OpusDecoder *dec;
+    unsigned char *in_buf;
+    size_t in_size;
+    unsigned char *out_buf;
+    size_t out_size;
+    size_t out_len;
+    int nb_files;
+    int nb_failed;
+    double audio_seconds;
+    long nb_packets;
+    double nb_bytes;
+} Worker;
+
+static void print_usage(char* argv[])
+{
+    fprintf(stderr, "Usage: %s -e <application> <sampling rate (Hz)> <channels (1/2)> "
+        "<bits per second> [options] <manifest>\n", argv[0]);
+    fprintf(stderr, "       %s -d <sampling rate (Hz)> <channels (1/2)> [options] <manifest>\n\n", argv[0]);
+    fprintf(stderr, "application: voip | audio | restricted-lowdelay\n" );
+    fprintf(stderr, "manifest: one job per line, \"<input> <output>\"; empty lines and lines starting with # are skipped\n" );
+    fprintf(stderr, "options:\n" );
+    fprintf(stderr, "-threads <n>         : number of worker threads; default: number of online CPUs\n" );
+    fprintf(stderr, "-cbr                 : enable constant bitrate; default: variable bitrate\n" );
+    fprintf(stderr, "-complexity <comp>   : encoder complexity, 0 (lowest) ... 10 (highest); default: 10\n" );
+    fprintf(stderr, "-framesize <10|20|40|60|adaptive> : frame size in ms; default: 20\n" );
+    fprintf(stderr, "                     adaptive: 20, 40 or 60 ms picked by the encoder\n" );
+}
+
+static void int_to_char(opus_uint32 i, unsigned char ch[4])
+{
+    ch[0] = i>>24;
+    ch[1] = (i>>16)&0xFF;
+    ch[2] = (i>>8)&0xFF;
+    ch[3] = i&0xFF;
+}
+
+static opus_uint32 char_to_int(const unsigned char ch[4])
+{
+    return ((opus_uint32)ch[0]<<24) | ((opus_uint32)ch[1]<<16)
+         | ((opus_uint32)ch[2]<< 8) |  (opus_uint32)ch[3];
+}
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+static int grow(unsigned char **buf, size_t *size, size_t needed)
+{
+    unsigned char *p;
+    size_t new_size;
+    if (needed <= *size)
+        return 0;
+    new_size = *size ? *size : IO_BLOCK;
+    while (new_size < needed)
+        new_size *= 2;
+    p = realloc(*buf, new_size);
+    if (p == NULL)
+        return -1;
+    *buf = p;
+    *size = new_size;
+    return 0;
+}
+
+/* Reads a whole file into the worker's input buffer. */
+static long read_file(Worker *w, const char *name)
+{
+    int fd;
+    struct stat st;
+    size_t pos = 0;
+    fd = open(name, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0 || grow(&w->in_buf, &w->in_size, st.st_size+1) != 0)
+    {
+        fprintf(stderr, "cannot read %s: %s\n", name, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    while (pos < (size_t)st.st_size)
+    {
+        size_t count = st.st_size-pos < IO_BLOCK ? st.st_size-pos : IO_BLOCK;
+        ssize_t ret = pread(fd, w->in_buf+pos, count, pos);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+        {
+            fprintf(stderr, "cannot read %s: %s\n", name, ret < 0 ? strerror(errno) : "short read");
+            close(fd);
+            return -1;
+        }
+        pos += ret;
+    }
+    close(fd);
+    return (long)pos;
+}
+
+static int write_file(Worker *w, const char *name)
+{
+    int fd;
+    size_t pos = 0;
+    fd = open(name, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "cannot write %s: %s\n", name, strerror(errno));
+        return -1;
+    }
+    while (pos < w->out_len)
+    {
+        size_t count = w->out_len-pos < IO_BLOCK ? w->out_len-pos : IO_BLOCK;
+        ssize_t ret = pwrite(fd, w->out_buf+pos, count, pos);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+        {
+            fprintf(stderr, "cannot write %s: %s\n", name, ret < 0 ? strerror(errno) : "short write");
+            close(fd);
+            return -1;
+        }
+        pos += ret;
+    }
+    return close(fd);
+}
+
+/* Encodes 16-bit little-endian PCM into the opus_demo bit-stream format. */
+static int encode_file(Worker *w, long len)
+{
+    const BulkConfig *cfg = w->cfg;
+    opus_int16 pcm[MAX_FRAME_SIZE*2];
+    long nb_samples, pos;
+    int i, min_frame_size;
+    nb_samples = len/(2*cfg->channels);
+    /* In adaptive mode, packets can be as short as 20 ms */
+    min_frame_size = cfg->adaptive ? cfg->Fs/50 : cfg->frame_size;
+    if (grow(&w->out_buf, &w->out_size, (nb_samples/min_frame_size+1)*(8+MAX_PACKET)) != 0)
+        return -1;
+    w->out_len = 0;
+    opus_encoder_ctl(w->enc, OPUS_RESET_STATE);
+    for (pos=0;pos<nb_samples;)
+    {
+        int nb, ret;
+        opus_uint32 rng;
+        unsigned char *out = w->out_buf+w->out_len;
+        const unsigned char *in = w->in_buf+2*cfg->channels*pos;
+        nb = cfg->channels*(nb_samples-pos < cfg->frame_size ? nb_samples-pos : cfg->frame_size);
+        for (i=0;i<nb;i++)
+            pcm[i] = (opus_int16)(in[2*i] | in[2*i+1]<<8);
+        /* The last frame is padded with silence */
+        for (;i<cfg->channels*cfg->frame_size;i++)
+            pcm[i] = 0;
+        ret = opus_encode(w->enc, pcm, cfg->frame_size, out+8, MAX_PACKET);
+        if (ret < 0)
+        {
+            fprintf(stderr, "opus_encode() returned %d\n", ret);
+            return -1;
+        }
+        opus_encoder_ctl(w->enc, OPUS_GET_FINAL_RANGE(&rng));
+        int_to_char(ret, out);
+        int_to_char(rng, out+4);
+        w->out_len += 8+ret;
+        w->nb_packets++;
+        w->nb_bytes += ret;
+        /* In adaptive mode, the rest of the look-ahead gets sent again */
+        pos += cfg->adaptive ? opus_packet_get_nb_samples(out+8, ret, cfg->Fs) : cfg->frame_size;
+    }
+    w->audio_seconds += (double)nb_samples/cfg->Fs;
+    return 0;
+}
+
+/* Decodes the opus_demo bit-stream format into 16-bit little-endian PCM. */
+static int decode_file(Worker *w, long len)
+{
+    const BulkConfig *cfg = w->cfg;
+    opus_int16 pcm[MAX_FRAME_SIZE*2];
+    long pos = 0;
+    int last_frame_size = cfg->Fs/50;
+    long nb_samples = 0;
+    w->out_len = 0;
+    opus_decoder_ctl(w->dec, OPUS_RESET_STATE);
+    while (pos+8 <= len)
+    {
+        const unsigned char *packet;
+        opus_uint32 packet_len, enc_rng, dec_rng;
+        int ret, i;
+        packet_len = char_to_int(w->in_buf+pos);
+        enc_rng = char_to_int(w->in_buf+pos+4);
+        packet = w->in_buf+pos+8;
+        if (packet_len > MAX_PACKET || pos+8+packet_len > (opus_uint32)len)
+        {
+            fprintf(stderr, "invalid packet length %u\n", (unsigned)packet_len);
+            return -1;
+        }
+        pos += 8+packet_len;
+        /* Empty packets mark losses, which are concealed */
+        ret = opus_decode(w->dec, packet_len ? packet : NULL, packet_len, pcm,
+              packet_len ? MAX_FRAME_SIZE : last_frame_size, 0);
+        if (ret < 0)
+        {
+            fprintf(stderr, "opus_decode() returned %d\n", ret);
+            return -1;
+        }
+        last_frame_size = ret;
+        opus_decoder_ctl(w->dec, OPUS_GET_FINAL_RANGE(&dec_rng));
+        if (packet_len && enc_rng != 0 && enc_rng != dec_rng)
+        {
+            fprintf(stderr, "range coder state mismatch between encoder and decoder\n");
+            return -1;
+        }
+        if (grow(&w->out_buf, &w->out_size, w->out_len+2*cfg->channels*ret) != 0)
+            return -1;
+        for (i=0;i<ret*cfg->channels;i++)
+        {
+            w->out_buf[w->out_len++] = pcm[i]&0xFF;
+            w->out_buf[w->out_len++] = (pcm[i]>>8)&0xFF;
+        }
+        nb_samples += ret;
+    }
+    w->audio_seconds += (double)nb_samples/cfg->Fs;
+    return 0;
+}
+
+static int take_job(Worker *w)
+{
+    const BulkConfig *cfg = w->cfg;
+    int i, job = -1;
+    JobQueue *q = &cfg->queues[w->id];
+    pthread_mutex_lock(&q->lock);
+    if (q->head < q->tail)
+        job = q->head++;
+    pthread_mutex_unlock(&q->lock);
+    for (i=1;job<0 && i<cfg->nb_threads;i++)
+    {
+        q = &cfg->queues[(w->id+i)%cfg->nb_threads];
+        pthread_mutex_lock(&q->lock);
+        if (q->head < q->tail)
+            job = --q->tail;
+        pthread_mutex_unlock(&q->lock);
+    }
+    return job;
+}
+
+static void *worker_main(void *arg)
+{
+    Worker *w = (Worker*)arg;
+    int job;
+    while ((job = take_job(w)) >= 0)
+    {
+        const Job *j = &w->cfg->jobs[job];
+        long len;
+        int ret;
+        len = read_file(w, j->in);
+        ret = len < 0 ? -1 : w->cfg->decode ? decode_file(w, len) : encode_file(w, len);
+        if (ret == 0)
+            ret = write_file(w, j->out);
+        if (ret != 0)
+        {
+            fprintf(stderr, "failed: %s\n", j->in);
+            w->nb_failed++;
+        }
+        w->nb_files++;
+    }
+    return NULL;
+}
+
+/* Reads the manifest, splitting it in place into input/output pairs. */
+static int parse_manifest(char *text, Job **jobs)
+{
+    int nb_jobs = 0, capacity = 0;
+    char *line, *next;
+    *jobs = NULL;
+    for (line=text;line && *line;line=next)
+    {
+        char *in, *out, *end;
+        next = strchr(line, '\n');
+        if (next) *next++ = 0;
+        in = line + strspn(line, " \t\r");
+        if (*in == 0 || *in == '#')
+            continue;
+        end = in + strcspn(in, " \t\r");
+        out = end + strspn(end, " \t\r");
+        if (*end == 0 || *out == 0)
+        {
+            fprintf(stderr, "invalid manifest line: %s\n", in);
+            return -1;
+        }
+        *end = 0;
+        out[strcspn(out, " \t\r")] = 0;
+        if (nb_jobs == capacity)
+        {
+            Job *p;
+            capacity = capacity ? 2*capacity : 1024;
+            p = realloc(*jobs, capacity*sizeof(**jobs));
+            if (p == NULL)
+                return -1;
+            *jobs = p;
+        }
+        (*jobs)[nb_jobs].in = in;
+        (*jobs)[nb_jobs].out = out;
+        nb_jobs++;
+    }
+    return nb_jobs;
+}
+
+int main(int argc, char *argv[])
+{
+    BulkConfig cfg;
+    Worker *workers = NULL;
+    Worker manifest_reader;
+    char *manifest = NULL;
+    long manifest_len;
+    int nb_jobs, args, i, err, nb_started;
+    int nb_files = 0, nb_failed = 0;
+    long nb_packets = 0;
+    double audio_seconds = 0, nb_bytes = 0, start, elapsed;
+    int ret = EXIT_FAILURE;
+
+    memset(&cfg, 0, sizeof(cfg));
+    memset(&manifest_reader, 0, sizeof(manifest_reader));
+    if (argc < 5)
+    {
+        print_usage(argv);
+        return EXIT_FAILURE;
+    }
+    args = 1;
+    if (strcmp(argv[args], "-d") == 0)
+        cfg.decode = 1;
+    else if (strcmp(argv[args], "-e") != 0)
+    {
+        print_usage(argv);
+        return EXIT_FAILURE;
+    }
+    args++;
+    if (!cfg.decode)
+    {
+        if (argc < 7)
+        {
+            print_usage(argv);
+            return EXIT_FAILURE;
+        }
+        if (strcmp(argv[args], "voip") == 0)
+            cfg.application = OPUS_APPLICATION_VOIP;
+        else if (strcmp(argv[args], "restricted-lowdelay") == 0)
+            cfg.application = OPUS_APPLICATION_RESTRICTED_LOWDELAY;
+        else if (strcmp(argv[args], "audio") == 0)
+            cfg.application = OPUS_APPLICATION_AUDIO;
+        else
+        {
+            fprintf(stderr, "unknown application: %s\n", argv[args]);
+            print_usage(argv);
+            return EXIT_FAILURE;
+        }
+        args++;
+    }
+    cfg.Fs = (opus_int32)atol(argv[args++]);
+    cfg.channels = atoi(argv[args++]);
+    if (!cfg.decode)
+        cfg.bitrate = (opus_int32)atol(argv[args++]);
+    if (cfg.Fs != 8000 && cfg.Fs != 12000 && cfg.Fs != 16000 && cfg.Fs != 24000 && cfg.Fs != 48000)
+    {
+        fprintf(stderr, "Supported sampling rates are 8000, 12000, 16000, 24000 and 48000.\n");
+        return EXIT_FAILURE;
+    }
+    if (cfg.channels < 1 || cfg.channels > 2)
+    {
+        fprintf(stderr, "Opus_bulk supports only 1 or 2 channels.\n");
+        return EXIT_FAILURE;
+    }
+    cfg.complexity = 10;
+    cfg.frame_size = cfg.Fs/50;
+    cfg.nb_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    while (args < argc-1)
+    {
+        if (strcmp(argv[args], "-threads") == 0 && args+1 < argc-1)
+        {
+            cfg.nb_threads = atoi(argv[args+1]);
+            args += 2;
+        } else if (strcmp(argv[args], "-cbr") == 0 && !cfg.decode) {
+            cfg.cbr = 1;
+            args++;
+        } else if (strcmp(argv[args], "-complexity") == 0 && !cfg.decode && args+1 < argc-1) {
+            cfg.complexity = atoi(argv[args+1]);
+            args += 2;
+        } else if (strcmp(argv[args], "-framesize") == 0 && !cfg.decode && args+1 < argc-1
+                   && strcmp(argv[args+1], "adaptive") == 0) {
+            cfg.adaptive = 1;
+            cfg.frame_size = 3*cfg.Fs/50;
+            args += 2;
+        } else if (strcmp(argv[args], "-framesize") == 0 && !cfg.decode && args+1 < argc-1) {
+            int ms = atoi(argv[args+1]);
+            if (ms != 10 && ms != 20 && ms != 40 && ms != 60)
+            {
+                fprintf(stderr, "Unsupported frame size: %s ms. Supported are 10, 20, 40, 60.\n", argv[args+1]);
+                return EXIT_FAILURE;
+            }
+            cfg.frame_size = cfg.Fs/1000*ms;
+            args += 2;
+        } else {
+            fprintf(stderr, "Error: unrecognized setting: %s\n\n", argv[args]);
+            print_usage(argv);
+            return EXIT_FAILURE;
+        }
+    }
+    if (cfg.nb_threads < 1)
+        cfg.nb_threads = 1;
+    if (cfg.nb_threads > MAX_THREADS)
+        cfg.nb_threads = MAX_THREADS;
+
+    manifest_len = read_file(&manifest_reader, argv[argc-1]);
+    if (manifest_len < 0)
+        return EXIT_FAILURE;
+    manifest = (char*)manifest_reader.in_buf;
+    manifest[manifest_len] = 0;
+    nb_jobs = parse_manifest(manifest, &cfg.jobs);
+    if (nb_jobs < 0)
+        goto failure;
+    if (cfg.nb_threads > nb_jobs)
+        cfg.nb_threads = nb_jobs > 0 ? nb_jobs : 1;
+    fprintf(stderr, "%s\n", opus_get_version_string());
+    fprintf(stderr, "%s %d files with %d threads\n", cfg.decode ? "Decoding" : "Encoding", nb_jobs, cfg.nb_threads);
+
+    cfg.queues = calloc(cfg.nb_threads, sizeof(*cfg.queues));
+    workers = calloc(cfg.nb_threads, sizeof(*workers));
+    if (cfg.queues == NULL || workers == NULL)
+    {
+        free(cfg.queues);
+        free(workers);
+        cfg.queues = NULL;
+        workers = NULL;
+        goto failure;
+    }
+    for (i=0;i<cfg.nb_threads;i++)
+    {
+        pthread_mutex_init(&cfg.queues[i].lock, NULL);
+        cfg.queues[i].head = (int)((long)nb_jobs*i/cfg.nb_threads);
+        cfg.queues[i].tail = (int)((long)nb_jobs*(i+1)/cfg.nb_threads);
+    }
+    for (i=0;i<cfg.nb_threads;i++)
+    {
+        Worker *w = &workers[i];
+        w->cfg = &cfg;
+        w->id = i;
+        /* One codec instance per worker, reset between files */
+        if (cfg.decode)
+        {
+            w->dec = opus_decoder_create(cfg.Fs, cfg.channels, &err);
+        } else {
+            w->enc = opus_encoder_create(cfg.Fs, cfg.channels, cfg.application, &err);
+            if (w->enc)
+            {
+                opus_encoder_ctl(w->enc, OPUS_SET_BITRATE(cfg.bitrate));
+                opus_encoder_ctl(w->enc, OPUS_SET_VBR(!cfg.cbr));
+                opus_encoder_ctl(w->enc, OPUS_SET_COMPLEXITY(cfg.complexity));
+                opus_encoder_ctl(w->enc, OPUS_SET_LSB_DEPTH(16));
+                if (cfg.adaptive)
+                    opus_encoder_ctl(w->enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE));
+            }
+        }
+        if (err != OPUS_OK)
+        {
+            fprintf(stderr, "Cannot create %s: %s\n", cfg.decode ? "decoder" : "encoder", opus_strerror(err));
+            goto failure;
+        }
+    }
+
+    start = now_seconds();
+    for (nb_started=0;nb_started<cfg.nb_threads;nb_started++)
+    {
+        if (pthread_create(&workers[nb_started].thread, NULL, worker_main, &workers[nb_started]) != 0)
+        {
+            /* The jobs of the missing workers get stolen by the others */
+            fprintf(stderr, "Cannot create thread %d\n", nb_started);
+            break;
+        }
+    }
+    if (nb_started == 0)
+        worker_main(&workers[0]);
+    for (i=0;i<nb_started;i++)
+        pthread_join(workers[i].thread, NULL);
+    elapsed = now_seconds() - start;
+
+    for (i=0;i<cfg.nb_threads;i++)
+    {
+        nb_files += workers[i].nb_files;
+        nb_failed += workers[i].nb_failed;
+        audio_seconds += workers[i].audio_seconds;
+        nb_packets += workers[i].nb_packets;
+        nb_bytes += workers[i].nb_bytes;
+    }
+    fprintf(stderr, "%d files (%d failed), %.1f s of audio in %.3f s: %.1f files/s, %.1fx realtime\n",
+            nb_files, nb_failed, audio_seconds, elapsed, nb_files/(elapsed+1e-9), audio_seconds/(elapsed+1e-9));
+    if (!cfg.decode && audio_seconds > 0)
+    {
+        fprintf(stderr, "%ld packets: %.1f packets/s, %.2f kb/s payload, %.2f kb/s with %d-byte IP/UDP/RTP headers\n",
+                nb_packets, nb_packets/audio_seconds, 8e-3*nb_bytes/audio_seconds,
+                8e-3*(nb_bytes+(double)TRANSPORT_OVERHEAD*nb_packets)/audio_seconds, TRANSPORT_OVERHEAD);
+    }
+    if (nb_failed == 0 && nb_files == nb_jobs)
+        ret = EXIT_SUCCESS;
+failure:
+    if (workers)
+    {
+        for (i=0;i<cfg.nb_threads;i++)
+        {
+            opus_encoder_destroy(workers[i].enc);
+            opus_decoder_destroy(workers[i].dec);
+            free(workers[i].in_buf);
+            free(workers[i].out_buf);
+            pthread_mutex_destroy(&cfg.queues[i].lock);
+        }
+    }
+    free(workers);
+    free(cfg.queues);
+    free(cfg.jobs);
+    free(manifest_reader.in_buf);
+    return ret;
+}
@@ -0,0 +1,100 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus_clones.h"
+
+#if defined(OPUS_X86_CLONES) && !defined(OPUS_CLONE)
+
+#include "x86/x86cpu.h"
+
+#ifdef NONTHREADSAFE_PSEUDOSTACK
+#error "The x86 clones require VAR_ARRAYS or USE_ALLOCA"
+#endif
+
+/* Each clone's copies of the entry points are renamed with its level as a
+   suffix when it is linked in; everything else in it is made local. */
+#define OPUS_CLONE_DECL(ret, name, suffix, params) ret name ## suffix params;
+#define OPUS_CLONE_ENTRY(ret, name, suffix, params) name ## suffix,
+
+#ifdef OPUS_X86_CLONE_V2
+OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_DECL, _x86_64_v2)
+static const OpusCloneTable clone_v2 = {
+  "x86-64-v2",
+  OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_ENTRY, _x86_64_v2)
+};
+#endif
+
+#ifdef OPUS_X86_CLONE_V3
+OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_DECL, _x86_64_v3)
+static const OpusCloneTable clone_v3 = {
+  "x86-64-v3",
+  OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_ENTRY, _x86_64_v3)
+};
+#endif
+
+#ifdef OPUS_X86_CLONE_V4
+OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_DECL, _x86_64_v4)
+static const OpusCloneTable clone_v4 = {
+  "x86-64-v4",
+  OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_ENTRY, _x86_64_v4)
+};
+#endif
+
+const OpusCloneTable *opus_clone = NULL;
+static int clone_selected = 0;
+
+const OpusCloneTable *opus_clone_table(int level)
+{
+  switch (level) {
+#ifdef OPUS_X86_CLONE_V2
+  case 2: return &clone_v2;
+#endif
+#ifdef OPUS_X86_CLONE_V3
+  case 3: return &clone_v3;
+#endif
+#ifdef OPUS_X86_CLONE_V4
+  case 4: return &clone_v4;
+#endif
+  default: return NULL;
+  }
+}
+
+void opus_clone_init(void)
+{
+  int level;
+  /* Concurrent first calls all store the same table. */
+  if (clone_selected) return;
+  /* Fall back to the highest clone that was built and the host can run. */
+  for (level=opus_select_x86_level();level>1 && opus_clone_table(level)==NULL;level--) {}
+  opus_clone = opus_clone_table(level);
+  clone_selected = 1;
+}
+
+#endif
@@ -0,0 +1,88 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef OPUS_CLONES_H
+#define OPUS_CLONES_H
+
+/* With OPUS_X86_CLONES, the whole codec is built again for each of the
+   x86-64-v2/v3/v4 microarchitecture levels, so that the compiler can
+   vectorize all of it and not just the RTCD kernels. The entry points below,
+   which every encode and decode call goes through, switch to the best clone
+   the host supports. The clones share the state layout, the SIMD kernels and
+   the model data with the baseline build. As a clone is only picked on hosts
+   that have the SIMD levels it was built for, it calls the kernels for those
+   directly instead of through the RTCD tables, so picking the clone is the
+   only dispatch left on its encode and decode paths. OPUS_CLONE is defined
+   when compiling a clone. */
+
+#include "opus_private.h"
+
+#define OPUS_CLONE_ENTRY_POINTS(X, suffix) \
+  X(opus_int32, opus_encode_native, suffix, (OpusEncoder *st, const opus_res *pcm, int frame_size, \
+        unsigned char *data, opus_int32 out_data_bytes, int lsb_depth, const void *analysis_pcm, \
+        opus_int32 analysis_size, int c1, int c2, int analysis_channels, downmix_func downmix, int float_api)) \
+  X(int, opus_decode_native, suffix, (OpusDecoder *st, const unsigned char *data, opus_int32 len, \
+        opus_res *pcm, int frame_size, int decode_fec, int self_delimited, opus_int32 *packet_offset, \
+        int soft_clip, const OpusDRED *dred, opus_int32 dred_offset)) \
+  X(int, opus_multistream_encode_native, suffix, (struct OpusMSEncoder *st, \
+        opus_copy_channel_in_func copy_channel_in, const void *pcm, int analysis_frame_size, \
+        unsigned char *data, opus_int32 max_data_bytes, int lsb_depth, downmix_func downmix, \
+        int float_api, void *user_data)) \
+  X(int, opus_multistream_decode_native, suffix, (struct OpusMSDecoder *st, const unsigned char *data, \
+        opus_int32 len, void *pcm, opus_copy_channel_out_func copy_channel_out, int frame_size, \
+        int decode_fec, int soft_clip, void *user_data)) \
+  X(int, opus_dred_process, suffix, (OpusDREDDecoder *dred_dec, const OpusDRED *src, OpusDRED *dst))
+
+#if defined(OPUS_X86_CLONES) && !defined(OPUS_CLONE)
+
+#define OPUS_CLONE_FIELD(ret, name, suffix, params) ret (*name) params;
+
+typedef struct {
+  const char *name;
+  OPUS_CLONE_ENTRY_POINTS(OPUS_CLONE_FIELD, _)
+} OpusCloneTable;
+
+/* The clone in use, or NULL for the baseline build. It is picked by the
+   first encoder or decoder init and never changes afterwards. */
+extern const OpusCloneTable *opus_clone;
+
+void opus_clone_init(void);
+
+/* Returns the clone for an x86-64 level, or NULL if it wasn't built. */
+const OpusCloneTable *opus_clone_table(int level);
+
+#define OPUS_CLONE_INIT() opus_clone_init()
+#define OPUS_CLONE_DISPATCH(name, args) \
+  do { if (opus_clone != NULL) return opus_clone->name args; } while (0)
+
+#else
+
+#define OPUS_CLONE_INIT() do {} while (0)
+#define OPUS_CLONE_DISPATCH(name, args) do {} while (0)
+
+#endif
+
+#endif /* OPUS_CLONES_H */
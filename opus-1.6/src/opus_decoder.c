@@ -47,6 +47,7 @@
 #include "stack_alloc.h"
 #include "float_cast.h"
 #include "opus_private.h"
+#include "opus_clones.h"
 #include "os_support.h"
 #include "structs.h"
 #include "define.h"
@@ -71,6 +72,7 @@ struct OpusDecoder {
    int          decode_gain;
    int          complexity;
    int          ignore_extensions;
+   int          shadow_decode;
    int          arch;
 #ifdef ENABLE_DEEP_PLC
     LPCNetPLCState lpcnet;
@@ -86,6 +88,7 @@ struct OpusDecoder {
    int          frame_size;
    int          prev_redundancy;
    int          last_packet_duration;
+   int          shadow_fade_in;
 #ifndef FIXED_POINT
    opus_val16   softclip_mem[2];
 #endif
@@ -180,6 +183,7 @@ int opus_decoder_init(OpusDecoder *st, opus_int32 Fs, int channels)
     lpcnet_plc_init( &st->lpcnet);
 #endif
    st->arch = opus_select_arch();
+   OPUS_CLONE_INIT();
    return OPUS_OK;
 }
 
@@ -440,13 +444,14 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
         }
      }
      st->DecControl.enable_deep_plc = st->complexity >= 5;
+     st->DecControl.shadow_decode = st->shadow_decode;
 #ifdef ENABLE_OSCE
      st->DecControl.osce_method = OSCE_METHOD_NONE;
 #ifndef DISABLE_LACE
-     if (st->complexity >= 6) {st->DecControl.osce_method = OSCE_METHOD_LACE;}
+     if (st->complexity >= 6 && !st->shadow_decode) {st->DecControl.osce_method = OSCE_METHOD_LACE;}
 #endif
 #ifndef DISABLE_NOLACE
-     if (st->complexity >= 7) {st->DecControl.osce_method = OSCE_METHOD_NOLACE;}
+     if (st->complexity >= 7 && !st->shadow_decode) {st->DecControl.osce_method = OSCE_METHOD_NOLACE;}
 #endif
 #ifdef ENABLE_OSCE_BWE
      if (st->complexity >= 4 && st->DecControl.enable_osce_bwe &&
@@ -490,7 +495,7 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
         pcm_ptr += silk_frame_size * st->channels;
         decoded_samples += silk_frame_size;
       } while( decoded_samples < frame_size );
-     if (pcm_too_small) {
+     if (pcm_too_small && !st->shadow_decode) {
         OPUS_COPY(pcm, pcm_silk, frame_size*st->channels);
      }
    }
@@ -640,13 +645,15 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
 
       celt_decode_with_ec(celt_dec, data+len, redundancy_bytes, redundant_audio, F5, NULL, 0);
       MUST_SUCCEED(celt_decoder_ctl(celt_dec, OPUS_GET_FINAL_RANGE(&redundant_rng)));
-      smooth_fade(pcm+st->channels*(frame_size-F2_5), redundant_audio+st->channels*F2_5,
-                  pcm+st->channels*(frame_size-F2_5), F2_5, st->channels, window, st->Fs);
+      if (!st->shadow_decode)
+         smooth_fade(pcm+st->channels*(frame_size-F2_5), redundant_audio+st->channels*F2_5,
+                     pcm+st->channels*(frame_size-F2_5), F2_5, st->channels, window, st->Fs);
    }
    /* 5ms redundant frame for CELT->SILK; ignore if the previous frame did not
       use CELT (the first redundancy frame in a transition from SILK may have
       been lost) */
-   if (redundancy && celt_to_silk && (st->prev_mode != MODE_SILK_ONLY || st->prev_redundancy))
+   if (redundancy && celt_to_silk && (st->prev_mode != MODE_SILK_ONLY || st->prev_redundancy)
+    && !st->shadow_decode)
    {
       for (c=0;c<st->channels;c++)
       {
@@ -656,7 +663,7 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
       smooth_fade(redundant_audio+st->channels*F2_5, pcm+st->channels*F2_5,
                   pcm+st->channels*F2_5, F2_5, st->channels, window, st->Fs);
    }
-   if (transition)
+   if (transition && !st->shadow_decode)
    {
       if (audiosize >= F5)
       {
@@ -677,7 +684,21 @@ static int opus_decode_frame(OpusDecoder *st, const unsigned char *data,
       }
    }
 
-   if(st->decode_gain)
+   if (st->shadow_decode)
+   {
+      /* Nothing was synthesized, so the output is just silence */
+      OPUS_CLEAR(pcm, audiosize*st->channels);
+   } else if (st->shadow_fade_in)
+   {
+      /* Fade in the first frame after leaving shadow mode */
+      VARDECL(opus_res, silence_pcm);
+      ALLOC(silence_pcm, F2_5*st->channels, opus_res);
+      OPUS_CLEAR(silence_pcm, F2_5*st->channels);
+      smooth_fade(silence_pcm, pcm, pcm, F2_5, st->channels, window, st->Fs);
+      st->shadow_fade_in = 0;
+   }
+
+   if(st->decode_gain && !st->shadow_decode)
    {
       opus_val32 gain;
       gain = celt_exp2(MULT16_16_P15(QCONST16(6.48814081e-4f, 25), st->decode_gain));
@@ -725,6 +746,8 @@ int opus_decode_native(OpusDecoder *st, const unsigned char *data,
    const unsigned char *padding;
    opus_int32 padding_len;
    OpusExtensionIterator iter;
+   OPUS_CLONE_DISPATCH(opus_decode_native, (st, data, len, pcm, frame_size, decode_fec,
+         self_delimited, packet_offset, soft_clip, dred, dred_offset));
    VALIDATE_OPUS_DECODER(st);
    if (decode_fec<0 || decode_fec>1)
       return OPUS_BAD_ARG;
@@ -869,10 +892,15 @@ int opus_decode_native(OpusDecoder *st, const unsigned char *data,
    if (OPUS_CHECK_ARRAY(pcm, nb_samples*st->channels))
       OPUS_PRINT_INT(nb_samples);
 #ifndef FIXED_POINT
-   if (soft_clip)
-      opus_pcm_soft_clip_impl(pcm, nb_samples, st->channels, st->softclip_mem, st->arch);
-   else
-      st->softclip_mem[0]=st->softclip_mem[1]=0;
+   /* With SOFT_CLIP_DEFERRED, opus_decode() does it along with the conversion
+      to 16 bits. */
+   if (soft_clip != SOFT_CLIP_DEFERRED)
+   {
+      if (soft_clip && !st->shadow_decode)
+         opus_pcm_soft_clip_impl(pcm, nb_samples, st->channels, st->softclip_mem, st->arch);
+      else
+         st->softclip_mem[0]=st->softclip_mem[1]=0;
+   }
 #endif
    return nb_samples;
 }
@@ -881,6 +909,29 @@ int opus_decode_native(OpusDecoder *st, const unsigned char *data,
 #define OPTIONAL_CLIP 0
 #else
 #define OPTIONAL_CLIP 1
+
+/* Soft clipping of a decoded packet followed by the conversion to 16 bits.
+   Decoded audio is rarely outside [-1,1], so both are first done in a single
+   pass that assumes it isn't, and the soft clipping only runs if that turns
+   out to be wrong or if it is still going on from the previous packet. */
+static void opus_soft_clip_float2int16(OpusDecoder *st, float *in, opus_int16 *out, int N)
+{
+   int c;
+   int within1;
+   within1 = celt_float2int16_checkwithin1(in, out, N*st->channels, st->arch);
+   if (st->shadow_decode)
+   {
+      st->softclip_mem[0]=st->softclip_mem[1]=0;
+      return;
+   }
+   for (c=0;c<st->channels;c++)
+      within1 &= st->softclip_mem[c] == 0;
+   if (!within1)
+   {
+      opus_pcm_soft_clip_impl(in, N, st->channels, st->softclip_mem, st->arch);
+      celt_float2int16(in, out, N*st->channels, st->arch);
+   }
+}
 #endif
 
 #if defined(FIXED_POINT) && !defined(ENABLE_RES24)
@@ -898,6 +949,7 @@ int opus_decode(OpusDecoder *st, const unsigned char *data,
        VARDECL(opus_res, out);
        int ret;
        int nb_samples;
+       int soft_clip = OPTIONAL_CLIP;
        ALLOC_STACK;
 
        if(frame_size<=0)
@@ -912,11 +964,17 @@ int opus_decode(OpusDecoder *st, const unsigned char *data,
              frame_size = IMIN(frame_size, nb_samples);
           else
              return OPUS_INVALID_PACKET;
+# if !defined(FIXED_POINT)
+          /* Packet decodes defer the soft clipping to the conversion below.
+             PLC and FEC still get soft clipped inside opus_decode_native()
+             through OPTIONAL_CLIP. */
+          soft_clip = SOFT_CLIP_DEFERRED;
+# endif
        }
        celt_assert(st->channels == 1 || st->channels == 2);
        ALLOC(out, frame_size*st->channels, opus_res);
 
-       ret = opus_decode_native(st, data, len, out, frame_size, decode_fec, 0, NULL, OPTIONAL_CLIP, NULL, 0);
+       ret = opus_decode_native(st, data, len, out, frame_size, decode_fec, 0, NULL, soft_clip, NULL, 0);
        if (ret > 0)
        {
 # if defined(FIXED_POINT)
@@ -924,7 +982,10 @@ int opus_decode(OpusDecoder *st, const unsigned char *data,
           for (i=0;i<ret*st->channels;i++)
              pcm[i] = RES2INT16(out[i]);
 # else
-          celt_float2int16(out, pcm, ret*st->channels, st->arch);
+          if (soft_clip == SOFT_CLIP_DEFERRED)
+             opus_soft_clip_float2int16(st, out, pcm, ret);
+          else
+             celt_float2int16(out, pcm, ret*st->channels, st->arch);
 # endif
        }
        RESTORE_STACK;
@@ -1105,6 +1166,46 @@ int opus_decoder_ctl(OpusDecoder *st, int request, ...)
       *value = st->rangeFinal;
    }
    break;
+   case OPUS_SET_SHADOW_DECODE_REQUEST:
+   {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value<0 || value>1)
+      {
+         goto bad_arg;
+      }
+      if (st->shadow_decode && !value)
+         st->shadow_fade_in = 1;
+      st->shadow_decode = value;
+      celt_decoder_ctl(celt_dec, CELT_SET_SHADOW_DECODE(value));
+   }
+   break;
+   case OPUS_GET_SHADOW_DECODE_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->shadow_decode;
+   }
+   break;
+   case OPUS_SET_PARAM_HINTS_REQUEST:
+   {
+      OpusParamHints *value = va_arg(ap, OpusParamHints*);
+      st->DecControl.paramHints = value ? value->silk : NULL;
+      celt_decoder_ctl(celt_dec, CELT_SET_PARAM_HINTS(value ? value->celt : NULL));
+   }
+   break;
+   case OPUS_GET_SILK_LAST_GAIN_INDEX_REQUEST:
+   {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      if (!value)
+      {
+         goto bad_arg;
+      }
+      *value = st->DecControl.lastGainIndex;
+   }
+   break;
    case OPUS_RESET_STATE:
    {
       OPUS_CLEAR((char*)&st->OPUS_DECODER_RESET_START,
@@ -1370,6 +1471,7 @@ int dred_decoder_load_model(OpusDREDDecoder *dec, const unsigned char *data, int
     WeightArray *list;
     int ret;
     parse_weights(&list, data, len);
+    DNN_PROFILE_MODEL("rdovaedec");
     ret = init_rdovaedec(&dec->model, list);
     opus_free(list);
     if (ret == 0) dec->loaded = 1;
@@ -1382,10 +1484,12 @@ int opus_dred_decoder_init(OpusDREDDecoder *dec)
    int ret = 0;
    dec->loaded = 0;
 #if defined(ENABLE_DRED) && !defined(USE_WEIGHTS_FILE)
+   DNN_PROFILE_MODEL("rdovaedec");
    ret = init_rdovaedec(&dec->model, rdovaedec_arrays);
    if (ret == 0) dec->loaded = 1;
 #endif
    dec->arch = opus_select_arch();
+   OPUS_CLONE_INIT();
    /* To make sure nobody forgets to init, use a magic number. */
    dec->magic = 0xD8EDDEC0;
    return (ret == 0) ? OPUS_OK : OPUS_UNIMPLEMENTED;
@@ -1586,6 +1690,7 @@ int opus_dred_parse(OpusDREDDecoder *dred_dec, OpusDRED *dred, const unsigned ch
 int opus_dred_process(OpusDREDDecoder *dred_dec, const OpusDRED *src, OpusDRED *dst)
 {
 #ifdef ENABLE_DRED
+   OPUS_CLONE_DISPATCH(opus_dred_process, (dred_dec, src, dst));
    if (dred_dec == NULL || src == NULL || dst == NULL || (src->process_stage != 1 && src->process_stage != 2))
       return OPUS_BAD_ARG;
    VALIDATE_DRED_DECODER(dred_dec);
@@ -0,0 +1,281 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Cuts, splits and concatenates streams in the opus_demo bitstream format
+   without re-encoding them, except for a crossfade between concatenated
+   streams. The pre-skip and end trim of a stream are not stored in that
+   format, so they are given on the command line and printed for the
+   output. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PACKET (48*1275)
+#define MAX_SEAM_PACKETS 512
+
+typedef struct {
+   unsigned char **data;
+   opus_int32 *len;
+   opus_uint32 *rng;
+   int nb_packets;
+} Stream;
+
+static void usage(char *argv0)
+{
+   fprintf(stderr, "usage: %s cut <input> <pre-skip> <start> <end> <output>\n", argv0);
+   fprintf(stderr, "       %s split <input> <pre-skip> <end trim> <position> <output1> <output2>\n", argv0);
+   fprintf(stderr, "       %s concat <channels> <crossfade> <input1> <end trim1> <input2> <pre-skip2> <output>\n", argv0);
+   fprintf(stderr, "Positions and durations are in samples at 48 kHz, and positions\n");
+   fprintf(stderr, "start after the pre-skip.\n");
+}
+
+static void int_to_char(opus_uint32 i, unsigned char ch[4])
+{
+    ch[0] = i>>24;
+    ch[1] = (i>>16)&0xFF;
+    ch[2] = (i>>8)&0xFF;
+    ch[3] = i&0xFF;
+}
+
+static opus_uint32 char_to_int(unsigned char ch[4])
+{
+    return ((opus_uint32)ch[0]<<24) | ((opus_uint32)ch[1]<<16)
+         | ((opus_uint32)ch[2]<< 8) |  (opus_uint32)ch[3];
+}
+
+static int read_stream(const char *name, Stream *s)
+{
+   FILE *fin;
+   int size = 0;
+   fin = fopen(name, "rb");
+   if (fin == NULL)
+   {
+      fprintf(stderr, "Error opening input file: %s\n", name);
+      return 1;
+   }
+   memset(s, 0, sizeof(*s));
+   while (1)
+   {
+      unsigned char ch[8];
+      opus_int32 len;
+      if (fread(ch, 1, 8, fin) != 8)
+         break;
+      len = char_to_int(ch);
+      if (len < 1 || len > MAX_PACKET)
+      {
+         fprintf(stderr, "%s: invalid or lost packet %d (length %d)\n", name, s->nb_packets, len);
+         fclose(fin);
+         return 1;
+      }
+      if (s->nb_packets == size)
+      {
+         size = 2*size + 256;
+         s->data = realloc(s->data, size*sizeof(*s->data));
+         s->len = realloc(s->len, size*sizeof(*s->len));
+         s->rng = realloc(s->rng, size*sizeof(*s->rng));
+         if (!s->data || !s->len || !s->rng)
+         {
+            fprintf(stderr, "Out of memory\n");
+            fclose(fin);
+            return 1;
+         }
+      }
+      s->data[s->nb_packets] = malloc(len);
+      if (!s->data[s->nb_packets] || fread(s->data[s->nb_packets], 1, len, fin) != (size_t)len)
+      {
+         fprintf(stderr, "%s: error reading packet %d\n", name, s->nb_packets);
+         fclose(fin);
+         return 1;
+      }
+      s->len[s->nb_packets] = len;
+      s->rng[s->nb_packets] = char_to_int(ch+4);
+      s->nb_packets++;
+   }
+   fclose(fin);
+   if (s->nb_packets == 0)
+   {
+      fprintf(stderr, "%s: no packets\n", name);
+      return 1;
+   }
+   return 0;
+}
+
+static int write_packet(FILE *fout, const unsigned char *data, opus_int32 len, opus_uint32 rng)
+{
+   unsigned char ch[8];
+   int_to_char(len, ch);
+   int_to_char(rng, ch+4);
+   return fwrite(ch, 1, 8, fout) != 8 || fwrite(data, 1, len, fout) != (size_t)len;
+}
+
+static FILE *open_output(const char *name)
+{
+   FILE *fout = fopen(name, "wb");
+   if (fout == NULL)
+      fprintf(stderr, "Error opening output file: %s\n", name);
+   return fout;
+}
+
+static opus_int64 stream_duration(const Stream *s)
+{
+   int i;
+   opus_int64 duration = 0;
+   for (i=0;i<s->nb_packets;i++)
+   {
+      int n = opus_packet_get_nb_samples(s->data[i], s->len[i], 48000);
+      if (n < 0)
+         return n;
+      duration += n;
+   }
+   return duration;
+}
+
+/* The new first packet keeps the last frame of the original one, and with
+   it its final range, unless it is also the last packet. */
+static int cut(const Stream *s, int pre_skip, opus_int64 start, opus_int64 end, const char *name)
+{
+   static unsigned char out[2*MAX_PACKET];
+   opus_int32 out_lens[2];
+   int range[2], trims[2];
+   int i, err;
+   FILE *fout;
+   err = opus_stream_cut((const unsigned char *const *)s->data, s->len, s->nb_packets, pre_skip,
+         start, end, out, sizeof(out), out_lens, range, trims);
+   if (err != OPUS_OK)
+   {
+      fprintf(stderr, "opus_stream_cut() failed: %s\n", opus_strerror(err));
+      return 1;
+   }
+   fout = open_output(name);
+   if (fout == NULL)
+      return 1;
+   err = write_packet(fout, out, out_lens[0], out_lens[1] > 0 ? s->rng[range[0]] : 0);
+   for (i=range[0]+1;i<range[1];i++)
+      err |= write_packet(fout, s->data[i], s->len[i], s->rng[i]);
+   if (out_lens[1] > 0)
+      err |= write_packet(fout, out+out_lens[0], out_lens[1], 0);
+   fclose(fout);
+   if (err)
+   {
+      fprintf(stderr, "Error writing %s\n", name);
+      return 1;
+   }
+   fprintf(stderr, "%s: %lld samples, pre-skip %d, end trim %d\n", name,
+         (long long)(end-start), trims[0], trims[1]);
+   return 0;
+}
+
+static int concat(const Stream *a, int a_end_trim, const Stream *b, int b_pre_skip,
+      int channels, int crossfade, const char *name)
+{
+   static unsigned char out[MAX_SEAM_PACKETS*1275];
+   static opus_int32 out_lens[MAX_SEAM_PACKETS];
+   int range[2];
+   int i, nb_seam, err;
+   unsigned char *p;
+   FILE *fout;
+   nb_seam = opus_stream_splice((const unsigned char *const *)a->data, a->len, a->nb_packets,
+         a_end_trim, (const unsigned char *const *)b->data, b->len, b->nb_packets, b_pre_skip,
+         channels, crossfade, out, sizeof(out), out_lens, MAX_SEAM_PACKETS, range);
+   if (nb_seam < 0)
+   {
+      fprintf(stderr, "opus_stream_splice() failed: %s\n", opus_strerror(nb_seam));
+      return 1;
+   }
+   fout = open_output(name);
+   if (fout == NULL)
+      return 1;
+   err = 0;
+   for (i=0;i<range[0];i++)
+      err |= write_packet(fout, a->data[i], a->len[i], a->rng[i]);
+   for (i=0,p=out;i<nb_seam;p+=out_lens[i++])
+      err |= write_packet(fout, p, out_lens[i], 0);
+   for (i=range[1];i<b->nb_packets;i++)
+      err |= write_packet(fout, b->data[i], b->len[i], b->rng[i]);
+   fclose(fout);
+   if (err)
+   {
+      fprintf(stderr, "Error writing %s\n", name);
+      return 1;
+   }
+   fprintf(stderr, "%s: %d seam packets, pre-skip of the first input, end trim of the second\n",
+         name, nb_seam);
+   return 0;
+}
+
+static void free_stream(Stream *s)
+{
+   int i;
+   for (i=0;i<s->nb_packets;i++)
+      free(s->data[i]);
+   free(s->data);
+   free(s->len);
+   free(s->rng);
+}
+
+int main(int argc, char *argv[])
+{
+   Stream a, b;
+   int ret;
+   if (argc == 7 && strcmp(argv[1], "cut") == 0)
+   {
+      if (read_stream(argv[2], &a))
+         return EXIT_FAILURE;
+      ret = cut(&a, atoi(argv[3]), atoll(argv[4]), atoll(argv[5]), argv[6]);
+      free_stream(&a);
+   } else if (argc == 8 && strcmp(argv[1], "split") == 0) {
+      int pre_skip;
+      opus_int64 at, length;
+      if (read_stream(argv[2], &a))
+         return EXIT_FAILURE;
+      pre_skip = atoi(argv[3]);
+      at = atoll(argv[5]);
+      length = stream_duration(&a) - pre_skip - atoi(argv[4]);
+      ret = cut(&a, pre_skip, 0, at, argv[6]) || cut(&a, pre_skip, at, length, argv[7]);
+      free_stream(&a);
+   } else if (argc == 9 && strcmp(argv[1], "concat") == 0) {
+      if (read_stream(argv[4], &a))
+         return EXIT_FAILURE;
+      if (read_stream(argv[6], &b))
+      {
+         free_stream(&a);
+         return EXIT_FAILURE;
+      }
+      ret = concat(&a, atoi(argv[5]), &b, atoi(argv[7]), atoi(argv[2]), atoi(argv[3]), argv[8]);
+      free_stream(&a);
+      free_stream(&b);
+   } else {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+   }
+   return ret ? EXIT_FAILURE : EXIT_SUCCESS;
+}
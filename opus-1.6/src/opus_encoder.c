@@ -40,16 +40,25 @@
 #include "arch.h"
 #include "pitch.h"
 #include "opus_private.h"
+#include "opus_clones.h"
 #include "os_support.h"
 #include "cpu_support.h"
 #include "analysis.h"
 #include "mathops.h"
 #include "tuning_parameters.h"
+#include "opus_thread.h"
 
 #ifdef ENABLE_DRED
 #include "dred_coding.h"
 #endif
 
+#ifdef ENABLE_NOISE_SUPPRESSION
+#ifdef FIXED_POINT
+#error "Noise suppression requires a floating-point build"
+#endif
+#include "nsdnn.h"
+#endif
+
 #ifdef FIXED_POINT
 #include "fixed/structs_FIX.h"
 #else
@@ -65,6 +74,23 @@
 #define MAX_ENCODER_BUFFER 480
 #endif
 
+/* The delay line is a power-of-two ring followed by a mirror of its first
+   encoder_buffer samples, so the most recent encoder_buffer samples can always
+   be accessed as one contiguous block without shifting the buffer. Only frames
+   shorter than encoder_buffer go through the ring and the mirror. */
+#ifdef ENABLE_QEXT
+#define DELAY_RING_SIZE 1024
+#else
+#define DELAY_RING_SIZE 512
+#endif
+#define DELAY_BUFFER_SIZE (DELAY_RING_SIZE+MAX_ENCODER_BUFFER)
+
+#ifdef ENABLE_DRED
+/* Voice activity history at 2.5 ms resolution, stored newest first in a ring
+   that is mirrored in full so that it can be read as a contiguous array. */
+#define DRED_ACTIVITY_SIZE (DRED_MAX_FRAMES*4)
+#endif
+
 #define PSEUDO_SNR_THRESHOLD 316.23f    /* 10^(25/10) */
 
 typedef struct {
@@ -79,6 +105,10 @@ struct OpusEncoder {
     silk_EncControlStruct silk_mode;
 #ifdef ENABLE_DRED
     DREDEnc      dred_encoder;
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+    NSDNNState   ns;
+    int          noise_suppression;
 #endif
     int          application;
     int          channels;
@@ -101,12 +131,16 @@ struct OpusEncoder {
     int          arch;
     int          use_dtx;                 /* general DTX for both SILK and CELT */
     int          fec_config;
+#ifdef ENABLE_THREADS
+    int          parallel_analysis;
+#endif
 #ifndef DISABLE_FLOAT_API
     TonalityAnalysisState analysis;
 #endif
 #ifdef ENABLE_QEXT
    int enable_qext;
 #endif
+    const OpusParamHints *param_hints;
 
 #define OPUS_ENCODER_RESET_START stream_channels
     int          stream_channels;
@@ -131,18 +165,21 @@ struct OpusEncoder {
 #endif
     int          nb_no_activity_ms_Q1;
     opus_val32   peak_signal_energy;
+    OpusFrameAnalysis frame_analysis;
 #ifdef ENABLE_DRED
     int          dred_duration;
     int          dred_q0;
     int          dred_dQ;
     int          dred_qmax;
     int          dred_target_chunks;
-    unsigned char activity_mem[DRED_MAX_FRAMES*4]; /* 2.5ms resolution*/
+    int          activity_head;
+    unsigned char activity_mem[DRED_ACTIVITY_SIZE*2];
 #endif
     int          nonfinal_frame; /* current frame is not the final in a packet */
     opus_uint32  rangeFinal;
+    int          delay_head;
     /* Needs to be the last field because it may be partially or completely omitted. */
-    opus_res     delay_buffer[MAX_ENCODER_BUFFER*2];
+    opus_res     delay_buffer[DELAY_BUFFER_SIZE*2];
 };
 
 /* Transition tables for the voice and music. First column is the
@@ -232,9 +269,9 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
         celtEncSizeBytes = celt_encoder_get_size(channels);
     base_size = align(sizeof(OpusEncoder));
     if (application == OPUS_APPLICATION_RESTRICTED_SILK || application == OPUS_APPLICATION_RESTRICTED_CELT) {
-       base_size = align(base_size - MAX_ENCODER_BUFFER*2*sizeof(opus_res));
+       base_size = align(base_size - DELAY_BUFFER_SIZE*2*sizeof(opus_res));
     } else if (channels==1)
-       base_size = align(base_size - MAX_ENCODER_BUFFER*sizeof(opus_res));
+       base_size = align(base_size - DELAY_BUFFER_SIZE*sizeof(opus_res));
     tot_size = base_size+silkEncSizeBytes+celtEncSizeBytes;
     if (st == NULL) {
         return tot_size;
@@ -248,6 +285,7 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
     st->Fs = Fs;
 
     st->arch = opus_select_arch();
+    OPUS_CLONE_INIT();
 
     if (application != OPUS_APPLICATION_RESTRICTED_CELT)
     {
@@ -288,6 +326,9 @@ int opus_encoder_init(OpusEncoder* st, opus_int32 Fs, int channels, int applicat
     /* Initialize DRED Encoder */
     dred_encoder_init( &st->dred_encoder, Fs, channels );
 #endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+    nsdnn_init(&st->ns, Fs, channels);
+#endif
 
     st->use_vbr = 1;
     /* Makes constrained VBR the default (safer for real-time use) */
@@ -359,6 +400,69 @@ static unsigned char gen_toc(int mode, int framerate, int bandwidth, int channel
    return toc;
 }
 
+/* Returns the last encoder_buffer samples of the delay line as a contiguous
+   block (oldest first). Writes through the returned pointer are only valid
+   until the next delay_line_push(). */
+static opus_res *delay_line_tail(OpusEncoder *st)
+{
+   int start;
+   start = (st->delay_head - st->encoder_buffer) & (DELAY_RING_SIZE-1);
+   return &st->delay_buffer[start*st->channels];
+}
+
+static void delay_line_push(OpusEncoder *st, const opus_res *x, int N)
+{
+   int C;
+   int pos;
+   C = st->channels;
+   if (N >= st->encoder_buffer)
+   {
+      /* The frame replaces the whole history. Writing it right below the end
+         of the ring keeps it contiguous, so it needs no mirror and costs the
+         same single copy as a linear buffer. */
+      OPUS_COPY(&st->delay_buffer[(DELAY_RING_SIZE-st->encoder_buffer)*C], x+(N-st->encoder_buffer)*C,
+            st->encoder_buffer*C);
+      st->delay_head = 0;
+      return;
+   }
+   /* Shorter frames are appended, which avoids shifting the history down. */
+   pos = st->delay_head;
+   while (N > 0)
+   {
+      int len = IMIN(N, DELAY_RING_SIZE-pos);
+      OPUS_COPY(&st->delay_buffer[pos*C], x, len*C);
+      if (pos < st->encoder_buffer)
+         OPUS_COPY(&st->delay_buffer[(DELAY_RING_SIZE+pos)*C], x, IMIN(len, st->encoder_buffer-pos)*C);
+      pos = (pos+len) & (DELAY_RING_SIZE-1);
+      x += len*C;
+      N -= len;
+   }
+   st->delay_head = pos;
+}
+
+#ifdef ENABLE_DRED
+static void dred_activity_push(OpusEncoder *st, unsigned char activity, int N)
+{
+   int i;
+   for (i=0;i<N;i++)
+   {
+      st->activity_head = st->activity_head == 0 ? DRED_ACTIVITY_SIZE-1 : st->activity_head-1;
+      st->activity_mem[st->activity_head] = st->activity_mem[st->activity_head+DRED_ACTIVITY_SIZE] = activity;
+   }
+}
+
+static void dred_activity_update(OpusEncoder *st, unsigned char activity, int N)
+{
+   int i;
+   for (i=0;i<N;i++)
+   {
+      int pos = st->activity_head+i;
+      if (pos >= DRED_ACTIVITY_SIZE) pos -= DRED_ACTIVITY_SIZE;
+      st->activity_mem[pos] = st->activity_mem[pos+DRED_ACTIVITY_SIZE] = activity;
+   }
+}
+#endif
+
 #ifdef FIXED_POINT
 /* Second order ARMA filter, alternative implementation */
 void silk_biquad_res(
@@ -619,6 +723,86 @@ static void gain_fade(const opus_res *in, opus_res *out, opus_val16 g1, opus_val
     while (++c<channels);
 }
 
+static opus_val16 stereo_width_gain(opus_int16 width_Q14)
+{
+#ifdef FIXED_POINT
+   return width_Q14==16384 ? Q15ONE : SHL16(width_Q14,1);
+#else
+   return width_Q14*(1.f/16384);
+#endif
+}
+
+/* Stereo width used when SILK does not pick one itself. */
+static opus_int16 rate_stereo_width(opus_int32 equiv_rate)
+{
+   if (equiv_rate > 32000)
+      return 16384;
+   else if (equiv_rate < 16000)
+      return 0;
+   else
+      return 16384 - 2048*(opus_int32)(32000-equiv_rate)/(equiv_rate-14000);
+}
+
+#ifdef ENABLE_THREADS
+/* CELT front-end analysis of a hybrid frame, run while SILK encodes the same
+   frame. It works on its own copy of the CELT input, with the gain and stereo
+   fades the main thread applies after SILK; the stereo width is a guess that
+   gets checked before the result is used. */
+typedef struct {
+   OpusThreadJob job;
+   const CELTEncoder *celt_enc;
+   const CELTMode *celt_mode;
+   opus_res *pcm;
+   int frame_size;
+   int channels;
+   opus_int32 Fs;
+   opus_val16 prev_HB_gain;
+   opus_val16 HB_gain;
+   int stereo_fade;
+   opus_int16 prev_width_Q14;
+   opus_int16 width_Q14;
+   int endband;
+   int stream_channels;
+   int ret;
+   CELTFrontEnd fe;
+} CELTFrontEndJob;
+
+static void celt_front_end_job(void *arg)
+{
+   CELTFrontEndJob *job = (CELTFrontEndJob*)arg;
+   const CELTMode *mode = job->celt_mode;
+   if (job->prev_HB_gain < Q15ONE || job->HB_gain < Q15ONE)
+   {
+      gain_fade(job->pcm, job->pcm, job->prev_HB_gain, job->HB_gain,
+            mode->overlap, job->frame_size, job->channels, mode->window, job->Fs);
+   }
+   if (job->stereo_fade)
+   {
+      stereo_fade(job->pcm, job->pcm, stereo_width_gain(job->prev_width_Q14),
+            stereo_width_gain(job->width_Q14), mode->overlap, job->frame_size,
+            job->channels, mode->window, job->Fs);
+   }
+   job->ret = celt_encode_front_end(job->celt_enc, job->pcm, job->frame_size,
+         job->endband, job->stream_channels, &job->fe);
+}
+#endif
+
+static int bandwidth_end_band(int bandwidth)
+{
+   switch(bandwidth)
+   {
+      case OPUS_BANDWIDTH_NARROWBAND:
+         return 13;
+      case OPUS_BANDWIDTH_MEDIUMBAND:
+      case OPUS_BANDWIDTH_WIDEBAND:
+         return 17;
+      case OPUS_BANDWIDTH_SUPERWIDEBAND:
+         return 19;
+      default:
+         return 21;
+   }
+}
+
 OpusEncoder *opus_encoder_create(opus_int32 Fs, int channels, int application, int *error)
 {
    int ret;
@@ -829,6 +1013,13 @@ opus_int32 frame_size_select(int application, opus_int32 frame_size, int variabl
       return -1;
    if (variable_duration == OPUS_FRAMESIZE_ARG)
       new_size = frame_size;
+   else if (variable_duration == OPUS_FRAMESIZE_ADAPTIVE)
+   {
+      /* The encoder picks the actual size later, up to what it was given. */
+      if (frame_size < Fs/50)
+         return -1;
+      new_size = IMIN(3*Fs/50, frame_size - frame_size%(Fs/50));
+   }
    else if (variable_duration >= OPUS_FRAMESIZE_2_5_MS && variable_duration <= OPUS_FRAMESIZE_120_MS)
    {
       if (variable_duration <= OPUS_FRAMESIZE_40_MS)
@@ -1133,6 +1324,41 @@ static int decide_dtx_mode(opus_int activity,            /* indicates if this fr
    return 0;
 }
 
+#ifndef DISABLE_FLOAT_API
+static void frame_analysis_set_info(OpusFrameAnalysis *fa, const AnalysisInfo *info, int detected_bandwidth)
+{
+   fa->analysis_valid = info->valid;
+   if (info->valid)
+   {
+      fa->activity_probability = (opus_int32)(.5f+32768.f*info->activity_probability);
+      fa->music_probability = (opus_int32)(.5f+32768.f*info->music_prob);
+      fa->tonality = (opus_int32)(.5f+32768.f*info->tonality);
+   } else {
+      fa->activity_probability = fa->music_probability = fa->tonality = 0;
+   }
+   fa->bandwidth = detected_bandwidth;
+}
+#endif
+
+static void frame_analysis_set_bands(OpusFrameAnalysis *fa, CELTEncoder *celt_enc, int endband)
+{
+   int i;
+   celt_glog bandE[OPUS_FRAME_ANALYSIS_BANDS];
+   celt_encoder_ctl(celt_enc, CELT_GET_BAND_ENERGIES(bandE));
+   for (i=0;i<endband;i++)
+   {
+#ifdef FIXED_POINT
+      opus_int32 e = PSHR32(bandE[i], DB_SHIFT-8);
+#else
+      opus_int32 e = float2int(256.f*bandE[i]);
+#endif
+      fa->band_energy[i] = (opus_int16)IMAX(-32768, IMIN(32767, e));
+   }
+   for (;i<OPUS_FRAME_ANALYSIS_BANDS;i++)
+      fa->band_energy[i] = 0;
+   fa->band_count = endband;
+}
+
 static int compute_redundancy_bytes(opus_int32 max_data_bytes, opus_int32 bitrate_bps, int frame_rate, int channels)
 {
    int redundancy_bytes_cap;
@@ -1202,11 +1428,21 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_res *pcm, int frame_si
     int analysis_read_subframe_bak=-1;
 #endif
     int is_silence = 0;
+#ifndef DISABLE_FLOAT_API
+    int analysis_enabled;
+#endif
 #ifdef ENABLE_DRED
     opus_int32 dred_bitrate_bps;
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+    int ns_active;
+    VARDECL(opus_res, ns_pcm);
 #endif
     ALLOC_STACK;
 
+    OPUS_CLONE_DISPATCH(opus_encode_native, (st, pcm, frame_size, data, out_data_bytes, lsb_depth,
+          analysis_pcm, analysis_size, c1, c2, analysis_channels, downmix, float_api));
+
 #ifdef ENABLE_QEXT
    if (st->enable_qext) packet_size_cap = QEXT_PACKET_SIZE_CAP;
 #endif
@@ -1237,14 +1473,69 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_res *pcm, int frame_si
 
     if (st->application != OPUS_APPLICATION_RESTRICTED_SILK)
         celt_encoder_ctl(celt_enc, CELT_GET_MODE(&celt_mode));
-    is_silence = is_digital_silence(pcm, frame_size, st->channels, lsb_depth);
 #ifndef DISABLE_FLOAT_API
     analysis_info.valid = 0;
+    /* With side information from a decoded stream, the mode and bandwidth are
+       forced anyway, so the tonality analysis is not worth its cost. */
 #ifdef FIXED_POINT
-    if (st->silk_mode.complexity >= 10 && st->Fs>=16000 && st->Fs<=48000 && st->application != OPUS_APPLICATION_RESTRICTED_SILK)
+    analysis_enabled = st->silk_mode.complexity >= 10 && st->Fs>=16000 && st->Fs<=48000 && st->application != OPUS_APPLICATION_RESTRICTED_SILK && st->param_hints == NULL;
 #else
-    if (st->silk_mode.complexity >= 7 && st->Fs>=16000 && st->Fs<=48000 && st->application != OPUS_APPLICATION_RESTRICTED_SILK)
+    analysis_enabled = st->silk_mode.complexity >= 7 && st->Fs>=16000 && st->Fs<=48000 && st->application != OPUS_APPLICATION_RESTRICTED_SILK && st->param_hints == NULL;
+#endif
 #endif
+
+    if (st->variable_duration == OPUS_FRAMESIZE_ADAPTIVE)
+    {
+#ifndef DISABLE_FLOAT_API
+       /* The denoised signal only exists for what actually gets encoded, so
+          it cannot be analyzed ahead. */
+       if (analysis_enabled
+#ifdef ENABLE_NOISE_SUPPRESSION
+             && !(st->noise_suppression && st->ns.loaded)
+#endif
+          )
+       {
+          /* Analyze all of the look-ahead now. The run_analysis() call below
+             then only has to account for the part that gets encoded. */
+          run_analysis(&st->analysis, celt_mode, analysis_pcm, analysis_size, 0,
+                c1, c2, analysis_channels, st->Fs,
+                lsb_depth, downmix, &analysis_info);
+          frame_size = tonality_select_frame_size(&st->analysis, frame_size);
+       } else
+#endif
+       {
+          /* Without the analysis there is nothing to base the choice on. */
+          frame_size = IMIN(frame_size, st->Fs/50);
+       }
+    }
+
+#ifdef ENABLE_NOISE_SUPPRESSION
+    ns_active = st->noise_suppression && st->ns.loaded;
+    ALLOC(ns_pcm, ns_active ? frame_size*st->channels : ALLOC_NONE, opus_res);
+    if (ns_active)
+    {
+       /* Frames shorter than the denoiser hop only go through its delay
+          line, so the lookahead stays the same. */
+       if (frame_size % (st->Fs/100) == 0)
+          nsdnn_process(&st->ns, ns_pcm, pcm, frame_size, st->arch);
+       else
+          nsdnn_bypass(&st->ns, ns_pcm, pcm, frame_size);
+       /* Both the coding and the analysis see the delayed signal. */
+       pcm = ns_pcm;
+       analysis_pcm = ns_pcm;
+       analysis_size = frame_size;
+       c1 = 0;
+       c2 = -2;
+       analysis_channels = st->channels;
+#ifndef DISABLE_FLOAT_API
+       downmix = downmix_float;
+#endif
+    }
+#endif
+
+    is_silence = is_digital_silence(pcm, frame_size, st->channels, lsb_depth);
+#ifndef DISABLE_FLOAT_API
+    if (analysis_enabled)
     {
        analysis_read_pos_bak = st->analysis.read_pos;
        analysis_read_subframe_bak = st->analysis.read_subframe;
@@ -1874,9 +2165,15 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
     int curr_bandwidth;
     int delay_compensation;
     int total_buffer;
+    opus_res *delay;
     opus_int activity = VAD_NO_DECISION;
+    int endband=21;
     VARDECL(opus_res, pcm_buf);
     VARDECL(opus_res, tmp_prefill);
+#ifdef ENABLE_THREADS
+    int fe_started=0;
+    VARDECL(CELTFrontEndJob, fe_job);
+#endif
     SAVE_STACK;
 
     max_data_bytes = IMIN(orig_max_data_bytes, 1276);
@@ -1917,6 +2214,13 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
        /* Boosting peak energy a bit because we didn't just average the active frames. */
        activity = 2*st->peak_signal_energy < (QCONST16(PSEUDO_SNR_THRESHOLD, 0) * (opus_val64)noise_energy);
     }
+#ifndef DISABLE_FLOAT_API
+    frame_analysis_set_info(&st->frame_analysis, analysis_info, st->detected_bandwidth);
+#endif
+    /* Updated below if SILK makes the VAD decision. */
+    st->frame_analysis.vad = activity > 0;
+    st->frame_analysis.pitch = 0;
+    st->frame_analysis.band_count = 0;
 
     /* For the first frame at a new SILK bandwidth */
     if (st->silk_bw_switch)
@@ -1953,7 +2257,8 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
     ec_enc_init(&enc, data, orig_max_data_bytes-1);
 
     ALLOC(pcm_buf, (total_buffer+frame_size)*st->channels, opus_res);
-    OPUS_COPY(pcm_buf, &st->delay_buffer[(st->encoder_buffer-total_buffer)*st->channels], total_buffer*st->channels);
+    delay = delay_line_tail(st);
+    OPUS_COPY(pcm_buf, &delay[(st->encoder_buffer-total_buffer)*st->channels], total_buffer*st->channels);
 
     if (st->mode == MODE_CELT_ONLY)
        hp_freq_smth1 = silk_LSHIFT( silk_lin2log( VARIABLE_HP_MIN_CUTOFF_HZ ), 8 );
@@ -2020,15 +2325,17 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
         /* DRED Encoder */
         dred_compute_latents( &st->dred_encoder, &pcm_buf[total_buffer*st->channels], frame_size, total_buffer, st->arch );
         frame_size_400Hz = frame_size*400/st->Fs;
-        OPUS_MOVE(&st->activity_mem[frame_size_400Hz], st->activity_mem, 4*DRED_MAX_FRAMES-frame_size_400Hz);
-        for (i=0;i<frame_size_400Hz;i++)
-           st->activity_mem[i] = activity;
+        dred_activity_push(st, activity, frame_size_400Hz);
     } else {
         st->dred_encoder.latents_buffer_fill = 0;
-        OPUS_CLEAR(st->activity_mem, 4*DRED_MAX_FRAMES);
+        st->activity_head = 0;
+        OPUS_CLEAR(st->activity_mem, 2*DRED_ACTIVITY_SIZE);
     }
 #endif
 
+#ifdef ENABLE_THREADS
+    ALLOC(fe_job, st->parallel_analysis ? 1 : ALLOC_NONE, CELTFrontEndJob);
+#endif
     /* SILK processing */
     HB_gain = Q15ONE;
     if (st->mode != MODE_CELT_ONLY)
@@ -2184,20 +2491,50 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
             /* Use a smooth onset for the SILK prefill to avoid the encoder trying to encode
                a discontinuity. The exact location is what we need to avoid leaving any "gap"
                in the audio when mixing with the redundant CELT frame. Here we can afford to
-               overwrite st->delay_buffer because the only thing that uses it before it gets
+               overwrite the delay line because the only thing that uses it before it gets
                rewritten is tmp_prefill[] and even then only the part after the ramp really
                gets used (rather than sent to the encoder and discarded) */
             prefill_offset = st->channels*(st->encoder_buffer-st->delay_compensation-st->Fs/400);
-            gain_fade(st->delay_buffer+prefill_offset, st->delay_buffer+prefill_offset,
+            gain_fade(delay+prefill_offset, delay+prefill_offset,
                   0, Q15ONE, celt_mode->overlap, st->Fs/400, st->channels, celt_mode->window, st->Fs);
-            OPUS_CLEAR(st->delay_buffer, prefill_offset);
-            pcm_silk = st->delay_buffer;
+            OPUS_CLEAR(delay, prefill_offset);
+            pcm_silk = delay;
             silk_Encode( silk_enc, &st->silk_mode, pcm_silk, st->encoder_buffer, NULL, &zero, prefill, activity );
             /* Prevent a second switch in the real encode call. */
             st->silk_mode.opusCanSwitch = 0;
         }
 
         pcm_silk = pcm_buf+total_buffer*st->channels;
+#ifdef ENABLE_THREADS
+        if (st->parallel_analysis && st->mode == MODE_HYBRID && st->prev_mode == MODE_HYBRID
+              && !prefill && st->application != OPUS_APPLICATION_RESTRICTED_SILK)
+        {
+           VARDECL(opus_res, fe_pcm);
+           ALLOC(fe_pcm, frame_size*st->channels, opus_res);
+           OPUS_COPY(fe_pcm, pcm_buf, frame_size*st->channels);
+           fe_job->job.run = celt_front_end_job;
+           fe_job->job.arg = fe_job;
+           fe_job->celt_enc = celt_enc;
+           fe_job->celt_mode = celt_mode;
+           fe_job->pcm = fe_pcm;
+           fe_job->frame_size = frame_size;
+           fe_job->channels = st->channels;
+           fe_job->Fs = st->Fs;
+           fe_job->prev_HB_gain = st->prev_HB_gain;
+           fe_job->HB_gain = HB_gain;
+           /* SILK picks the stereo width for stereo streams: assume it keeps the last one. */
+           fe_job->prev_width_Q14 = st->hybrid_stereo_width_Q14;
+           fe_job->width_Q14 = st->stream_channels==1 ? rate_stereo_width(equiv_rate) : st->silk_mode.stereoWidth_Q14;
+           fe_job->stereo_fade = !st->energy_masking && st->channels == 2
+                 && (fe_job->prev_width_Q14 < (1 << 14) || fe_job->width_Q14 < (1 << 14));
+           fe_job->endband = bandwidth_end_band(curr_bandwidth);
+           fe_job->stream_channels = st->stream_channels;
+           opus_thread_start(&fe_job->job);
+           ret = silk_Encode( silk_enc, &st->silk_mode, pcm_silk, frame_size, &enc, &nBytes, 0, activity );
+           opus_thread_wait(&fe_job->job);
+           fe_started = 1;
+        } else
+#endif
         ret = silk_Encode( silk_enc, &st->silk_mode, pcm_silk, frame_size, &enc, &nBytes, 0, activity );
         if( ret ) {
             /*fprintf (stderr, "SILK encode error: %d\n", ret);*/
@@ -2224,10 +2561,15 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
         if (activity == VAD_NO_DECISION) {
            activity = (st->silk_mode.signalType != TYPE_NO_VOICE_ACTIVITY);
 #ifdef ENABLE_DRED
-           for (i=0;i<frame_size*400/st->Fs;i++)
-              st->activity_mem[i] = activity;
+           dred_activity_update(st, activity, frame_size*400/st->Fs);
 #endif
         }
+        st->frame_analysis.vad = activity;
+        if (st->silk_mode.signalType == TYPE_VOICED)
+        {
+           silk_encoder_state *sCmn = &((silk_encoder*)silk_enc)->state_Fxx[0].sCmn;
+           st->frame_analysis.pitch = sCmn->prevLag*48/sCmn->fs_kHz;
+        }
         if (nBytes==0)
         {
            st->rangeFinal = 0;
@@ -2252,24 +2594,7 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
     /* CELT processing */
     if (st->application != OPUS_APPLICATION_RESTRICTED_SILK)
     {
-        int endband=21;
-
-        switch(curr_bandwidth)
-        {
-            case OPUS_BANDWIDTH_NARROWBAND:
-                endband = 13;
-                break;
-            case OPUS_BANDWIDTH_MEDIUMBAND:
-            case OPUS_BANDWIDTH_WIDEBAND:
-                endband = 17;
-                break;
-            case OPUS_BANDWIDTH_SUPERWIDEBAND:
-                endband = 19;
-                break;
-            case OPUS_BANDWIDTH_FULLBAND:
-                endband = 21;
-                break;
-        }
+        endband = bandwidth_end_band(curr_bandwidth);
         celt_encoder_ctl(celt_enc, CELT_SET_END_BAND(endband));
         celt_encoder_ctl(celt_enc, CELT_SET_CHANNELS(st->stream_channels));
         celt_encoder_ctl(celt_enc, OPUS_SET_BITRATE(OPUS_BITRATE_MAX));
@@ -2287,18 +2612,12 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
     if (st->mode != MODE_SILK_ONLY && st->mode != st->prev_mode && st->prev_mode > 0
           && st->application != OPUS_APPLICATION_RESTRICTED_CELT)
     {
-       OPUS_COPY(tmp_prefill, &st->delay_buffer[(st->encoder_buffer-total_buffer-st->Fs/400)*st->channels], st->channels*st->Fs/400);
+       OPUS_COPY(tmp_prefill, &delay[(st->encoder_buffer-total_buffer-st->Fs/400)*st->channels], st->channels*st->Fs/400);
     }
 
-    if (st->channels*(st->encoder_buffer-(frame_size+total_buffer)) > 0)
-    {
-       OPUS_MOVE(st->delay_buffer, &st->delay_buffer[st->channels*frame_size], st->channels*(st->encoder_buffer-frame_size-total_buffer));
-       OPUS_COPY(&st->delay_buffer[st->channels*(st->encoder_buffer-frame_size-total_buffer)],
-             &pcm_buf[0],
-             (frame_size+total_buffer)*st->channels);
-    } else {
-       OPUS_COPY(st->delay_buffer, &pcm_buf[(frame_size+total_buffer-st->encoder_buffer)*st->channels], st->encoder_buffer*st->channels);
-    }
+    /* The history part of pcm_buf is already in the delay line (a SILK prefill
+       may have modified it, but SILK frames always replace the whole history). */
+    delay_line_push(st, &pcm_buf[total_buffer*st->channels], frame_size);
     /* gain_fade() and stereo_fade() need to be after the buffer copying
        because we don't want any of this to affect the SILK part */
     if( ( st->prev_HB_gain < Q15ONE || HB_gain < Q15ONE ) && celt_mode != NULL ) {
@@ -2307,27 +2626,13 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
     }
     st->prev_HB_gain = HB_gain;
     if (st->mode != MODE_HYBRID || st->stream_channels==1)
-    {
-       if (equiv_rate > 32000)
-          st->silk_mode.stereoWidth_Q14 = 16384;
-       else if (equiv_rate < 16000)
-          st->silk_mode.stereoWidth_Q14 = 0;
-       else
-          st->silk_mode.stereoWidth_Q14 = 16384 - 2048*(opus_int32)(32000-equiv_rate)/(equiv_rate-14000);
-    }
+       st->silk_mode.stereoWidth_Q14 = rate_stereo_width(equiv_rate);
     if( !st->energy_masking && st->channels == 2 ) {
         /* Apply stereo width reduction (at low bitrates) */
         if( st->hybrid_stereo_width_Q14 < (1 << 14) || st->silk_mode.stereoWidth_Q14 < (1 << 14) ) {
             opus_val16 g1, g2;
-            g1 = st->hybrid_stereo_width_Q14;
-            g2 = (opus_val16)(st->silk_mode.stereoWidth_Q14);
-#ifdef FIXED_POINT
-            g1 = g1==16384 ? Q15ONE : SHL16(g1,1);
-            g2 = g2==16384 ? Q15ONE : SHL16(g2,1);
-#else
-            g1 *= (1.f/16384);
-            g2 *= (1.f/16384);
-#endif
+            g1 = stereo_width_gain(st->hybrid_stereo_width_Q14);
+            g2 = stereo_width_gain(st->silk_mode.stereoWidth_Q14);
             if ( celt_mode != NULL )
             {
                 stereo_fade(pcm_buf, pcm_buf, g1, g2, celt_mode->overlap,
@@ -2478,6 +2783,10 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
         {
 #ifdef ENABLE_QEXT
            if (st->mode == MODE_CELT_ONLY) celt_encoder_ctl(celt_enc, OPUS_SET_QEXT(st->enable_qext));
+#endif
+#ifdef ENABLE_THREADS
+           if (fe_started && fe_job->ret == OPUS_OK && fe_job->width_Q14 == st->silk_mode.stereoWidth_Q14)
+              celt_encoder_ctl(celt_enc, CELT_SET_FRONT_END(&fe_job->fe));
 #endif
            ret = celt_encode_with_ec(celt_enc, pcm_buf, frame_size, NULL, nb_compr_bytes, &enc);
 #ifdef ENABLE_QEXT
@@ -2488,6 +2797,7 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
               RESTORE_STACK;
               return OPUS_INTERNAL_ERROR;
            }
+           frame_analysis_set_bands(&st->frame_analysis, celt_enc, endband);
            /* Put CELT->SILK redundancy data in the right place. */
            if (redundancy && celt_to_silk && st->mode==MODE_HYBRID && nb_compr_bytes != ret)
            {
@@ -2611,7 +2921,7 @@ static opus_int32 opus_encode_frame_native(OpusEncoder *st, const opus_res *pcm,
            buf[1] = DRED_EXPERIMENTAL_VERSION;
 #endif
            dred_bytes = dred_encode_silk_frame(&st->dred_encoder, buf+DRED_EXPERIMENTAL_BYTES, dred_chunks, dred_bytes_left-DRED_EXPERIMENTAL_BYTES,
-                                               st->dred_q0, st->dred_dQ, st->dred_qmax, st->activity_mem, st->arch);
+                                               st->dred_q0, st->dred_dQ, st->dred_qmax, &st->activity_mem[st->activity_head], st->arch);
            if (dred_bytes > 0) {
               dred_bytes += DRED_EXPERIMENTAL_BYTES;
               celt_assert(dred_bytes <= dred_bytes_left);
@@ -3078,6 +3388,10 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             *value = st->Fs/400;
             if (st->application != OPUS_APPLICATION_RESTRICTED_LOWDELAY && st->application != OPUS_APPLICATION_RESTRICTED_CELT)
                 *value += st->delay_compensation;
+#ifdef ENABLE_NOISE_SUPPRESSION
+            if (st->noise_suppression && st->ns.loaded)
+                *value += st->Fs/100;
+#endif
         }
         break;
         case OPUS_GET_SAMPLE_RATE_REQUEST:
@@ -3127,7 +3441,8 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
                 value != OPUS_FRAMESIZE_5_MS   && value != OPUS_FRAMESIZE_10_MS  &&
                 value != OPUS_FRAMESIZE_20_MS  && value != OPUS_FRAMESIZE_40_MS  &&
                 value != OPUS_FRAMESIZE_60_MS  && value != OPUS_FRAMESIZE_80_MS  &&
-                value != OPUS_FRAMESIZE_100_MS && value != OPUS_FRAMESIZE_120_MS)
+                value != OPUS_FRAMESIZE_100_MS && value != OPUS_FRAMESIZE_120_MS &&
+                value != OPUS_FRAMESIZE_ADAPTIVE)
             {
                goto bad_arg;
             }
@@ -3160,6 +3475,44 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
            *value = st->silk_mode.reducedDependency;
         }
         break;
+#ifdef ENABLE_THREADS
+        case OPUS_SET_PARALLEL_ANALYSIS_REQUEST:
+        {
+           opus_int32 value = va_arg(ap, opus_int32);
+           if (value > 1 || value < 0)
+              goto bad_arg;
+           st->parallel_analysis = value;
+        }
+        break;
+        case OPUS_GET_PARALLEL_ANALYSIS_REQUEST:
+        {
+           opus_int32 *value = va_arg(ap, opus_int32*);
+           if (!value)
+              goto bad_arg;
+           *value = st->parallel_analysis;
+        }
+        break;
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+        case OPUS_SET_NOISE_SUPPRESSION_REQUEST:
+        {
+           opus_int32 value = va_arg(ap, opus_int32);
+           if (value > 1 || value < 0)
+              goto bad_arg;
+           if (value && !st->noise_suppression)
+              nsdnn_reset(&st->ns);
+           st->noise_suppression = value;
+        }
+        break;
+        case OPUS_GET_NOISE_SUPPRESSION_REQUEST:
+        {
+           opus_int32 *value = va_arg(ap, opus_int32*);
+           if (!value)
+              goto bad_arg;
+           *value = st->noise_suppression;
+        }
+        break;
+#endif
         case OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST:
         {
             opus_int32 value = va_arg(ap, opus_int32);
@@ -3249,6 +3602,9 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
 #ifdef ENABLE_DRED
            /* Initialize DRED Encoder */
            dred_encoder_reset( &st->dred_encoder );
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+           nsdnn_reset(&st->ns);
 #endif
            st->stream_channels = st->channels;
            st->hybrid_stereo_width_Q14 = 1 << 14;
@@ -3269,6 +3625,25 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             st->user_forced_mode = value;
         }
         break;
+        case OPUS_SET_PARAM_HINTS_REQUEST:
+        {
+            OpusParamHints *value = va_arg(ap, OpusParamHints*);
+            st->param_hints = value;
+            st->silk_mode.paramHints = value ? value->silk : NULL;
+            if (st->application != OPUS_APPLICATION_RESTRICTED_SILK)
+               ret = celt_encoder_ctl(celt_enc, CELT_SET_PARAM_HINTS(value ? value->celt : NULL));
+        }
+        break;
+        case OPUS_GET_SILK_LAST_GAIN_INDEX_REQUEST:
+        {
+            opus_int32 *value = va_arg(ap, opus_int32*);
+            if (!value)
+            {
+                goto bad_arg;
+            }
+            *value = st->silk_mode.lastGainIndex;
+        }
+        break;
         case OPUS_SET_LFE_REQUEST:
         {
             opus_int32 value = va_arg(ap, opus_int32);
@@ -3285,6 +3660,16 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
                ret = celt_encoder_ctl(celt_enc, OPUS_SET_ENERGY_MASK(value));
         }
         break;
+        case OPUS_GET_FRAME_ANALYSIS_REQUEST:
+        {
+            OpusFrameAnalysis *value = va_arg(ap, OpusFrameAnalysis*);
+            if (!value)
+            {
+                goto bad_arg;
+            }
+            *value = st->frame_analysis;
+        }
+        break;
         case OPUS_GET_IN_DTX_REQUEST:
         {
             opus_int32 *value = va_arg(ap, opus_int32*);
@@ -3321,6 +3706,10 @@ int opus_encoder_ctl(OpusEncoder *st, int request, ...)
             }
 #ifdef ENABLE_DRED
             ret = dred_encoder_load_model(&st->dred_encoder, data, len);
+#endif
+#ifdef ENABLE_NOISE_SUPPRESSION
+            if (ret == OPUS_OK)
+               ret = nsdnn_load_model(&st->ns, data, len) == 0 ? OPUS_OK : OPUS_BAD_ARG;
 #endif
         }
         break;
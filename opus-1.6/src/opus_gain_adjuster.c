@@ -0,0 +1,299 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus.h"
+#include "opus_private.h"
+#include "os_support.h"
+#include "stack_alloc.h"
+#include "entenc.h"
+#include "entdec.h"
+#include "API.h"
+
+struct OpusGainAdjuster {
+   int          channels;
+   int          silk_rew_offset;
+   int          decoder_offset;
+   int          encoder_offset;
+   int          prev_mode;
+   int          prev_transcoded;
+};
+
+int opus_gain_adjuster_get_size(int channels)
+{
+   int silkRewSizeBytes, ret;
+   int decSizeBytes, encSizeBytes;
+   if (channels<1 || channels>2)
+      return 0;
+   ret = silk_Get_Gain_Rewriter_Size(&silkRewSizeBytes);
+   if (ret)
+      return 0;
+   decSizeBytes = opus_decoder_get_size(channels);
+   encSizeBytes = opus_encoder_get_size(channels);
+   if (!decSizeBytes || !encSizeBytes)
+      return 0;
+   return align(sizeof(OpusGainAdjuster))+align(silkRewSizeBytes)+align(decSizeBytes)+encSizeBytes;
+}
+
+int opus_gain_adjuster_init(OpusGainAdjuster *st, int channels)
+{
+   int silkRewSizeBytes, ret;
+   if (channels<1 || channels>2)
+      return OPUS_BAD_ARG;
+   OPUS_CLEAR((char*)st, opus_gain_adjuster_get_size(channels));
+   ret = silk_Get_Gain_Rewriter_Size(&silkRewSizeBytes);
+   if (ret)
+      return OPUS_INTERNAL_ERROR;
+   st->channels = channels;
+   st->silk_rew_offset = align(sizeof(OpusGainAdjuster));
+   st->decoder_offset = st->silk_rew_offset+align(silkRewSizeBytes);
+   st->encoder_offset = st->decoder_offset+align(opus_decoder_get_size(channels));
+
+   ret = silk_InitGainRewriter((char*)st+st->silk_rew_offset);
+   if (ret)
+      return OPUS_INTERNAL_ERROR;
+   ret = opus_decoder_init((OpusDecoder*)(void*)((char*)st+st->decoder_offset), 48000, channels);
+   if (ret != OPUS_OK)
+      return ret;
+   ret = opus_encoder_init((OpusEncoder*)(void*)((char*)st+st->encoder_offset), 48000, channels,
+         OPUS_APPLICATION_AUDIO);
+   if (ret != OPUS_OK)
+      return ret;
+   st->prev_mode = 0;
+   st->prev_transcoded = 0;
+   return OPUS_OK;
+}
+
+OpusGainAdjuster *opus_gain_adjuster_create(int channels, int *error)
+{
+   int ret;
+   OpusGainAdjuster *st;
+   if (channels<1 || channels>2)
+   {
+      if (error)
+         *error = OPUS_BAD_ARG;
+      return NULL;
+   }
+   st = (OpusGainAdjuster *)opus_alloc(opus_gain_adjuster_get_size(channels));
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_gain_adjuster_init(st, channels);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+void opus_gain_adjuster_destroy(OpusGainAdjuster *st)
+{
+   opus_free(st);
+}
+
+static int packet_mode(const unsigned char *data)
+{
+   if (data[0]&0x80)
+      return MODE_CELT_ONLY;
+   else if ((data[0]&0x60) == 0x60)
+      return MODE_HYBRID;
+   else
+      return MODE_SILK_ONLY;
+}
+
+/* Offsets the SILK gains of each frame and repacketizes the result. Returns
+   OPUS_UNIMPLEMENTED when the packet needs to be transcoded instead. */
+static opus_int32 opus_gain_adjuster_rewrite(OpusGainAdjuster *st, const unsigned char *data,
+      opus_int32 len, int gain_Q8, unsigned char *out, opus_int32 maxlen)
+{
+   int i, count, ret, frame_ms, internal_rate;
+   unsigned char toc;
+   const unsigned char *frames[48];
+   opus_int16 size[48];
+   silk_DecControlStruct DecControl;
+   OpusRepacketizer rp;
+   void *silk_rew;
+   VARDECL(unsigned char, tmp);
+   SAVE_STACK;
+
+   silk_rew = (char*)st+st->silk_rew_offset;
+   count = opus_packet_parse(data, len, &toc, frames, size, NULL);
+   if (count < 0)
+   {
+      RESTORE_STACK;
+      return count;
+   }
+   frame_ms = opus_packet_get_samples_per_frame(data, 1000);
+   switch (opus_packet_get_bandwidth(data))
+   {
+   case OPUS_BANDWIDTH_NARROWBAND:
+      internal_rate = 8000;
+      break;
+   case OPUS_BANDWIDTH_MEDIUMBAND:
+      internal_rate = 12000;
+      break;
+   default:
+      internal_rate = 16000;
+   }
+   DecControl.nChannelsAPI = 1;
+   DecControl.nChannelsInternal = 1;
+   DecControl.API_sampleRate = 48000;
+   DecControl.internalSampleRate = internal_rate;
+   DecControl.payloadSize_ms = frame_ms;
+
+   /* The SILK decoder of the receiver is reset when switching from CELT */
+   if (st->prev_mode == MODE_CELT_ONLY)
+      silk_ResetGainRewriter(silk_rew, 10, 10);
+
+   ALLOC(tmp, count*(1+1275), unsigned char);
+   opus_repacketizer_init(&rp);
+   for (i=0;i<count;i++)
+   {
+      unsigned char *frame_out = tmp+i*(1+1275);
+      opus_int32 frame_len;
+      frame_out[0] = toc&0xFC;
+      if (size[i] <= 1)
+      {
+         /* Decoded as a lost frame, which resets the gain history */
+         OPUS_COPY(frame_out+1, frames[i], size[i]);
+         frame_len = size[i];
+         silk_ResetGainRewriter(silk_rew, 10, 10);
+      } else {
+         ec_dec dec;
+         ec_enc enc;
+         ec_dec_init(&dec, (unsigned char*)frames[i], size[i]);
+         ec_enc_init(&enc, frame_out+1, 1275);
+         ret = silk_RewriteGains(silk_rew, &DecControl, gain_Q8, &dec, &enc);
+         /* Redundant CELT frames would need their energy adjusted too */
+         if (ret || ec_tell(&dec)+17 <= 8*size[i])
+         {
+            RESTORE_STACK;
+            return OPUS_UNIMPLEMENTED;
+         }
+         frame_len = (ec_tell(&enc)+7)>>3;
+         ec_enc_done(&enc);
+         if (ec_get_error(&enc))
+         {
+            RESTORE_STACK;
+            return OPUS_UNIMPLEMENTED;
+         }
+         /* Trailing zeros are filled in by the range decoder, as the encoder relies on */
+         while (frame_len>2 && frame_out[frame_len]==0)
+            frame_len--;
+      }
+      ret = opus_repacketizer_cat(&rp, frame_out, frame_len+1);
+      if (ret != OPUS_OK)
+      {
+         RESTORE_STACK;
+         return ret;
+      }
+   }
+   ret = opus_repacketizer_out(&rp, out, maxlen);
+   RESTORE_STACK;
+   return ret;
+}
+
+/* Decodes the packet with the gain applied and encodes the result in the same
+   mode, bandwidth, channel count, and frame size at the same bitrate. */
+static opus_int32 opus_gain_adjuster_transcode(OpusGainAdjuster *st, const unsigned char *data,
+      opus_int32 len, int gain_Q8, unsigned char *out, opus_int32 maxlen)
+{
+   int nb_samples, ret;
+   OpusDecoder *dec;
+   OpusEncoder *enc;
+   VARDECL(opus_int32, pcm);
+   SAVE_STACK;
+
+   dec = (OpusDecoder*)(void*)((char*)st+st->decoder_offset);
+   enc = (OpusEncoder*)(void*)((char*)st+st->encoder_offset);
+   /* The decoder and encoder skipped the packets that were rewritten, so
+      starting over is cleaner than continuing from stale state. */
+   if (!st->prev_transcoded)
+   {
+      opus_decoder_ctl(dec, OPUS_RESET_STATE);
+      opus_encoder_ctl(enc, OPUS_RESET_STATE);
+   }
+   nb_samples = opus_packet_get_nb_samples(data, len, 48000);
+   if (nb_samples <= 0)
+   {
+      RESTORE_STACK;
+      return nb_samples < 0 ? nb_samples : OPUS_INVALID_PACKET;
+   }
+   ALLOC(pcm, nb_samples*st->channels, opus_int32);
+   opus_decoder_ctl(dec, OPUS_SET_GAIN(gain_Q8));
+   ret = opus_decode24(dec, data, len, pcm, nb_samples, 0);
+   if (ret < 0)
+   {
+      RESTORE_STACK;
+      return ret;
+   }
+   opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(packet_mode(data)));
+   opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(opus_packet_get_bandwidth(data)));
+   opus_encoder_ctl(enc, OPUS_SET_FORCE_CHANNELS(IMIN(st->channels, opus_packet_get_nb_channels(data))));
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE((opus_int32)((opus_int64)len*8*48000/nb_samples)));
+   ret = opus_encode24(enc, pcm, nb_samples, out, maxlen);
+   RESTORE_STACK;
+   return ret;
+}
+
+opus_int32 opus_gain_adjuster_process(OpusGainAdjuster *st, const unsigned char *data,
+      opus_int32 len, int gain_Q8, unsigned char *out, opus_int32 maxlen)
+{
+   int mode;
+   opus_int32 ret = OPUS_UNIMPLEMENTED;
+
+   if (data == NULL || len < 1 || out == NULL || maxlen < 1 || gain_Q8<-32768 || gain_Q8>32767)
+      return OPUS_BAD_ARG;
+   mode = packet_mode(data);
+   if (mode == MODE_SILK_ONLY && opus_packet_get_nb_channels(data) == 1)
+      ret = opus_gain_adjuster_rewrite(st, data, len, gain_Q8, out, maxlen);
+   if (ret == OPUS_UNIMPLEMENTED)
+   {
+      opus_int32 prev_gain_in, prev_gain_out;
+      ret = opus_gain_adjuster_transcode(st, data, len, gain_Q8, out, maxlen);
+      /* The next gains of the input are coded against what our decoder has seen,
+         and the receiver now follows our encoder */
+      opus_decoder_ctl((OpusDecoder*)(void*)((char*)st+st->decoder_offset),
+            OPUS_GET_SILK_LAST_GAIN_INDEX(&prev_gain_in));
+      opus_encoder_ctl((OpusEncoder*)(void*)((char*)st+st->encoder_offset),
+            OPUS_GET_SILK_LAST_GAIN_INDEX(&prev_gain_out));
+      silk_ResetGainRewriter((char*)st+st->silk_rew_offset, prev_gain_in, prev_gain_out);
+      st->prev_transcoded = 1;
+   } else {
+      st->prev_transcoded = 0;
+   }
+   st->prev_mode = mode;
+   return ret;
+}
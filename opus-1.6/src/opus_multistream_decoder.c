@@ -32,6 +32,7 @@
 #include "opus_multistream.h"
 #include "opus.h"
 #include "opus_private.h"
+#include "opus_clones.h"
 #include "stack_alloc.h"
 #include <stdarg.h>
 #include "float_cast.h"
@@ -196,6 +197,8 @@ int opus_multistream_decode_native(
    VARDECL(opus_res, buf);
    ALLOC_STACK;
 
+   OPUS_CLONE_DISPATCH(opus_multistream_decode_native, (st, data, len, pcm, copy_channel_out,
+         frame_size, decode_fec, soft_clip, user_data));
    VALIDATE_MS_DECODER(st);
    if (frame_size <= 0)
    {
@@ -445,6 +448,7 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
        case OPUS_GET_LAST_PACKET_DURATION_REQUEST:
        case OPUS_GET_PHASE_INVERSION_DISABLED_REQUEST:
        case OPUS_GET_COMPLEXITY_REQUEST:
+       case OPUS_GET_SHADOW_DECODE_REQUEST:
        {
           OpusDecoder *dec;
           /* For int32* GET params, just query the first stream */
@@ -521,6 +525,7 @@ int opus_multistream_decoder_ctl_va_list(OpusMSDecoder *st, int request,
        case OPUS_SET_GAIN_REQUEST:
        case OPUS_SET_COMPLEXITY_REQUEST:
        case OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST:
+       case OPUS_SET_SHADOW_DECODE_REQUEST:
        {
           int s;
           /* This works for int32 params */
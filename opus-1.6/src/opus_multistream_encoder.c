@@ -32,6 +32,7 @@
 #include "opus_multistream.h"
 #include "opus.h"
 #include "opus_private.h"
+#include "opus_clones.h"
 #include "stack_alloc.h"
 #include <stdarg.h>
 #include "float_cast.h"
@@ -868,6 +869,9 @@ int opus_multistream_encode_native
    opus_int32 smallest_packet;
    ALLOC_STACK;
 
+   OPUS_CLONE_DISPATCH(opus_multistream_encode_native, (st, copy_channel_in, pcm, analysis_frame_size,
+         data, max_data_bytes, lsb_depth, downmix, float_api, user_data));
+
    if (st->mapping_type == MAPPING_TYPE_SURROUND)
    {
       preemph_mem = ms_get_preemph_mem(st);
@@ -1205,6 +1209,8 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
    case OPUS_GET_PREDICTION_DISABLED_REQUEST:
    case OPUS_GET_PHASE_INVERSION_DISABLED_REQUEST:
    case OPUS_GET_QEXT_REQUEST:
+   case OPUS_GET_PARALLEL_ANALYSIS_REQUEST:
+   case OPUS_GET_NOISE_SUPPRESSION_REQUEST:
    {
       OpusEncoder *enc;
       /* For int32* GET params, just query the first stream */
@@ -1253,6 +1259,8 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
    case OPUS_SET_PREDICTION_DISABLED_REQUEST:
    case OPUS_SET_PHASE_INVERSION_DISABLED_REQUEST:
    case OPUS_SET_QEXT_REQUEST:
+   case OPUS_SET_PARALLEL_ANALYSIS_REQUEST:
+   case OPUS_SET_NOISE_SUPPRESSION_REQUEST:
    {
       int s;
       /* This works for int32 params */
@@ -1298,6 +1306,11 @@ int opus_multistream_encoder_ctl_va_list(OpusMSEncoder *st, int request,
    case OPUS_SET_EXPERT_FRAME_DURATION_REQUEST:
    {
        opus_int32 value = va_arg(ap, opus_int32);
+       /* The streams would each pick their own duration. */
+       if (value == OPUS_FRAMESIZE_ADAPTIVE)
+       {
+          goto bad_arg;
+       }
        st->variable_duration = value;
    }
    break;
@@ -172,6 +172,28 @@ typedef void (*opus_copy_channel_out_func)(
 #define OPUS_SET_FORCE_MODE_REQUEST    11002
 #define OPUS_SET_FORCE_MODE(x) OPUS_SET_FORCE_MODE_REQUEST, opus_check_int(x)
 
+struct silk_param_hints;
+
+/* Side information of a decoded frame that an encoder can reuse instead of
+   analysing its input again (see opus_transrater.c). */
+typedef struct {
+   struct silk_param_hints *silk;
+   CELTParamHints *celt;
+} OpusParamHints;
+
+#define opus_check_param_hints_ptr(ptr) ((ptr) + ((ptr) - (OpusParamHints*)(ptr)))
+
+/** Decoder: export the side information of each decoded frame.
+    Encoder: reuse the side information where it matches the encoded frame,
+    and skip the tonality analysis. NULL disables both. */
+#define OPUS_SET_PARAM_HINTS_REQUEST    11020
+#define OPUS_SET_PARAM_HINTS(x) OPUS_SET_PARAM_HINTS_REQUEST, opus_check_param_hints_ptr(x)
+
+/** Gets the last SILK gain index of the first channel, which the gain of the
+    next frame is delta coded against (see opus_gain_adjuster.c). */
+#define OPUS_GET_SILK_LAST_GAIN_INDEX_REQUEST    11021
+#define OPUS_GET_SILK_LAST_GAIN_INDEX(x) OPUS_GET_SILK_LAST_GAIN_INDEX_REQUEST, opus_check_int_ptr(x)
+
 typedef void (*downmix_func)(const void *, opus_val32 *, int, int, int, int, int);
 void downmix_float(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
 void downmix_int(const void *_x, opus_val32 *sub, int subframe, int offset, int c1, int c2, int C);
@@ -189,6 +211,10 @@ opus_int32 opus_encode_native(OpusEncoder *st, const opus_res *pcm, int frame_si
       const void *analysis_pcm, opus_int32 analysis_size, int c1, int c2,
       int analysis_channels, downmix_func downmix, int float_api);
 
+/* soft_clip value for opus_decode_native() that leaves the soft clipping of
+   a decoded packet, and the clipping state, to the caller. */
+#define SOFT_CLIP_DEFERRED 2
+
 int opus_decode_native(OpusDecoder *st, const unsigned char *data, opus_int32 len,
       opus_res *pcm, int frame_size, int decode_fec, int self_delimited,
       opus_int32 *packet_offset, int soft_clip, const OpusDRED *dred, opus_int32 dred_offset);
@@ -0,0 +1,343 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus.h"
+#include "opus_private.h"
+#include "os_support.h"
+
+/* Minimum amount of the original audio re-encoded on either side of the
+   crossfade, so that switching between original and re-encoded packets
+   happens away from it. */
+#define SPLICE_MARGIN 480
+/* Audio encoded and thrown away before the seam, so that the encoder state
+   has settled by the time the decoder switches to the seam packets. */
+#define SPLICE_PRIMING 1920
+/* Largest seam packet */
+#define SPLICE_MAX_PACKET 1275
+
+int opus_stream_cut(const unsigned char *const *packets, const opus_int32 *lens,
+      int nb_packets, int pre_skip, opus_int64 start, opus_int64 end,
+      unsigned char *out, opus_int32 maxlen, opus_int32 out_lens[2], int range[2],
+      int trims[2])
+{
+   int i;
+   int first=-1, last=-1;
+   int first_frame=0, last_frame=0, first_count=0;
+   opus_int64 dec_start, dec_end, roll;
+   opus_int64 t, first_start=0, last_end=0;
+   opus_int32 len;
+   OpusRepacketizer rp;
+
+   if (nb_packets < 1 || pre_skip < 0 || start < 0 || end <= start || maxlen < 1)
+      return OPUS_BAD_ARG;
+   dec_start = pre_skip + start;
+   dec_end = pre_skip + end;
+   /* Give the decoder time to converge before the first sample we keep.
+      Near the start of the stream, start from the beginning. */
+   roll = dec_start - OPUS_STREAM_EDIT_PREROLL;
+   if (roll < 0)
+      roll = 0;
+   /* Only the TOC of the packets up to the end of the cut is read. */
+   t = 0;
+   for (i=0;i<nb_packets;i++)
+   {
+      int count, frame_size;
+      opus_int64 next;
+      if (lens[i] < 1)
+         return OPUS_INVALID_PACKET;
+      count = opus_packet_get_nb_frames(packets[i], lens[i]);
+      if (count < 0)
+         return count;
+      frame_size = opus_packet_get_samples_per_frame(packets[i], 48000);
+      next = t + count*frame_size;
+      if (first < 0 && next > roll)
+      {
+         first = i;
+         first_count = count;
+         first_frame = (int)((roll - t)/frame_size);
+         first_start = t + first_frame*frame_size;
+      }
+      if (next >= dec_end)
+      {
+         last = i;
+         last_frame = (int)((dec_end - 1 - t)/frame_size);
+         last_end = t + (last_frame+1)*frame_size;
+         break;
+      }
+      t = next;
+   }
+   if (last < 0)
+      return OPUS_BAD_ARG;
+
+   /* Drop the frames outside the cut from the first and last packets. */
+   opus_repacketizer_init(&rp);
+   if (opus_repacketizer_cat(&rp, packets[first], lens[first]) != OPUS_OK)
+      return OPUS_INVALID_PACKET;
+   if (first == last)
+   {
+      len = opus_repacketizer_out_range(&rp, first_frame, last_frame+1, out, maxlen);
+      if (len < 0)
+         return len;
+      out_lens[0] = len;
+      out_lens[1] = 0;
+   } else {
+      len = opus_repacketizer_out_range(&rp, first_frame, first_count, out, maxlen);
+      if (len < 0)
+         return len;
+      out_lens[0] = len;
+      opus_repacketizer_init(&rp);
+      if (opus_repacketizer_cat(&rp, packets[last], lens[last]) != OPUS_OK)
+         return OPUS_INVALID_PACKET;
+      len = opus_repacketizer_out_range(&rp, 0, last_frame+1, out+out_lens[0], maxlen-out_lens[0]);
+      if (len < 0)
+         return len;
+      out_lens[1] = len;
+   }
+   range[0] = first;
+   range[1] = last;
+   trims[0] = (int)(dec_start - first_start);
+   trims[1] = (int)(last_end - dec_end);
+   return OPUS_OK;
+}
+
+static opus_int32 stream_bitrate(opus_int32 bytes, opus_int32 duration)
+{
+   return (opus_int32)((opus_int64)bytes*8*48000/IMAX(duration, 1));
+}
+
+static int packet_mode(const unsigned char *data)
+{
+   if (data[0]&0x80)
+      return MODE_CELT_ONLY;
+   else if ((data[0]&0x60) == 0x60)
+      return MODE_HYBRID;
+   return MODE_SILK_ONLY;
+}
+
+/* Decodes packets into pcm, which must hold all their samples. Returns the
+   number of samples decoded or an error code. */
+static opus_int32 decode_packets(OpusDecoder *dec, const unsigned char *const *packets,
+      const opus_int32 *lens, int count, int channels, opus_int16 *pcm)
+{
+   int i;
+   opus_int32 pos = 0;
+   for (i=0;i<count;i++)
+   {
+      int ret;
+      ret = opus_decode(dec, packets[i], lens[i], pcm+pos*channels, 5760, 0);
+      if (ret < 0)
+         return ret;
+      pos += ret;
+   }
+   return pos;
+}
+
+int opus_stream_splice(const unsigned char *const *a, const opus_int32 *a_lens, int a_count,
+      int a_end_trim, const unsigned char *const *b, const opus_int32 *b_lens, int b_count,
+      int b_pre_skip, int channels, int crossfade, unsigned char *out, opus_int32 maxlen,
+      opus_int32 *out_lens, int max_packets, int range[2])
+{
+   int i, j, k, c;
+   int ret;
+   int lookahead;
+   int nb_out;
+   opus_int32 xfade, a_end, fade_start;
+   opus_int32 s_a, s_k, t_b, b_needed, t;
+   opus_int32 a_bytes, b_bytes, bitrate;
+   opus_int32 seam_len, pos, written;
+   opus_int16 *pcm_a = NULL;
+   opus_int16 *pcm_b = NULL;
+   opus_int16 *seam = NULL;
+   unsigned char packet[SPLICE_MAX_PACKET];
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+
+   if (a_count < 1 || b_count < 1 || a_end_trim < 0 || b_pre_skip < 0 || channels < 1
+         || channels > 2 || crossfade < 0 || crossfade > 48000 || maxlen < 1 || max_packets < 1)
+      return OPUS_BAD_ARG;
+   enc = opus_encoder_create(48000, channels, OPUS_APPLICATION_AUDIO, &ret);
+   if (enc == NULL)
+      return ret;
+   opus_encoder_ctl(enc, OPUS_GET_LOOKAHEAD(&lookahead));
+
+   /* Positions in the first stream count from the end of its last packet, so
+      that the packets before the seam never need to be looked at. Positions in
+      the second stream count from the start of its first packet. Packet
+      boundaries are always multiples of 120 samples from either origin, so
+      lengthening the crossfade to make the seam a multiple of 120 samples
+      lets it be encoded as whole frames. */
+   a_end = -a_end_trim;
+   xfade = crossfade + (120 - (b_pre_skip + crossfade + a_end_trim)%120)%120;
+
+   /* First packet boundary of the second stream after the crossfade */
+   t = 0;
+   b_bytes = 0;
+   for (j=0;j<b_count && t < b_pre_skip+xfade+SPLICE_MARGIN;j++)
+   {
+      ret = b_lens[j] > 0 ? opus_packet_get_nb_samples(b[j], b_lens[j], 48000) : OPUS_INVALID_PACKET;
+      if (ret < 0)
+         goto done;
+      t += ret;
+      b_bytes += b_lens[j];
+   }
+   t_b = t;
+   /* The encoder needs the audio up to its lookahead past the seam. */
+   for (k=j;k<b_count && t < t_b+lookahead;k++)
+   {
+      ret = b_lens[k] > 0 ? opus_packet_get_nb_samples(b[k], b_lens[k], 48000) : OPUS_INVALID_PACKET;
+      if (ret < 0)
+         goto done;
+      t += ret;
+   }
+   if (t < t_b+lookahead)
+   {
+      ret = OPUS_BAD_ARG;
+      goto done;
+   }
+   b_needed = k;
+   pcm_b = (opus_int16*)opus_alloc(t*channels*sizeof(*pcm_b));
+
+   /* Last packet boundary of the first stream before the crossfade */
+   s_a = 0;
+   a_bytes = 0;
+   for (i=a_count;i>0 && s_a > a_end-xfade-SPLICE_MARGIN;i--)
+   {
+      ret = a_lens[i-1] > 0 ? opus_packet_get_nb_samples(a[i-1], a_lens[i-1], 48000) : OPUS_INVALID_PACKET;
+      if (ret < 0)
+         goto done;
+      s_a -= ret;
+      a_bytes += a_lens[i-1];
+   }
+   if (s_a > a_end-xfade-SPLICE_MARGIN)
+   {
+      ret = OPUS_BAD_ARG;
+      goto done;
+   }
+   /* Decode from early enough for the decoder to converge before the
+      encoder input starts. */
+   s_k = s_a;
+   for (k=i;k>0 && s_k > s_a-SPLICE_PRIMING+lookahead-OPUS_STREAM_EDIT_PREROLL;k--)
+   {
+      ret = a_lens[k-1] > 0 ? opus_packet_get_nb_samples(a[k-1], a_lens[k-1], 48000) : OPUS_INVALID_PACKET;
+      if (ret < 0)
+         goto done;
+      s_k -= ret;
+   }
+   pcm_a = (opus_int16*)opus_alloc(-s_k*channels*sizeof(*pcm_a));
+
+   /* The seam covers s_a up to the start of packet j of the second stream,
+      which ends up right after the crossfade. */
+   fade_start = a_end - xfade;
+   seam_len = SPLICE_PRIMING + (t_b - b_pre_skip + fade_start - s_a);
+   seam = (opus_int16*)opus_alloc(seam_len*channels*sizeof(*seam));
+   dec = (OpusDecoder*)opus_alloc(opus_decoder_get_size(channels));
+   if (pcm_a == NULL || pcm_b == NULL || seam == NULL || dec == NULL)
+   {
+      opus_free(dec);
+      ret = OPUS_ALLOC_FAIL;
+      goto done;
+   }
+   ret = opus_decoder_init(dec, 48000, channels);
+   if (ret == OPUS_OK)
+      ret = decode_packets(dec, a+k, a_lens+k, a_count-k, channels, pcm_a);
+   if (ret >= 0)
+   {
+      opus_decoder_ctl(dec, OPUS_RESET_STATE);
+      ret = decode_packets(dec, b, b_lens, b_needed, channels, pcm_b);
+   }
+   opus_free(dec);
+   if (ret < 0)
+      goto done;
+
+   /* The encoder output lags its input by the lookahead, so the input starts
+      that far ahead of the seam, minus the priming. */
+   for (pos=0;pos<seam_len;pos++)
+   {
+      opus_int32 o = s_a - SPLICE_PRIMING + lookahead + pos;
+      for (c=0;c<channels;c++)
+      {
+         opus_int32 va, vb;
+         va = o >= s_k && o < a_end ? pcm_a[(o-s_k)*channels+c] : 0;
+         vb = o >= fade_start ? pcm_b[(o-fade_start+b_pre_skip)*channels+c] : 0;
+         if (o >= fade_start && o < a_end)
+         {
+            opus_int32 w = (2*(o-fade_start)+1)*16384/xfade;
+            va = (va*(32768-w) + vb*w + 16384)>>15;
+         } else if (o >= a_end) {
+            va = vb;
+         }
+         seam[pos*channels+c] = (opus_int16)va;
+      }
+   }
+
+   /* Match the first packet kept from the second stream, so that the decoder
+      does not have to switch modes when it reaches it. */
+   bitrate = IMAX(stream_bitrate(a_bytes, -s_a), stream_bitrate(b_bytes, t_b));
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(IMAX(6000, IMIN(510000, bitrate))));
+   opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(opus_packet_get_bandwidth(b[j])));
+   opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(packet_mode(b[j])));
+   for (pos=0;pos<SPLICE_PRIMING;pos+=960)
+   {
+      ret = opus_encode(enc, seam+pos*channels, 960, packet, SPLICE_MAX_PACKET);
+      if (ret < 0)
+         goto done;
+   }
+   /* Frames shorter than 20 ms first, so that the seam ends with 20 ms frames
+      that SILK and hybrid can use. */
+   nb_out = 0;
+   written = 0;
+   while (pos < seam_len)
+   {
+      int frame_size = 120;
+      while (frame_size < 960 && !((seam_len-pos)%(2*frame_size)))
+         frame_size <<= 1;
+      ret = opus_encode(enc, seam+pos*channels, frame_size, packet, SPLICE_MAX_PACKET);
+      if (ret < 0)
+         goto done;
+      if (nb_out >= max_packets || ret > maxlen-written)
+      {
+         ret = OPUS_BUFFER_TOO_SMALL;
+         goto done;
+      }
+      OPUS_COPY(out+written, packet, ret);
+      out_lens[nb_out++] = ret;
+      written += ret;
+      pos += frame_size;
+   }
+   range[0] = i;
+   range[1] = j;
+   ret = nb_out;
+done:
+   opus_free(seam);
+   opus_free(pcm_b);
+   opus_free(pcm_a);
+   opus_encoder_destroy(enc);
+   return ret;
+}
@@ -0,0 +1,114 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus_thread.h"
+
+#ifdef ENABLE_THREADS
+
+#ifdef NONTHREADSAFE_PSEUDOSTACK
+#error "Thread support requires VAR_ARRAYS or USE_ALLOCA"
+#endif
+
+#include <pthread.h>
+
+static pthread_once_t helper_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t helper_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t helper_start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t helper_done_cond = PTHREAD_COND_INITIALIZER;
+static OpusThreadJob *helper_job = NULL;
+static int helper_busy = 0;
+static int helper_running = 0;
+
+static void *helper_main(void *arg)
+{
+   (void)arg;
+   pthread_mutex_lock(&helper_lock);
+   for (;;)
+   {
+      OpusThreadJob *job;
+      while (helper_job == NULL)
+         pthread_cond_wait(&helper_start_cond, &helper_lock);
+      job = helper_job;
+      helper_job = NULL;
+      pthread_mutex_unlock(&helper_lock);
+
+      job->run(job->arg);
+
+      pthread_mutex_lock(&helper_lock);
+      job->done = 1;
+      helper_busy = 0;
+      pthread_cond_broadcast(&helper_done_cond);
+   }
+   return NULL;
+}
+
+static void helper_init(void)
+{
+   pthread_t thread;
+   if (pthread_create(&thread, NULL, helper_main, NULL) == 0)
+   {
+      pthread_detach(thread);
+      pthread_mutex_lock(&helper_lock);
+      helper_running = 1;
+      pthread_mutex_unlock(&helper_lock);
+   }
+}
+
+int opus_thread_start(OpusThreadJob *job)
+{
+   int queued = 0;
+   pthread_once(&helper_once, helper_init);
+   job->done = 0;
+   pthread_mutex_lock(&helper_lock);
+   if (helper_running && !helper_busy)
+   {
+      helper_job = job;
+      helper_busy = 1;
+      queued = 1;
+      pthread_cond_signal(&helper_start_cond);
+   }
+   pthread_mutex_unlock(&helper_lock);
+   if (!queued)
+   {
+      job->run(job->arg);
+      job->done = 1;
+   }
+   return queued;
+}
+
+void opus_thread_wait(OpusThreadJob *job)
+{
+   pthread_mutex_lock(&helper_lock);
+   while (!job->done)
+      pthread_cond_wait(&helper_done_cond, &helper_lock);
+   pthread_mutex_unlock(&helper_lock);
+}
+
+#endif
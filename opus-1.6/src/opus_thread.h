@@ -0,0 +1,52 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef OPUS_THREAD_H
+#define OPUS_THREAD_H
+
+/* A single helper thread shared by everything in the process. There is no
+   queue: if the helper is busy (or could not be started), the job simply runs
+   in the calling thread, so callers never depend on it for correctness. */
+
+typedef struct OpusThreadJob {
+   void (*run)(void *arg);
+   void *arg;
+   int done;
+} OpusThreadJob;
+
+#ifdef ENABLE_THREADS
+
+/** Starts job->run(job->arg) on the helper thread. Returns 1 if the job was
+    handed to the helper, or 0 if it already ran in the calling thread.
+    Either way, opus_thread_wait() must be called before using the results. */
+int opus_thread_start(OpusThreadJob *job);
+
+/** Waits for a job started with opus_thread_start() to complete. */
+void opus_thread_wait(OpusThreadJob *job);
+
+#endif
+
+#endif /* OPUS_THREAD_H */
@@ -0,0 +1,198 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opus.h"
+#include "opus_private.h"
+#include "os_support.h"
+#include "stack_alloc.h"
+#include "structs.h"
+
+struct OpusTransrater {
+   int          channels;
+   int          decoder_offset;
+   int          encoder_offset;
+   silk_param_hints silk_hints;
+   CELTParamHints celt_hints;
+};
+
+int opus_transrater_get_size(int channels)
+{
+   int decSizeBytes, encSizeBytes;
+   if (channels<1 || channels>2)
+      return 0;
+   decSizeBytes = opus_decoder_get_size(channels);
+   encSizeBytes = opus_encoder_get_size(channels);
+   if (!decSizeBytes || !encSizeBytes)
+      return 0;
+   return align(sizeof(OpusTransrater))+align(decSizeBytes)+encSizeBytes;
+}
+
+int opus_transrater_init(OpusTransrater *st, int channels)
+{
+   int ret;
+   if (channels<1 || channels>2)
+      return OPUS_BAD_ARG;
+   OPUS_CLEAR((char*)st, opus_transrater_get_size(channels));
+   st->channels = channels;
+   st->decoder_offset = align(sizeof(OpusTransrater));
+   st->encoder_offset = st->decoder_offset+align(opus_decoder_get_size(channels));
+
+   ret = opus_decoder_init((OpusDecoder*)(void*)((char*)st+st->decoder_offset), 48000, channels);
+   if (ret != OPUS_OK)
+      return ret;
+   ret = opus_encoder_init((OpusEncoder*)(void*)((char*)st+st->encoder_offset), 48000, channels,
+         OPUS_APPLICATION_AUDIO);
+   if (ret != OPUS_OK)
+      return ret;
+   return OPUS_OK;
+}
+
+OpusTransrater *opus_transrater_create(int channels, int *error)
+{
+   int ret;
+   OpusTransrater *st;
+   if (channels<1 || channels>2)
+   {
+      if (error)
+         *error = OPUS_BAD_ARG;
+      return NULL;
+   }
+   st = (OpusTransrater *)opus_alloc(opus_transrater_get_size(channels));
+   if (st == NULL)
+   {
+      if (error)
+         *error = OPUS_ALLOC_FAIL;
+      return NULL;
+   }
+   ret = opus_transrater_init(st, channels);
+   if (error)
+      *error = ret;
+   if (ret != OPUS_OK)
+   {
+      opus_free(st);
+      st = NULL;
+   }
+   return st;
+}
+
+void opus_transrater_destroy(OpusTransrater *st)
+{
+   opus_free(st);
+}
+
+static int packet_mode(const unsigned char *data)
+{
+   if (data[0]&0x80)
+      return MODE_CELT_ONLY;
+   else if ((data[0]&0x60) == 0x60)
+      return MODE_HYBRID;
+   else
+      return MODE_SILK_ONLY;
+}
+
+opus_int32 opus_transrater_process(OpusTransrater *st, const unsigned char *data,
+      opus_int32 len, opus_int32 bitrate, unsigned char *out, opus_int32 maxlen)
+{
+   int i, count, frame_size;
+   int ret = OPUS_OK;
+   unsigned char toc;
+   const unsigned char *frames[48];
+   opus_int16 size[48];
+   OpusDecoder *dec;
+   OpusEncoder *enc;
+   OpusParamHints hints;
+   OpusRepacketizer rp;
+   VARDECL(opus_int32, pcm);
+   VARDECL(unsigned char, tmp);
+   SAVE_STACK;
+
+   if (data == NULL || len < 1 || out == NULL || maxlen < 1 || bitrate <= 0)
+   {
+      RESTORE_STACK;
+      return OPUS_BAD_ARG;
+   }
+   count = opus_packet_parse(data, len, &toc, frames, size, NULL);
+   if (count < 0)
+   {
+      RESTORE_STACK;
+      return count;
+   }
+   frame_size = opus_packet_get_samples_per_frame(data, 48000);
+   dec = (OpusDecoder*)(void*)((char*)st+st->decoder_offset);
+   enc = (OpusEncoder*)(void*)((char*)st+st->encoder_offset);
+
+   /* The decoder exports the side information of each frame, which the
+      encoder then uses in place of its own analysis. */
+   hints.silk = &st->silk_hints;
+   hints.celt = &st->celt_hints;
+   opus_decoder_ctl(dec, OPUS_SET_PARAM_HINTS(&hints));
+   opus_encoder_ctl(enc, OPUS_SET_PARAM_HINTS(&hints));
+   opus_encoder_ctl(enc, OPUS_SET_FORCE_MODE(packet_mode(data)));
+   opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(opus_packet_get_bandwidth(data)));
+   opus_encoder_ctl(enc, OPUS_SET_FORCE_CHANNELS(IMIN(st->channels, opus_packet_get_nb_channels(data))));
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(bitrate));
+
+   /* Frames are transrated one at a time so that the side information
+      always describes the frame being encoded. */
+   ALLOC(pcm, frame_size*st->channels, opus_int32);
+   ALLOC(tmp, count*(1+1275), unsigned char);
+   opus_repacketizer_init(&rp);
+   for (i=0;i<count;i++)
+   {
+      unsigned char *frame_out = tmp+i*(1+1275);
+      opus_int32 frame_len;
+      frame_out[0] = toc&0xFC;
+      OPUS_COPY(frame_out+1, frames[i], size[i]);
+      st->silk_hints.nFrames = 0;
+      st->celt_hints.valid = 0;
+      ret = opus_decode24(dec, frame_out, size[i]+1, pcm, frame_size, 0);
+      if (ret < 0)
+         break;
+      frame_len = opus_encode24(enc, pcm, frame_size, frame_out, 1+1275);
+      if (frame_len < 0)
+      {
+         ret = frame_len;
+         break;
+      }
+      ret = opus_repacketizer_cat(&rp, frame_out, frame_len);
+      if (ret != OPUS_OK)
+      {
+         /* The encoder switched configuration within the packet */
+         ret = OPUS_INTERNAL_ERROR;
+         break;
+      }
+   }
+   opus_decoder_ctl(dec, OPUS_SET_PARAM_HINTS((OpusParamHints*)NULL));
+   opus_encoder_ctl(enc, OPUS_SET_PARAM_HINTS((OpusParamHints*)NULL));
+   if (ret >= 0)
+      ret = opus_repacketizer_out(&rp, out, maxlen);
+   RESTORE_STACK;
+   return ret;
+}
@@ -0,0 +1,1510 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Microbenchmark for the run-time dispatched (RTCD) kernels.
+
+   For every kernel, the C reference and every arch level supported by the
+   host are timed on representative input sizes, and the output of each arch
+   is checked against the C reference in the same run. Integer kernels must
+   match exactly; float kernels are allowed the rounding differences that
+   come from a different summation order (and, for the int8 DNN layers, from
+   the unsigned input quantization used on x86).
+
+   The kernels that are called many times per frame are also timed through
+   the RTCD table and called directly ("rtcd" and "direct"), which is the
+   dispatch overhead the x86-64 level clones remove.
+
+   With OPUS_X86_CLONES, whole encode and decode runs are also timed for the
+   baseline build and every x86-64 level clone the host supports, and each
+   clone must produce exactly the same packets and audio.
+
+   Usage: opus_kernel_bench [-scale <n>] [<kernel> ...]
+   -scale multiplies the number of calls per measurement and the optional
+   kernel names restrict the run to kernels whose name contains one of them.
+   The exit status is non-zero if any arch does not match the reference. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "opus.h"
+#include "arch.h"
+#include "os_support.h"
+#include "cpu_support.h"
+#include "celt.h"
+#include "pitch.h"
+#include "celt_lpc.h"
+#include "vq.h"
+#include "mathops.h"
+#include "main.h"
+#include "tables.h"
+#include "tuning_parameters.h"
+#ifndef FIXED_POINT
+#undef PI /* mathops.h and SigProc_FLP.h disagree on its precision */
+#include "float/SigProc_FLP.h"
+#endif
+#if defined(ENABLE_DEEP_PLC) && !defined(USE_WEIGHTS_FILE)
+#define BENCH_DNN
+#include "nnet.h"
+#include "plc_data.h"
+#include "pitchdnn_data.h"
+#include "pitchdnn.h"
+#include "fargan_data.h"
+#ifdef ENABLE_DRED
+#include "dred_rdovae_dec_data.h"
+#endif
+#endif
+#if defined(ENABLE_OSCE_BWE) && !defined(DISABLE_BBWENET) && !defined(USE_WEIGHTS_FILE)
+#define BENCH_OSCE_BWE
+#include "osce.h"
+#endif
+#ifdef OPUS_X86_CLONES
+#include "src/opus_clones.h"
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BENCH_UNIT "cycles"
+static double bench_ticks(void)
+{
+   return (double)__rdtsc();
+}
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BENCH_UNIT "cycles"
+static double bench_ticks(void)
+{
+   return (double)__rdtsc();
+}
+#elif defined(CLOCK_MONOTONIC)
+#define BENCH_UNIT "ns"
+static double bench_ticks(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return 1e9*ts.tv_sec + ts.tv_nsec;
+}
+#else
+#define BENCH_UNIT "ns"
+static double bench_ticks(void)
+{
+   return clock()*(1e9/CLOCKS_PER_SEC);
+}
+#endif
+
+/* Keeps the compiler from hoisting the (possibly inlined) C reference out of
+   the timing loop. */
+#if defined(__GNUC__)
+#define BENCH_BARRIER() __asm__ __volatile__("" ::: "memory")
+#else
+#define BENCH_BARRIER()
+#endif
+
+#ifdef BENCH_DNN
+/* After <x86intrin.h>, as vec.h emulates the AVX types it lacks. */
+#include "vec.h"
+#endif
+
+#define BENCH_REPS 5
+#define BENCH_PI 3.14159265358979323846
+
+/* Pseudo-arch used to run the C reference. */
+#define ARCH_C (-1)
+
+#if defined(OPUS_HAVE_RTCD) && (defined(OPUS_X86_MAY_HAVE_SSE) || defined(OPUS_X86_MAY_HAVE_SSE2) || \
+    defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_X86_MAY_HAVE_AVX2) || defined(OPUS_X86_MAY_HAVE_AVX512))
+static const char *arch_names[] = {"base", "SSE", "SSE2", "SSE4.1", "AVX2", "AVX-512", "arch6", "arch7"};
+#elif defined(OPUS_HAVE_RTCD) && (defined(OPUS_ARM_ASM) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
+static const char *arch_names[] = {"ARMv4", "EDSP", "Media", "NEON", "DOTPROD", "arch5", "arch6", "arch7"};
+#else
+static const char *arch_names[] = {"default"};
+#endif
+
+typedef struct {
+   const char *name;
+   const char *size;
+   /* Calls per measurement at -scale 1. */
+   int iters;
+   void (*init)(void);
+   /* Restores any state the kernel updates, so that each arch starts from
+      the same input. May be NULL. */
+   void (*reset)(void);
+   void (*run)(int arch);
+   void (*save_ref)(void);
+   int (*check)(void);
+   /* Calls per second of audio for kernels that process whole frames, so
+      that the cost can also be reported per second (0 otherwise). */
+   int calls_per_sec;
+} KernelBench;
+
+static opus_uint32 bench_seed = 1;
+
+static float bench_rand(void)
+{
+   bench_seed = 1664525*bench_seed + 1013904223;
+   return (opus_int32)bench_seed*(1.f/2147483648.f);
+}
+
+/* Harmonic signal plus noise in [-1,1]. */
+static float bench_signal(int i, float period)
+{
+   return .5f*(float)sin(2*BENCH_PI*i/period) + .25f*(float)sin(6*BENCH_PI*i/period) + .25f*bench_rand();
+}
+
+#ifdef FIXED_POINT
+#define BENCH_VAL16(v) ((opus_val16)floor(.5+1024*(v)))
+#define BENCH_SIG(v) ((celt_sig)floor(.5+1024*4096*(v)))
+#define BENCH_NORM(v) ((celt_norm)floor(.5+NORM_SCALING*(v)))
+#else
+#define BENCH_VAL16(v) (v)
+#define BENCH_SIG(v) (32768*(v))
+#define BENCH_NORM(v) (v)
+#endif
+
+#if !defined(FIXED_POINT) || defined(BENCH_DNN)
+static int check_float(const float *out, const float *ref, int N, float tol)
+{
+   int i;
+   float maxref = 1e-9f;
+   for (i=0;i<N;i++)
+      maxref = MAX32(maxref, (float)fabs(ref[i]));
+   for (i=0;i<N;i++) {
+      if (!(fabs(out[i]-ref[i]) <= tol*maxref))
+         return 0;
+   }
+   return 1;
+}
+#endif
+
+#ifdef FIXED_POINT
+#define check_val32(out, ref, N) (memcmp(out, ref, (N)*sizeof(*(out))) == 0)
+#define check_val16(out, ref, N) (memcmp(out, ref, (N)*sizeof(*(out))) == 0)
+#else
+#define check_val32(out, ref, N) check_float(out, ref, N, 1e-5f)
+#define check_val16(out, ref, N) check_float(out, ref, N, 1e-5f)
+#endif
+
+/* CELT kernels */
+
+#define PITCH_LEN 240
+#define PITCH_MAX 244
+#define IP_LEN 480
+#define FIR_LEN 480
+#define FIR_ORD 24
+#define COMB_LEN 840
+#define COMB_T 400
+#define PVQ_N 16
+#define PVQ_K 10
+#define ROT_MAX 176
+#define TF_N 176
+#define TF_K 5
+#define TRANSIENT_LEN 1080
+#define PCM_LEN 1920
+
+static opus_val16 celt_x[IP_LEN+PITCH_MAX];
+static opus_val16 celt_y[IP_LEN+PITCH_MAX];
+static opus_val16 celt_y2[IP_LEN];
+static opus_val32 celt_out32[COMB_LEN];
+static opus_val32 celt_ref32[COMB_LEN];
+static opus_val16 celt_out16[FIR_LEN];
+static opus_val16 celt_ref16[FIR_LEN];
+static opus_val16 fir_num[FIR_ORD];
+static celt_sig comb_x[COMB_LEN+COMB_T+2];
+static celt_norm pvq_in[PVQ_N];
+static celt_norm pvq_x[PVQ_N];
+static int pvq_iy[PVQ_N];
+static int pvq_iy_ref[PVQ_N];
+static celt_norm rot_in[ROT_MAX];
+static celt_norm rot_x[ROT_MAX];
+static celt_norm rot_ref[ROT_MAX];
+static celt_norm tf_x[TF_K*TF_N];
+static celt_sig transient_x[2*TRANSIENT_LEN];
+#ifndef FIXED_POINT
+static opus_val16 transient_out[TRANSIENT_LEN+4];
+static opus_val16 transient_ref[TRANSIENT_LEN+4];
+#endif
+#ifndef DISABLE_FLOAT_API
+static float pcm_x[PCM_LEN];
+static opus_int16 pcm_out[PCM_LEN+1];
+static opus_int16 pcm_ref[PCM_LEN+1];
+static volatile int pcm_hint;
+#endif
+
+static void celt_init(void)
+{
+   int i;
+   for (i=0;i<IP_LEN+PITCH_MAX;i++) {
+      celt_x[i] = BENCH_VAL16(bench_signal(i, 97.3f));
+      celt_y[i] = BENCH_VAL16(bench_signal(i+50, 97.3f));
+   }
+   for (i=0;i<IP_LEN;i++)
+      celt_y2[i] = BENCH_VAL16(bench_signal(i+53, 97.3f));
+   for (i=0;i<FIR_ORD;i++)
+      fir_num[i] = QCONST16(.9f, SIG_SHIFT)*(1-2*(i&1))/(i+2);
+   for (i=0;i<COMB_LEN+COMB_T+2;i++)
+      comb_x[i] = BENCH_SIG(bench_signal(i, COMB_T));
+   {
+      float norm = 0;
+      float tmp[PVQ_N];
+      for (i=0;i<PVQ_N;i++) {
+         tmp[i] = bench_rand();
+         norm += tmp[i]*tmp[i];
+      }
+      norm = 1.f/(float)sqrt(norm);
+      for (i=0;i<PVQ_N;i++)
+         pvq_in[i] = BENCH_NORM(tmp[i]*norm);
+   }
+   for (i=0;i<ROT_MAX;i++)
+      rot_in[i] = BENCH_NORM(.1f*bench_rand());
+   for (i=0;i<TF_K*TF_N;i++)
+      tf_x[i] = BENCH_NORM(.1f*bench_rand());
+   for (i=0;i<TRANSIENT_LEN;i++) {
+      /* A click halfway through the left channel */
+      transient_x[i] = BENCH_SIG(.1f*bench_signal(i, 61.7f) + (i>=TRANSIENT_LEN/2 && i<TRANSIENT_LEN/2+8 ? .8f : 0));
+      transient_x[TRANSIENT_LEN+i] = BENCH_SIG(.3f*bench_signal(i+17, 43.1f));
+   }
+#ifndef DISABLE_FLOAT_API
+   for (i=0;i<PCM_LEN;i++)
+      pcm_x[i] = .9f*bench_signal(i, 73.1f);
+#endif
+}
+
+static void save_ref32(void)
+{
+   OPUS_COPY(celt_ref32, celt_out32, COMB_LEN);
+}
+
+static void save_ref16(void)
+{
+   OPUS_COPY(celt_ref16, celt_out16, FIR_LEN);
+}
+
+static void run_inner_prod(int arch)
+{
+   if (arch == ARCH_C) celt_out32[0] = celt_inner_prod_c(celt_x, celt_y, IP_LEN);
+   else celt_out32[0] = celt_inner_prod(celt_x, celt_y, IP_LEN, arch);
+}
+
+static int check_inner_prod(void)
+{
+   return check_val32(celt_out32, celt_ref32, 1);
+}
+
+static void run_dual_inner_prod(int arch)
+{
+   if (arch == ARCH_C) dual_inner_prod_c(celt_x, celt_y, celt_y2, IP_LEN, &celt_out32[0], &celt_out32[1]);
+   else dual_inner_prod(celt_x, celt_y, celt_y2, IP_LEN, &celt_out32[0], &celt_out32[1], arch);
+}
+
+static int check_dual_inner_prod(void)
+{
+   return check_val32(celt_out32, celt_ref32, 2);
+}
+
+static void run_xcorr_kernel(int arch)
+{
+   OPUS_CLEAR(celt_out32, 4);
+   if (arch == ARCH_C) xcorr_kernel_c(celt_x, celt_y, celt_out32, PITCH_LEN);
+   else xcorr_kernel(celt_x, celt_y, celt_out32, PITCH_LEN, arch);
+}
+
+static int check_xcorr_kernel(void)
+{
+   return check_val32(celt_out32, celt_ref32, 4);
+}
+
+static void run_pitch_xcorr(int arch)
+{
+   if (arch == ARCH_C) celt_pitch_xcorr_c(celt_x, celt_y, celt_out32, PITCH_LEN, PITCH_MAX, 0);
+   else celt_pitch_xcorr(celt_x, celt_y, celt_out32, PITCH_LEN, PITCH_MAX, arch);
+}
+
+static int check_pitch_xcorr(void)
+{
+   return check_val32(celt_out32, celt_ref32, PITCH_MAX);
+}
+
+static void run_fir(int arch)
+{
+   if (arch == ARCH_C) celt_fir_c(celt_x+FIR_ORD, fir_num, celt_out16, FIR_LEN, FIR_ORD, 0);
+   else celt_fir(celt_x+FIR_ORD, fir_num, celt_out16, FIR_LEN, FIR_ORD, arch);
+}
+
+static int check_fir(void)
+{
+   return check_val16(celt_out16, celt_ref16, FIR_LEN);
+}
+
+#ifdef OVERRIDE_COMB_FILTER_CONST
+static void run_comb_filter_const(int arch)
+{
+   opus_val16 g10 = QCONST16(.3066f*.5f, 15);
+   opus_val16 g11 = QCONST16(.2170f*.5f, 15);
+   opus_val16 g12 = QCONST16(.1296f*.5f, 15);
+#ifdef NON_STATIC_COMB_FILTER_CONST_C
+   if (arch == ARCH_C) comb_filter_const_c(celt_out32, comb_x+COMB_T+2, COMB_T, COMB_LEN, g10, g11, g12);
+   else
+#else
+   /* The C version is not built when the SIMD one is presumed, so compare
+      against the default arch instead. */
+   if (arch == ARCH_C) arch = 0;
+#endif
+   comb_filter_const(celt_out32, comb_x+COMB_T+2, COMB_T, COMB_LEN, g10, g11, g12, arch);
+}
+
+static int check_comb_filter_const(void)
+{
+   return check_val32(celt_out32, celt_ref32, COMB_LEN);
+}
+#endif
+
+static void run_pvq_search(int arch)
+{
+   OPUS_COPY(pvq_x, pvq_in, PVQ_N);
+   if (arch == ARCH_C) op_pvq_search_c(pvq_x, pvq_iy, PVQ_K, PVQ_N, 0);
+   else op_pvq_search(pvq_x, pvq_iy, PVQ_K, PVQ_N, arch);
+}
+
+static void save_ref_pvq(void)
+{
+   OPUS_COPY(pvq_iy_ref, pvq_iy, PVQ_N);
+}
+
+static int check_pvq_search(void)
+{
+   return memcmp(pvq_iy, pvq_iy_ref, sizeof(pvq_iy)) == 0;
+}
+
+/* The forward and inverse rotations of a band of N samples split into B
+   blocks, with the same second stride as exp_rotation(). */
+static void run_exp_rotation(int arch, int N, int B)
+{
+   int len, stride2=0;
+   opus_val16 c, s;
+   c = QCONST16(.9f, 15);
+   s = QCONST16(.43589f, 15);
+   if (N>=8*B)
+   {
+      stride2 = 1;
+      while ((stride2*stride2+stride2)*B + (B>>2) < N)
+         stride2++;
+   }
+   len = N/B;
+   OPUS_COPY(rot_x, rot_in, N);
+   if (arch == ARCH_C) {
+      exp_rotation_blocks_c(rot_x, len, B, stride2, c, s, 1, 0);
+      exp_rotation_blocks_c(rot_x, len, B, stride2, c, s, -1, 0);
+   } else {
+      exp_rotation_blocks(rot_x, len, B, stride2, c, s, 1, arch);
+      exp_rotation_blocks(rot_x, len, B, stride2, c, s, -1, arch);
+   }
+}
+
+static void run_exp_rotation_16(int arch) { run_exp_rotation(arch, 16, 1); }
+static void run_exp_rotation_176(int arch) { run_exp_rotation(arch, 176, 1); }
+static void run_exp_rotation_2x48(int arch) { run_exp_rotation(arch, 96, 2); }
+static void run_exp_rotation_4x16(int arch) { run_exp_rotation(arch, 64, 4); }
+static void run_exp_rotation_8x22(int arch) { run_exp_rotation(arch, 176, 8); }
+
+static void save_ref_rotation(void)
+{
+   OPUS_COPY(rot_ref, rot_x, ROT_MAX);
+}
+
+/* The blocks are rotated with the same arithmetic as the C code. */
+static int check_exp_rotation(void)
+{
+   return memcmp(rot_x, rot_ref, sizeof(rot_x)) == 0;
+}
+
+static void run_tf_l1_metrics(int arch)
+{
+   if (arch == ARCH_C) tf_l1_metrics_c(tf_x, TF_N, TF_K, celt_out32);
+   else tf_l1_metrics(tf_x, TF_N, TF_K, celt_out32, arch);
+}
+
+/* Every lane accumulates in the C order, so the sums must match exactly. */
+static int check_tf_l1_metrics(void)
+{
+   return memcmp(celt_out32, celt_ref32, TF_K*sizeof(*celt_out32)) == 0;
+}
+
+#ifndef FIXED_POINT
+static void run_transient_energy(int arch)
+{
+   /* The masked energy of both channels, followed by their mean and maximum. */
+   opus_val16 *out = transient_out;
+   if (arch == ARCH_C) transient_energy_c(transient_x, TRANSIENT_LEN, 2, .0625f, out, out+TRANSIENT_LEN, out+TRANSIENT_LEN+2);
+   else transient_energy(transient_x, TRANSIENT_LEN, 2, .0625f, out, out+TRANSIENT_LEN, out+TRANSIENT_LEN+2, arch);
+}
+
+static void save_ref_transient(void)
+{
+   OPUS_COPY(transient_ref, transient_out, TRANSIENT_LEN+4);
+}
+
+static int check_transient_energy(void)
+{
+   return memcmp(transient_out, transient_ref, sizeof(transient_out)) == 0;
+}
+#endif
+
+#ifndef DISABLE_FLOAT_API
+static void run_float2int16(int arch)
+{
+   if (arch == ARCH_C) celt_float2int16_c(pcm_x, pcm_out, PCM_LEN);
+   else celt_float2int16(pcm_x, pcm_out, PCM_LEN, arch);
+}
+
+static void run_float2int16_checkwithin1(int arch)
+{
+   /* The result of the range check is stored after the samples. */
+   if (arch == ARCH_C) pcm_out[PCM_LEN] = celt_float2int16_checkwithin1_c(pcm_x, pcm_out, PCM_LEN);
+   else pcm_out[PCM_LEN] = celt_float2int16_checkwithin1(pcm_x, pcm_out, PCM_LEN, arch);
+}
+
+static void run_limit2_checkwithin1(int arch)
+{
+   /* The input is within [-1,1], so it is never modified. The returned hint
+      is implementation-dependent and not checked. */
+   if (arch == ARCH_C) pcm_hint = opus_limit2_checkwithin1_c(pcm_x, PCM_LEN);
+   else pcm_hint = opus_limit2_checkwithin1(pcm_x, PCM_LEN, arch);
+}
+
+static void save_ref_pcm(void)
+{
+   OPUS_COPY(pcm_ref, pcm_out, PCM_LEN+1);
+}
+
+static int check_pcm(void)
+{
+   return memcmp(pcm_out, pcm_ref, sizeof(pcm_out)) == 0;
+}
+#endif
+
+/* SILK kernels */
+
+#define SILK_FS_KHZ 16
+#define SILK_NB_SUBFR 4
+#define SILK_SUBFR_LEN (5*SILK_FS_KHZ)
+#define SILK_FRAME_LEN (SILK_NB_SUBFR*SILK_SUBFR_LEN)
+#define SILK_LPC_ORDER 16
+#define BURG_LEN (SILK_NB_SUBFR*(SILK_LPC_ORDER+SILK_SUBFR_LEN))
+
+static silk_encoder_state silk_enc;
+static silk_encoder_state silk_enc_saved;
+static silk_nsq_state silk_nsq;
+static silk_nsq_state silk_nsq_saved;
+static silk_nsq_state silk_nsq_ref;
+static SideInfoIndices silk_indices;
+static SideInfoIndices silk_indices_ref;
+static opus_int16 silk_x16[BURG_LEN];
+static opus_int8 silk_pulses[SILK_FRAME_LEN];
+static opus_int8 silk_pulses_ref[SILK_FRAME_LEN];
+static opus_int16 silk_PredCoef_Q12[2*MAX_LPC_ORDER];
+static opus_int16 silk_LTPCoef_Q14[LTP_ORDER*MAX_NB_SUBFR];
+static opus_int16 silk_AR_Q13[MAX_NB_SUBFR*MAX_SHAPE_LPC_ORDER];
+static opus_int silk_HarmShapeGain_Q14[MAX_NB_SUBFR];
+static opus_int silk_Tilt_Q14[MAX_NB_SUBFR];
+static opus_int32 silk_LF_shp_Q14[MAX_NB_SUBFR];
+static opus_int32 silk_Gains_Q16[MAX_NB_SUBFR];
+static opus_int silk_pitchL[MAX_NB_SUBFR];
+static opus_int32 silk_XX_Q17[LTP_ORDER*LTP_ORDER];
+static opus_int32 silk_xX_Q17[LTP_ORDER];
+static opus_int16 silk_NLSF_Q15[MAX_LPC_ORDER];
+/* Distinct vectors for silk_NLSF_encode(), so that the branches of the C
+   trellis are not all learned by the predictor. */
+#define SILK_NLSF_SETS 16
+static opus_int16 silk_NLSF_set_Q15[SILK_NLSF_SETS][MAX_LPC_ORDER];
+static opus_int16 silk_NLSF_W_QW[SILK_NLSF_SETS][MAX_LPC_ORDER];
+static opus_int32 silk_out32[64];
+static opus_int32 silk_ref32[64];
+#ifndef FIXED_POINT
+static silk_float silk_xflp[BURG_LEN];
+static double silk_outd;
+static double silk_refd;
+#endif
+
+static void silk_init(void)
+{
+   int i, k;
+   OPUS_CLEAR(&silk_enc, 1);
+   OPUS_CLEAR(&silk_nsq, 1);
+   OPUS_CLEAR(&silk_indices, 1);
+   silk_enc.fs_kHz = SILK_FS_KHZ;
+   silk_enc.nb_subfr = SILK_NB_SUBFR;
+   silk_enc.subfr_length = SILK_SUBFR_LEN;
+   silk_enc.frame_length = SILK_FRAME_LEN;
+   silk_enc.ltp_mem_length = LTP_MEM_LENGTH_MS*SILK_FS_KHZ;
+   silk_enc.predictLPCOrder = SILK_LPC_ORDER;
+   silk_enc.shapingLPCOrder = MAX_SHAPE_LPC_ORDER;
+   silk_enc.nStatesDelayedDecision = MAX_DEL_DEC_STATES;
+   silk_VAD_Init(&silk_enc.sVAD);
+   silk_enc_saved = silk_enc;
+
+   silk_nsq.prev_gain_Q16 = 65536;
+   silk_nsq.lagPrev = 100;
+   silk_nsq_saved = silk_nsq;
+   silk_indices.signalType = TYPE_VOICED;
+   silk_indices.NLSFInterpCoef_Q2 = 4;
+
+   for (i=0;i<BURG_LEN;i++)
+      silk_x16[i] = (opus_int16)floor(.5+6000*bench_signal(i, 112.5f));
+   for (i=0;i<SILK_LPC_ORDER;i++) {
+      silk_PredCoef_Q12[i] = silk_PredCoef_Q12[i+MAX_LPC_ORDER] =
+            (opus_int16)floor(.5+4096*.6*pow(.6, i)*(1-2*(i&1)));
+   }
+   for (k=0;k<MAX_NB_SUBFR;k++) {
+      for (i=0;i<MAX_SHAPE_LPC_ORDER;i++)
+         silk_AR_Q13[k*MAX_SHAPE_LPC_ORDER+i] = (opus_int16)floor(.5+8192*.3*pow(.7, i));
+      silk_LTPCoef_Q14[k*LTP_ORDER+1] = SILK_FIX_CONST(.1, 14);
+      silk_LTPCoef_Q14[k*LTP_ORDER+2] = SILK_FIX_CONST(.5, 14);
+      silk_LTPCoef_Q14[k*LTP_ORDER+3] = SILK_FIX_CONST(.1, 14);
+      silk_HarmShapeGain_Q14[k] = SILK_FIX_CONST(.3, 14);
+      silk_Tilt_Q14[k] = -SILK_FIX_CONST(.2, 14);
+      silk_LF_shp_Q14[k] = silk_LSHIFT(SILK_FIX_CONST(.45, 14), 16) | (opus_uint16)-SILK_FIX_CONST(.5, 14);
+      silk_Gains_Q16[k] = silk_LSHIFT(120, 16);
+      silk_pitchL[k] = 110 + 2*k;
+   }
+   for (i=0;i<LTP_ORDER;i++) {
+      for (k=0;k<LTP_ORDER;k++)
+         silk_XX_Q17[i*LTP_ORDER+k] = (opus_int32)floor(.5+131072*pow(.8, abs(i-k)));
+      silk_xX_Q17[i] = (opus_int32)floor(.5+131072*.7*pow(.5, abs(i-2)));
+   }
+   for (i=0;i<SILK_LPC_ORDER;i++)
+      silk_NLSF_Q15[i] = (opus_int16)((i+1)*32767/(SILK_LPC_ORDER+1) + 300*bench_rand());
+   for (k=0;k<SILK_NLSF_SETS;k++) {
+      for (i=0;i<SILK_LPC_ORDER;i++)
+         silk_NLSF_set_Q15[k][i] = (opus_int16)((i+1)*32767/(SILK_LPC_ORDER+1) + 300*bench_rand());
+      silk_NLSF_VQ_weights_laroia(silk_NLSF_W_QW[k], silk_NLSF_set_Q15[k], SILK_LPC_ORDER);
+   }
+#ifndef FIXED_POINT
+   for (i=0;i<BURG_LEN;i++)
+      silk_xflp[i] = silk_x16[i];
+#endif
+}
+
+static void save_ref_silk32(void)
+{
+   OPUS_COPY(silk_ref32, silk_out32, 64);
+}
+
+static int check_silk32(void)
+{
+   return memcmp(silk_out32, silk_ref32, sizeof(silk_out32)) == 0;
+}
+
+static void reset_vad(void)
+{
+   silk_enc = silk_enc_saved;
+}
+
+static void run_vad(int arch)
+{
+   int i;
+   if (arch == ARCH_C) silk_VAD_GetSA_Q8_c(&silk_enc, silk_x16);
+   else silk_VAD_GetSA_Q8(&silk_enc, silk_x16, arch);
+   silk_out32[0] = silk_enc.speech_activity_Q8;
+   silk_out32[1] = silk_enc.input_tilt_Q15;
+   for (i=0;i<VAD_N_BANDS;i++)
+      silk_out32[2+i] = silk_enc.input_quality_bands_Q15[i];
+}
+
+static void reset_nsq(void)
+{
+   silk_nsq = silk_nsq_saved;
+   silk_indices.Seed = 0;
+}
+
+static void save_ref_nsq(void)
+{
+   silk_nsq_ref = silk_nsq;
+   silk_indices_ref = silk_indices;
+   OPUS_COPY(silk_pulses_ref, silk_pulses, SILK_FRAME_LEN);
+}
+
+static int check_nsq(void)
+{
+   return memcmp(silk_pulses, silk_pulses_ref, sizeof(silk_pulses)) == 0
+       && memcmp(silk_nsq.xq, silk_nsq_ref.xq, sizeof(silk_nsq.xq)) == 0
+       && silk_nsq.rand_seed == silk_nsq_ref.rand_seed
+       && silk_indices.Seed == silk_indices_ref.Seed;
+}
+
+static void run_nsq(int arch)
+{
+   silk_enc.warping_Q16 = 0;
+   silk_enc.arch = arch == ARCH_C ? 0 : arch;
+   if (arch == ARCH_C) {
+      silk_NSQ_c(&silk_enc, &silk_nsq, &silk_indices, silk_x16, silk_pulses, silk_PredCoef_Q12,
+            silk_LTPCoef_Q14, silk_AR_Q13, silk_HarmShapeGain_Q14, silk_Tilt_Q14, silk_LF_shp_Q14,
+            silk_Gains_Q16, silk_pitchL, SILK_FIX_CONST(1.2, 10), SILK_FIX_CONST(.95, 14));
+   } else {
+      silk_NSQ(&silk_enc, &silk_nsq, &silk_indices, silk_x16, silk_pulses, silk_PredCoef_Q12,
+            silk_LTPCoef_Q14, silk_AR_Q13, silk_HarmShapeGain_Q14, silk_Tilt_Q14, silk_LF_shp_Q14,
+            silk_Gains_Q16, silk_pitchL, SILK_FIX_CONST(1.2, 10), SILK_FIX_CONST(.95, 14), arch);
+   }
+}
+
+static void run_nsq_del_dec(int arch)
+{
+   silk_enc.warping_Q16 = SILK_FS_KHZ*SILK_FIX_CONST(WARPING_MULTIPLIER, 16);
+   silk_enc.arch = arch == ARCH_C ? 0 : arch;
+   if (arch == ARCH_C) {
+      silk_NSQ_del_dec_c(&silk_enc, &silk_nsq, &silk_indices, silk_x16, silk_pulses, silk_PredCoef_Q12,
+            silk_LTPCoef_Q14, silk_AR_Q13, silk_HarmShapeGain_Q14, silk_Tilt_Q14, silk_LF_shp_Q14,
+            silk_Gains_Q16, silk_pitchL, SILK_FIX_CONST(1.2, 10), SILK_FIX_CONST(.95, 14));
+   } else {
+      silk_NSQ_del_dec(&silk_enc, &silk_nsq, &silk_indices, silk_x16, silk_pulses, silk_PredCoef_Q12,
+            silk_LTPCoef_Q14, silk_AR_Q13, silk_HarmShapeGain_Q14, silk_Tilt_Q14, silk_LF_shp_Q14,
+            silk_Gains_Q16, silk_pitchL, SILK_FIX_CONST(1.2, 10), SILK_FIX_CONST(.95, 14), arch);
+   }
+}
+
+static void run_vq_wmat_ec(int arch)
+{
+   opus_int8 ind;
+   opus_int gain_Q7;
+   if (arch == ARCH_C) {
+      silk_VQ_WMat_EC_c(&ind, &silk_out32[1], &silk_out32[2], &gain_Q7, silk_XX_Q17, silk_xX_Q17,
+            silk_LTP_vq_ptrs_Q7[2], silk_LTP_vq_gain_ptrs_Q7[2], silk_LTP_gain_BITS_Q5_ptrs[2],
+            SILK_SUBFR_LEN, SILK_FIX_CONST(1.5, 7), silk_LTP_vq_sizes[2]);
+   } else {
+      silk_VQ_WMat_EC(&ind, &silk_out32[1], &silk_out32[2], &gain_Q7, silk_XX_Q17, silk_xX_Q17,
+            silk_LTP_vq_ptrs_Q7[2], silk_LTP_vq_gain_ptrs_Q7[2], silk_LTP_gain_BITS_Q5_ptrs[2],
+            SILK_SUBFR_LEN, SILK_FIX_CONST(1.5, 7), silk_LTP_vq_sizes[2], arch);
+   }
+   silk_out32[0] = ind;
+   silk_out32[3] = gain_Q7;
+}
+
+static void run_nlsf_vq(int arch)
+{
+   const silk_NLSF_CB_struct *cb = &silk_NLSF_CB_WB;
+   if (arch == ARCH_C) silk_NLSF_VQ_c(silk_out32, silk_NLSF_Q15, cb->CB1_NLSF_Q8, cb->CB1_Wght_Q9, cb->nVectors, cb->order);
+   else silk_NLSF_VQ(silk_out32, silk_NLSF_Q15, cb->CB1_NLSF_Q8, cb->CB1_Wght_Q9, cb->nVectors, cb->order, arch);
+}
+
+/* The first stage VQ and the survivor trellises of SILK_NLSF_SETS vectors,
+   as at complexity 10. */
+static void run_nlsf_encode(int arch)
+{
+   opus_int8 indices[MAX_LPC_ORDER+1];
+   opus_int16 NLSF_Q15[MAX_LPC_ORDER];
+   opus_uint32 hash;
+   int i, k;
+   /* The kernels are called through silk_NLSF_encode(), so the default arch
+      stands in for the C version. */
+   if (arch == ARCH_C) arch = 0;
+   for (k=0;k<SILK_NLSF_SETS;k++) {
+      OPUS_COPY(NLSF_Q15, silk_NLSF_set_Q15[k], SILK_LPC_ORDER);
+      silk_out32[2*k] = silk_NLSF_encode(indices, NLSF_Q15, &silk_NLSF_CB_WB, silk_NLSF_W_QW[k],
+            SILK_FIX_CONST(0.003, 20), 16, TYPE_VOICED, arch);
+      hash = 0;
+      for (i=0;i<SILK_LPC_ORDER;i++)
+         hash = 31*hash + (opus_uint32)(indices[i]*65536 + NLSF_Q15[i]);
+      silk_out32[2*k+1] = (opus_int32)hash;
+   }
+}
+
+#ifdef FIXED_POINT
+static void run_inner_prod16(int arch)
+{
+   opus_int64 ret;
+   if (arch == ARCH_C) ret = silk_inner_prod16_c(silk_x16, silk_x16+1, BURG_LEN-1);
+   else ret = silk_inner_prod16(silk_x16, silk_x16+1, BURG_LEN-1, arch);
+   silk_out32[0] = (opus_int32)ret;
+   silk_out32[1] = (opus_int32)(ret>>32);
+}
+
+static void run_burg_modified(int arch)
+{
+   opus_int32 res_nrg;
+   opus_int res_nrg_Q;
+   if (arch == ARCH_C) {
+      silk_burg_modified_c(&res_nrg, &res_nrg_Q, &silk_out32[2], silk_x16, SILK_FIX_CONST(1e-4, 30),
+            SILK_LPC_ORDER+SILK_SUBFR_LEN, SILK_NB_SUBFR, SILK_LPC_ORDER, 0);
+   } else {
+      silk_burg_modified(&res_nrg, &res_nrg_Q, &silk_out32[2], silk_x16, SILK_FIX_CONST(1e-4, 30),
+            SILK_LPC_ORDER+SILK_SUBFR_LEN, SILK_NB_SUBFR, SILK_LPC_ORDER, arch);
+   }
+   silk_out32[0] = res_nrg;
+   silk_out32[1] = res_nrg_Q;
+}
+#else
+static void run_inner_product_FLP(int arch)
+{
+   if (arch == ARCH_C) silk_outd = silk_inner_product_FLP_c(silk_xflp, silk_xflp+1, BURG_LEN-1);
+   else silk_outd = silk_inner_product_FLP(silk_xflp, silk_xflp+1, BURG_LEN-1, arch);
+}
+
+static void save_ref_flp(void)
+{
+   silk_refd = silk_outd;
+}
+
+static int check_flp(void)
+{
+   return fabs(silk_outd-silk_refd) <= 1e-9*fabs(silk_refd);
+}
+#endif
+
+#ifdef BENCH_DNN
+
+/* DNN kernels, using layers of the built-in PLC and pitch models. */
+
+#define DNN_MAX 1024
+#define CONV_HEIGHT NB_XCORR_FEATURES
+#define CONV_STRIDE (NB_XCORR_FEATURES+2)
+
+static PLCModel plc_model;
+static PitchDNN pitch_model;
+static float dnn_in[4*DNN_MAX];
+static float dnn_out[4*DNN_MAX];
+static float dnn_ref[4*DNN_MAX];
+static float dnn_mem[4*DNN_MAX];
+static float dnn_mem_saved[4*DNN_MAX];
+static int dnn_ok;
+static LinearLayer dense_half;
+static opus_uint16 dense_half_weights[PLC_DENSE_IN_OUT_SIZE*DNN_MAX];
+
+static void dnn_init(void)
+{
+   int i;
+   dnn_ok = init_plcmodel(&plc_model, plcmodel_arrays) == 0
+         && init_pitchdnn(&pitch_model, pitchdnn_arrays) == 0;
+   if (dnn_ok) {
+      dense_half = plc_model.plc_dense_in;
+      for (i=0;i<dense_half.nb_inputs*dense_half.nb_outputs;i++)
+         dense_half_weights[i] = float_to_half(dense_half.float_weights[i]);
+      dense_half.float_weights = NULL;
+      dense_half.half_weights = dense_half_weights;
+   }
+   for (i=0;i<4*DNN_MAX;i++) {
+      dnn_in[i] = bench_rand();
+      dnn_mem_saved[i] = bench_rand();
+   }
+}
+
+static void save_ref_dnn(void)
+{
+   OPUS_COPY(dnn_ref, dnn_out, 4*DNN_MAX);
+}
+
+static void run_dense_float(int arch)
+{
+   if (arch == ARCH_C) compute_linear_c(&plc_model.plc_dense_in, dnn_out, dnn_in);
+   else compute_linear(&plc_model.plc_dense_in, dnn_out, dnn_in, arch);
+}
+
+static int check_dense_float(void)
+{
+   return dnn_ok && check_float(dnn_out, dnn_ref, plc_model.plc_dense_in.nb_outputs, 1e-5f);
+}
+
+/* The reference is the float layer, so this also checks the fp16 rounding. */
+static void run_dense_half(int arch)
+{
+   if (arch == ARCH_C) compute_linear_c(&plc_model.plc_dense_in, dnn_out, dnn_in);
+   else compute_linear(&dense_half, dnn_out, dnn_in, arch);
+}
+
+static int check_dense_half(void)
+{
+   return dnn_ok && check_float(dnn_out, dnn_ref, plc_model.plc_dense_in.nb_outputs, 2e-3f);
+}
+
+static void run_dense_int8(int arch)
+{
+   if (arch == ARCH_C) compute_linear_c(&plc_model.plc_gru1_recurrent, dnn_out, dnn_in);
+   else compute_linear(&plc_model.plc_gru1_recurrent, dnn_out, dnn_in, arch);
+}
+
+static int check_dense_int8(void)
+{
+   /* x86 quantizes the inputs to 8 bits. */
+   return dnn_ok && check_float(dnn_out, dnn_ref, plc_model.plc_gru1_recurrent.nb_outputs, 2e-2f);
+}
+
+static void run_tanh(int arch)
+{
+   if (arch == ARCH_C) compute_activation_c(dnn_out, dnn_in, DNN_MAX, ACTIVATION_TANH);
+   else compute_activation(dnn_out, dnn_in, DNN_MAX, ACTIVATION_TANH, arch);
+}
+
+static void run_sigmoid(int arch)
+{
+   if (arch == ARCH_C) compute_activation_c(dnn_out, dnn_in, DNN_MAX, ACTIVATION_SIGMOID);
+   else compute_activation(dnn_out, dnn_in, DNN_MAX, ACTIVATION_SIGMOID, arch);
+}
+
+static void run_valin(int arch)
+{
+   if (arch == ARCH_C) compute_activation_c(dnn_out, dnn_in, DNN_MAX, ACTIVATION_VALIN);
+   else compute_activation(dnn_out, dnn_in, DNN_MAX, ACTIVATION_VALIN, arch);
+}
+
+static int check_activation(void)
+{
+   return check_float(dnn_out, dnn_ref, DNN_MAX, 1e-3f);
+}
+
+static void reset_conv2d(void)
+{
+   OPUS_COPY(dnn_mem, dnn_mem_saved, 4*DNN_MAX);
+}
+
+static void run_conv2d(int arch)
+{
+   if (arch == ARCH_C) compute_conv2d_c(&pitch_model.conv2d_2, dnn_out, dnn_mem, dnn_in, CONV_HEIGHT, CONV_STRIDE, ACTIVATION_TANH);
+   else compute_conv2d(&pitch_model.conv2d_2, dnn_out, dnn_mem, dnn_in, CONV_HEIGHT, CONV_STRIDE, ACTIVATION_TANH, arch);
+}
+
+static int check_conv2d(void)
+{
+   return dnn_ok && check_float(dnn_out, dnn_ref, CONV_HEIGHT, 1e-3f);
+}
+
+/* GRU layers of the models. The reference is the unfused sequence of
+   compute_linear() and compute_activation() calls that compute_generic_gru()
+   used to make, so the compute_gru rows check the fused GRU of every arch
+   against it and the gru_unfused rows give the cost of the old sequence. */
+
+#define GRU_MAX 512
+
+static const LinearLayer *gru_input;
+static const LinearLayer *gru_recurrent;
+static float gru_tol;
+static FARGAN fargan_model;
+#ifdef ENABLE_DRED
+static RDOVAEDec rdovae_dec_model;
+#endif
+
+static void gru_init_plc(void)
+{
+   dnn_init();
+   gru_input = &plc_model.plc_gru1_input;
+   gru_recurrent = &plc_model.plc_gru1_recurrent;
+   gru_tol = 2e-2f;
+}
+
+static void gru_init_pitch(void)
+{
+   dnn_init();
+   gru_input = &pitch_model.gru_1_input;
+   gru_recurrent = &pitch_model.gru_1_recurrent;
+   gru_tol = 2e-2f;
+}
+
+static void gru_init_fargan(void)
+{
+   dnn_init();
+   dnn_ok = dnn_ok && init_fargan(&fargan_model, fargan_arrays) == 0;
+   gru_input = &fargan_model.sig_net_gru1_input;
+   gru_recurrent = &fargan_model.sig_net_gru1_recurrent;
+   gru_tol = 2e-2f;
+}
+
+#ifdef ENABLE_DRED
+static void gru_init_rdovae(void)
+{
+   dnn_init();
+   dnn_ok = dnn_ok && init_rdovaedec(&rdovae_dec_model, rdovaedec_arrays) == 0;
+   gru_input = &rdovae_dec_model.dec_gru1_input;
+   gru_recurrent = &rdovae_dec_model.dec_gru1_recurrent;
+   gru_tol = 2e-2f;
+}
+#endif
+
+static void reset_gru(void)
+{
+   OPUS_COPY(dnn_mem, dnn_mem_saved, GRU_MAX);
+}
+
+static void gru_unfused(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int arch)
+{
+   int i, N;
+   float zrh[3*GRU_MAX];
+   float recur[3*GRU_MAX];
+   float *z, *r, *h;
+   N = recurrent_weights->nb_inputs;
+   z = zrh;
+   r = &zrh[N];
+   h = &zrh[2*N];
+   if (arch == ARCH_C) {
+      compute_linear_c(input_weights, zrh, in);
+      compute_linear_c(recurrent_weights, recur, state);
+   } else {
+      compute_linear(input_weights, zrh, in, arch);
+      compute_linear(recurrent_weights, recur, state, arch);
+   }
+   for (i=0;i<2*N;i++)
+      zrh[i] += recur[i];
+   if (arch == ARCH_C) compute_activation_c(zrh, zrh, 2*N, ACTIVATION_SIGMOID);
+   else compute_activation(zrh, zrh, 2*N, ACTIVATION_SIGMOID, arch);
+   for (i=0;i<N;i++)
+      h[i] += recur[2*N+i]*r[i];
+   if (arch == ARCH_C) compute_activation_c(h, h, N, ACTIVATION_TANH);
+   else compute_activation(h, h, N, ACTIVATION_TANH, arch);
+   for (i=0;i<N;i++)
+      state[i] = z[i]*state[i] + (1-z[i])*h[i];
+}
+
+static void run_gru(int arch)
+{
+   if (arch == ARCH_C) gru_unfused(gru_input, gru_recurrent, dnn_mem, dnn_in, ARCH_C);
+   else compute_gru(gru_input, gru_recurrent, dnn_mem, dnn_in, arch);
+}
+
+static void run_gru_unfused(int arch)
+{
+   gru_unfused(gru_input, gru_recurrent, dnn_mem, dnn_in, arch);
+}
+
+static void save_ref_gru(void)
+{
+   OPUS_COPY(dnn_ref, dnn_mem, GRU_MAX);
+}
+
+static int check_gru(void)
+{
+   return dnn_ok && check_float(dnn_mem, dnn_ref, gru_recurrent->nb_inputs, gru_tol);
+}
+#endif
+
+#ifdef BENCH_OSCE_BWE
+
+/* Complete BBWENet bandwidth extension of a 20 ms frame (16 kHz in, 48 kHz
+   out). There is no separate C version, so arch 0 is the reference. */
+
+#define BWE_LEN 320
+
+static OSCEModel bwe_model;
+static silk_OSCE_BWE_struct bwe_state;
+static opus_int16 bwe_in[BWE_LEN];
+static opus_int16 bwe_out[3*BWE_LEN];
+static opus_int16 bwe_ref[3*BWE_LEN];
+static int bwe_ok;
+
+static void bwe_init(void)
+{
+   int i;
+   OPUS_CLEAR(&bwe_model, 1);
+   bwe_ok = osce_load_models(&bwe_model, NULL, 0) == 0;
+   for (i=0;i<BWE_LEN;i++) {
+      bwe_in[i] = (opus_int16)floor(.5+8000*bench_signal(i, 80.f)+500*bench_rand());
+   }
+}
+
+static void reset_bwe(void)
+{
+   osce_bwe_reset(&bwe_state);
+}
+
+static void run_bwe(int arch)
+{
+   osce_bwe(&bwe_model, &bwe_state, bwe_out, bwe_in, BWE_LEN, arch < 0 ? 0 : arch);
+}
+
+static void save_ref_bwe(void)
+{
+   OPUS_COPY(bwe_ref, bwe_out, 3*BWE_LEN);
+}
+
+static int check_bwe(void)
+{
+   int i;
+   if (!bwe_ok) return 0;
+   /* The DNN layers use different approximations on different archs. */
+   for (i=0;i<3*BWE_LEN;i++) {
+      if (abs(bwe_out[i]-bwe_ref[i]) > 16) return 0;
+   }
+   return 1;
+}
+#endif
+
+static const KernelBench kernels[] = {
+   {"celt_inner_prod", "N=480", 20000, celt_init, NULL, run_inner_prod, save_ref32, check_inner_prod, 0},
+   {"dual_inner_prod", "N=480", 10000, celt_init, NULL, run_dual_inner_prod, save_ref32, check_dual_inner_prod, 0},
+   {"xcorr_kernel", "len=240", 20000, celt_init, NULL, run_xcorr_kernel, save_ref32, check_xcorr_kernel, 0},
+   {"celt_pitch_xcorr", "240x244", 100, celt_init, NULL, run_pitch_xcorr, save_ref32, check_pitch_xcorr, 0},
+   {"celt_fir", "480x24", 1000, celt_init, NULL, run_fir, save_ref16, check_fir, 0},
+#ifdef OVERRIDE_COMB_FILTER_CONST
+   {"comb_filter_const", "N=840", 5000, celt_init, NULL, run_comb_filter_const, save_ref32, check_comb_filter_const, 0},
+#endif
+   {"op_pvq_search", "N=16,K=10", 20000, celt_init, NULL, run_pvq_search, save_ref_pvq, check_pvq_search, 0},
+   {"exp_rotation", "N=16", 20000, celt_init, NULL, run_exp_rotation_16, save_ref_rotation, check_exp_rotation, 0},
+   {"exp_rotation", "N=176", 5000, celt_init, NULL, run_exp_rotation_176, save_ref_rotation, check_exp_rotation, 0},
+   {"exp_rotation", "2x48", 5000, celt_init, NULL, run_exp_rotation_2x48, save_ref_rotation, check_exp_rotation, 0},
+   {"exp_rotation", "4x16", 10000, celt_init, NULL, run_exp_rotation_4x16, save_ref_rotation, check_exp_rotation, 0},
+   {"exp_rotation", "8x22", 5000, celt_init, NULL, run_exp_rotation_8x22, save_ref_rotation, check_exp_rotation, 0},
+   {"tf_l1_metrics", "5x176", 20000, celt_init, NULL, run_tf_l1_metrics, save_ref32, check_tf_l1_metrics, 0},
+#ifndef FIXED_POINT
+   {"transient_energy", "2x1080", 5000, celt_init, NULL, run_transient_energy, save_ref_transient, check_transient_energy, 0},
+#endif
+#ifndef DISABLE_FLOAT_API
+   {"celt_float2int16", "N=1920", 20000, celt_init, NULL, run_float2int16, save_ref_pcm, check_pcm, 0},
+   {"float2int16_checkwithin1", "N=1920", 20000, celt_init, NULL, run_float2int16_checkwithin1, save_ref_pcm, check_pcm, 0},
+   {"limit2_checkwithin1", "N=1920", 20000, celt_init, NULL, run_limit2_checkwithin1, save_ref_pcm, check_pcm, 0},
+#endif
+   {"silk_VAD_GetSA_Q8", "320@16k", 1000, silk_init, reset_vad, run_vad, save_ref_silk32, check_silk32, 0},
+   {"silk_NSQ", "320@16k", 200, silk_init, reset_nsq, run_nsq, save_ref_nsq, check_nsq, 0},
+   {"silk_NSQ_del_dec", "320@16k,4", 50, silk_init, reset_nsq, run_nsq_del_dec, save_ref_nsq, check_nsq, 0},
+   {"silk_VQ_WMat_EC", "L=32", 5000, silk_init, NULL, run_vq_wmat_ec, save_ref_silk32, check_silk32, 0},
+   {"silk_NLSF_VQ", "K=32,d=16", 5000, silk_init, NULL, run_nlsf_vq, save_ref_silk32, check_silk32, 0},
+   {"silk_NLSF_encode", "16x16", 30, silk_init, NULL, run_nlsf_encode, save_ref_silk32, check_silk32, 0},
+#ifdef FIXED_POINT
+   {"silk_inner_prod16", "N=383", 20000, silk_init, NULL, run_inner_prod16, save_ref_silk32, check_silk32, 0},
+   {"silk_burg_modified", "4x96,d=16", 200, silk_init, NULL, run_burg_modified, save_ref_silk32, check_silk32, 0},
+#else
+   {"silk_inner_product_FLP", "N=383", 20000, silk_init, NULL, run_inner_product_FLP, save_ref_flp, check_flp, 0},
+#endif
+#ifdef BENCH_DNN
+   {"compute_linear", "57x128 f32", 2000, dnn_init, NULL, run_dense_float, save_ref_dnn, check_dense_float, 0},
+   {"compute_linear", "57x128 f16", 2000, dnn_init, NULL, run_dense_half, save_ref_dnn, check_dense_half, 0},
+   {"compute_linear", "192x576 i8", 500, dnn_init, NULL, run_dense_int8, save_ref_dnn, check_dense_int8, 0},
+   {"compute_activation", "tanh 1024", 5000, dnn_init, NULL, run_tanh, save_ref_dnn, check_activation, 0},
+   {"compute_activation", "sigm 1024", 5000, dnn_init, NULL, run_sigmoid, save_ref_dnn, check_activation, 0},
+   {"compute_activation", "valin 1024", 5000, dnn_init, NULL, run_valin, save_ref_dnn, check_activation, 0},
+   {"compute_conv2d", "4x3x3,224", 500, dnn_init, reset_conv2d, run_conv2d, save_ref_dnn, check_conv2d, 0},
+   {"compute_gru", "PLC", 500, gru_init_plc, reset_gru, run_gru, save_ref_gru, check_gru, 0},
+   {"gru_unfused", "PLC", 500, gru_init_plc, reset_gru, run_gru_unfused, save_ref_gru, check_gru, 0},
+   {"compute_gru", "pitchDNN", 2000, gru_init_pitch, reset_gru, run_gru, save_ref_gru, check_gru, 0},
+   {"gru_unfused", "pitchDNN", 2000, gru_init_pitch, reset_gru, run_gru_unfused, save_ref_gru, check_gru, 0},
+   {"compute_gru", "FARGAN", 1000, gru_init_fargan, reset_gru, run_gru, save_ref_gru, check_gru, 0},
+   {"gru_unfused", "FARGAN", 1000, gru_init_fargan, reset_gru, run_gru_unfused, save_ref_gru, check_gru, 0},
+#ifdef ENABLE_DRED
+   {"compute_gru", "RDOVAE dec", 2000, gru_init_rdovae, reset_gru, run_gru, save_ref_gru, check_gru, 0},
+   {"gru_unfused", "RDOVAE dec", 2000, gru_init_rdovae, reset_gru, run_gru_unfused, save_ref_gru, check_gru, 0},
+#endif
+#endif
+#ifdef BENCH_OSCE_BWE
+   {"osce_bwe", "20ms@16k", 50, bwe_init, reset_bwe, run_bwe, save_ref_bwe, check_bwe, 50},
+#endif
+};
+
+static double time_kernel(const KernelBench *k, int arch, int iters)
+{
+   int r, i;
+   double best = -1;
+   for (r=0;r<BENCH_REPS;r++) {
+      double t0, t1;
+      t0 = bench_ticks();
+      for (i=0;i<iters;i++) {
+         k->run(arch);
+         BENCH_BARRIER();
+      }
+      t1 = bench_ticks();
+      if (best < 0 || t1-t0 < best) best = t1-t0;
+   }
+   return best/iters;
+}
+
+static void print_per_second(const KernelBench *k, double t)
+{
+   if (k->calls_per_sec) {
+      fprintf(stdout, "  (%.2f M" BENCH_UNIT " per second of audio)", 1e-6*t*k->calls_per_sec);
+   }
+   fprintf(stdout, "\n");
+}
+
+static int selected(const char *name, int argc, char **argv)
+{
+   int i;
+   if (argc == 0) return 1;
+   for (i=0;i<argc;i++) {
+      if (strstr(name, argv[i]) != NULL) return 1;
+   }
+   return 0;
+}
+
+/* Call-site dispatch overhead. The kernels below are called many times per
+   frame on short inputs, and in the baseline build every call loads the
+   function from the RTCD table and makes an indirect call. The x86-64 level
+   clones call the host's kernel directly instead. Both are timed here in
+   loops shaped like their callers, with the same kernel for both. */
+
+#if defined(OPUS_HAVE_RTCD) && defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1) \
+    && defined(FIXED_POINT)
+#define DISPATCH_XCORR_KERNEL xcorr_kernel_sse4_1
+#define DISPATCH_XCORR_ARCH 3
+#elif defined(OPUS_HAVE_RTCD) && defined(OPUS_X86_MAY_HAVE_SSE) && !defined(OPUS_X86_PRESUME_SSE) \
+    && !defined(FIXED_POINT)
+#define DISPATCH_XCORR_KERNEL xcorr_kernel_sse
+#define DISPATCH_XCORR_ARCH 1
+#endif
+
+#if defined(OPUS_HAVE_RTCD) && defined(OPUS_X86_MAY_HAVE_SSE4_1) && !defined(OPUS_X86_PRESUME_SSE4_1) \
+    && defined(FIXED_POINT)
+#define DISPATCH_INNER_PROD16
+#endif
+
+#if defined(OPUS_HAVE_RTCD) && defined(OPUS_X86_MAY_HAVE_AVX2) && !defined(OPUS_X86_PRESUME_AVX512) \
+    && (!defined(OPUS_X86_PRESUME_AVX2) || defined(OPUS_X86_MAY_HAVE_AVX512)) && !defined(FIXED_POINT)
+#define DISPATCH_INNER_PRODUCT_FLP
+#endif
+
+#if defined(DISPATCH_XCORR_KERNEL) || defined(DISPATCH_INNER_PROD16) || defined(DISPATCH_INNER_PRODUCT_FLP)
+#define BENCH_DISPATCH
+
+/* Lags of the CELT pitch search second pass and length of its decimated
+   input, and the SILK LTP analysis subframe. */
+#define DISPATCH_LAGS 64
+#define DISPATCH_XCORR_LEN 60
+#define DISPATCH_LTP_LEN SILK_SUBFR_LEN
+
+typedef struct {
+   const char *name;
+   const char *size;
+   /* Calls of the whole loop per measurement at -scale 1. */
+   int iters;
+   /* Number of kernel calls in the loop. */
+   int calls;
+   /* Lowest arch with a kernel of its own. */
+   int min_arch;
+   void (*init)(void);
+   void (*run)(int arch, int direct);
+   void (*save)(void);
+   int (*check)(void);
+} DispatchBench;
+
+#ifdef DISPATCH_XCORR_KERNEL
+static void run_dispatch_xcorr(int arch, int direct)
+{
+   int i;
+   for (i=0;i<DISPATCH_LAGS;i+=4) {
+      OPUS_CLEAR(&celt_out32[i], 4);
+      if (direct) DISPATCH_XCORR_KERNEL(celt_x, celt_y+i, &celt_out32[i], DISPATCH_XCORR_LEN);
+      else xcorr_kernel(celt_x, celt_y+i, &celt_out32[i], DISPATCH_XCORR_LEN, arch);
+   }
+}
+
+static int check_dispatch_xcorr(void)
+{
+   return memcmp(celt_out32, celt_ref32, DISPATCH_LAGS*sizeof(*celt_out32)) == 0;
+}
+#endif
+
+#ifdef DISPATCH_INNER_PROD16
+static void run_dispatch_inner_prod16(int arch, int direct)
+{
+   int i;
+   for (i=0;i<LTP_ORDER;i++) {
+      opus_int64 ret;
+      if (direct) ret = silk_inner_prod16_sse4_1(silk_x16, silk_x16+i, DISPATCH_LTP_LEN);
+      else ret = silk_inner_prod16(silk_x16, silk_x16+i, DISPATCH_LTP_LEN, arch);
+      silk_out32[i] = (opus_int32)ret;
+   }
+}
+#endif
+
+#ifdef DISPATCH_INNER_PRODUCT_FLP
+static double silk_outd_lags[LTP_ORDER];
+static double silk_refd_lags[LTP_ORDER];
+
+static void run_dispatch_inner_product_FLP(int arch, int direct)
+{
+   int i;
+   for (i=0;i<LTP_ORDER;i++) {
+#ifdef OPUS_X86_MAY_HAVE_AVX512
+      if (direct && arch >= 5) silk_outd_lags[i] = silk_inner_product_FLP_avx512(silk_xflp, silk_xflp+i, DISPATCH_LTP_LEN);
+      else
+#endif
+      if (direct) silk_outd_lags[i] = silk_inner_product_FLP_avx2(silk_xflp, silk_xflp+i, DISPATCH_LTP_LEN);
+      else silk_outd_lags[i] = silk_inner_product_FLP(silk_xflp, silk_xflp+i, DISPATCH_LTP_LEN, arch);
+   }
+}
+
+static void save_dispatch_flp(void)
+{
+   OPUS_COPY(silk_refd_lags, silk_outd_lags, LTP_ORDER);
+}
+
+static int check_dispatch_flp(void)
+{
+   return memcmp(silk_outd_lags, silk_refd_lags, sizeof(silk_outd_lags)) == 0;
+}
+#endif
+
+static const DispatchBench dispatch_kernels[] = {
+#ifdef DISPATCH_XCORR_KERNEL
+   {"xcorr_kernel", "64x60", 20000, DISPATCH_LAGS/4, DISPATCH_XCORR_ARCH, celt_init,
+         run_dispatch_xcorr, save_ref32, check_dispatch_xcorr},
+#endif
+#ifdef DISPATCH_INNER_PROD16
+   {"silk_inner_prod16", "5x80", 50000, LTP_ORDER, 3, silk_init,
+         run_dispatch_inner_prod16, save_ref_silk32, check_silk32},
+#endif
+#ifdef DISPATCH_INNER_PRODUCT_FLP
+   {"silk_inner_product_FLP", "5x80", 50000, LTP_ORDER, 4, silk_init,
+         run_dispatch_inner_product_FLP, save_dispatch_flp, check_dispatch_flp},
+#endif
+};
+
+/* The two are interleaved, so that both see the same changes in the host
+   load and clock. */
+static void time_dispatch(const DispatchBench *k, int arch, int iters, double *rtcd_time, double *direct_time)
+{
+   int r, i, direct;
+   double best[2] = {-1, -1};
+   for (r=0;r<BENCH_REPS;r++) {
+      for (direct=0;direct<2;direct++) {
+         double t0, t1;
+         t0 = bench_ticks();
+         for (i=0;i<iters;i++) {
+            k->run(arch, direct);
+            BENCH_BARRIER();
+         }
+         t1 = bench_ticks();
+         if (best[direct] < 0 || t1-t0 < best[direct]) best[direct] = t1-t0;
+      }
+   }
+   *rtcd_time = best[0]/((double)iters*k->calls);
+   *direct_time = best[1]/((double)iters*k->calls);
+}
+
+static int bench_dispatch(int max_arch, int scale, int argc, char **argv)
+{
+   int i;
+   int failures = 0;
+   for (i=0;i<(int)(sizeof(dispatch_kernels)/sizeof(dispatch_kernels[0]));i++) {
+      const DispatchBench *k = &dispatch_kernels[i];
+      double rtcd_time, direct_time;
+      int ok;
+      if (max_arch < k->min_arch || !selected(k->name, argc, argv)) continue;
+      bench_seed = 1;
+      k->init();
+      k->run(max_arch, 0);
+      k->save();
+      k->run(max_arch, 1);
+      ok = k->check();
+      time_dispatch(k, max_arch, k->iters*scale, &rtcd_time, &direct_time);
+      fprintf(stdout, "%-22s %-11s %-8s %14.2f %7.2fx\n", k->name, k->size, "rtcd", rtcd_time, 1.);
+      fprintf(stdout, "%-22s %-11s %-8s %14.2f %7.2fx  %s\n", "", "", "direct", direct_time,
+            rtcd_time/direct_time, ok ? "ok" : "MISMATCH");
+      failures += !ok;
+   }
+   return failures;
+}
+#endif
+
+#ifdef OPUS_X86_CLONES
+/* Whole-codec runs for the x86-64-v2/v3/v4 clones, which mostly measure the
+   code the RTCD kernels don't cover. Every clone must produce the same
+   packets and the same decoded audio as the baseline build. */
+
+#define CLONE_SECONDS 4
+#define CLONE_FRAME 960
+#define CLONE_FRAMES (50*CLONE_SECONDS)
+#define CLONE_MAX_PACKET 1500
+
+typedef struct {
+   const char *name;
+   int channels;
+   int application;
+   opus_int32 bitrate;
+} CloneConfig;
+
+static const CloneConfig clone_configs[] = {
+   {"CELT 64k", 2, OPUS_APPLICATION_AUDIO, 64000},
+   {"hybrid 24k", 1, OPUS_APPLICATION_VOIP, 24000},
+   {"SILK 12k", 1, OPUS_APPLICATION_VOIP, 12000},
+};
+
+static opus_int16 clone_pcm[2*CLONE_FRAME*CLONE_FRAMES];
+static unsigned char clone_packets[CLONE_FRAMES][CLONE_MAX_PACKET];
+static unsigned char clone_ref_packets[CLONE_FRAMES][CLONE_MAX_PACKET];
+static opus_int32 clone_len[CLONE_FRAMES];
+static opus_int32 clone_ref_len[CLONE_FRAMES];
+static opus_int16 clone_out[2*CLONE_FRAME];
+static opus_uint32 clone_hash;
+static opus_uint32 clone_ref_hash;
+
+static double run_clone_encode(const CloneConfig *cfg)
+{
+   int i;
+   double t0, t1;
+   OpusEncoder *enc;
+   enc = opus_encoder_create(48000, cfg->channels, cfg->application, NULL);
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(cfg->bitrate));
+   t0 = bench_ticks();
+   for (i=0;i<CLONE_FRAMES;i++) {
+      clone_len[i] = opus_encode(enc, &clone_pcm[i*CLONE_FRAME*cfg->channels], CLONE_FRAME,
+            clone_packets[i], CLONE_MAX_PACKET);
+   }
+   t1 = bench_ticks();
+   opus_encoder_destroy(enc);
+   return t1-t0;
+}
+
+static double run_clone_decode(const CloneConfig *cfg)
+{
+   int i, j;
+   double t0, t1;
+   OpusDecoder *dec;
+   dec = opus_decoder_create(48000, cfg->channels, NULL);
+   clone_hash = 0;
+   t0 = bench_ticks();
+   for (i=0;i<CLONE_FRAMES;i++) {
+      int n = opus_decode(dec, clone_ref_packets[i], clone_ref_len[i], clone_out, CLONE_FRAME, 0);
+      for (j=0;j<n*cfg->channels;j++) clone_hash = 31*clone_hash + (opus_uint16)clone_out[j];
+   }
+   t1 = bench_ticks();
+   opus_decoder_destroy(dec);
+   return t1-t0;
+}
+
+static int bench_clones(int scale, int argc, char **argv)
+{
+   int c, r, level, i;
+   int failures = 0;
+   int max_level = opus_select_x86_level();
+   if (!selected("opus_encode", argc, argv) && !selected("opus_decode", argc, argv)) return 0;
+   for (i=0;i<2*CLONE_FRAME*CLONE_FRAMES;i++)
+      clone_pcm[i] = (opus_int16)floor(.5+8000*bench_signal(i/2, 97.f + 40*((i>>14)&3)));
+   for (c=0;c<(int)(sizeof(clone_configs)/sizeof(clone_configs[0]));c++) {
+      const CloneConfig *cfg = &clone_configs[c];
+      double enc_time[5], dec_time[5];
+      int enc_ok[5], dec_ok[5];
+      /* The levels are interleaved so that they all see the same changes in
+         the host load and clock. */
+      for (r=0;r<BENCH_REPS*scale;r++) {
+         for (level=1;level<=max_level;level++) {
+            double t;
+            opus_clone = opus_clone_table(level);
+            if (level > 1 && opus_clone == NULL) continue;
+            t = run_clone_encode(cfg);
+            if (r == 0 && level == 1) {
+               OPUS_COPY(&clone_ref_packets[0][0], &clone_packets[0][0], CLONE_FRAMES*CLONE_MAX_PACKET);
+               OPUS_COPY(clone_ref_len, clone_len, CLONE_FRAMES);
+               enc_ok[1] = 1;
+            } else {
+               int ok = memcmp(clone_len, clone_ref_len, sizeof(clone_len)) == 0;
+               for (i=0;ok && i<CLONE_FRAMES;i++)
+                  ok = memcmp(clone_packets[i], clone_ref_packets[i], clone_len[i]) == 0;
+               if (r == 0) enc_ok[level] = ok;
+               else enc_ok[level] &= ok;
+            }
+            if (r == 0 || t < enc_time[level]) enc_time[level] = t;
+            t = run_clone_decode(cfg);
+            if (r == 0 && level == 1) {
+               clone_ref_hash = clone_hash;
+               dec_ok[1] = 1;
+            } else if (r == 0) {
+               dec_ok[level] = clone_hash == clone_ref_hash;
+            } else {
+               dec_ok[level] &= clone_hash == clone_ref_hash;
+            }
+            if (r == 0 || t < dec_time[level]) dec_time[level] = t;
+         }
+      }
+      for (level=1;level<=max_level;level++) {
+         const char *name;
+         if (level > 1 && opus_clone_table(level) == NULL) continue;
+         name = level > 1 ? opus_clone_table(level)->name + 7 : "base";
+         fprintf(stdout, "%-22s %-11s %-8s %14.1f %7.2fx  %s", "opus_encode", level == 1 ? cfg->name : "",
+               name, 1e-6*enc_time[level]/CLONE_SECONDS, enc_time[1]/enc_time[level], enc_ok[level] ? "ok" : "MISMATCH");
+         fprintf(stdout, "  (M" BENCH_UNIT " per second of audio)\n");
+         fprintf(stdout, "%-22s %-11s %-8s %14.1f %7.2fx  %s\n", "opus_decode", "",
+               name, 1e-6*dec_time[level]/CLONE_SECONDS, dec_time[1]/dec_time[level], dec_ok[level] ? "ok" : "MISMATCH");
+         failures += !enc_ok[level] + !dec_ok[level];
+      }
+   }
+   opus_clone = NULL;
+   return failures;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+   int i;
+   int arch;
+   int max_arch;
+   int scale = 1;
+   int failures = 0;
+   max_arch = opus_select_arch();
+   argc--;
+   argv++;
+   if (argc >= 2 && strcmp(argv[0], "-scale") == 0) {
+      scale = atoi(argv[1]);
+      if (scale < 1) {
+         fprintf(stderr, "usage: opus_kernel_bench [-scale <n>] [<kernel> ...]\n");
+         return EXIT_FAILURE;
+      }
+      argc -= 2;
+      argv += 2;
+   }
+   fprintf(stdout, "%s, %s build, host arch %d (%s)\n", opus_get_version_string(),
+#ifdef FIXED_POINT
+         "fixed-point",
+#else
+         "floating-point",
+#endif
+         max_arch, arch_names[max_arch]);
+   fprintf(stdout, "%-22s %-11s %-8s %14s %8s  %s\n", "kernel", "size", "arch", BENCH_UNIT "/call", "speedup", "check");
+   for (i=0;i<(int)(sizeof(kernels)/sizeof(kernels[0]));i++) {
+      const KernelBench *k = &kernels[i];
+      double c_time;
+      if (!selected(k->name, argc, argv)) continue;
+      bench_seed = 1;
+      k->init();
+      if (k->reset) k->reset();
+      k->run(ARCH_C);
+      k->save_ref();
+      c_time = time_kernel(k, ARCH_C, k->iters*scale);
+      fprintf(stdout, "%-22s %-11s %-8s %14.1f %7.2fx", k->name, k->size, "C", c_time, 1.);
+      print_per_second(k, c_time);
+      for (arch=0;arch<=max_arch;arch++) {
+         double t;
+         int ok;
+         if (k->reset) k->reset();
+         k->run(arch);
+         ok = k->check();
+         t = time_kernel(k, arch, k->iters*scale);
+         fprintf(stdout, "%-22s %-11s %-8s %14.1f %7.2fx  %s", "", "", arch_names[arch], t, c_time/t,
+               ok ? "ok" : "MISMATCH");
+         print_per_second(k, t);
+         failures += !ok;
+      }
+   }
+#ifdef BENCH_DISPATCH
+   failures += bench_dispatch(max_arch, scale, argc, argv);
+#endif
+#ifdef OPUS_X86_CLONES
+   failures += bench_clones(scale, argc, argv);
+#endif
+   if (failures) {
+      fprintf(stderr, "%d kernel(s) do not match the C reference\n", failures);
+      return EXIT_FAILURE;
+   }
+   return EXIT_SUCCESS;
+}
@@ -240,6 +240,34 @@ opus_int32 test_dec_api(void)
    fprintf(stdout,"    OPUS_SET_GAIN ................................ OK.\n");
    fprintf(stdout,"    OPUS_GET_GAIN ................................ OK.\n");
 
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec, OPUS_GET_SHADOW_DECODE(&i));
+   VG_CHECK(&i,sizeof(i));
+   if(err != OPUS_OK || i!=0)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_GET_SHADOW_DECODE(null_int_ptr));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_SHADOW_DECODE(-1));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_SHADOW_DECODE(2));
+   if(err != OPUS_BAD_ARG)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_SHADOW_DECODE(1));
+   if(err != OPUS_OK)test_failed();
+   cfgs++;
+   VG_UNDEF(&i,sizeof(i));
+   err=opus_decoder_ctl(dec, OPUS_GET_SHADOW_DECODE(&i));
+   VG_CHECK(&i,sizeof(i));
+   if(err != OPUS_OK || i!=1)test_failed();
+   cfgs++;
+   err=opus_decoder_ctl(dec, OPUS_SET_SHADOW_DECODE(0));
+   if(err != OPUS_OK)test_failed();
+   cfgs++;
+   fprintf(stdout,"    OPUS_SET_SHADOW_DECODE ....................... OK.\n");
+   fprintf(stdout,"    OPUS_GET_SHADOW_DECODE ....................... OK.\n");
+
    /*Reset the decoder*/
    dec2=malloc(opus_decoder_get_size(2));
    memcpy(dec2,dec,opus_decoder_get_size(2));
@@ -1372,6 +1400,21 @@ opus_int32 test_enc_api(void)
      "    OPUS_SET_PREDICTION_DISABLED ................. OK.\n",
      "    OPUS_GET_PREDICTION_DISABLED ................. OK.\n")
 
+   /*Only implemented when built with thread support*/
+   err=opus_encoder_ctl(enc,OPUS_GET_PARALLEL_ANALYSIS(&i));
+   if(err==OPUS_OK)
+   {
+      if(i!=0)test_failed();
+      cfgs++;
+      err=opus_encoder_ctl(enc,OPUS_GET_PARALLEL_ANALYSIS(null_int_ptr));
+      if(err!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      CHECK_SETGET(OPUS_SET_PARALLEL_ANALYSIS(i),OPUS_GET_PARALLEL_ANALYSIS(&i),-1,2,1,0,
+        "    OPUS_SET_PARALLEL_ANALYSIS ................... OK.\n",
+        "    OPUS_GET_PARALLEL_ANALYSIS ................... OK.\n")
+   } else if(err!=OPUS_UNIMPLEMENTED)test_failed();
+   cfgs++;
+
    err=opus_encoder_ctl(enc,OPUS_GET_EXPERT_FRAME_DURATION(null_int_ptr));
    if(err!=OPUS_BAD_ARG)test_failed();
    cfgs++;
@@ -1402,6 +1445,9 @@ opus_int32 test_enc_api(void)
    err=opus_encoder_ctl(enc,OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_120_MS));
    if(err!=OPUS_OK)test_failed();
    cfgs++;
+   err=opus_encoder_ctl(enc,OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE));
+   if(err!=OPUS_OK)test_failed();
+   cfgs++;
    CHECK_SETGET(OPUS_SET_EXPERT_FRAME_DURATION(i),OPUS_GET_EXPERT_FRAME_DURATION(&i),0,-1,
          OPUS_FRAMESIZE_60_MS,OPUS_FRAMESIZE_ARG,
      "    OPUS_SET_EXPERT_FRAME_DURATION ............... OK.\n",
@@ -1428,6 +1474,21 @@ opus_int32 test_enc_api(void)
    VG_CHECK(packet,i);
    cfgs++;
    fprintf(stdout,"    opus_encode() ................................ OK.\n");
+
+   {
+      OpusFrameAnalysis fa;
+      err=opus_encoder_ctl(enc,OPUS_GET_FRAME_ANALYSIS((OpusFrameAnalysis*)NULL));
+      if(err!=OPUS_BAD_ARG)test_failed();
+      cfgs++;
+      VG_UNDEF(&fa,sizeof(fa));
+      err=opus_encoder_ctl(enc,OPUS_GET_FRAME_ANALYSIS(&fa));
+      if(err!=OPUS_OK)test_failed();
+      VG_CHECK(&fa,sizeof(fa));
+      if(fa.vad!=0 || fa.pitch!=0)test_failed();
+      if(fa.band_count<0 || fa.band_count>OPUS_FRAME_ANALYSIS_BANDS)test_failed();
+      cfgs++;
+      fprintf(stdout,"    OPUS_GET_FRAME_ANALYSIS ...................... OK.\n");
+   }
 #ifndef DISABLE_FLOAT_API
    memset(fbuf,0,sizeof(float)*2*960);
    VG_UNDEF(packet,sizeof(packet));
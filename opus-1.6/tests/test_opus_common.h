@@ -84,3 +84,203 @@ static OPUS_INLINE void _test_failed(const char *file, int line)
 #define opus_test_assert(cond) {if (!(cond)) {test_failed();}}
 #define expect_true(cond, msg) {if (!(cond)) {fprintf(stderr, "FAIL - %s\n", msg); test_failed();}}
 void regression_test(void);
+
+/* Encoded mono streams at 48 kHz, for the tests of the compressed-domain
+   processing (gain adjuster, transrater, stream editing) */
+#include <math.h>
+#include <time.h>
+
+#define TEST_STREAM_FS 48000
+#define TEST_STREAM_MAX_PACKET 1500
+/* Decoded output of the first 100 ms is not compared */
+#define TEST_STREAM_SKIP (TEST_STREAM_FS/10)
+
+typedef struct {
+   const char *name;
+   int application;
+   int bandwidth;
+   int frame_size;
+   opus_int32 bitrate;
+   /* Bitrate the stream is encoded again at, 0 for the same bitrate */
+   opus_int32 target;
+   int fec;
+} TestStreamConfig;
+
+typedef struct {
+   unsigned char *data;
+   opus_int32 *len;
+   int nb_packets;
+} TestStream;
+
+/* Flags for test_generate_speech() */
+#define TEST_SPEECH_PAUSES 1 /* Syllable gaps and a pause every 2.5 s */
+#define TEST_SPEECH_CLICKS 2 /* A noise floor and a few percussive clicks */
+
+/* Voiced segments with a pitch wandering around the given one and a
+   syllable-rate envelope */
+static OPUS_INLINE void test_generate_speech(opus_int16 *pcm, int n, double pitch, int flags)
+{
+   const double pi = 3.141592653589793;
+   int i, k;
+   double phase = 0, lp = 0;
+   for (i=0;i<n;i++)
+   {
+      double t = (double)i/TEST_STREAM_FS;
+      double f0 = pitch + .4*pitch*sin(2*pi*.7*t);
+      double env = sin(2*pi*2.*t);
+      double x = 0;
+      phase += 2*pi*f0/TEST_STREAM_FS;
+      if (phase > 2*pi) phase -= 2*pi;
+      for (k=1;k<=20;k++)
+         x += sin(k*phase)/k;
+      if (flags & TEST_SPEECH_PAUSES)
+      {
+         env = env > 0 ? env : 0;
+         if (fmod(t, 2.5) > 2.)
+            env = 0;
+      } else {
+         env = .6 + .4*env;
+      }
+      /* Some noise for fricatives and a simple spectral tilt */
+      x += ((int)(fast_rand()%2001)-1000)*1e-4;
+      if ((flags & TEST_SPEECH_CLICKS) && fmod(t, .77) < .002)
+         x += ((int)(fast_rand()%2001)-1000)*2e-3;
+      lp = .6*lp + .4*x;
+      if (flags & TEST_SPEECH_CLICKS)
+         env += .05;
+      pcm[i] = (opus_int16)floor(.5 + 6000*env*lp);
+   }
+}
+
+static OPUS_INLINE void test_stream_alloc(TestStream *s, int nb_packets)
+{
+   s->nb_packets = nb_packets;
+   s->data = malloc(nb_packets*TEST_STREAM_MAX_PACKET);
+   s->len = malloc(nb_packets*sizeof(*s->len));
+   if (!s->data || !s->len) test_failed();
+}
+
+static OPUS_INLINE void test_stream_free(TestStream *s)
+{
+   free(s->data);
+   free(s->len);
+}
+
+static OPUS_INLINE void test_stream_encoder_setup(OpusEncoder *enc, const TestStreamConfig *cfg, opus_int32 bitrate)
+{
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(bitrate));
+   opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(cfg->bandwidth));
+   opus_encoder_ctl(enc, OPUS_SET_INBAND_FEC(cfg->fec));
+   opus_encoder_ctl(enc, OPUS_SET_PACKET_LOSS_PERC(cfg->fec ? 20 : 0));
+   opus_encoder_ctl(enc, OPUS_SET_COMPLEXITY(5));
+}
+
+static OPUS_INLINE void test_stream_encode(const TestStreamConfig *cfg, const opus_int16 *pcm, int n, TestStream *s)
+{
+   OpusEncoder *enc;
+   int i, err;
+   enc = opus_encoder_create(TEST_STREAM_FS, 1, cfg->application, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   test_stream_encoder_setup(enc, cfg, cfg->bitrate);
+   test_stream_alloc(s, n/cfg->frame_size);
+   for (i=0;i<s->nb_packets;i++)
+   {
+      s->len[i] = opus_encode(enc, pcm+i*cfg->frame_size, cfg->frame_size,
+            s->data+i*TEST_STREAM_MAX_PACKET, TEST_STREAM_MAX_PACKET);
+      if (s->len[i] < 0) test_failed();
+   }
+   opus_encoder_destroy(enc);
+}
+
+/* Decodes a stream, optionally with a decoder gain */
+static OPUS_INLINE void test_stream_decode(const TestStream *s, int frame_size, int gain_Q8, opus_int16 *out)
+{
+   OpusDecoder *dec;
+   int i, err;
+   dec = opus_decoder_create(TEST_STREAM_FS, 1, &err);
+   if (err != OPUS_OK || dec == NULL) test_failed();
+   opus_decoder_ctl(dec, OPUS_SET_GAIN(gain_Q8));
+   for (i=0;i<s->nb_packets;i++)
+   {
+      if (opus_decode(dec, s->data+i*TEST_STREAM_MAX_PACKET, s->len[i], out+i*frame_size, frame_size, 0) != frame_size)
+         test_failed();
+   }
+   opus_decoder_destroy(dec);
+}
+
+/* The straightforward way to process a stream: decode, apply the gain, and
+   encode again at the target bitrate. Returns the CPU time and the maximum
+   delay of the output. */
+static OPUS_INLINE double test_stream_transcode(const TestStreamConfig *cfg, const TestStream *in, int gain_Q8,
+      TestStream *out, int *delay)
+{
+   OpusDecoder *dec;
+   OpusEncoder *enc;
+   opus_int16 pcm[5760];
+   int i, err;
+   opus_int32 lookahead;
+   clock_t start;
+   dec = opus_decoder_create(TEST_STREAM_FS, 1, &err);
+   if (err != OPUS_OK || dec == NULL) test_failed();
+   enc = opus_encoder_create(TEST_STREAM_FS, 1, cfg->application, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   test_stream_encoder_setup(enc, cfg, cfg->target ? cfg->target : cfg->bitrate);
+   opus_encoder_ctl(enc, OPUS_GET_LOOKAHEAD(&lookahead));
+   *delay = 2*lookahead;
+   out->nb_packets = in->nb_packets;
+   start = clock();
+   for (i=0;i<in->nb_packets;i++)
+   {
+      int j;
+      if (opus_decode(dec, in->data+i*TEST_STREAM_MAX_PACKET, in->len[i], pcm, cfg->frame_size, 0) != cfg->frame_size)
+         test_failed();
+      if (gain_Q8)
+      {
+         for (j=0;j<cfg->frame_size;j++)
+         {
+            double x = pcm[j]*pow(10, gain_Q8/(20.*256));
+            pcm[j] = (opus_int16)(x > 32767 ? 32767 : x < -32768 ? -32768 : x);
+         }
+      }
+      out->len[i] = opus_encode(enc, pcm, cfg->frame_size, out->data+i*TEST_STREAM_MAX_PACKET, TEST_STREAM_MAX_PACKET);
+      if (out->len[i] < 0) test_failed();
+   }
+   opus_encoder_destroy(enc);
+   opus_decoder_destroy(dec);
+   return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+/* SNR of x against the reference, x being delayed by up to the given number of samples */
+static OPUS_INLINE double test_snr_db(const opus_int16 *ref, const opus_int16 *x, int n, int max_delay)
+{
+   int i, delay, best_delay = 0;
+   double best = -1, sig = 0, err = 0;
+   /* Find the delay on the first second, assuming it is constant */
+   for (delay=0;delay<=max_delay;delay++)
+   {
+      double xcorr = 0;
+      for (i=TEST_STREAM_SKIP;i<TEST_STREAM_SKIP+TEST_STREAM_FS;i++)
+         xcorr += (double)x[i+delay]*ref[i];
+      if (xcorr > best)
+      {
+         best = xcorr;
+         best_delay = delay;
+      }
+   }
+   for (i=TEST_STREAM_SKIP;i<n-max_delay;i++)
+   {
+      double e = (double)x[i+best_delay] - ref[i];
+      sig += (double)ref[i]*ref[i];
+      err += e*e;
+   }
+   return 10*log10((sig+1)/(err+1));
+}
+
+static OPUS_INLINE double test_energy_db(const opus_int16 *x, int n)
+{
+   int i;
+   double e = 1;
+   for (i=TEST_STREAM_SKIP;i<n;i++)
+      e += (double)x[i]*x[i];
+   return 10*log10(e);
+}
@@ -309,8 +309,10 @@ int run_test1(int no_fuzz)
    opus_int32 i,j;
    int rc,err;
    OpusEncoder *enc;
+   OpusEncoder *enc_par;
    OpusMSEncoder *MSenc;
    OpusDecoder *dec;
+   OpusDecoder *dec_shadow;
    OpusMSDecoder *MSdec;
    OpusMSDecoder *MSdec_err;
    OpusDecoder *dec_err[10];
@@ -319,6 +321,7 @@ int run_test1(int no_fuzz)
    short *out2buf;
    opus_int32 bitrate_bps;
    unsigned char packet[MAX_PACKET+257];
+   unsigned char packet_par[MAX_PACKET];
    opus_uint32 enc_final_range;
    opus_uint32 dec_final_range;
    int fswitch;
@@ -375,6 +378,9 @@ int run_test1(int no_fuzz)
    dec = opus_decoder_create(48000, 2, &err);
    if(err != OPUS_OK || dec==NULL)test_failed();
 
+   dec_shadow = opus_decoder_create(48000, 2, &err);
+   if(err != OPUS_OK || dec_shadow==NULL)test_failed();
+
    MSdec = opus_multistream_decoder_create(48000, 2, 2, 0, mapping, &err);
    if(err != OPUS_OK || MSdec==NULL)test_failed();
 
@@ -404,6 +410,16 @@ int run_test1(int no_fuzz)
       enc=enccpy;
    }
 
+   /*Parallel analysis is only available in builds with thread support*/
+   enc_par=(OpusEncoder *)malloc(opus_encoder_get_size(2));
+   if(enc_par==NULL)test_failed();
+   memcpy(enc_par,enc,opus_encoder_get_size(2));
+   if(opus_encoder_ctl(enc_par, OPUS_SET_PARALLEL_ANALYSIS(1))!=OPUS_OK)
+   {
+      free(enc_par);
+      enc_par=NULL;
+   }
+
    inbuf=(short *)malloc(sizeof(short)*SAMPLES*2);
    outbuf=(short *)malloc(sizeof(short)*SAMPLES*2);
    out2buf=(short *)malloc(sizeof(short)*MAX_FRAME_SAMP*3);
@@ -438,7 +454,7 @@ int run_test1(int no_fuzz)
          rate=rates[j]+fast_rand()%rates[j];
          count=i=0;
          do {
-            int bw,len,out_samples,frame_size,unpad;
+            int bw,len,len_par=0,out_samples,frame_size,unpad;
             int qext=0;
             frame_size=frame[j];
             if((fast_rand()&255)==0)
@@ -475,8 +491,17 @@ int run_test1(int no_fuzz)
             qext=fast_rand()%2;
             if(opus_encoder_ctl(enc, OPUS_SET_QEXT(qext))!=OPUS_OK)test_failed();
 #endif
+            if(modes[j]==1 && enc_par!=NULL)
+            {
+               /*Parallel analysis must not change the bitstream*/
+               memcpy(enc_par,enc,opus_encoder_get_size(2));
+               if(opus_encoder_ctl(enc_par, OPUS_SET_PARALLEL_ANALYSIS(1))!=OPUS_OK)test_failed();
+               len_par = opus_encode(enc_par, &inbuf[i<<1], frame_size, packet_par, MAX_PACKET);
+               if(len_par<0 || len_par>MAX_PACKET)test_failed();
+            }
             len = opus_encode(enc, &inbuf[i<<1], frame_size, packet, MAX_PACKET);
             if(len<0 || len>MAX_PACKET)test_failed();
+            if(modes[j]==1 && enc_par!=NULL && (len!=len_par || memcmp(packet,packet_par,len)!=0))test_failed();
             if(opus_encoder_ctl(enc, OPUS_GET_FINAL_RANGE(&enc_final_range))!=OPUS_OK)test_failed();
             if((fast_rand()&3)==0)
             {
@@ -630,6 +655,17 @@ int run_test1(int no_fuzz)
       /* compare final range encoder rng values of encoder and decoder */
       if(dec_final_range!=enc_final_range)test_failed();
 
+      /* shadow decoding must keep the decoder in sync and output silence */
+      if(opus_decoder_ctl(dec_shadow, OPUS_SET_SHADOW_DECODE((count/37)&1))!=OPUS_OK)test_failed();
+      out_samples = opus_decode(dec_shadow, packet, len, out2buf, MAX_FRAME_SAMP, 0);
+      if(out_samples!=frame_size)test_failed();
+      opus_decoder_ctl(dec_shadow, OPUS_GET_FINAL_RANGE(&dec_final_range));
+      if(dec_final_range!=enc_final_range)test_failed();
+      if((count/37)&1)
+      {
+         for(j=0;j<frame_size*2;j++)if(out2buf[j]!=0)test_failed();
+      }
+
       /* We fuzz the packet, but take care not to only corrupt the payload
          Corrupted headers are tested elsewhere and we need to actually run
          the decoders in order to compare them. */
@@ -667,10 +703,12 @@ int run_test1(int no_fuzz)
 
    if(opus_encoder_ctl(enc, OPUS_RESET_STATE)!=OPUS_OK)test_failed();
    opus_encoder_destroy(enc);
+   free(enc_par);
    if(opus_multistream_encoder_ctl(MSenc, OPUS_RESET_STATE)!=OPUS_OK)test_failed();
    opus_multistream_encoder_destroy(MSenc);
    if(opus_decoder_ctl(dec, OPUS_RESET_STATE)!=OPUS_OK)test_failed();
    opus_decoder_destroy(dec);
+   opus_decoder_destroy(dec_shadow);
    if(opus_multistream_decoder_ctl(MSdec, OPUS_RESET_STATE)!=OPUS_OK)test_failed();
    opus_multistream_decoder_destroy(MSdec);
    opus_multistream_decoder_destroy(MSdec_err);
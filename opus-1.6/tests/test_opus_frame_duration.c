@@ -0,0 +1,147 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks OPUS_FRAMESIZE_ADAPTIVE: the packet durations the encoder picks
+   from its look-ahead, resending what was not encoded, and the fallbacks. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "opus.h"
+#include "opus_multistream.h"
+#include "test_opus_common.h"
+
+#define FS TEST_STREAM_FS
+#define SECONDS 8
+#define NB_SAMPLES (FS*SECONDS)
+#define FRAME_20MS (FS/50)
+#define MAX_PACKET 1500
+
+/* Encodes the signal passing up to max_ms of look-ahead per call, and
+   decodes it back. Counts the packets of each duration in hist[]. */
+static void encode_adaptive(const opus_int16 *pcm, int complexity, int max_ms, int hist[3])
+{
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+   unsigned char packet[MAX_PACKET];
+   opus_int16 out[3*FRAME_20MS];
+   int pos, err;
+   int max_size = max_ms*FS/1000;
+   enc = opus_encoder_create(FS, 1, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   dec = opus_decoder_create(FS, 1, &err);
+   if (err != OPUS_OK || dec == NULL) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE)) != OPUS_OK) test_failed();
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(24000));
+   opus_encoder_ctl(enc, OPUS_SET_COMPLEXITY(complexity));
+   hist[0] = hist[1] = hist[2] = 0;
+   for (pos=0;pos+max_size<=NB_SAMPLES;)
+   {
+      int len, nb_samples, ret;
+      len = opus_encode(enc, pcm+pos, max_size, packet, MAX_PACKET);
+      if (len <= 0) test_failed();
+      nb_samples = opus_packet_get_nb_samples(packet, len, FS);
+      /* Never more than what was passed, and only 20, 40 or 60 ms */
+      if (nb_samples > max_size || nb_samples%FRAME_20MS != 0 || nb_samples > 3*FRAME_20MS)
+         test_failed();
+      hist[nb_samples/FRAME_20MS-1]++;
+      ret = opus_decode(dec, packet, len, out, 3*FRAME_20MS, 0);
+      if (ret != nb_samples) test_failed();
+      pos += nb_samples;
+   }
+   opus_encoder_destroy(enc);
+   opus_decoder_destroy(dec);
+}
+
+int main(int _argc, char **_argv)
+{
+   const char *oversion;
+   opus_int16 *pcm;
+   OpusEncoder *enc;
+   OpusMSEncoder *msenc;
+   unsigned char packet[MAX_PACKET];
+   unsigned char mapping[2] = {0, 1};
+   int hist[3];
+   int err;
+   (void)_argc;
+   (void)_argv;
+
+   iseed = 0;
+   Rw = Rz = iseed;
+   oversion = opus_get_version_string();
+   if (!oversion) test_failed();
+   fprintf(stderr, "Testing %s adaptive frame duration.\n", oversion);
+
+   pcm = malloc(NB_SAMPLES*sizeof(*pcm));
+   if (!pcm) test_failed();
+   test_generate_speech(pcm, NB_SAMPLES, 140, TEST_SPEECH_PAUSES);
+
+   /* With 60 ms of look-ahead, steady parts get long packets and the
+      onsets start short ones. */
+   encode_adaptive(pcm, 10, 60, hist);
+   fprintf(stderr, "    60 ms look-ahead: %d x 20 ms, %d x 40 ms, %d x 60 ms\n", hist[0], hist[1], hist[2]);
+#ifndef DISABLE_FLOAT_API
+   if (hist[2] == 0 || hist[0] + hist[1] == 0) test_failed();
+#else
+   if (hist[1] != 0 || hist[2] != 0) test_failed();
+#endif
+
+   /* The amount of audio passed in caps the duration */
+   encode_adaptive(pcm, 10, 40, hist);
+   fprintf(stderr, "    40 ms look-ahead: %d x 20 ms, %d x 40 ms\n", hist[0], hist[1]);
+   if (hist[2] != 0) test_failed();
+
+   /* Without the analysis, the encoder sticks to 20 ms */
+   encode_adaptive(pcm, 0, 60, hist);
+   if (hist[1] != 0 || hist[2] != 0) test_failed();
+   fprintf(stderr, "    complexity 0 ............................. OK.\n");
+
+   enc = opus_encoder_create(FS, 1, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE)) != OPUS_OK) test_failed();
+   /* Less than 20 ms cannot be encoded, 30 ms gets a 20 ms packet */
+   if (opus_encode(enc, pcm, FRAME_20MS/2, packet, MAX_PACKET) != OPUS_BAD_ARG) test_failed();
+   err = opus_encode(enc, pcm, 3*FRAME_20MS/2, packet, MAX_PACKET);
+   if (err <= 0 || opus_packet_get_nb_samples(packet, err, FS) != FRAME_20MS) test_failed();
+   opus_encoder_destroy(enc);
+   fprintf(stderr, "    short look-ahead ......................... OK.\n");
+
+   /* The streams of a multistream encoder would not agree on a duration */
+   msenc = opus_multistream_encoder_create(FS, 2, 2, 0, mapping, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || msenc == NULL) test_failed();
+   if (opus_multistream_encoder_ctl(msenc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ADAPTIVE)) != OPUS_BAD_ARG)
+      test_failed();
+   opus_multistream_encoder_destroy(msenc);
+   fprintf(stderr, "    multistream rejects it ................... OK.\n");
+
+   free(pcm);
+   fprintf(stderr, "All adaptive frame duration tests passed.\n");
+   return 0;
+}
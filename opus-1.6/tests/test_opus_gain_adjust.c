@@ -0,0 +1,237 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks the gain adjuster against decode/scale/encode: bit-exactness of the
+   compressed-domain path at 0 dB and quality of the adjusted stream. The CPU
+   time of both is reported. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "opus.h"
+#include "../src/opus_private.h"
+#include "test_opus_common.h"
+
+#define FS TEST_STREAM_FS
+#define NB_SAMPLES (FS*10)
+#define MAX_PACKET TEST_STREAM_MAX_PACKET
+
+static const TestStreamConfig configs[] = {
+   {"SILK NB 20 ms",       OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_NARROWBAND, 960,  12000, 0, 0},
+   {"SILK WB 20 ms + FEC", OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_WIDEBAND,   960,  20000, 0, 1},
+   {"SILK WB 60 ms + FEC", OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_WIDEBAND,   2880, 16000, 0, 1},
+   {"SILK MB 10 ms",       OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_MEDIUMBAND, 480,  16000, 0, 0},
+   {"hybrid SWB 20 ms",    OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_SUPERWIDEBAND, 960, 32000, 0, 0},
+   {"CELT FB 20 ms",       OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,   960,  64000, 0, 0}
+};
+
+/* Gain adjustment in the compressed domain, falling back to transcoding */
+static double adjust_stream(const TestStream *in, int gain_Q8, TestStream *out)
+{
+   OpusGainAdjuster *st;
+   int i, err;
+   clock_t start;
+   st = opus_gain_adjuster_create(1, &err);
+   if (err != OPUS_OK || st == NULL) test_failed();
+   out->nb_packets = in->nb_packets;
+   start = clock();
+   for (i=0;i<in->nb_packets;i++)
+   {
+      out->len[i] = opus_gain_adjuster_process(st, in->data+i*MAX_PACKET, in->len[i], gain_Q8,
+            out->data+i*MAX_PACKET, MAX_PACKET);
+      if (out->len[i] < 0) test_failed();
+   }
+   opus_gain_adjuster_destroy(st);
+   return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+static void test_config(const TestStreamConfig *cfg, const opus_int16 *pcm)
+{
+   static const int gains_Q8[2] = {-1536, 1024};
+   TestStream in, adj, ref;
+   opus_int16 *out_ref, *out_adj, *out_ref2;
+   int g, i, delay, is_silk;
+   double t_adj, t_ref;
+
+   test_stream_encode(cfg, pcm, NB_SAMPLES, &in);
+   test_stream_alloc(&adj, in.nb_packets);
+   test_stream_alloc(&ref, in.nb_packets);
+   out_ref = malloc(NB_SAMPLES*sizeof(*out_ref));
+   out_adj = malloc(NB_SAMPLES*sizeof(*out_adj));
+   out_ref2 = malloc(NB_SAMPLES*sizeof(*out_ref2));
+   if (!out_ref || !out_adj || !out_ref2)
+      test_failed();
+   is_silk = cfg->bandwidth <= OPUS_BANDWIDTH_WIDEBAND;
+
+   /* No gain: the compressed-domain path must reproduce SILK packets exactly,
+      except the few with a redundant CELT frame around mode switches */
+   adjust_stream(&in, 0, &adj);
+   if (is_silk)
+   {
+      int nb_same = 0;
+      for (i=0;i<in.nb_packets;i++)
+      {
+         nb_same += adj.len[i] == in.len[i] && !memcmp(adj.data+i*MAX_PACKET, in.data+i*MAX_PACKET, in.len[i]);
+      }
+      fprintf(stderr, "    %-20s  0.0 dB: %d of %d packets unchanged\n", cfg->name, nb_same, in.nb_packets);
+      if (nb_same < in.nb_packets*9/10)
+         test_failed();
+   }
+
+   for (g=0;g<2;g++)
+   {
+      double snr_adj, snr_ref, level, expected;
+      t_adj = adjust_stream(&in, gains_Q8[g], &adj);
+      t_ref = test_stream_transcode(cfg, &in, gains_Q8[g], &ref, &delay);
+      test_stream_decode(&adj, cfg->frame_size, 0, out_adj);
+      test_stream_decode(&ref, cfg->frame_size, 0, out_ref2);
+      test_stream_decode(&in, cfg->frame_size, 0, out_ref);
+      level = test_energy_db(out_adj, NB_SAMPLES) - test_energy_db(out_ref, NB_SAMPLES);
+      if (is_silk)
+      {
+         /* The SILK gain is rounded to steps of ~1.37 dB */
+         int steps = (int)floor(.5 + gains_Q8[g]/256./1.3697);
+         expected = steps*1.3697;
+         test_stream_decode(&in, cfg->frame_size, (int)floor(.5 + expected*256), out_ref);
+         snr_adj = test_snr_db(out_ref, out_adj, NB_SAMPLES, 0);
+      } else {
+         expected = gains_Q8[g]/256.;
+         test_stream_decode(&in, cfg->frame_size, gains_Q8[g], out_ref);
+         snr_adj = test_snr_db(out_ref, out_adj, NB_SAMPLES, delay);
+      }
+      snr_ref = test_snr_db(out_ref, out_ref2, NB_SAMPLES, delay);
+      fprintf(stderr, "    %-20s %+5.1f dB: level %+5.2f dB, SNR %5.1f dB in %6.3f s"
+            " (decode/scale/encode: SNR %5.1f dB in %6.3f s)\n", cfg->name, gains_Q8[g]/256.,
+            level, snr_adj, t_adj, snr_ref, t_ref);
+      if (fabs(level - expected) > 1.)
+         test_failed();
+      if (is_silk)
+      {
+         /* Only the gain quantization differs from decoding with a gain */
+         if (snr_adj < 25)
+            test_failed();
+      }
+   }
+
+   test_stream_free(&in);
+   test_stream_free(&adj);
+   test_stream_free(&ref);
+   free(out_ref);
+   free(out_adj);
+   free(out_ref2);
+}
+
+/* Loud stereo packets are transcoded, and the quiet mono packets that follow them are
+   rewritten with their gains coded against what the receiver got from the transcoder */
+static void test_stereo_switching(const opus_int16 *pcm)
+{
+   OpusEncoder *enc;
+   OpusGainAdjuster *st;
+   OpusDecoder *dec_in, *dec_adj;
+   unsigned char in[MAX_PACKET], out[MAX_PACKET];
+   opus_int16 stereo[2*960], dec_pcm[2*960];
+   int i, j, err, steps, nb_checked = 0, nb_wrong = 0;
+   const int gain_Q8 = -1536;
+
+   enc = opus_encoder_create(FS, 2, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(24000));
+   opus_encoder_ctl(enc, OPUS_SET_BANDWIDTH(OPUS_BANDWIDTH_WIDEBAND));
+   opus_encoder_ctl(enc, OPUS_SET_COMPLEXITY(5));
+   st = opus_gain_adjuster_create(2, &err);
+   if (err != OPUS_OK || st == NULL) test_failed();
+   dec_in = opus_decoder_create(FS, 2, &err);
+   if (err != OPUS_OK || dec_in == NULL) test_failed();
+   dec_adj = opus_decoder_create(FS, 2, &err);
+   if (err != OPUS_OK || dec_adj == NULL) test_failed();
+   steps = (int)floor(.5 + gain_Q8/256./1.3697);
+   for (i=0;i<NB_SAMPLES/960;i++)
+   {
+      opus_int32 len, adj_len, gain_in, gain_adj;
+      for (j=0;j<960;j++)
+      {
+         stereo[2*j] = i%4 == 0 ? pcm[i*960+j] : pcm[i*960+j]/40;
+         stereo[2*j+1] = stereo[2*j]/2;
+      }
+      opus_encoder_ctl(enc, OPUS_SET_FORCE_CHANNELS(i%4 == 0 ? 2 : 1));
+      len = opus_encode(enc, stereo, 960, in, MAX_PACKET);
+      if (len < 0) test_failed();
+      adj_len = opus_gain_adjuster_process(st, in, len, gain_Q8, out, MAX_PACKET);
+      if (adj_len < 0) test_failed();
+      if (opus_decode(dec_in, in, len, dec_pcm, 960, 0) != 960) test_failed();
+      if (opus_decode(dec_adj, out, adj_len, dec_pcm, 960, 0) != 960) test_failed();
+      /* The receiver's gain index of rewritten packets is that of the input, offset */
+      if (len > 1 && !(in[0]&0x80) && (in[0]&0x60) != 0x60 && opus_packet_get_nb_channels(in) == 1)
+      {
+         int expected;
+         opus_decoder_ctl(dec_in, OPUS_GET_SILK_LAST_GAIN_INDEX(&gain_in));
+         opus_decoder_ctl(dec_adj, OPUS_GET_SILK_LAST_GAIN_INDEX(&gain_adj));
+         expected = gain_in + steps < 0 ? 0 : gain_in + steps > 63 ? 63 : gain_in + steps;
+         nb_checked++;
+         nb_wrong += gain_adj != expected;
+      }
+   }
+   fprintf(stderr, "    stereo switching: %d of %d rewritten packets with a gain index off\n",
+         nb_wrong, nb_checked);
+   if (nb_checked < NB_SAMPLES/960/4 || nb_wrong > nb_checked/50)
+      test_failed();
+   opus_decoder_destroy(dec_adj);
+   opus_decoder_destroy(dec_in);
+   opus_gain_adjuster_destroy(st);
+   opus_encoder_destroy(enc);
+}
+
+int main(int _argc, char **_argv)
+{
+   const char *oversion;
+   opus_int16 *pcm;
+   unsigned i;
+   (void)_argc;
+   (void)_argv;
+
+   iseed = 0;
+   Rw = Rz = iseed;
+   oversion = opus_get_version_string();
+   if (!oversion) test_failed();
+   fprintf(stderr, "Testing %s gain adjuster.\n", oversion);
+
+   pcm = malloc(NB_SAMPLES*sizeof(*pcm));
+   if (!pcm) test_failed();
+   test_generate_speech(pcm, NB_SAMPLES, 150, TEST_SPEECH_PAUSES);
+   for (i=0;i<sizeof(configs)/sizeof(configs[0]);i++)
+      test_config(&configs[i], pcm);
+   test_stereo_switching(pcm);
+   free(pcm);
+
+   fprintf(stderr, "All gain adjuster tests passed.\n");
+   return 0;
+}
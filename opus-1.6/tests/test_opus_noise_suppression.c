@@ -0,0 +1,296 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Measures what the noise suppression pre-stage buys on noisy speech: the
+   VBR bitrate, the fraction of DTX frames and the CPU time, with the cost of
+   the denoiser itself estimated from CBR runs where the encoder does the same
+   work either way. The speech is checked to survive and the noise in pauses to
+   be attenuated. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "opus.h"
+#include "test_opus_common.h"
+
+#define FS TEST_STREAM_FS
+#define SECONDS 30
+#define NB_SAMPLES (FS*SECONDS)
+#define FRAME_SIZE 960
+#define MAX_PACKET TEST_STREAM_MAX_PACKET
+/* test_generate_speech() talks for 2 s out of every 2.5 s */
+#define PERIOD (5*FS/2)
+#define TALK (2*FS)
+
+typedef struct {
+   int nb_dtx;
+   double seconds;
+} EncodeStats;
+
+static const TestStreamConfig voip = {"VoIP 24 kb/s", OPUS_APPLICATION_VOIP, OPUS_AUTO, FRAME_SIZE, 24000, 0, 0};
+
+/* Speech with pauses over stationary low-passed noise about 15 dB below it */
+static void generate_signal(opus_int16 *pcm, opus_int16 *clean)
+{
+   int i;
+   double noise_lp = 0;
+   test_generate_speech(clean, NB_SAMPLES, 140, TEST_SPEECH_PAUSES);
+   for (i=0;i<NB_SAMPLES;i++)
+   {
+      double n = ((int)(fast_rand()%2001)-1000)*1e-3;
+      noise_lp = .8*noise_lp + .2*n;
+      pcm[i] = (opus_int16)floor(.5 + clean[i] + 2250*noise_lp);
+   }
+}
+
+static void encode_signal(const opus_int16 *pcm, int noise_suppression, int vbr,
+      EncodeStats *stats, TestStream *s, int *lookahead)
+{
+   OpusEncoder *enc;
+   clock_t start;
+   int i, err;
+   opus_int32 value;
+   enc = opus_encoder_create(FS, 1, voip.application, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_SET_NOISE_SUPPRESSION(noise_suppression)) != OPUS_OK) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_GET_NOISE_SUPPRESSION(&value)) != OPUS_OK || value != noise_suppression) test_failed();
+   test_stream_encoder_setup(enc, &voip, voip.bitrate);
+   /* The default complexity, at which the DTX decision uses the signal analysis */
+   opus_encoder_ctl(enc, OPUS_SET_COMPLEXITY(10));
+   opus_encoder_ctl(enc, OPUS_SET_VBR(vbr));
+   opus_encoder_ctl(enc, OPUS_SET_DTX(vbr));
+   opus_encoder_ctl(enc, OPUS_GET_LOOKAHEAD(&value));
+   if (lookahead) *lookahead = value;
+   stats->nb_dtx = 0;
+   start = clock();
+   for (i=0;i<s->nb_packets;i++)
+   {
+      s->len[i] = opus_encode(enc, pcm+i*FRAME_SIZE, FRAME_SIZE, s->data+i*MAX_PACKET, MAX_PACKET);
+      if (s->len[i] < 0) test_failed();
+      if (s->len[i] <= 2) stats->nb_dtx++;
+   }
+   stats->seconds = (double)(clock()-start)/CLOCKS_PER_SEC;
+   opus_encoder_destroy(enc);
+}
+
+static opus_int32 stream_bytes(const TestStream *s)
+{
+   int i;
+   opus_int32 bytes = 0;
+   for (i=0;i<s->nb_packets;i++)
+      bytes += s->len[i];
+   return bytes;
+}
+
+/* Energy in dB of the talk segments (talk=1) or of the pauses (talk=0),
+   skipping the first period while the denoiser converges. */
+static double segment_energy(const opus_int16 *x, int n, int talk)
+{
+   int i;
+   double e = 0;
+   for (i=PERIOD;i<n;i++)
+   {
+      int pos = i%PERIOD;
+      int in_talk = pos < TALK;
+      if (!talk && pos >= PERIOD-FS/20) continue;
+      if (in_talk != talk) continue;
+      e += (double)x[i]*x[i];
+   }
+   return 10*log10(e+1);
+}
+
+/* Best of a few runs to keep the timing robust to other load. */
+static double best_time(const opus_int16 *pcm, int noise_suppression, int vbr, TestStream *s)
+{
+   int i;
+   double best = 1e9;
+   EncodeStats stats;
+   for (i=0;i<3;i++)
+   {
+      encode_signal(pcm, noise_suppression, vbr, &stats, s, NULL);
+      if (stats.seconds < best) best = stats.seconds;
+   }
+   return best;
+}
+
+/* 5 ms frames bypass the denoiser, but still go through its delay line, so
+   the decoded signal lines up with the input delayed by the lookahead. */
+static void test_short_frame_delay(const opus_int16 *pcm)
+{
+   OpusEncoder *enc;
+   OpusDecoder *dec;
+   unsigned char packet[MAX_PACKET];
+   opus_int16 *out;
+   opus_int32 lookahead;
+   int i, err, delay, best_delay = 0;
+   double best = -1;
+   enc = opus_encoder_create(FS, 1, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   dec = opus_decoder_create(FS, 1, &err);
+   if (err != OPUS_OK || dec == NULL) test_failed();
+   out = malloc(TALK*sizeof(*out));
+   if (!out) test_failed();
+   opus_encoder_ctl(enc, OPUS_SET_NOISE_SUPPRESSION(1));
+   opus_encoder_ctl(enc, OPUS_SET_BITRATE(64000));
+   opus_encoder_ctl(enc, OPUS_GET_LOOKAHEAD(&lookahead));
+   for (i=0;i<TALK;i+=FS/200)
+   {
+      int len = opus_encode(enc, pcm+i, FS/200, packet, MAX_PACKET);
+      if (len < 0) test_failed();
+      if (opus_decode(dec, packet, len, out+i, FS/200, 0) != FS/200) test_failed();
+   }
+   for (delay=0;delay<=2*lookahead;delay++)
+   {
+      double xcorr = 0;
+      for (i=FS/10;i<TALK-2*lookahead;i++)
+         xcorr += (double)out[i+delay]*pcm[i];
+      if (xcorr > best)
+      {
+         best = xcorr;
+         best_delay = delay;
+      }
+   }
+   fprintf(stderr, "    5 ms frames: delay %d samples, lookahead %d\n", best_delay, (int)lookahead);
+   if (abs(best_delay - lookahead) > 2) test_failed();
+   free(out);
+   opus_decoder_destroy(dec);
+   opus_encoder_destroy(enc);
+}
+
+/* Mixes frame sizes at 16 kHz stereo: 2.5 and 5 ms frames bypass the
+   denoiser but keep its delay. */
+static void test_frame_sizes(const opus_int16 *pcm)
+{
+   static const int frame_sizes[] = {160, 40, 320, 80, 960, 160};
+   OpusEncoder *enc;
+   unsigned char packet[MAX_PACKET];
+   opus_int16 stereo[2*960];
+   opus_int32 lookahead;
+   int i, j, err, pos = 0;
+   enc = opus_encoder_create(16000, 2, OPUS_APPLICATION_VOIP, &err);
+   if (err != OPUS_OK || enc == NULL) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_SET_NOISE_SUPPRESSION(2)) != OPUS_BAD_ARG) test_failed();
+   if (opus_encoder_ctl(enc, OPUS_SET_NOISE_SUPPRESSION(1)) != OPUS_OK) test_failed();
+   opus_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_ARG));
+   opus_encoder_ctl(enc, OPUS_GET_LOOKAHEAD(&lookahead));
+   if (lookahead != 16000/400 + 16000/250 + 16000/100) test_failed();
+   for (i=0;i<100;i++)
+   {
+      int frame_size = frame_sizes[i%(sizeof(frame_sizes)/sizeof(frame_sizes[0]))];
+      for (j=0;j<frame_size;j++)
+      {
+         stereo[2*j] = pcm[pos+3*j];
+         stereo[2*j+1] = pcm[pos+3*j]/2;
+      }
+      pos += 3*frame_size;
+      if (opus_encode(enc, stereo, frame_size, packet, MAX_PACKET) < 0) test_failed();
+   }
+   if (opus_encoder_ctl(enc, OPUS_RESET_STATE) != OPUS_OK) test_failed();
+   opus_encoder_destroy(enc);
+}
+
+int main(int _argc, char **_argv)
+{
+   const char *oversion;
+   opus_int16 *pcm, *clean, *out;
+   TestStream s;
+   EncodeStats off, on;
+   opus_int32 bytes_off, bytes_on;
+   int lookahead_off, lookahead_on;
+   double talk_off, talk_on, pause_off, pause_on, talk_clean;
+   double t_off, t_on, t_cbr_off, t_cbr_on;
+   double denoiser, savings;
+   (void)_argc;
+   (void)_argv;
+
+   iseed = 42;
+   Rw = Rz = iseed;
+   oversion = opus_get_version_string();
+   if (!oversion) test_failed();
+   fprintf(stderr, "Testing %s noise suppression.\n", oversion);
+
+   pcm = malloc(NB_SAMPLES*sizeof(*pcm));
+   clean = malloc(NB_SAMPLES*sizeof(*clean));
+   out = malloc(NB_SAMPLES*sizeof(*out));
+   if (!pcm || !clean || !out) test_failed();
+   test_stream_alloc(&s, NB_SAMPLES/FRAME_SIZE);
+   generate_signal(pcm, clean);
+   test_frame_sizes(pcm);
+   test_short_frame_delay(pcm);
+   talk_clean = segment_energy(clean, NB_SAMPLES, 1);
+
+   /* The decoded output is delayed by the lookahead */
+   encode_signal(pcm, 0, 1, &off, &s, &lookahead_off);
+   bytes_off = stream_bytes(&s);
+   test_stream_decode(&s, FRAME_SIZE, 0, out);
+   talk_off = segment_energy(out+lookahead_off, NB_SAMPLES-lookahead_off, 1);
+   pause_off = segment_energy(out+lookahead_off, NB_SAMPLES-lookahead_off, 0);
+
+   encode_signal(pcm, 1, 1, &on, &s, &lookahead_on);
+   if (lookahead_on != lookahead_off + FS/100) test_failed();
+   bytes_on = stream_bytes(&s);
+   test_stream_decode(&s, FRAME_SIZE, 0, out);
+   talk_on = segment_energy(out+lookahead_on, NB_SAMPLES-lookahead_on, 1);
+   pause_on = segment_energy(out+lookahead_on, NB_SAMPLES-lookahead_on, 0);
+
+   fprintf(stderr, "    bitrate: %5.1f kb/s off, %5.1f kb/s on (%+.0f%%)\n",
+         bytes_off*8e-3/SECONDS, bytes_on*8e-3/SECONDS, 100.*(bytes_on-bytes_off)/bytes_off);
+   fprintf(stderr, "    DTX duty cycle: %4.1f%% off, %4.1f%% on\n",
+         100.*off.nb_dtx/s.nb_packets, 100.*on.nb_dtx/s.nb_packets);
+   fprintf(stderr, "    talk energy vs clean: %+5.1f dB off, %+5.1f dB on; pause noise attenuated by %4.1f dB\n",
+         talk_off-talk_clean, talk_on-talk_clean, pause_off-pause_on);
+   /* The speech must survive and the noise in pauses must go away, so that
+      both the rate and the DTX duty cycle improve. Only the long pauses,
+      30% of the time, are long enough for DTX. */
+   if (talk_on < talk_clean - 3) test_failed();
+   if (pause_off - pause_on < 10) test_failed();
+   if (bytes_on > .9*bytes_off) test_failed();
+   if (on.nb_dtx < off.nb_dtx + s.nb_packets/10) test_failed();
+
+   /* Timings are only reported, they depend too much on the machine load. */
+   t_off = best_time(pcm, 0, 1, &s);
+   t_on = best_time(pcm, 1, 1, &s);
+   t_cbr_off = best_time(pcm, 0, 0, &s);
+   t_cbr_on = best_time(pcm, 1, 0, &s);
+   denoiser = t_cbr_on - t_cbr_off;
+   savings = denoiser - (t_on - t_off);
+   fprintf(stderr, "    CPU for %d s: %.1f ms off, %.1f ms on; denoiser %.1f ms (%.0f%% of the CBR encoder), "
+         "encoder savings %.1f ms, net %+.1f ms\n", SECONDS, 1e3*t_off, 1e3*t_on, 1e3*denoiser,
+         100.*denoiser/t_cbr_off, 1e3*savings, 1e3*(t_on-t_off));
+
+   test_stream_free(&s);
+   free(pcm);
+   free(clean);
+   free(out);
+   fprintf(stderr, "All noise suppression tests passed.\n");
+   return 0;
+}
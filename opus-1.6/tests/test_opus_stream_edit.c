@@ -0,0 +1,387 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks stream cutting and splicing: cuts must decode to the same audio as
+   the corresponding part of the whole stream, splices to the crossfade of the
+   two streams, and editing an hour-long stream must take less time than
+   decoding ten seconds of it. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "opus.h"
+#include "test_opus_common.h"
+
+#define FS TEST_STREAM_FS
+#define NB_SAMPLES (FS*10)
+#define MAX_PACKET TEST_STREAM_MAX_PACKET
+#define CROSSFADE 960
+/* Minimum SNR of cut streams against the original decoded stream */
+#define MIN_SNR 15
+
+static const TestStreamConfig configs[] = {
+   {"SILK WB 20 ms",     OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_WIDEBAND,      960,  24000, 0, 0},
+   {"hybrid SWB 40 ms",  OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_SUPERWIDEBAND, 1920, 32000, 0, 0},
+   {"CELT FB 20 ms",     OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,      960,  64000, 0, 0},
+   {"CELT FB 60 ms",     OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,      2880, 64000, 0, 0}
+};
+
+/* Ranges to cut, in samples */
+static const opus_int64 cuts[][2] = {
+   {0, FS},
+   {12345, 200000},
+   {5*FS+100, 5*FS+300},
+   {3*FS+17, 9*FS-5},
+   {NB_SAMPLES-5000, NB_SAMPLES}
+};
+
+/* Packet list in the form the stream editing calls take. The packets live
+   in an encoded TestStream or in the buffers the edits write to. */
+typedef struct {
+   const unsigned char **data;
+   opus_int32 *len;
+   int nb_packets;
+   int pre_skip;
+   int end_trim;
+} Stream;
+
+static void alloc_stream(Stream *s, int nb_packets)
+{
+   s->data = malloc(nb_packets*sizeof(*s->data));
+   s->len = malloc(nb_packets*sizeof(*s->len));
+   if (!s->data || !s->len) test_failed();
+   s->nb_packets = 0;
+}
+
+static void free_stream(Stream *s)
+{
+   free(s->data);
+   free(s->len);
+}
+
+static void append_packet(Stream *s, const unsigned char *data, opus_int32 len)
+{
+   s->data[s->nb_packets] = data;
+   s->len[s->nb_packets] = len;
+   s->nb_packets++;
+}
+
+/* Encodes the signal into enc, padded to account for the encoder delay, and
+   lists its packets in s. */
+static void encode_stream(const TestStreamConfig *cfg, const opus_int16 *pcm, TestStream *enc, Stream *s)
+{
+   OpusEncoder *st;
+   opus_int16 *padded;
+   opus_int32 lookahead;
+   int i, err, nb_packets;
+   st = opus_encoder_create(FS, 1, cfg->application, &err);
+   if (err != OPUS_OK || st == NULL) test_failed();
+   test_stream_encoder_setup(st, cfg, cfg->bitrate);
+   opus_encoder_ctl(st, OPUS_GET_LOOKAHEAD(&lookahead));
+   opus_encoder_destroy(st);
+   nb_packets = (NB_SAMPLES+lookahead+cfg->frame_size-1)/cfg->frame_size;
+   padded = calloc(nb_packets*cfg->frame_size, sizeof(*padded));
+   if (!padded) test_failed();
+   memcpy(padded, pcm, NB_SAMPLES*sizeof(*pcm));
+   test_stream_encode(cfg, padded, nb_packets*cfg->frame_size, enc);
+   alloc_stream(s, nb_packets);
+   for (i=0;i<nb_packets;i++)
+      append_packet(s, enc->data+i*MAX_PACKET, enc->len[i]);
+   s->pre_skip = lookahead;
+   s->end_trim = nb_packets*cfg->frame_size - lookahead - NB_SAMPLES;
+   free(padded);
+}
+
+/* Decodes a stream from its start, dropping the pre-skip and the end trim.
+   Returns the number of samples. */
+static int decode_stream(const Stream *s, opus_int16 *out, int max_samples)
+{
+   OpusDecoder *dec;
+   opus_int16 *pcm;
+   int i, err, pos = 0, len;
+   dec = opus_decoder_create(FS, 1, &err);
+   if (err != OPUS_OK || dec == NULL) test_failed();
+   pcm = malloc((max_samples+s->pre_skip+5760)*sizeof(*pcm));
+   if (!pcm) test_failed();
+   for (i=0;i<s->nb_packets;i++)
+   {
+      int ret = opus_decode(dec, s->data[i], s->len[i], pcm+pos, 5760, 0);
+      if (ret < 0 || pos+ret > max_samples+s->pre_skip+s->end_trim) test_failed();
+      pos += ret;
+   }
+   len = pos - s->pre_skip - s->end_trim;
+   if (len < 0) test_failed();
+   memcpy(out, pcm+s->pre_skip, len*sizeof(*out));
+   opus_decoder_destroy(dec);
+   free(pcm);
+   return len;
+}
+
+static double snr_db(const opus_int16 *ref, const opus_int16 *x, int n)
+{
+   int i;
+   double sig = 0, err = 0;
+   for (i=0;i<n;i++)
+   {
+      double e = (double)x[i] - ref[i];
+      sig += (double)ref[i]*ref[i];
+      err += e*e;
+   }
+   return 10*log10((sig+1)/(err+1));
+}
+
+/* Cuts [start, end) out of a stream, the new first and last packets being
+   stored in buf. */
+static void cut_stream(const Stream *in, opus_int64 start, opus_int64 end, unsigned char *buf, Stream *out)
+{
+   opus_int32 out_lens[2];
+   int range[2], trims[2], i;
+   if (opus_stream_cut(in->data, in->len, in->nb_packets, in->pre_skip, start, end, buf,
+         2*MAX_PACKET, out_lens, range, trims) != OPUS_OK)
+      test_failed();
+   if (range[0] < 0 || range[1] < range[0] || range[1] >= in->nb_packets)
+      test_failed();
+   if ((range[0] == range[1]) != (out_lens[1] == 0))
+      test_failed();
+   alloc_stream(out, range[1]-range[0]+1);
+   append_packet(out, buf, out_lens[0]);
+   for (i=range[0]+1;i<range[1];i++)
+      append_packet(out, in->data[i], in->len[i]);
+   if (out_lens[1] > 0)
+      append_packet(out, buf+out_lens[0], out_lens[1]);
+   out->pre_skip = trims[0];
+   out->end_trim = trims[1];
+   /* Only the packets needed to converge before the start are kept */
+   if (trims[0] < 0 || trims[0] > OPUS_STREAM_EDIT_PREROLL+960 || trims[1] < 0 || trims[1] >= 960)
+      test_failed();
+}
+
+static void test_cuts(const TestStreamConfig *cfg, const Stream *s, const opus_int16 *ref)
+{
+   unsigned i;
+   unsigned char buf[2*MAX_PACKET];
+   opus_int32 out_lens[2];
+   int range[2], trims[2];
+   opus_int16 *out;
+   Stream c;
+   double min_snr = 1000;
+   out = malloc(NB_SAMPLES*sizeof(*out));
+   if (!out) test_failed();
+   for (i=0;i<sizeof(cuts)/sizeof(cuts[0]);i++)
+   {
+      int len;
+      double snr;
+      cut_stream(s, cuts[i][0], cuts[i][1], buf, &c);
+      len = decode_stream(&c, out, NB_SAMPLES);
+      if (len != cuts[i][1]-cuts[i][0]) test_failed();
+      snr = snr_db(ref+cuts[i][0], out, len);
+      if (snr < min_snr) min_snr = snr;
+      free_stream(&c);
+   }
+   /* Cuts past the end or empty are rejected */
+   if (opus_stream_cut(s->data, s->len, s->nb_packets, s->pre_skip, 0, NB_SAMPLES+s->end_trim+1,
+         buf, sizeof(buf), out_lens, range, trims) != OPUS_BAD_ARG)
+      test_failed();
+   if (opus_stream_cut(s->data, s->len, s->nb_packets, s->pre_skip, FS, FS,
+         buf, sizeof(buf), out_lens, range, trims) != OPUS_BAD_ARG)
+      test_failed();
+   fprintf(stderr, "    %-17s cuts: SNR >= %5.1f dB\n", cfg->name, min_snr);
+   if (min_snr < MIN_SNR) test_failed();
+   free(out);
+}
+
+/* Splices the first 4.5 s of one stream with the last 8.7 s of another,
+   both with odd trims. The seam is compared with the crossfade of the two
+   decoded streams, and must be at least about as close to it as the
+   decoded stream is to the original audio. */
+static void test_splice(const TestStreamConfig *cfg, const Stream *s1, const opus_int16 *ref1,
+      const Stream *s2, const opus_int16 *ref2, double coding_snr)
+{
+   unsigned char buf_a[2*MAX_PACKET], buf_b[2*MAX_PACKET];
+   unsigned char *seam_data;
+   opus_int32 seam_lens[64];
+   int range[2], nb_seam, i, len, len_a, len_b, xfade, fade_start;
+   unsigned char *p;
+   opus_int16 *out, *expected;
+   Stream a, b, o;
+   double seam_snr, snr_b;
+
+   cut_stream(s1, 0, 9*FS/2+37, buf_a, &a);
+   cut_stream(s2, 13*FS/10+11, NB_SAMPLES, buf_b, &b);
+   len_a = 9*FS/2+37;
+   len_b = NB_SAMPLES-(13*FS/10+11);
+   seam_data = malloc(64*1275);
+   if (!seam_data) test_failed();
+   nb_seam = opus_stream_splice(a.data, a.len, a.nb_packets, a.end_trim, b.data, b.len,
+         b.nb_packets, b.pre_skip, 1, CROSSFADE, seam_data, 64*1275, seam_lens, 64, range);
+   if (nb_seam < 1) test_failed();
+   if (range[0] < 1 || range[0] > a.nb_packets || range[1] < 0 || range[1] >= b.nb_packets)
+      test_failed();
+   alloc_stream(&o, range[0]+nb_seam+b.nb_packets-range[1]);
+   for (i=0;i<range[0];i++)
+      append_packet(&o, a.data[i], a.len[i]);
+   for (i=0,p=seam_data;i<nb_seam;p+=seam_lens[i++])
+      append_packet(&o, p, seam_lens[i]);
+   for (i=range[1];i<b.nb_packets;i++)
+      append_packet(&o, b.data[i], b.len[i]);
+   o.pre_skip = a.pre_skip;
+   o.end_trim = b.end_trim;
+
+   out = malloc(2*NB_SAMPLES*sizeof(*out));
+   expected = malloc(2*NB_SAMPLES*sizeof(*expected));
+   if (!out || !expected) test_failed();
+   len = decode_stream(&o, out, 2*NB_SAMPLES);
+   xfade = len_a + len_b - len;
+   if (xfade < CROSSFADE || xfade >= CROSSFADE+120) test_failed();
+   fade_start = len_a - xfade;
+   for (i=0;i<len;i++)
+   {
+      if (i < fade_start)
+         expected[i] = ref1[i];
+      else if (i >= len_a)
+         expected[i] = ref2[i-fade_start+13*FS/10+11];
+      else
+      {
+         double w = (i-fade_start+.5)/xfade;
+         expected[i] = (opus_int16)floor(.5 + (1-w)*ref1[i] + w*ref2[i-fade_start+13*FS/10+11]);
+      }
+   }
+   /* The first stream is used as is up to the seam */
+   if (snr_db(expected, out, fade_start-FS/10) < 90) test_failed();
+   seam_snr = snr_db(expected+fade_start-FS/10, out+fade_start-FS/10, xfade+FS/5);
+   snr_b = snr_db(expected+len_a+FS/10, out+len_a+FS/10, len-len_a-FS/10);
+   fprintf(stderr, "    %-17s splice: %d seam packets, crossfade %d, seam SNR %5.1f dB, after %5.1f dB\n",
+         cfg->name, nb_seam, xfade, seam_snr, snr_b);
+   /* The seam is a second generation, but only of the crossfaded audio */
+   if (seam_snr < coding_snr - 1. || snr_b < MIN_SNR) test_failed();
+
+   free(out);
+   free(expected);
+   free(seam_data);
+   free_stream(&o);
+   free_stream(&a);
+   free_stream(&b);
+}
+
+/* Edits an hour-long stream made of the same packets over and over, and
+   reports the time it takes next to that of decoding ten seconds of it. */
+static void test_hour(const Stream *s)
+{
+   Stream h;
+   opus_int16 *out;
+   unsigned char buf[2*MAX_PACKET];
+   unsigned char *seam_data;
+   opus_int32 seam_lens[64];
+   int range[2], i;
+   clock_t start;
+   double t_decode, t_cut, t_splice;
+   Stream c;
+
+   alloc_stream(&h, 360*s->nb_packets);
+   for (i=0;i<360*s->nb_packets;i++)
+      append_packet(&h, s->data[i%s->nb_packets], s->len[i%s->nb_packets]);
+   h.pre_skip = s->pre_skip;
+   h.end_trim = s->end_trim;
+   out = malloc(2*NB_SAMPLES*sizeof(*out));
+   seam_data = malloc(64*1275);
+   if (!out || !seam_data) test_failed();
+
+   start = clock();
+   decode_stream(s, out, 2*NB_SAMPLES);
+   t_decode = (double)(clock()-start)/CLOCKS_PER_SEC;
+   start = clock();
+   cut_stream(&h, (opus_int64)1800*FS+1234, (opus_int64)1830*FS, buf, &c);
+   t_cut = (double)(clock()-start)/CLOCKS_PER_SEC;
+   free_stream(&c);
+   start = clock();
+   if (opus_stream_splice(h.data, h.len, h.nb_packets, h.end_trim, h.data, h.len,
+         h.nb_packets, h.pre_skip, 1, CROSSFADE, seam_data, 64*1275, seam_lens, 64, range) < 1)
+      test_failed();
+   t_splice = (double)(clock()-start)/CLOCKS_PER_SEC;
+   fprintf(stderr, "    one hour: cut in %.2f ms, splice in %.2f ms (decoding 10 s: %.2f ms)\n",
+         1e3*t_cut, 1e3*t_splice, 1e3*t_decode);
+   free(out);
+   free(seam_data);
+   free_stream(&h);
+}
+
+static void test_config(const TestStreamConfig *cfg, const opus_int16 *pcm1, const opus_int16 *pcm2, int hour)
+{
+   TestStream enc1, enc2;
+   opus_int16 *ref1, *ref2;
+   Stream s1, s2;
+   ref1 = malloc(NB_SAMPLES*sizeof(*ref1));
+   ref2 = malloc(NB_SAMPLES*sizeof(*ref2));
+   if (!ref1 || !ref2) test_failed();
+   encode_stream(cfg, pcm1, &enc1, &s1);
+   encode_stream(cfg, pcm2, &enc2, &s2);
+   if (decode_stream(&s1, ref1, NB_SAMPLES) != NB_SAMPLES) test_failed();
+   if (decode_stream(&s2, ref2, NB_SAMPLES) != NB_SAMPLES) test_failed();
+   test_cuts(cfg, &s1, ref1);
+   test_splice(cfg, &s1, ref1, &s2, ref2, snr_db(pcm1, ref1, NB_SAMPLES));
+   if (hour)
+      test_hour(&s1);
+   free_stream(&s1);
+   free_stream(&s2);
+   test_stream_free(&enc1);
+   test_stream_free(&enc2);
+   free(ref1);
+   free(ref2);
+}
+
+int main(int _argc, char **_argv)
+{
+   const char *oversion;
+   opus_int16 *pcm1, *pcm2;
+   unsigned i;
+   (void)_argc;
+   (void)_argv;
+
+   iseed = 0;
+   Rw = Rz = iseed;
+   oversion = opus_get_version_string();
+   if (!oversion) test_failed();
+   fprintf(stderr, "Testing %s stream editing.\n", oversion);
+
+   pcm1 = malloc(NB_SAMPLES*sizeof(*pcm1));
+   pcm2 = malloc(NB_SAMPLES*sizeof(*pcm2));
+   if (!pcm1 || !pcm2) test_failed();
+   test_generate_speech(pcm1, NB_SAMPLES, 150, 0);
+   test_generate_speech(pcm2, NB_SAMPLES, 220, 0);
+   for (i=0;i<sizeof(configs)/sizeof(configs[0]);i++)
+      test_config(&configs[i], pcm1, pcm2, i == 2);
+   free(pcm1);
+   free(pcm2);
+
+   fprintf(stderr, "All stream editing tests passed.\n");
+   return 0;
+}
@@ -0,0 +1,156 @@
+/* Copyright (c) 2026 The opuslib authors */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Checks the transrater against decode/encode at the same bitrate: output
+   bitrate and quality of the transrated stream. The CPU time of both is
+   reported. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "opus.h"
+#include "test_opus_common.h"
+
+#define FS TEST_STREAM_FS
+#define NB_SAMPLES (FS*10)
+#define MAX_PACKET TEST_STREAM_MAX_PACKET
+
+static const TestStreamConfig configs[] = {
+   {"SILK WB 20 ms",    OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_WIDEBAND,      960,  24000, 12000, 0},
+   {"SILK WB 60 ms",    OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_WIDEBAND,      2880, 20000, 10000, 0},
+   {"hybrid SWB 20 ms", OPUS_APPLICATION_VOIP,  OPUS_BANDWIDTH_SUPERWIDEBAND, 960,  40000, 24000, 0},
+   {"CELT FB 10 ms",    OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,      480,  96000, 48000, 0},
+   {"CELT FB 20 ms",    OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,      960,  96000, 48000, 0},
+   {"CELT FB 60 ms",    OPUS_APPLICATION_AUDIO, OPUS_BANDWIDTH_FULLBAND,      2880, 64000, 32000, 0}
+};
+
+static double bitrate_kbps(const TestStream *s, int frame_size)
+{
+   int i;
+   double bytes = 0;
+   for (i=0;i<s->nb_packets;i++)
+      bytes += s->len[i];
+   return 8*bytes*FS/((double)s->nb_packets*frame_size)*1e-3;
+}
+
+static double transrate_stream(const TestStreamConfig *cfg, const TestStream *in, TestStream *out)
+{
+   OpusTransrater *st;
+   int i, err;
+   clock_t start;
+   st = opus_transrater_create(1, &err);
+   if (err != OPUS_OK || st == NULL) test_failed();
+   out->nb_packets = in->nb_packets;
+   start = clock();
+   for (i=0;i<in->nb_packets;i++)
+   {
+      out->len[i] = opus_transrater_process(st, in->data+i*MAX_PACKET, in->len[i], cfg->target,
+            out->data+i*MAX_PACKET, MAX_PACKET);
+      if (out->len[i] < 0) test_failed();
+      /* The transrated packet keeps the configuration of the input packet */
+      if (opus_packet_get_samples_per_frame(out->data+i*MAX_PACKET, FS)*opus_packet_get_nb_frames(out->data+i*MAX_PACKET, out->len[i])
+            != cfg->frame_size)
+         test_failed();
+      if (opus_packet_get_bandwidth(out->data+i*MAX_PACKET) != opus_packet_get_bandwidth(in->data+i*MAX_PACKET))
+         test_failed();
+   }
+   opus_transrater_destroy(st);
+   return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+static void test_config(const TestStreamConfig *cfg, const opus_int16 *pcm)
+{
+   TestStream in, tr, ref;
+   opus_int16 *out_in, *out_tr, *out_ref;
+   int delay;
+   double t_tr, t_ref, snr_tr, snr_ref, level, rate;
+
+   test_stream_encode(cfg, pcm, NB_SAMPLES, &in);
+   test_stream_alloc(&tr, in.nb_packets);
+   test_stream_alloc(&ref, in.nb_packets);
+   out_in = malloc(NB_SAMPLES*sizeof(*out_in));
+   out_tr = malloc(NB_SAMPLES*sizeof(*out_tr));
+   out_ref = malloc(NB_SAMPLES*sizeof(*out_ref));
+   if (!out_in || !out_tr || !out_ref)
+      test_failed();
+
+   t_tr = transrate_stream(cfg, &in, &tr);
+   t_ref = test_stream_transcode(cfg, &in, 0, &ref, &delay);
+   test_stream_decode(&in, cfg->frame_size, 0, out_in);
+   test_stream_decode(&tr, cfg->frame_size, 0, out_tr);
+   test_stream_decode(&ref, cfg->frame_size, 0, out_ref);
+   rate = bitrate_kbps(&tr, cfg->frame_size);
+   level = test_energy_db(out_tr, NB_SAMPLES) - test_energy_db(out_in, NB_SAMPLES);
+   snr_tr = test_snr_db(out_in, out_tr, NB_SAMPLES, delay);
+   snr_ref = test_snr_db(out_in, out_ref, NB_SAMPLES, delay);
+   fprintf(stderr, "    %-17s %5.1f kb/s: %5.1f kb/s, level %+5.2f dB, SNR %5.1f dB in %6.3f s"
+         " (decode/encode: %5.1f kb/s, SNR %5.1f dB in %6.3f s)\n", cfg->name, cfg->target*1e-3,
+         rate, level, snr_tr, t_tr, bitrate_kbps(&ref, cfg->frame_size), snr_ref, t_ref);
+   if (fabs(rate - cfg->target*1e-3) > .2*cfg->target*1e-3)
+      test_failed();
+   if (fabs(level) > 1.)
+      test_failed();
+   if (snr_tr < snr_ref - 2.)
+      test_failed();
+
+   test_stream_free(&in);
+   test_stream_free(&tr);
+   test_stream_free(&ref);
+   free(out_in);
+   free(out_tr);
+   free(out_ref);
+}
+
+int main(int _argc, char **_argv)
+{
+   const char *oversion;
+   opus_int16 *pcm;
+   unsigned i;
+   (void)_argc;
+   (void)_argv;
+
+   iseed = 0;
+   Rw = Rz = iseed;
+   oversion = opus_get_version_string();
+   if (!oversion) test_failed();
+   fprintf(stderr, "Testing %s transrater.\n", oversion);
+
+   pcm = malloc(NB_SAMPLES*sizeof(*pcm));
+   if (!pcm) test_failed();
+   test_generate_speech(pcm, NB_SAMPLES, 150, TEST_SPEECH_PAUSES|TEST_SPEECH_CLICKS);
+   for (i=0;i<sizeof(configs)/sizeof(configs[0]);i++)
+      test_config(&configs[i], pcm);
+   free(pcm);
+
+   fprintf(stderr, "All transrater tests passed.\n");
+   return 0;
+}
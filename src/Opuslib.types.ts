@@ -20,6 +20,31 @@ export interface AudioConfig {
   amplitudeEventInterval?: number
   /** Save debug PCM audio to file (development only) */
   saveDebugAudio?: boolean
+  /** Attach the encoder's per-frame analysis to each audio chunk (default false) */
+  enableFrameAnalysis?: boolean
+  /**
+   * Let the encoder pick 20, 40 or 60 ms packets from the signal (default false).
+   * frameSize (40 or 60) is then the most audio handed to the encoder, i.e. the latency cap.
+   */
+  adaptiveFrameSize?: boolean
+}
+
+/**
+ * Encoder analysis of a frame (VAD, speech/music classifier, pitch, band energies)
+ */
+export interface FrameAnalysis {
+  /** Voice activity decision */
+  vad: boolean
+  /** Probability of speech or music activity (0.0 - 1.0), if the encoder's analysis ran */
+  activityProbability?: number
+  /** Probability that the frame is music rather than speech (0.0 - 1.0), if the encoder's analysis ran */
+  musicProbability?: number
+  /** Tonality estimate (0.0 - 1.0), if the encoder's analysis ran */
+  tonality?: number
+  /** Pitch period in samples at 48 kHz, or 0 if the frame was not voiced */
+  pitch: number
+  /** Energy of each encoded CELT band in dB (empty for SILK-only frames) */
+  bandEnergies: number[]
 }
 
 /**
@@ -32,6 +57,8 @@ export interface AudioChunkEvent {
   timestamp: number
   /** Sequence number (increments with each packet) */
   sequenceNumber: number
+  /** Encoder analysis of the packet's last frame (only when enableFrameAnalysis is set) */
+  analysis?: FrameAnalysis
 }
 
 /**